@@ -0,0 +1,353 @@
+/**
+ * @file      autoexposure.cpp
+ * @brief     AutoExposure plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./autoexposure.h"
+#include <vector>
+#include "./sensor_link.h"
+#include "./white_balance_link.h"
+
+/**
+ * @brief
+ * Constructor.
+ */
+AutoExposure::AutoExposure() : PluginBase() {
+  DEBUG_PRINT("AutoExposure::AutoExposure()\n");
+
+  set_plugin_name("AutoExposure");
+
+  AddInputPortCandidateSpec(kGRAY8);  /* Raw8*/
+  AddInputPortCandidateSpec(kGRAY16); /* Raw16*/
+
+  set_is_use_dest_buffer(false);
+
+  common_ = NULL;
+  frame_count_ = 0;
+  is_format_error_ = false;
+  is_exposure_active_ = false;
+  has_request_ = false;
+  requested_.exposure = kExposureControlNone;
+  requested_.analog_gain = kExposureControlNone;
+  requested_.digital_gain = kExposureControlNone;
+  request_frame_ = 0;
+  is_waiting_ = false;
+  is_converging_ = false;
+  is_late_warned_ = false;
+  converge_frame_ = 0;
+  timerclear(&converge_time_);
+  is_unknown_warned_ = false;
+  is_wb_converging_ = false;
+
+  // Initialize
+  wnd_ = new AutoExposureWnd(this);
+  settings_ = wnd_->settings();
+  wnd_->InitDialog();
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+AutoExposure::~AutoExposure() { delete wnd_; }
+
+/**
+ * @brief
+ * Initialize routine of the AutoExposure plugin.
+ * @param common [in] commom parameters.
+ * @return If true, successful initialization
+ */
+bool AutoExposure::InitProcess(CommonParam* common) {
+  DEBUG_PRINT("AutoExposure::InitProcess \n");
+  common_ = common;
+  wnd_->PostCaptureInit();
+
+  settings_ = wnd_->settings();
+  frame_count_ = 0;
+  is_format_error_ = false;
+  has_request_ = false;
+  is_waiting_ = false;
+  is_converging_ = false;
+  is_late_warned_ = false;
+  is_unknown_warned_ = false;
+  is_wb_converging_ = false;
+
+  ExposureControlParams params;
+  params.gain_model = settings_.gain_model;
+  params.target = settings_.target_percent / 100.0;
+  params.damping = settings_.damping_percent / 100.0;
+  params.tolerance = settings_.tolerance_percent / 100.0;
+  params.max_exposure = settings_.max_exposure;
+  params.max_analog = settings_.max_analog;
+  params.max_digital = settings_.max_digital;
+  exposure_.Start(params);
+  white_balance_.Start(settings_.awb_damping_percent / 100.0);
+
+  is_exposure_active_ = settings_.is_ae;
+  if (is_exposure_active_ && SensorLink::Instance()->is_attached() == false) {
+    PLUGIN_LOG_WARNING("Exposure - no sensor takes the settings");
+    is_exposure_active_ = false;
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Finalize routine of the AutoExposure plugin.
+ */
+void AutoExposure::EndProcess() {
+  DEBUG_PRINT("AutoExposure::EndProcess \n");
+  if (is_converging_) {
+    PLUGIN_LOG_WARNING("Exposure - stopped while converging");
+    is_converging_ = false;
+  }
+  wnd_->PostCaptureEnd();
+}
+
+/**
+ * @brief
+ * Post-processing routine of the AutoExposure plugin.
+ * This function is empty implementation.
+ */
+void AutoExposure::DoPostProcess(void) {}
+
+/**
+ * @brief
+ * Main routine of the AutoExposure plugin.
+ * Take the statistics of the frame and update the loops.
+ * @param src_image [in] src image data.
+ * @param dst_image [out] dst image data.
+ * @return If true, success in the main processing
+ */
+bool AutoExposure::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
+  if (src_image == NULL) {
+    DEBUG_PRINT("[AutoExposure]src_image == NULL\n");
+    return false;
+  }
+  unsigned int count = frame_count_++;
+  if (count % settings_.interval != 0) {
+    return true;
+  }
+  if (!is_exposure_active_ && !settings_.is_awb) {
+    return true;
+  }
+
+  BayerStats stats;
+  if (BayerStatsCompute(*src_image, common_->first_pixel(),
+                        common_->optical_black(), kAutoExposureStatsGridW,
+                        kAutoExposureStatsGridH, &stats) == false) {
+    if (!is_format_error_) {
+      PLUGIN_LOG_ERROR("Exposure - the frame format is not supported");
+      is_format_error_ = true;
+    }
+    return false;
+  }
+
+  FrameMetadata* metadata = frame_metadata();
+  unsigned int frame_number =
+      (metadata != NULL) ? metadata->frame_number : count;
+  if (is_exposure_active_) {
+    UpdateExposure(stats, metadata, frame_number);
+  }
+  if (settings_.is_awb) {
+    UpdateWhiteBalance(stats, frame_number);
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Update the exposure loop.
+ * @param stats [in] statistics of the frame.
+ * @param metadata [in] metadata of the frame (can be NULL).
+ * @param frame_number [in] number of the frame.
+ */
+void AutoExposure::UpdateExposure(const BayerStats& stats,
+                                  const FrameMetadata* metadata,
+                                  unsigned int frame_number) {
+  // The settings the frame was exposed with. Without them in the metadata,
+  // the settings requested are taken after kAutoExposureMaxWaitFrames.
+  ExposureSetting in_effect;
+  bool is_known =
+      (metadata != NULL && metadata->exposure != kFrameMetadataUnknown);
+  if (is_known) {
+    in_effect.exposure = metadata->exposure;
+    in_effect.analog_gain = metadata->analog_gain;
+    in_effect.digital_gain = metadata->digital_gain;
+  } else if (has_request_) {
+    in_effect = requested_;
+  } else {
+    if (!is_unknown_warned_) {
+      PLUGIN_LOG_WARNING("Exposure - the exposure of the frames is unknown");
+      is_unknown_warned_ = true;
+    }
+    return;
+  }
+
+  // Frames exposed before the request are not measured again.
+  if (is_waiting_) {
+    bool is_in_effect =
+        is_known && in_effect.exposure == requested_.exposure &&
+        in_effect.analog_gain == requested_.analog_gain &&
+        (requested_.digital_gain == kExposureControlNone ||
+         in_effect.digital_gain == requested_.digital_gain);
+    if (!is_in_effect &&
+        frame_number - request_frame_ < kAutoExposureMaxWaitFrames) {
+      return;
+    }
+    is_waiting_ = false;
+  }
+
+  ExposureSetting request;
+  bool is_request = exposure_.Update(stats, in_effect, &request);
+  if (is_request && !is_converging_) {
+    is_converging_ = true;
+    is_late_warned_ = false;
+    converge_frame_ = frame_number;
+    gettimeofday(&converge_time_, NULL);
+  }
+
+  if (settings_.is_trace && is_converging_) {
+    PLUGIN_LOG_MESSAGE(
+        "Exposure trace - frame:%u level:%.3f p98:%.3f clipped:%.3f "
+        "ratio:%.2f in:%d/%d/%d out:%d/%d/%d",
+        frame_number, stats.average_y, BayerStatsPercentile(stats, 0.98),
+        stats.clipped, exposure_.ratio(), in_effect.exposure,
+        in_effect.analog_gain, in_effect.digital_gain, request.exposure,
+        request.analog_gain, request.digital_gain);
+  } else {
+    DEBUG_PRINT("[AutoExposure] frame:%u level:%.3f ratio:%.2f in:%d/%d/%d\n",
+                frame_number, stats.average_y, exposure_.ratio(),
+                in_effect.exposure, in_effect.analog_gain,
+                in_effect.digital_gain);
+  }
+
+  if (is_request) {
+    SensorLinkRequest link_request;
+    SensorLinkRequestClear(&link_request);
+    link_request.exposure = request.exposure;
+    link_request.analog_gain = request.analog_gain;
+    if (request.digital_gain != kExposureControlNone) {
+      link_request.digital_gain = request.digital_gain;
+    }
+    if (SensorLink::Instance()->Submit(link_request) == false) {
+      DEBUG_PRINT("[AutoExposure] setting dropped\n");
+    }
+    requested_ = request;
+    request_frame_ = frame_number;
+    has_request_ = true;
+    is_waiting_ = true;
+  }
+
+  if (!is_converging_) {
+    return;
+  }
+  unsigned int frames = frame_number - converge_frame_;
+  if (exposure_.is_settled()) {
+    if (frames > kAutoExposureMaxSettleFrames) {
+      PLUGIN_LOG_WARNING(
+          "Exposure - settled late, frames:%u time:%.1fms level:%.3f "
+          "setting:%d/%d/%d",
+          frames, ConvergeMsec(), stats.average_y, in_effect.exposure,
+          in_effect.analog_gain, in_effect.digital_gain);
+    } else {
+      PLUGIN_LOG_MESSAGE(
+          "Exposure - settled frames:%u time:%.1fms level:%.3f "
+          "setting:%d/%d/%d",
+          frames, ConvergeMsec(), stats.average_y, in_effect.exposure,
+          in_effect.analog_gain, in_effect.digital_gain);
+    }
+    is_converging_ = false;
+  } else if (frames > kAutoExposureMaxSettleFrames && !is_late_warned_) {
+    PLUGIN_LOG_WARNING("Exposure - not settled after %u frames", frames);
+    is_late_warned_ = true;
+  }
+}
+
+/**
+ * @brief
+ * Update the white balance loop.
+ * @param stats [in] statistics of the frame.
+ * @param frame_number [in] number of the frame.
+ */
+void AutoExposure::UpdateWhiteBalance(const BayerStats& stats,
+                                      unsigned int frame_number) {
+  if (white_balance_.Update(stats)) {
+    WhiteBalanceLink::Instance()->Publish(white_balance_.red(),
+                                          white_balance_.blue());
+    is_wb_converging_ = true;
+    if (settings_.is_trace) {
+      PLUGIN_LOG_MESSAGE(
+          "White balance trace - frame:%u r:%.3f g:%.3f b:%.3f "
+          "gain r:%.3f b:%.3f",
+          frame_number, stats.neutral_r, stats.neutral_g, stats.neutral_b,
+          white_balance_.red(), white_balance_.blue());
+    }
+  }
+  if (is_wb_converging_ && white_balance_.is_settled()) {
+    PLUGIN_LOG_MESSAGE("White balance - settled gain r:%.2f b:%.2f",
+                       white_balance_.red(), white_balance_.blue());
+    is_wb_converging_ = false;
+  }
+}
+
+/**
+ * @brief
+ * Get the time since the start of the convergence.
+ * @return time in msec.
+ */
+double AutoExposure::ConvergeMsec(void) {
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  return (now.tv_sec - converge_time_.tv_sec) * 1000.0 +
+         (now.tv_usec - converge_time_.tv_usec) / 1000.0;
+}
+
+/**
+ * @brief
+ * Open setting window of the AutoExposure plugin.
+ * @param state [in] ImageProcessingState
+ */
+void AutoExposure::OpenSettingWindow(ImageProcessingState state) {
+  if (wnd_ == NULL) {
+    DEBUG_PRINT("wnd_ == NULL\n");
+    return;
+  }
+  wxString window_title(plugin_name().c_str(), wxConvUTF8);
+  wnd_->SetTitle(window_title);
+  wnd_->InitDialog();
+  wnd_->Show(true);
+  wnd_->Raise();
+}
+
+/**
+ * @brief
+ * Close setting window of the AutoExposure plugin.
+ * @return If true, success close window
+ */
+bool AutoExposure::CloseSettingWindow() {
+  if (wnd_ == NULL) {
+    return false;
+  }
+  wnd_->Show(false);
+  return true;
+}
+
+/**
+ * @brief
+ * Set the list of parameter setting string for the AutoExposure plugin.
+ * @param params [in] settings string.
+ */
+void AutoExposure::SetPluginSettings(std::vector<wxString> params) {
+  wnd_->SetPluginSettings(params);
+}
+
+extern "C" PluginBase* Create(void) {
+  DEBUG_PRINT("Create AutoExposure plugins\n");
+  AutoExposure* plugin = new AutoExposure();
+  return plugin;
+}
+
+extern "C" void Destroy(PluginBase* plugin) { delete plugin; }
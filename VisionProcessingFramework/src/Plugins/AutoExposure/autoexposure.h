@@ -0,0 +1,169 @@
+/**
+ * @file      autoexposure.h
+ * @brief     AutoExposure plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _AUTOEXPOSURE_H_
+#define _AUTOEXPOSURE_H_
+
+#include <sys/time.h>
+#include <vector>
+#include "./autoexposure_define.h"
+#include "./autoexposure_wnd.h"
+#include "./bayer_stats.h"
+#include "./common_param.h"
+#include "./exposure_control.h"
+#include "./plugin_base.h"
+#include "./white_balance_control.h"
+
+/**
+ * @class AutoExposure
+ * @brief Closed-loop auto exposure and auto white balance.
+ * The plugin is placed on the raw frames, before WhiteBalanceGain (on a
+ * branch or in the main flow). Every interval frames it samples a grid of
+ * Bayer quads, whatever the size of the frame, and updates two damped
+ * loops:
+ * - the exposure loop requests the integration time and the gains through
+ *   the asynchronous register path of the sensor (SensorLink), then waits
+ *   for the frames exposed with them (metadata of the frame);
+ * - the white balance loop publishes the gains to WhiteBalanceGain
+ *   (WhiteBalanceLink), which takes them with its next frame.
+ * Neither waits for the bus nor for the other plugin. The frames and the
+ * time from a scene change to the settled exposure are logged, and every
+ * update when the trace is on.
+ */
+class AutoExposure : public PluginBase {
+ private:
+  /*! Parameter setting window.*/
+  AutoExposureWnd* wnd_;
+  /*! Common parameter */
+  CommonParam* common_;
+  /*! Settings of the capture */
+  AutoExposureSettings settings_;
+  /*! Frames processed in the capture */
+  unsigned int frame_count_;
+  /*! Whether the frame format is not supported */
+  bool is_format_error_;
+
+  /*! Exposure loop */
+  ExposureControl exposure_;
+  /*! Whether the exposure loop runs in this capture */
+  bool is_exposure_active_;
+  /*! Whether a setting was requested */
+  bool has_request_;
+  /*! Setting requested last */
+  ExposureSetting requested_;
+  /*! Frame number when the setting was requested */
+  unsigned int request_frame_;
+  /*! Whether the loop waits for the setting requested */
+  bool is_waiting_;
+  /*! Whether the exposure is converging after a change */
+  bool is_converging_;
+  /*! Whether the late convergence was warned */
+  bool is_late_warned_;
+  /*! Frame number at the start of the convergence */
+  unsigned int converge_frame_;
+  /*! Time at the start of the convergence */
+  struct timeval converge_time_;
+  /*! Whether the unknown setting in effect was warned */
+  bool is_unknown_warned_;
+
+  /*! White balance loop */
+  WhiteBalanceControl white_balance_;
+  /*! Whether the white balance is converging after a change */
+  bool is_wb_converging_;
+
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  AutoExposure(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~AutoExposure(void);
+
+  /**
+   * @brief
+   * Initialize routine of the AutoExposure plugin.
+   * @param common [in] commom parameters.
+   * @return If true, successful initialization
+   */
+  virtual bool InitProcess(CommonParam* common);
+
+  /**
+   * @brief
+   * Finalize routine of the AutoExposure plugin.
+   */
+  virtual void EndProcess(void);
+
+  /**
+   * @brief
+   * Post-processing routine of the AutoExposure plugin.
+   * This function is empty implementation.
+   */
+  virtual void DoPostProcess(void);
+
+  /**
+   * @brief
+   * Main routine of the AutoExposure plugin.
+   * Take the statistics of the frame and update the loops.
+   * @param src_image [in] src image data.
+   * @param dst_image [out] dst image data.
+   * @return If true, success in the main processing
+   */
+  virtual bool DoProcess(cv::Mat* src_image, cv::Mat* dst_image);
+
+  /**
+   * @brief
+   * Open setting window of the AutoExposure plugin.
+   * @param state [in] ImageProcessingState
+   */
+  virtual void OpenSettingWindow(ImageProcessingState state);
+
+  /**
+   * @brief
+   * Close setting window of the AutoExposure plugin.
+   * @return If true, success close window
+   */
+  virtual bool CloseSettingWindow(void);
+
+  /**
+   * @brief
+   * Set the list of parameter setting string for the AutoExposure plugin.
+   * @param params [in] settings string.
+   */
+  virtual void SetPluginSettings(std::vector<wxString> params);
+
+ private:
+  /**
+   * @brief
+   * Update the exposure loop.
+   * @param stats [in] statistics of the frame.
+   * @param metadata [in] metadata of the frame (can be NULL).
+   * @param frame_number [in] number of the frame.
+   */
+  void UpdateExposure(const BayerStats& stats, const FrameMetadata* metadata,
+                      unsigned int frame_number);
+
+  /**
+   * @brief
+   * Update the white balance loop.
+   * @param stats [in] statistics of the frame.
+   * @param frame_number [in] number of the frame.
+   */
+  void UpdateWhiteBalance(const BayerStats& stats, unsigned int frame_number);
+
+  /**
+   * @brief
+   * Get the time since the start of the convergence.
+   * @return time in msec.
+   */
+  double ConvergeMsec(void);
+};
+#endif /* _AUTOEXPOSURE_H_*/
@@ -0,0 +1,111 @@
+/**
+ * @file      autoexposure_define.h
+ * @brief     Definition of values for AutoExposure plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _AUTOEXPOSURE_DEFINE_H_
+#define _AUTOEXPOSURE_DEFINE_H_
+
+/* Identification ID of UI.*/
+#define kAutoExposureWndId                  92000
+#define kRadioAutoExposureGainModelId       92001
+#define kCheckBoxAutoExposureAeId           92002
+#define kCheckBoxAutoExposureAwbId          92003
+#define kTextCtrlAutoExposureIntervalId     92004
+#define kTextCtrlAutoExposureTargetId       92005
+#define kTextCtrlAutoExposureDampingId      92006
+#define kTextCtrlAutoExposureToleranceId    92007
+#define kTextCtrlAutoExposureMaxExposureId  92008
+#define kTextCtrlAutoExposureMaxAnalogId    92009
+#define kTextCtrlAutoExposureMaxDigitalId   92010
+#define kTextCtrlAutoExposureAwbDampingId   92011
+#define kCheckBoxAutoExposureTraceId        92012
+#define kButtonAutoExposureApplyId          92013
+
+/* Main window definition*/
+#define kAutoExposureWndTitle "Auto exposure / white balance"
+#define kAutoExposureWndPointX 0
+#define kAutoExposureWndPointY 0
+#define kAutoExposureWndSizeW 340
+#define kAutoExposureWndSizeH 580
+
+/* Gain model radio box definition*/
+#define kRadioAutoExposureGainModelName "Analog gain register"
+#define kRadioAutoExposureGainModelPointX 10
+#define kRadioAutoExposureGainModelPointY 10
+#define kRadioAutoExposureGainModelSizeW 310
+#define kRadioAutoExposureGainModelSizeH 90
+
+/* Window settings definition (label x, value x, first y, line height)*/
+#define kCheckBoxAutoExposureAeName "Auto exposure"
+#define kCheckBoxAutoExposureAwbName "Auto white balance"
+#define kStaticTextAutoExposureIntervalName "Update interval (frames)"
+#define kStaticTextAutoExposureTargetName "Target level (% of white)"
+#define kStaticTextAutoExposureDampingName "Exposure damping (%)"
+#define kStaticTextAutoExposureToleranceName "Tolerance (%)"
+#define kStaticTextAutoExposureMaxExposureName "Exposure max (lines)"
+#define kStaticTextAutoExposureMaxAnalogName "Analog gain max (register)"
+#define kStaticTextAutoExposureMaxDigitalName "Digital gain max (register)"
+#define kStaticTextAutoExposureAwbDampingName "White balance damping (%)"
+#define kCheckBoxAutoExposureTraceName "Log the convergence trace"
+#define kAutoExposureSettingsLabelPointX 10
+#define kAutoExposureSettingsValuePointX 220
+#define kAutoExposureSettingsPointY 110
+#define kAutoExposureSettingsLineH 35
+#define kAutoExposureSettingsLabelSizeW 200
+#define kAutoExposureSettingsValueSizeW 100
+#define kAutoExposureSettingsSizeH 25
+
+/* Apply button definition*/
+#define kButtonAutoExposureApplyName "Apply"
+#define kButtonAutoExposureApplyPointX 240
+#define kButtonAutoExposureApplyPointY 500
+#define kButtonAutoExposureApplySizeW 80
+#define kButtonAutoExposureApplySizeH 35
+
+/* Settings (lines of the ini file and of the flow settings)*/
+#define kAutoExposureSettingsGainModelIndex 0
+#define kAutoExposureSettingsAeIndex 1
+#define kAutoExposureSettingsAwbIndex 2
+#define kAutoExposureSettingsIntervalIndex 3
+#define kAutoExposureSettingsTargetIndex 4
+#define kAutoExposureSettingsDampingIndex 5
+#define kAutoExposureSettingsToleranceIndex 6
+#define kAutoExposureSettingsMaxExposureIndex 7
+#define kAutoExposureSettingsMaxAnalogIndex 8
+#define kAutoExposureSettingsMaxDigitalIndex 9
+#define kAutoExposureSettingsAwbDampingIndex 10
+#define kAutoExposureSettingsTraceIndex 11
+#define kAutoExposureSettingsNum 12
+#define kAutoExposureConfigFile "../lib/Plugins/output/AutoExposure.ini"
+
+/* Default settings (IMX219)*/
+#define kAutoExposureDefaultInterval 1
+#define kAutoExposureDefaultTarget 18
+#define kAutoExposureDefaultDamping 50
+#define kAutoExposureDefaultTolerance 6
+#define kAutoExposureDefaultMaxExposure 1700
+#define kAutoExposureDefaultMaxAnalog 232
+#define kAutoExposureDefaultMaxDigital 256
+#define kAutoExposureDefaultAwbDamping 50
+
+/* Statistics*/
+/* Bayer quads sampled per row and per column of the frame*/
+#define kAutoExposureStatsGridW 64
+#define kAutoExposureStatsGridH 48
+/* White level of the 16 bit raw frames (10 bit data)*/
+#define kAutoExposureWhite16 1023
+
+/* Control loop*/
+/* Digital gain register value of the unity gain*/
+#define kAutoExposureDigitalUnity 256
+/* Frames waited for the settings requested to be in effect*/
+#define kAutoExposureMaxWaitFrames 6
+/* Consecutive updates within the tolerance before the loop is settled*/
+#define kAutoExposureSettleUpdates 2
+/* A scene change which takes more frames to settle is warned*/
+#define kAutoExposureMaxSettleFrames 30
+
+#endif /* _AUTOEXPOSURE_DEFINE_H_*/
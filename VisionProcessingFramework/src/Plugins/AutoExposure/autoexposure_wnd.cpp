@@ -0,0 +1,444 @@
+/**
+ * @file      autoexposure_wnd.cpp
+ * @brief     Setting window of AutoExposure plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./autoexposure_wnd.h"
+#include <vector>
+#include "./../../logger.h"
+#include "./autoexposure.h"
+
+BEGIN_DECLARE_EVENT_TYPES()
+DECLARE_LOCAL_EVENT_TYPE(CAPTURE_INITIALIZE, wxNewEventType())
+DECLARE_LOCAL_EVENT_TYPE(CAPTURE_END, wxNewEventType())
+END_DECLARE_EVENT_TYPES()
+DEFINE_LOCAL_EVENT_TYPE(CAPTURE_INITIALIZE)
+DEFINE_LOCAL_EVENT_TYPE(CAPTURE_END)
+BEGIN_EVENT_TABLE(AutoExposureWnd, wxFrame)
+EVT_CLOSE(AutoExposureWnd::OnClose)
+EVT_COMMAND(wxID_ANY, CAPTURE_INITIALIZE, AutoExposureWnd::OnCaptureInit)
+EVT_COMMAND(wxID_ANY, CAPTURE_END, AutoExposureWnd::OnCaptureEnd)
+EVT_BUTTON(kButtonAutoExposureApplyId, AutoExposureWnd::OnApply)
+END_EVENT_TABLE()
+
+/**
+ * @brief
+ * Create a label and a text control on a line of the settings.
+ * @param parent [in] window.
+ * @param id [in] id of the text control.
+ * @param label [in] label.
+ * @param y [in] position of the line.
+ * @param static_text [out] label control.
+ * @param text_ctrl [out] text control.
+ */
+static void CreateSettingLine(wxWindow *parent, int id, const wxString &label,
+                              int y, wxStaticText **static_text,
+                              wxTextCtrl **text_ctrl) {
+  *static_text = new wxStaticText(
+      parent, wxID_ANY, label, wxPoint(kAutoExposureSettingsLabelPointX, y),
+      wxSize(kAutoExposureSettingsLabelSizeW, kAutoExposureSettingsSizeH));
+  *text_ctrl = new wxTextCtrl(
+      parent, id, wxT(""), wxPoint(kAutoExposureSettingsValuePointX, y),
+      wxSize(kAutoExposureSettingsValueSizeW, kAutoExposureSettingsSizeH));
+}
+
+/**
+ * @brief
+ * Read an integer line of the settings.
+ * @param lines [in] settings string.
+ * @param index [in] index of the line.
+ * @param min [in] lowest value.
+ * @param max [in] highest value.
+ * @param value [out] value, unchanged if the line is invalid.
+ */
+static void ReadSettingLine(const std::vector<wxString> &lines,
+                            unsigned int index, long min, long max,  // NOLINT
+                            int *value) {
+  long line_value;  // NOLINT
+  if (lines.size() > index && lines[index].ToLong(&line_value) &&
+      line_value >= min && line_value <= max) {
+    *value = static_cast<int>(line_value);
+  }
+}
+
+/**
+ * @brief
+ * Constructor for this window.
+ * @param auto_exposure [in] Pointer to the AutoExposure class
+ */
+AutoExposureWnd::AutoExposureWnd(AutoExposure *auto_exposure)
+    : wxFrame(NULL, kAutoExposureWndId, wxT(kAutoExposureWndTitle),
+              wxPoint(kAutoExposureWndPointX, kAutoExposureWndPointY),
+              wxSize(kAutoExposureWndSizeW, kAutoExposureWndSizeH)) {
+  auto_exposure_ = auto_exposure;
+  settings_.gain_model = kAeGainModelImx219;
+  settings_.is_ae = true;
+  settings_.is_awb = true;
+  settings_.interval = kAutoExposureDefaultInterval;
+  settings_.target_percent = kAutoExposureDefaultTarget;
+  settings_.damping_percent = kAutoExposureDefaultDamping;
+  settings_.tolerance_percent = kAutoExposureDefaultTolerance;
+  settings_.max_exposure = kAutoExposureDefaultMaxExposure;
+  settings_.max_analog = kAutoExposureDefaultMaxAnalog;
+  settings_.max_digital = kAutoExposureDefaultMaxDigital;
+  settings_.awb_damping_percent = kAutoExposureDefaultAwbDamping;
+  settings_.is_trace = false;
+
+  // Create the gain model radio box
+  wxString model_tbl[kAeGainModelNum];
+  for (int i = 0; i < kAeGainModelNum; i++) {
+    model_tbl[i] =
+        wxString(AeGainModelName(static_cast<AeGainModel>(i)), wxConvUTF8);
+  }
+  radio_box_gain_model_ = new wxRadioBox(
+      this, kRadioAutoExposureGainModelId,
+      wxT(kRadioAutoExposureGainModelName),
+      wxPoint(kRadioAutoExposureGainModelPointX,
+              kRadioAutoExposureGainModelPointY),
+      wxSize(kRadioAutoExposureGainModelSizeW,
+             kRadioAutoExposureGainModelSizeH),
+      kAeGainModelNum, model_tbl, 0, wxRA_SPECIFY_ROWS);
+
+  // Create the loop controls
+  int y = kAutoExposureSettingsPointY;
+  wxSize check_size(
+      kAutoExposureSettingsLabelSizeW + kAutoExposureSettingsValueSizeW,
+      kAutoExposureSettingsSizeH);
+  check_box_ae_ = new wxCheckBox(
+      this, kCheckBoxAutoExposureAeId, wxT(kCheckBoxAutoExposureAeName),
+      wxPoint(kAutoExposureSettingsLabelPointX, y), check_size);
+  y += kAutoExposureSettingsLineH;
+  check_box_awb_ = new wxCheckBox(
+      this, kCheckBoxAutoExposureAwbId, wxT(kCheckBoxAutoExposureAwbName),
+      wxPoint(kAutoExposureSettingsLabelPointX, y), check_size);
+  y += kAutoExposureSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoExposureIntervalId,
+                    wxT(kStaticTextAutoExposureIntervalName), y,
+                    &static_text_interval_, &text_ctrl_interval_);
+  y += kAutoExposureSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoExposureTargetId,
+                    wxT(kStaticTextAutoExposureTargetName), y,
+                    &static_text_target_, &text_ctrl_target_);
+  y += kAutoExposureSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoExposureDampingId,
+                    wxT(kStaticTextAutoExposureDampingName), y,
+                    &static_text_damping_, &text_ctrl_damping_);
+  y += kAutoExposureSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoExposureToleranceId,
+                    wxT(kStaticTextAutoExposureToleranceName), y,
+                    &static_text_tolerance_, &text_ctrl_tolerance_);
+  y += kAutoExposureSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoExposureMaxExposureId,
+                    wxT(kStaticTextAutoExposureMaxExposureName), y,
+                    &static_text_max_exposure_, &text_ctrl_max_exposure_);
+  y += kAutoExposureSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoExposureMaxAnalogId,
+                    wxT(kStaticTextAutoExposureMaxAnalogName), y,
+                    &static_text_max_analog_, &text_ctrl_max_analog_);
+  y += kAutoExposureSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoExposureMaxDigitalId,
+                    wxT(kStaticTextAutoExposureMaxDigitalName), y,
+                    &static_text_max_digital_, &text_ctrl_max_digital_);
+  y += kAutoExposureSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoExposureAwbDampingId,
+                    wxT(kStaticTextAutoExposureAwbDampingName), y,
+                    &static_text_awb_damping_, &text_ctrl_awb_damping_);
+  y += kAutoExposureSettingsLineH;
+  check_box_trace_ = new wxCheckBox(
+      this, kCheckBoxAutoExposureTraceId, wxT(kCheckBoxAutoExposureTraceName),
+      wxPoint(kAutoExposureSettingsLabelPointX, y), check_size);
+
+  // Create the apply button
+  button_apply_ = new wxButton(
+      this, kButtonAutoExposureApplyId, wxT(kButtonAutoExposureApplyName),
+      wxPoint(kButtonAutoExposureApplyPointX, kButtonAutoExposureApplyPointY),
+      wxSize(kButtonAutoExposureApplySizeW, kButtonAutoExposureApplySizeH));
+
+  LoadSettingsFromFile(wxT(kAutoExposureConfigFile));
+  UpdateControls();
+}
+
+/**
+ * @brief
+ * Destructor for this window.
+ */
+AutoExposureWnd::~AutoExposureWnd() {}
+
+/**
+ * @brief
+ * The handler function for EVT_CLOSE.
+ */
+void AutoExposureWnd::OnClose(wxCloseEvent &event) { Show(false); }
+
+/**
+ * @brief
+ * Post local event(CAPTURE_INITIALIZE) for initialize the screen settings on
+ * own thread.
+ */
+void AutoExposureWnd::PostCaptureInit(void) {
+  DEBUG_PRINT("AutoExposureWnd::PostCaptureInit\n");
+  wxCommandEvent event(CAPTURE_INITIALIZE);
+  event.SetString(wxT("This is the init"));
+  wxPostEvent(this, event);
+}
+
+/**
+ * @brief
+ * Post local event(CAPTURE_END) for destroy the screen on own thread.
+ */
+void AutoExposureWnd::PostCaptureEnd(void) {
+  DEBUG_PRINT("AutoExposureWnd::PostCaptureEnd\n");
+  wxCommandEvent event(CAPTURE_END);
+  event.SetString(wxT("This is the end"));
+  wxPostEvent(this, event);
+}
+
+/**
+ * @brief
+ * The handler function for local event(CAPTURE_INITIALIZE).
+ * Disable the settings.
+ */
+void AutoExposureWnd::OnCaptureInit(wxCommandEvent &event) {
+  EnableSettings(false);
+}
+
+/**
+ * @brief
+ * The handler function for local event(CAPTURE_END).
+ * Enable the settings.
+ */
+void AutoExposureWnd::OnCaptureEnd(wxCommandEvent &event) {
+  EnableSettings(true);
+}
+
+/**
+ * @brief
+ * Enable or disable the settings.
+ * @param enable [in] If true, the settings are enabled.
+ */
+void AutoExposureWnd::EnableSettings(bool enable) {
+  radio_box_gain_model_->Enable(enable);
+  check_box_ae_->Enable(enable);
+  check_box_awb_->Enable(enable);
+  text_ctrl_interval_->Enable(enable);
+  text_ctrl_target_->Enable(enable);
+  text_ctrl_damping_->Enable(enable);
+  text_ctrl_tolerance_->Enable(enable);
+  text_ctrl_max_exposure_->Enable(enable);
+  text_ctrl_max_analog_->Enable(enable);
+  text_ctrl_max_digital_->Enable(enable);
+  text_ctrl_awb_damping_->Enable(enable);
+  check_box_trace_->Enable(enable);
+  button_apply_->Enable(enable);
+}
+
+/**
+ * @brief
+ * The handler function for kButtonAutoExposureApplyId.
+ * Reflect the settings, which are used from the next capture.
+ */
+void AutoExposureWnd::OnApply(wxCommandEvent &event) {
+  DEBUG_PRINT("AutoExposureWnd::OnApply\n");
+  std::vector<wxString> lines(kAutoExposureSettingsNum);
+  lines[kAutoExposureSettingsGainModelIndex]
+      << radio_box_gain_model_->GetSelection();
+  lines[kAutoExposureSettingsAeIndex] =
+      check_box_ae_->GetValue() ? wxT("1") : wxT("0");
+  lines[kAutoExposureSettingsAwbIndex] =
+      check_box_awb_->GetValue() ? wxT("1") : wxT("0");
+  lines[kAutoExposureSettingsIntervalIndex] = text_ctrl_interval_->GetValue();
+  lines[kAutoExposureSettingsTargetIndex] = text_ctrl_target_->GetValue();
+  lines[kAutoExposureSettingsDampingIndex] = text_ctrl_damping_->GetValue();
+  lines[kAutoExposureSettingsToleranceIndex] =
+      text_ctrl_tolerance_->GetValue();
+  lines[kAutoExposureSettingsMaxExposureIndex] =
+      text_ctrl_max_exposure_->GetValue();
+  lines[kAutoExposureSettingsMaxAnalogIndex] =
+      text_ctrl_max_analog_->GetValue();
+  lines[kAutoExposureSettingsMaxDigitalIndex] =
+      text_ctrl_max_digital_->GetValue();
+  lines[kAutoExposureSettingsAwbDampingIndex] =
+      text_ctrl_awb_damping_->GetValue();
+  lines[kAutoExposureSettingsTraceIndex] =
+      check_box_trace_->GetValue() ? wxT("1") : wxT("0");
+  SetSettings(lines);
+  UpdateControls();
+  WriteSettingsToFile(wxT(kAutoExposureConfigFile));
+  this->Show(false);
+}
+
+/**
+ * @brief
+ * Show the settings in the controls.
+ */
+void AutoExposureWnd::UpdateControls(void) {
+  radio_box_gain_model_->SetSelection(settings_.gain_model);
+  check_box_ae_->SetValue(settings_.is_ae);
+  check_box_awb_->SetValue(settings_.is_awb);
+  text_ctrl_interval_->SetValue(
+      wxString::Format(wxT("%d"), settings_.interval));
+  text_ctrl_target_->SetValue(
+      wxString::Format(wxT("%d"), settings_.target_percent));
+  text_ctrl_damping_->SetValue(
+      wxString::Format(wxT("%d"), settings_.damping_percent));
+  text_ctrl_tolerance_->SetValue(
+      wxString::Format(wxT("%d"), settings_.tolerance_percent));
+  text_ctrl_max_exposure_->SetValue(
+      wxString::Format(wxT("%d"), settings_.max_exposure));
+  text_ctrl_max_analog_->SetValue(
+      wxString::Format(wxT("%d"), settings_.max_analog));
+  text_ctrl_max_digital_->SetValue(
+      wxString::Format(wxT("%d"), settings_.max_digital));
+  text_ctrl_awb_damping_->SetValue(
+      wxString::Format(wxT("%d"), settings_.awb_damping_percent));
+  check_box_trace_->SetValue(settings_.is_trace);
+}
+
+/**
+ * @brief
+ * Set the settings from a list of strings (lines of the settings file).
+ * Invalid values keep the current settings.
+ * @param lines [in] settings string.
+ */
+void AutoExposureWnd::SetSettings(const std::vector<wxString> &lines) {
+  int value = settings_.gain_model;
+  ReadSettingLine(lines, kAutoExposureSettingsGainModelIndex, 0,
+                  kAeGainModelNum - 1, &value);
+  settings_.gain_model = static_cast<AeGainModel>(value);
+  value = settings_.is_ae ? 1 : 0;
+  ReadSettingLine(lines, kAutoExposureSettingsAeIndex, 0, 1, &value);
+  settings_.is_ae = (value != 0);
+  value = settings_.is_awb ? 1 : 0;
+  ReadSettingLine(lines, kAutoExposureSettingsAwbIndex, 0, 1, &value);
+  settings_.is_awb = (value != 0);
+  ReadSettingLine(lines, kAutoExposureSettingsIntervalIndex, 1, 1000,
+                  &settings_.interval);
+  ReadSettingLine(lines, kAutoExposureSettingsTargetIndex, 1, 99,
+                  &settings_.target_percent);
+  ReadSettingLine(lines, kAutoExposureSettingsDampingIndex, 1, 100,
+                  &settings_.damping_percent);
+  ReadSettingLine(lines, kAutoExposureSettingsToleranceIndex, 0, 50,
+                  &settings_.tolerance_percent);
+  ReadSettingLine(lines, kAutoExposureSettingsMaxExposureIndex, 1, 0xFFFF,
+                  &settings_.max_exposure);
+  ReadSettingLine(lines, kAutoExposureSettingsMaxAnalogIndex, 0, 0xFFFF,
+                  &settings_.max_analog);
+  ReadSettingLine(lines, kAutoExposureSettingsMaxDigitalIndex, 0, 0xFFFF,
+                  &settings_.max_digital);
+  ReadSettingLine(lines, kAutoExposureSettingsAwbDampingIndex, 1, 100,
+                  &settings_.awb_damping_percent);
+  value = settings_.is_trace ? 1 : 0;
+  ReadSettingLine(lines, kAutoExposureSettingsTraceIndex, 0, 1, &value);
+  settings_.is_trace = (value != 0);
+}
+
+/**
+ * @brief
+ * Set the list of parameter setting string for the AutoExposure plugin.
+ * @param params [in] settings string.
+ */
+void AutoExposureWnd::SetPluginSettings(std::vector<wxString> params) {
+  SetSettings(params);
+  UpdateControls();
+  WriteSettingsToFile(wxT(kAutoExposureConfigFile));
+}
+
+/**
+ * @brief
+ * Load the parameters from the file.
+ * @param file_path [in] file path.
+ * @return If true, reading the file success
+ */
+bool AutoExposureWnd::LoadSettingsFromFile(wxString file_path) {
+  wxTextFile text_file;
+  bool ret = false;
+
+  ret = wxFile::Exists(file_path);
+  if (ret == true) {
+    ret = text_file.Open(file_path);
+    if (ret == false) {
+      DEBUG_PRINT("Could not open file =%s\n",
+                  (const char *)file_path.mb_str());
+      return false;
+    }
+  } else {
+    DEBUG_PRINT("File does not exist =%s\n", (const char *)file_path.mb_str());
+    return false;
+  }
+
+  ret = text_file.Eof();
+  if (ret == true) {
+    DEBUG_PRINT("Blank init file\n");
+    text_file.Close();
+    return false;
+  }
+  std::vector<wxString> lines;
+  lines.push_back(text_file.GetFirstLine());
+  while (text_file.Eof() == false) {
+    lines.push_back(text_file.GetNextLine());
+  }
+  SetSettings(lines);
+  text_file.Close();
+  return true;
+}
+
+/**
+ * @brief
+ * Write the parameters to the file.
+ * @param file_path [in] file path.
+ * @return If true, writing the file success
+ */
+bool AutoExposureWnd::WriteSettingsToFile(wxString file_path) {
+  wxTextFile text_file;
+  bool ret = false;
+
+  ret = wxFile::Exists(file_path);
+  if (ret == true) {
+    ret = text_file.Open(file_path);
+    if (ret == false) {
+      ret = text_file.Create(file_path);
+      if (ret == false) {
+        LOG_ERROR("[plugin:AutoExposure] Fail to create file = %s\n",
+                  (const char *)file_path.mb_str());
+        return false;
+      }
+    }
+  } else {
+    ret = text_file.Create(file_path);
+    if (ret == false) {
+      LOG_ERROR("[plugin:AutoExposure] Fail to create file = %s\n",
+                (const char *)file_path.mb_str());
+      return false;
+    }
+  }
+  text_file.Clear();
+  auto_exposure_->ClearPluginSettings();
+
+  std::vector<wxString> lines(kAutoExposureSettingsNum);
+  lines[kAutoExposureSettingsGainModelIndex]
+      << static_cast<int>(settings_.gain_model);
+  lines[kAutoExposureSettingsAeIndex] << (settings_.is_ae ? 1 : 0);
+  lines[kAutoExposureSettingsAwbIndex] << (settings_.is_awb ? 1 : 0);
+  lines[kAutoExposureSettingsIntervalIndex] << settings_.interval;
+  lines[kAutoExposureSettingsTargetIndex] << settings_.target_percent;
+  lines[kAutoExposureSettingsDampingIndex] << settings_.damping_percent;
+  lines[kAutoExposureSettingsToleranceIndex] << settings_.tolerance_percent;
+  lines[kAutoExposureSettingsMaxExposureIndex] << settings_.max_exposure;
+  lines[kAutoExposureSettingsMaxAnalogIndex] << settings_.max_analog;
+  lines[kAutoExposureSettingsMaxDigitalIndex] << settings_.max_digital;
+  lines[kAutoExposureSettingsAwbDampingIndex]
+      << settings_.awb_damping_percent;
+  lines[kAutoExposureSettingsTraceIndex] << (settings_.is_trace ? 1 : 0);
+  for (unsigned int i = 0; i < lines.size(); i++) {
+    auto_exposure_->AddLinePluginSettings(lines[i]);
+    text_file.AddLine(lines[i]);
+  }
+
+  if (auto_exposure_->is_cloned() == false) {
+    text_file.Write();
+  }
+  text_file.Close();
+  return true;
+}
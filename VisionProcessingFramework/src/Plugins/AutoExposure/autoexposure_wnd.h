@@ -0,0 +1,194 @@
+/**
+ * @file      autoexposure_wnd.h
+ * @brief     Setting window of AutoExposure plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+#ifndef _AUTOEXPOSURE_WND_H_
+#define _AUTOEXPOSURE_WND_H_
+
+#include <vector>
+
+#include "./include.h"
+#include "./autoexposure_define.h"
+#include "./exposure_control.h"
+
+class AutoExposure;
+
+/**
+ * @struct AutoExposureSettings
+ * @brief Settings of the AutoExposure plugin.
+ */
+typedef struct {
+  /*! Analog gain register model */
+  AeGainModel gain_model;
+  /*! Whether the exposure is controlled */
+  bool is_ae;
+  /*! Whether the white balance is controlled */
+  bool is_awb;
+  /*! Frames between the updates */
+  int interval;
+  /*! Target average level in percent of the white level */
+  int target_percent;
+  /*! Exposure error corrected by an update in percent */
+  int damping_percent;
+  /*! Exposure error not corrected in percent */
+  int tolerance_percent;
+  /*! Longest coarse integration time (lines) */
+  int max_exposure;
+  /*! Highest analog gain register value */
+  int max_analog;
+  /*! Highest digital gain register value (unity or lower: not controlled) */
+  int max_digital;
+  /*! White balance error corrected by an update in percent */
+  int awb_damping_percent;
+  /*! Whether every update is logged */
+  bool is_trace;
+} AutoExposureSettings;
+
+/**
+ * @class AutoExposureWnd
+ * @brief Setting window of AutoExposure plugin.
+ * The settings are taken at the start of the capture.
+ */
+class AutoExposureWnd : public wxFrame {
+ private:
+  /*! Settings */
+  AutoExposureSettings settings_;
+  /*! Pointer to the AutoExposure class */
+  AutoExposure* auto_exposure_;
+
+ public:
+  /**
+   * @brief
+   * Constructor for this window.
+   * @param auto_exposure [in] Pointer to the AutoExposure class
+   */
+  explicit AutoExposureWnd(AutoExposure* auto_exposure);
+
+  /**
+   * @brief
+   * Destructor for this window.
+   */
+  virtual ~AutoExposureWnd(void);
+
+  /**
+   * @brief
+   * Get the settings.
+   * @return settings.
+   */
+  AutoExposureSettings settings(void) const { return settings_; }
+
+  /**
+   * @brief
+   * Post local event(CAPTURE_INITIALIZE) for initialize the screen settings on
+   * own thread.
+   */
+  virtual void PostCaptureInit(void);
+
+  /**
+   * @brief
+   * Post local event(CAPTURE_END) for destroy the screen on own thread.
+   */
+  virtual void PostCaptureEnd(void);
+
+  /**
+   * @brief
+   * The handler function for EVT_CLOSE.
+   */
+  virtual void OnClose(wxCloseEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * Set the list of parameter setting string for the AutoExposure plugin.
+   * @param params [in] settings string.
+   */
+  void SetPluginSettings(std::vector<wxString> params);
+
+ protected:
+  /*! UI*/
+  wxRadioBox* radio_box_gain_model_;
+  wxCheckBox* check_box_ae_;
+  wxCheckBox* check_box_awb_;
+  wxStaticText* static_text_interval_;
+  wxTextCtrl* text_ctrl_interval_;
+  wxStaticText* static_text_target_;
+  wxTextCtrl* text_ctrl_target_;
+  wxStaticText* static_text_damping_;
+  wxTextCtrl* text_ctrl_damping_;
+  wxStaticText* static_text_tolerance_;
+  wxTextCtrl* text_ctrl_tolerance_;
+  wxStaticText* static_text_max_exposure_;
+  wxTextCtrl* text_ctrl_max_exposure_;
+  wxStaticText* static_text_max_analog_;
+  wxTextCtrl* text_ctrl_max_analog_;
+  wxStaticText* static_text_max_digital_;
+  wxTextCtrl* text_ctrl_max_digital_;
+  wxStaticText* static_text_awb_damping_;
+  wxTextCtrl* text_ctrl_awb_damping_;
+  wxCheckBox* check_box_trace_;
+  wxButton* button_apply_;
+
+ private:
+  /*! Event table of wxWidgets.*/
+  DECLARE_EVENT_TABLE();
+
+  /**
+   * @brief
+   * The handler function for kButtonAutoExposureApplyId.
+   * Reflect the settings, which are used from the next capture.
+   */
+  virtual void OnApply(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * The handler function for local event(CAPTURE_INITIALIZE).
+   * Disable the settings.
+   */
+  virtual void OnCaptureInit(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * The handler function for local event(CAPTURE_END).
+   * Enable the settings.
+   */
+  virtual void OnCaptureEnd(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * Enable or disable the settings.
+   * @param enable [in] If true, the settings are enabled.
+   */
+  void EnableSettings(bool enable);
+
+  /**
+   * @brief
+   * Show the settings in the controls.
+   */
+  void UpdateControls(void);
+
+  /**
+   * @brief
+   * Set the settings from a list of strings (lines of the settings file).
+   * @param lines [in] settings string.
+   */
+  void SetSettings(const std::vector<wxString>& lines);
+
+  /**
+   * @brief
+   * Load the parameters from the file.
+   * @param file_path [in] file path.
+   * @return If true, reading the file success
+   */
+  bool LoadSettingsFromFile(wxString file_path);
+
+  /**
+   * @brief
+   * Write the parameters to the file.
+   * @param file_path [in] file path.
+   * @return If true, writing the file success
+   */
+  bool WriteSettingsToFile(wxString file_path);
+};
+
+#endif /* _AUTOEXPOSURE_WND_H_*/
@@ -0,0 +1,153 @@
+/**
+ * @file      bayer_stats.cpp
+ * @brief     Raw frame statistics of AutoExposure plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./bayer_stats.h"
+#include <string.h>
+#include <algorithm>
+#include "./autoexposure_define.h"
+
+/* A quad darker than this (0..1) is left out of the neutral averages*/
+#define kBayerStatsDarkLevel 0.02
+/* A pixel at or above this fraction of the white level is clipped*/
+#define kBayerStatsClipLevel 0.98
+
+/**
+ * @brief
+ * Take the statistics of a raw frame on a grid of Bayer quads.
+ * @param raw [in] raw frame.
+ * @param color [in] color of the pixels of a quad (0:R 1:Gr 2:Gb 3:B),
+ * in the order top-left, top-right, bottom-left, bottom-right.
+ * @param optical_black [in] optical black level.
+ * @param white [in] white level.
+ * @param grid_w [in] quads sampled per row.
+ * @param grid_h [in] quads sampled per column.
+ * @param stats [out] statistics.
+ */
+template <typename T>
+static void ComputeQuads(const cv::Mat& raw, const int color[4],
+                         int optical_black, int white, int grid_w,
+                         int grid_h, BayerStats* stats) {
+  int quads_w = raw.cols / 2;
+  int quads_h = raw.rows / 2;
+  int step_x = std::max(1, quads_w / grid_w);
+  int step_y = std::max(1, quads_h / grid_h);
+  double scale = 1.0 / std::max(1, white - optical_black);
+  int clip = static_cast<int>(white * kBayerStatsClipLevel);
+  double sum[4] = {0, 0, 0, 0};
+  double neutral[4] = {0, 0, 0, 0};
+  double sum_y = 0;
+  int clipped = 0;
+
+  for (int qy = step_y / 2; qy < quads_h; qy += step_y) {
+    const T* row0 = raw.ptr<T>(qy * 2);
+    const T* row1 = raw.ptr<T>(qy * 2 + 1);
+    for (int qx = step_x / 2; qx < quads_w; qx += step_x) {
+      int pixel[4];
+      pixel[0] = row0[qx * 2];
+      pixel[1] = row0[qx * 2 + 1];
+      pixel[2] = row1[qx * 2];
+      pixel[3] = row1[qx * 2 + 1];
+      double level[4];
+      bool is_clipped = false;
+      for (int i = 0; i < 4; i++) {
+        is_clipped |= (pixel[i] >= clip);
+        level[color[i]] = std::max(0, pixel[i] - optical_black) * scale;
+      }
+      double y = (level[0] + level[1] + level[2] + level[3]) / 4;
+      for (int c = 0; c < 4; c++) {
+        sum[c] += level[c];
+      }
+      sum_y += y;
+      int bin = std::min(kBayerStatsBins - 1,
+                         static_cast<int>(y * kBayerStatsBins));
+      stats->histogram[bin]++;
+      if (is_clipped) {
+        clipped++;
+      } else if (y >= kBayerStatsDarkLevel) {
+        for (int c = 0; c < 4; c++) {
+          neutral[c] += level[c];
+        }
+        stats->neutral_quads++;
+      }
+      stats->quads++;
+    }
+  }
+
+  if (stats->quads > 0) {
+    stats->average_y = sum_y / stats->quads;
+    stats->average_r = sum[0] / stats->quads;
+    stats->average_g = (sum[1] + sum[2]) / 2 / stats->quads;
+    stats->average_b = sum[3] / stats->quads;
+    stats->clipped = static_cast<double>(clipped) / stats->quads;
+  }
+  if (stats->neutral_quads > 0) {
+    stats->neutral_r = neutral[0] / stats->neutral_quads;
+    stats->neutral_g = (neutral[1] + neutral[2]) / 2 / stats->neutral_quads;
+    stats->neutral_b = neutral[3] / stats->neutral_quads;
+  }
+}
+
+/**
+ * @brief
+ * Take the statistics of a raw frame on a grid of Bayer quads.
+ * Only grid_w x grid_h quads are read, whatever the size of the frame.
+ * @param raw [in] raw frame (CV_8UC1 or CV_16UC1, 10 bit data).
+ * @param first_pixel [in] color of the first pixel (0:R 1:Gr 2:Gb 3:B).
+ * @param optical_black [in] optical black level.
+ * @param grid_w [in] quads sampled per row.
+ * @param grid_h [in] quads sampled per column.
+ * @param stats [out] statistics.
+ * @return If false, the frame is not supported.
+ */
+bool BayerStatsCompute(const cv::Mat& raw, int first_pixel,
+                       int optical_black, int grid_w, int grid_h,
+                       BayerStats* stats) {
+  memset(stats, 0, sizeof(BayerStats));
+  if (raw.empty() || raw.channels() != 1 || raw.cols < 2 || raw.rows < 2 ||
+      first_pixel < 0 || first_pixel > 3 || grid_w <= 0 || grid_h <= 0) {
+    return false;
+  }
+
+  // Color of each pixel of a quad, as the filter of WhiteBalanceGain.
+  int color[4];
+  for (int i = 0; i < 4; i++) {
+    int x = i % 2;
+    int y = i / 2;
+    color[i] = (((first_pixel + x) % 2) + ((first_pixel / 2 + y) % 2) * 2) % 4;
+  }
+
+  if (raw.depth() == CV_8U) {
+    ComputeQuads<unsigned char>(raw, color, optical_black, 255, grid_w,
+                                grid_h, stats);
+  } else if (raw.depth() == CV_16U) {
+    ComputeQuads<unsigned short>(raw, color, optical_black,  // NOLINT
+                                 kAutoExposureWhite16, grid_w, grid_h,
+                                 stats);
+  } else {
+    return false;
+  }
+  return stats->quads > 0;
+}
+
+/**
+ * @brief
+ * Get a percentile of the luminance from the histogram.
+ * @param stats [in] statistics.
+ * @param fraction [in] fraction of the quads (0..1) at or below the level.
+ * @return level (upper edge of the bin, 0..1).
+ */
+double BayerStatsPercentile(const BayerStats& stats, double fraction) {
+  int limit = static_cast<int>(stats.quads * fraction);
+  int count = 0;
+  for (int bin = 0; bin < kBayerStatsBins; bin++) {
+    count += stats.histogram[bin];
+    if (count > limit) {
+      return static_cast<double>(bin + 1) / kBayerStatsBins;
+    }
+  }
+  return 1.0;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file      bayer_stats.h
+ * @brief     Raw frame statistics of AutoExposure plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _BAYER_STATS_H_
+#define _BAYER_STATS_H_
+
+#include "./include.h"
+
+/* Bins of the luminance histogram*/
+#define kBayerStatsBins 64
+
+/**
+ * @struct BayerStats
+ * @brief Statistics of the Bayer quads sampled from a raw frame.
+ * The levels have the optical black subtracted and are in 0..1 of the
+ * white level.
+ */
+typedef struct {
+  /*! Number of the quads sampled */
+  int quads;
+  /*! Average luminance ((R + Gr + Gb + B) / 4) */
+  double average_y;
+  /*! Average of red pixels */
+  double average_r;
+  /*! Average of green pixels */
+  double average_g;
+  /*! Average of blue pixels */
+  double average_b;
+  /*! Number of the quads neither dark nor clipped */
+  int neutral_quads;
+  /*! Average of red pixels of the quads neither dark nor clipped */
+  double neutral_r;
+  /*! Average of green pixels of the quads neither dark nor clipped */
+  double neutral_g;
+  /*! Average of blue pixels of the quads neither dark nor clipped */
+  double neutral_b;
+  /*! Fraction of the quads with a clipped pixel */
+  double clipped;
+  /*! Histogram of the luminance of the quads */
+  int histogram[kBayerStatsBins];
+} BayerStats;
+
+/**
+ * @brief
+ * Take the statistics of a raw frame on a grid of Bayer quads.
+ * Only grid_w x grid_h quads are read, whatever the size of the frame.
+ * @param raw [in] raw frame (CV_8UC1 or CV_16UC1, 10 bit data).
+ * @param first_pixel [in] color of the first pixel (0:R 1:Gr 2:Gb 3:B).
+ * @param optical_black [in] optical black level.
+ * @param grid_w [in] quads sampled per row.
+ * @param grid_h [in] quads sampled per column.
+ * @param stats [out] statistics.
+ * @return If false, the frame is not supported.
+ */
+bool BayerStatsCompute(const cv::Mat& raw, int first_pixel,
+                       int optical_black, int grid_w, int grid_h,
+                       BayerStats* stats);
+
+/**
+ * @brief
+ * Get a percentile of the luminance from the histogram.
+ * @param stats [in] statistics.
+ * @param fraction [in] fraction of the quads (0..1) at or below the level.
+ * @return level (upper edge of the bin, 0..1).
+ */
+double BayerStatsPercentile(const BayerStats& stats, double fraction);
+
+#endif /* _BAYER_STATS_H_*/
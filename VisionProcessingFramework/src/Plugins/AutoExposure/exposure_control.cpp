@@ -0,0 +1,199 @@
+/**
+ * @file      exposure_control.cpp
+ * @brief     Exposure control loop of AutoExposure plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./exposure_control.h"
+#include <math.h>
+#include <algorithm>
+#include "./autoexposure_define.h"
+
+/* Level under which the frame is taken as black (0..1)*/
+#define kExposureControlMinLevel (1.0 / 1024)
+/* Error (log) above which the correction is not damped*/
+#define kExposureControlJump 0.693147  /* log(2) */
+/* Largest correction of an update (log)*/
+#define kExposureControlMaxStep 3.465736  /* log(32) */
+/* Fraction of the quads clipped above which the exposure is lowered*/
+#define kExposureControlClipHigh 0.02
+/* Fraction of the quads clipped above which the exposure is not raised*/
+#define kExposureControlClipLow 0.01
+/* Correction while the highlights are clipped*/
+#define kExposureControlClipRatio 0.8
+
+/**
+ * @brief
+ * Get the name of a gain model.
+ * @param model [in] gain model.
+ * @return name.
+ */
+const char* AeGainModelName(AeGainModel model) {
+  switch (model) {
+    case kAeGainModelImx219:
+      return "256/(256-x) (IMX219)";
+    case kAeGainModelImx378:
+      return "1024/(1024-x) (IMX378)";
+    case kAeGainModelImx408:
+      return "x*24/255 dB (IMX408)";
+    default:
+      return "";
+  }
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+ExposureControl::ExposureControl(void) {
+  params_.gain_model = kAeGainModelImx219;
+  params_.target = kAutoExposureDefaultTarget / 100.0;
+  params_.damping = kAutoExposureDefaultDamping / 100.0;
+  params_.tolerance = kAutoExposureDefaultTolerance / 100.0;
+  params_.max_exposure = kAutoExposureDefaultMaxExposure;
+  params_.max_analog = kAutoExposureDefaultMaxAnalog;
+  params_.max_digital = kAutoExposureDefaultMaxDigital;
+  is_settled_ = false;
+  in_band_updates_ = 0;
+  ratio_ = 1.0;
+  total_ = 0;
+}
+
+/**
+ * @brief
+ * Start the loop.
+ * @param params [in] parameters.
+ */
+void ExposureControl::Start(const ExposureControlParams& params) {
+  params_ = params;
+  is_settled_ = false;
+  in_band_updates_ = 0;
+  ratio_ = 1.0;
+  total_ = 0;
+}
+
+/**
+ * @brief
+ * Give the statistics of a frame.
+ * @param stats [in] statistics of the frame.
+ * @param in_effect [in] settings the frame was exposed with (the
+ * integration time must be known).
+ * @param request [out] settings to request.
+ * @return If true, request is a new setting to request.
+ */
+bool ExposureControl::Update(const BayerStats& stats,
+                             const ExposureSetting& in_effect,
+                             ExposureSetting* request) {
+  *request = in_effect;
+  if (in_effect.exposure <= 0) {
+    return false;
+  }
+
+  double ratio =
+      params_.target / std::max(stats.average_y, kExposureControlMinLevel);
+  if (stats.clipped > kExposureControlClipHigh) {
+    ratio = std::min(ratio, kExposureControlClipRatio);
+  } else if (stats.clipped > kExposureControlClipLow) {
+    ratio = std::min(ratio, 1.0);
+  }
+  ratio_ = ratio;
+  double error = log(ratio);
+  if (fabs(error) <= log(1.0 + params_.tolerance)) {
+    if (++in_band_updates_ >= kAutoExposureSettleUpdates) {
+      is_settled_ = true;
+    }
+    return false;
+  }
+  in_band_updates_ = 0;
+  is_settled_ = false;
+
+  double step = (fabs(error) > kExposureControlJump)
+                    ? error
+                    : error * params_.damping;
+  step = std::max(-kExposureControlMaxStep,
+                  std::min(kExposureControlMaxStep, step));
+
+  // The settings in effect, the gains not known taken as the lowest.
+  bool is_digital = (params_.max_digital > kAutoExposureDigitalUnity);
+  int analog = std::max(0, in_effect.analog_gain);
+  double digital = (in_effect.digital_gain > 0)
+                       ? static_cast<double>(in_effect.digital_gain) /
+                             kAutoExposureDigitalUnity
+                       : 1.0;
+  double total = in_effect.exposure * AnalogGain(analog) *
+                 (is_digital ? digital : 1.0) * exp(step);
+  total_ = total;
+
+  // The integration time first (the lowest noise), then the gains. The
+  // digital gain not controlled stays as it is.
+  int exposure = static_cast<int>(total + 0.5);
+  exposure = std::max(1, std::min(params_.max_exposure, exposure));
+  double gain = total / exposure;
+  analog = std::min(params_.max_analog, AnalogRegister(gain));
+  request->exposure = exposure;
+  request->analog_gain = analog;
+  request->digital_gain = kExposureControlNone;
+  if (is_digital) {
+    int reg = static_cast<int>(
+        kAutoExposureDigitalUnity * gain / AnalogGain(analog) + 0.5);
+    request->digital_gain =
+        std::max(kAutoExposureDigitalUnity, std::min(params_.max_digital, reg));
+  }
+
+  if (request->exposure == in_effect.exposure &&
+      request->analog_gain == in_effect.analog_gain &&
+      (request->digital_gain == kExposureControlNone ||
+       request->digital_gain == in_effect.digital_gain)) {
+    // At the limits: nothing more can be done.
+    is_settled_ = true;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Get the gain of an analog gain register value.
+ * @param reg [in] register value.
+ * @return gain.
+ */
+double ExposureControl::AnalogGain(int reg) const {
+  switch (params_.gain_model) {
+    case kAeGainModelImx219:
+      return 256.0 / (256 - std::min(reg, 255));
+    case kAeGainModelImx378:
+      return 1024.0 / (1024 - std::min(reg, 1023));
+    case kAeGainModelImx408:
+      return pow(10.0, reg * 24.0 / 255 / 20);
+    default:
+      return 1.0;
+  }
+}
+
+/**
+ * @brief
+ * Get the analog gain register value of a gain (rounded down, so the
+ * gain requested is not exceeded).
+ * @param gain [in] gain (1 or higher).
+ * @return register value.
+ */
+int ExposureControl::AnalogRegister(double gain) const {
+  gain = std::max(1.0, gain);
+  double reg = 0;
+  switch (params_.gain_model) {
+    case kAeGainModelImx219:
+      reg = 256 - 256 / gain;
+      break;
+    case kAeGainModelImx378:
+      reg = 1024 - 1024 / gain;
+      break;
+    case kAeGainModelImx408:
+      reg = 20 * log10(gain) * 255 / 24;
+      break;
+    default:
+      break;
+  }
+  // A small margin keeps an exact gain from rounding one step down.
+  return std::max(0, static_cast<int>(reg + 1e-6));
+}
@@ -0,0 +1,167 @@
+/**
+ * @file      exposure_control.h
+ * @brief     Exposure control loop of AutoExposure plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _EXPOSURE_CONTROL_H_
+#define _EXPOSURE_CONTROL_H_
+
+#include "./bayer_stats.h"
+
+/* Value of a setting which is not known or not requested*/
+#define kExposureControlNone -1
+
+/**
+ * @enum AeGainModel
+ * @brief Relation between the analog gain register and the gain.
+ */
+typedef enum {
+  /*! 256 / (256 - register) (IMX219) */
+  kAeGainModelImx219 = 0,
+  /*! 1024 / (1024 - register) (IMX378) */
+  kAeGainModelImx378,
+  /*! register * 24 / 255 dB (IMX408) */
+  kAeGainModelImx408,
+  kAeGainModelNum
+} AeGainModel;
+
+/**
+ * @brief
+ * Get the name of a gain model.
+ * @param model [in] gain model.
+ * @return name.
+ */
+const char* AeGainModelName(AeGainModel model);
+
+/**
+ * @struct ExposureControlParams
+ * @brief Parameters of the exposure control loop.
+ */
+typedef struct {
+  /*! Analog gain register model */
+  AeGainModel gain_model;
+  /*! Target average level (0..1 of the white level) */
+  double target;
+  /*! Fraction of the error corrected by an update (0..1] */
+  double damping;
+  /*! Relative error which is not corrected */
+  double tolerance;
+  /*! Longest coarse integration time (lines) */
+  int max_exposure;
+  /*! Highest analog gain register value */
+  int max_analog;
+  /*! Highest digital gain register value (unity or lower: not controlled) */
+  int max_digital;
+} ExposureControlParams;
+
+/**
+ * @struct ExposureSetting
+ * @brief Sensor registers of the exposure (kExposureControlNone: not known
+ * or not requested).
+ */
+typedef struct {
+  /*! Coarse integration time register value */
+  int exposure;
+  /*! Analog gain register value */
+  int analog_gain;
+  /*! Digital gain register value */
+  int digital_gain;
+} ExposureSetting;
+
+/**
+ * @class ExposureControl
+ * @brief Damped control loop of the exposure.
+ * An update compares the average level of a frame with the target and
+ * computes the total exposure (integration time x gains) which brings it
+ * there, from the settings the frame was exposed with. The error is
+ * corrected in the log domain: an error above a factor of two (a scene
+ * change) is corrected at once, a smaller one by the damping fraction, so
+ * the loop neither overshoots on the delay of the sensor nor hunts within
+ * the tolerance. Clipped highlights cap the correction. The total is split
+ * into the integration time first, then the analog gain, then the digital
+ * gain. The class only decides the settings: the caller requests them and
+ * gives back the statistics of the frames exposed with them.
+ */
+class ExposureControl {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  ExposureControl(void);
+
+  /**
+   * @brief
+   * Start the loop.
+   * @param params [in] parameters.
+   */
+  void Start(const ExposureControlParams& params);
+
+  /**
+   * @brief
+   * Give the statistics of a frame.
+   * @param stats [in] statistics of the frame.
+   * @param in_effect [in] settings the frame was exposed with (the
+   * integration time must be known).
+   * @param request [out] settings to request.
+   * @return If true, request is a new setting to request.
+   */
+  bool Update(const BayerStats& stats, const ExposureSetting& in_effect,
+              ExposureSetting* request);
+
+  /**
+   * @brief
+   * Whether the level stayed within the tolerance for
+   * kAutoExposureSettleUpdates updates, or the settings are at their
+   * limits.
+   * @return If true, the loop is settled.
+   */
+  bool is_settled(void) const { return is_settled_; }
+
+  /**
+   * @brief
+   * Get the error of the last update.
+   * @return target / level (1: no error).
+   */
+  double ratio(void) const { return ratio_; }
+
+  /**
+   * @brief
+   * Get the total exposure requested last.
+   * @return integration time (lines) x gains.
+   */
+  double total(void) const { return total_; }
+
+ private:
+  /**
+   * @brief
+   * Get the gain of an analog gain register value.
+   * @param reg [in] register value.
+   * @return gain.
+   */
+  double AnalogGain(int reg) const;
+
+  /**
+   * @brief
+   * Get the analog gain register value of a gain (rounded down, so the
+   * gain requested is not exceeded).
+   * @param gain [in] gain (1 or higher).
+   * @return register value.
+   */
+  int AnalogRegister(double gain) const;
+
+  /*! Parameters */
+  ExposureControlParams params_;
+  /*! Whether the loop is settled */
+  bool is_settled_;
+  /*! Consecutive updates within the tolerance */
+  int in_band_updates_;
+  /*! Error of the last update */
+  double ratio_;
+  /*! Total exposure requested last */
+  double total_;
+};
+
+#endif /* _EXPOSURE_CONTROL_H_*/
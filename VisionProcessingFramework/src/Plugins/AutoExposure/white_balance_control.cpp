@@ -0,0 +1,97 @@
+/**
+ * @file      white_balance_control.cpp
+ * @brief     White balance control loop of AutoExposure plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./white_balance_control.h"
+#include <math.h>
+#include <algorithm>
+#include "./autoexposure_define.h"
+
+/* Lowest and highest gains*/
+#define kWhiteBalanceControlMinGain 0.25
+#define kWhiteBalanceControlMaxGain 8.0
+/* Fraction of the quads which must be neutral to update the gains*/
+#define kWhiteBalanceControlMinNeutral 0.05
+/* Relative error of the gains taken as settled*/
+#define kWhiteBalanceControlTolerance 0.02
+/* Relative change of the gains which is published*/
+#define kWhiteBalanceControlMinChange 0.005
+
+/**
+ * @brief
+ * Constructor.
+ */
+WhiteBalanceControl::WhiteBalanceControl(void) {
+  damping_ = kAutoExposureDefaultAwbDamping / 100.0;
+  is_started_ = false;
+  is_settled_ = false;
+  in_band_updates_ = 0;
+  red_ = 1.0;
+  blue_ = 1.0;
+  published_red_ = 1.0;
+  published_blue_ = 1.0;
+}
+
+/**
+ * @brief
+ * Start the loop.
+ * @param damping [in] fraction of the error corrected by an update (0..1].
+ */
+void WhiteBalanceControl::Start(double damping) {
+  damping_ = damping;
+  is_started_ = false;
+  is_settled_ = false;
+  in_band_updates_ = 0;
+}
+
+/**
+ * @brief
+ * Give the statistics of a frame.
+ * @param stats [in] statistics of the raw frame.
+ * @return If true, the gains changed enough to be published.
+ */
+bool WhiteBalanceControl::Update(const BayerStats& stats) {
+  if (stats.neutral_quads < stats.quads * kWhiteBalanceControlMinNeutral ||
+      stats.neutral_r <= 0 || stats.neutral_b <= 0 ||
+      stats.neutral_g <= 0) {
+    return false;
+  }
+  double target_red = std::max(
+      kWhiteBalanceControlMinGain,
+      std::min(kWhiteBalanceControlMaxGain, stats.neutral_g / stats.neutral_r));
+  double target_blue = std::max(
+      kWhiteBalanceControlMinGain,
+      std::min(kWhiteBalanceControlMaxGain, stats.neutral_g / stats.neutral_b));
+
+  double error_red = log(target_red / red_);
+  double error_blue = log(target_blue / blue_);
+  double band = log(1.0 + kWhiteBalanceControlTolerance);
+  if (fabs(error_red) <= band && fabs(error_blue) <= band) {
+    if (++in_band_updates_ >= kAutoExposureSettleUpdates) {
+      is_settled_ = true;
+    }
+  } else {
+    in_band_updates_ = 0;
+    is_settled_ = false;
+  }
+
+  // The first gains are published whatever they are: the gain plugin
+  // holds the manual ones until then.
+  bool is_first = !is_started_;
+  double damping = is_first ? 1.0 : damping_;
+  red_ *= exp(error_red * damping);
+  blue_ *= exp(error_blue * damping);
+  is_started_ = true;
+
+  if (!is_first &&
+      fabs(red_ / published_red_ - 1.0) < kWhiteBalanceControlMinChange &&
+      fabs(blue_ / published_blue_ - 1.0) < kWhiteBalanceControlMinChange) {
+    return false;
+  }
+  published_red_ = red_;
+  published_blue_ = blue_;
+  return true;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file      white_balance_control.h
+ * @brief     White balance control loop of AutoExposure plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _WHITE_BALANCE_CONTROL_H_
+#define _WHITE_BALANCE_CONTROL_H_
+
+#include "./bayer_stats.h"
+
+/**
+ * @class WhiteBalanceControl
+ * @brief Damped gray world white balance.
+ * The target gains bring the red and the blue averages of the quads neither
+ * dark nor clipped to the green one. The statistics must be those of the
+ * raw frame, before the white balance gains. The first update takes the
+ * target at once; the next ones correct the damping fraction of the error
+ * in the log domain, so the colors do not flicker with the content.
+ */
+class WhiteBalanceControl {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  WhiteBalanceControl(void);
+
+  /**
+   * @brief
+   * Start the loop.
+   * @param damping [in] fraction of the error corrected by an update (0..1].
+   */
+  void Start(double damping);
+
+  /**
+   * @brief
+   * Give the statistics of a frame.
+   * @param stats [in] statistics of the raw frame.
+   * @return If true, the gains changed enough to be published.
+   */
+  bool Update(const BayerStats& stats);
+
+  /**
+   * @brief
+   * Get the red gain.
+   * @return red gain.
+   */
+  float red(void) const { return static_cast<float>(red_); }
+
+  /**
+   * @brief
+   * Get the blue gain.
+   * @return blue gain.
+   */
+  float blue(void) const { return static_cast<float>(blue_); }
+
+  /**
+   * @brief
+   * Whether the gains stayed near the target for kAutoExposureSettleUpdates
+   * updates.
+   * @return If true, the loop is settled.
+   */
+  bool is_settled(void) const { return is_settled_; }
+
+ private:
+  /*! Fraction of the error corrected by an update */
+  double damping_;
+  /*! Whether the gains were set by an update */
+  bool is_started_;
+  /*! Whether the loop is settled */
+  bool is_settled_;
+  /*! Consecutive updates near the target */
+  int in_band_updates_;
+  /*! Red gain */
+  double red_;
+  /*! Blue gain */
+  double blue_;
+  /*! Red gain published last */
+  double published_red_;
+  /*! Blue gain published last */
+  double published_blue_;
+};
+
+#endif /* _WHITE_BALANCE_CONTROL_H_*/
@@ -0,0 +1,405 @@
+/**
+ * @file      autofocus.cpp
+ * @brief     AutoFocus plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./autofocus.h"
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "./frame_pyramid.h"
+#include "./sensor_link.h"
+
+/**
+ * @brief
+ * Constructor.
+ */
+AutoFocus::AutoFocus() : PluginBase() {
+  DEBUG_PRINT("AutoFocus::AutoFocus()\n");
+
+  set_plugin_name("AutoFocus");
+
+  AddInputPortCandidateSpec(kGRAY8);  /* Raw8*/
+  AddInputPortCandidateSpec(kGRAY16); /* Raw16*/
+  AddInputPortCandidateSpec(kBGR888); /* BGR888 */
+  AddInputPortCandidateSpec(kBGR48);  /* BGR48 */
+
+  set_is_use_dest_buffer(false);
+
+  common_ = NULL;
+  run_request_ = 0;
+  run_seen_ = 0;
+  is_searching_ = false;
+  is_start_pending_ = false;
+  is_format_error_ = false;
+  requested_code_ = kSensorLinkNone;
+  request_frame_ = 0;
+  effect_frame_ = 0;
+  has_effect_frame_ = false;
+  start_frame_ = 0;
+  timerclear(&start_time_);
+  memset(&report_, 0, sizeof(report_));
+  has_report_ = false;
+
+  // Initialize
+  wnd_ = new AutoFocusWnd(this);
+  settings_ = wnd_->settings();
+  wnd_->InitDialog();
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+AutoFocus::~AutoFocus() {
+  StopAsyncProcess(false);
+  delete wnd_;
+}
+
+/**
+ * @brief
+ * Initialize routine of the AutoFocus plugin.
+ * @param common [in] commom parameters.
+ * @return If true, successful initialization
+ */
+bool AutoFocus::InitProcess(CommonParam* common) {
+  DEBUG_PRINT("AutoFocus::InitProcess \n");
+  common_ = common;
+  wnd_->PostCaptureInit();
+
+  settings_ = wnd_->settings();
+  run_seen_ = run_request_;
+  is_searching_ = false;
+  is_start_pending_ = false;
+  is_format_error_ = false;
+  {
+    wxMutexLocker lock(report_mutex_);
+    has_report_ = false;
+  }
+  if (StartAsyncProcess(this, kAutoFocusMaxInFlight, kAsyncDropOldest) ==
+      false) {
+    PLUGIN_LOG_ERROR("Failed to start the focus thread");
+    return false;
+  }
+  if (settings_.is_at_start) {
+    Trigger();
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Finalize routine of the AutoFocus plugin.
+ * A search running is given up.
+ */
+void AutoFocus::EndProcess() {
+  DEBUG_PRINT("AutoFocus::EndProcess \n");
+  StopAsyncProcess(false);
+  if (is_searching_) {
+    PLUGIN_LOG_WARNING("Focus - stopped while searching");
+    is_searching_ = false;
+  }
+  LogReport();
+  wnd_->PostCaptureEnd();
+}
+
+/**
+ * @brief
+ * Post-processing routine of the AutoFocus plugin.
+ * This function is empty implementation.
+ */
+void AutoFocus::DoPostProcess(void) {}
+
+/**
+ * @brief
+ * Main routine of the AutoFocus plugin.
+ * Start the search requested, hand the ROI to the worker while the search
+ * runs, and log the result.
+ * @param src_image [in] src image data.
+ * @param dst_image [out] dst image data.
+ * @return If true, success in the main processing
+ */
+bool AutoFocus::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
+  if (src_image == NULL) {
+    DEBUG_PRINT("[AutoFocus]src_image == NULL\n");
+    return false;
+  }
+  LogReport();
+
+  // A request during a search is taken by that search.
+  unsigned int request = run_request_;
+  if (request != run_seen_) {
+    run_seen_ = request;
+    if (!is_searching_) {
+      if (SensorLink::Instance()->is_attached() == false) {
+        PLUGIN_LOG_WARNING("Focus - no sensor takes the lens codes");
+      } else {
+        is_start_pending_ = true;
+        is_searching_ = true;
+      }
+    }
+  }
+  if (!is_searching_) {
+    return true;
+  }
+
+  // The smallest level which keeps the metric width; the level is shared
+  // with the other outputs of the branch.
+  cv::Size frame_size = src_image->size();
+  int width = std::min(settings_.metric_width, frame_size.width);
+  cv::Size metric_size(width, std::max(1, frame_size.height * width /
+                                              std::max(1, frame_size.width)));
+  int level = FramePyramid::LevelFor(frame_size, metric_size);
+  const cv::Mat* gray =
+      GetDerivedLevel(src_image, kFrameDerivedGray8U, level);
+  if (gray == NULL) {
+    if (!is_format_error_) {
+      PLUGIN_LOG_ERROR("Focus - the frame format is not supported");
+      is_format_error_ = true;
+    }
+    is_searching_ = false;
+    return false;
+  }
+  FrameMetadata* metadata = frame_metadata();
+  cv::Rect roi = GetRoi(frame_size, gray->size(), metadata);
+  SubmitAsyncFrame((*gray)(roi));
+  return true;
+}
+
+/**
+ * @brief
+ * Asynchronous routine of the AutoFocus plugin.
+ * Measure the sharpness of the ROI and move the lens to the next code.
+ * @param image [in] ROI of the gray frame owned by the worker.
+ * @param metadata [in] metadata of the frame owned by the worker.
+ * @return If true, the frame is measured.
+ */
+bool AutoFocus::DoAsyncProcess(cv::Mat* image, FrameMetadata* metadata) {
+  unsigned int frame_number = metadata->frame_number;
+  if (is_start_pending_) {
+    is_start_pending_ = false;
+    // The climb starts where the lens is.
+    int start_code = metadata->focus;
+    if (start_code == kFrameMetadataUnknown) {
+      start_code = (requested_code_ != kSensorLinkNone)
+                       ? requested_code_
+                       : (settings_.min_code + settings_.max_code) / 2;
+    }
+    search_.Start(settings_.min_code, settings_.max_code,
+                  settings_.coarse_step, start_code);
+    start_frame_ = frame_number;
+    gettimeofday(&start_time_, NULL);
+    RequestCode(search_.code(), frame_number);
+    return false;
+  }
+  if (!is_searching_) {
+    return false;
+  }
+  if (frame_number - start_frame_ > kAutoFocusMaxFrames) {
+    FinishSearch(false, frame_number);
+    return false;
+  }
+
+  // Only the frames exposed with the lens settled at the code are measured.
+  // Without the code in the metadata, the control delay is assumed.
+  if (metadata->focus == kFrameMetadataUnknown) {
+    if (frame_number - request_frame_ <
+        static_cast<unsigned int>(kAutoFocusDelayFrames +
+                                  settings_.settle_frames)) {
+      return false;
+    }
+  } else {
+    if (metadata->focus != requested_code_) {
+      return false;
+    }
+    if (!has_effect_frame_) {
+      has_effect_frame_ = true;
+      effect_frame_ = frame_number;
+    }
+    if (frame_number - effect_frame_ <
+        static_cast<unsigned int>(settings_.settle_frames)) {
+      return false;
+    }
+  }
+
+  double sharpness = FocusMetricCompute(*image, settings_.metric);
+  if (sharpness < 0) {
+    FinishSearch(false, frame_number);
+    return false;
+  }
+  DEBUG_PRINT("[AutoFocus] frame:%u code:%d sharpness:%.2f\n", frame_number,
+              requested_code_, sharpness);
+  bool is_done = search_.Update(sharpness);
+  RequestCode(search_.code(), frame_number);
+  if (is_done) {
+    FinishSearch(true, frame_number);
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * The requests and the results are handled on every frame, so the
+ * framework never skips this plugin. The worker drops frames by itself.
+ * @return true.
+ */
+bool AutoFocus::CanAcceptAsyncFrame(void) { return true; }
+
+/**
+ * @brief
+ * Request a search (any thread).
+ * The search starts with the next frame.
+ */
+void AutoFocus::Trigger(void) { __sync_add_and_fetch(&run_request_, 1); }
+
+/**
+ * @brief
+ * Get the ROI measured in a pyramid level.
+ * @param frame_size [in] size of the frame.
+ * @param level_size [in] size of the level.
+ * @param metadata [in] metadata of the frame (can be NULL).
+ * @return ROI in the level.
+ */
+cv::Rect AutoFocus::GetRoi(const cv::Size& frame_size,
+                           const cv::Size& level_size,
+                           const FrameMetadata* metadata) {
+  double scale_x = static_cast<double>(level_size.width) / frame_size.width;
+  double scale_y = static_cast<double>(level_size.height) / frame_size.height;
+  cv::Rect roi;
+  if (metadata != NULL && metadata->has_onepush_rect) {
+    // The one-push rectangle has the start and the end coordinates.
+    const CvRect& rect = metadata->onepush_rect;
+    roi.x = cvRound(rect.x * scale_x);
+    roi.y = cvRound(rect.y * scale_y);
+    roi.width = cvRound(rect.width * scale_x) - roi.x;
+    roi.height = cvRound(rect.height * scale_y) - roi.y;
+  } else {
+    roi.width = level_size.width * settings_.roi_percent / 100;
+    roi.height = level_size.height * settings_.roi_percent / 100;
+    roi.x = (level_size.width - roi.width) / 2;
+    roi.y = (level_size.height - roi.height) / 2;
+  }
+  roi &= cv::Rect(0, 0, level_size.width, level_size.height);
+  // The metric needs 3x3 pixels.
+  if (roi.width < 3 || roi.height < 3) {
+    roi = cv::Rect(0, 0, level_size.width, level_size.height);
+  }
+  return roi;
+}
+
+/**
+ * @brief
+ * Request a lens code (worker thread).
+ * @param code [in] lens code.
+ * @param frame_number [in] number of the frame being processed.
+ */
+void AutoFocus::RequestCode(int code, unsigned int frame_number) {
+  if (code != requested_code_) {
+    SensorLinkRequest request;
+    SensorLinkRequestClear(&request);
+    request.focus = code;
+    if (SensorLink::Instance()->Submit(request) == false) {
+      DEBUG_PRINT("[AutoFocus] lens code %d dropped\n", code);
+    }
+  }
+  requested_code_ = code;
+  request_frame_ = frame_number;
+  has_effect_frame_ = false;
+}
+
+/**
+ * @brief
+ * End the search and keep the result (worker thread).
+ * @param is_converged [in] If true, the search converged.
+ * @param frame_number [in] number of the frame being processed.
+ */
+void AutoFocus::FinishSearch(bool is_converged, unsigned int frame_number) {
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  {
+    wxMutexLocker lock(report_mutex_);
+    report_.is_converged = is_converged;
+    report_.code = search_.code();
+    report_.sharpness = search_.best_sharpness();
+    report_.frames = frame_number - start_frame_;
+    report_.msec = (now.tv_sec - start_time_.tv_sec) * 1000.0 +
+                   (now.tv_usec - start_time_.tv_usec) / 1000.0;
+    report_.measurements = search_.measurements();
+    has_report_ = true;
+  }
+  is_searching_ = false;
+}
+
+/**
+ * @brief
+ * Log the result of the last search.
+ */
+void AutoFocus::LogReport(void) {
+  AutoFocusReport report;
+  {
+    wxMutexLocker lock(report_mutex_);
+    if (!has_report_) {
+      return;
+    }
+    report = report_;
+    has_report_ = false;
+  }
+  if (report.is_converged) {
+    PLUGIN_LOG_MESSAGE(
+        "Focus - code:%d %s:%.1f frames:%u time:%.1fms measured:%d",
+        report.code, FocusMetricName(settings_.metric), report.sharpness,
+        report.frames, report.msec, report.measurements);
+  } else {
+    PLUGIN_LOG_WARNING("Focus - not converged, frames:%u time:%.1fms",
+                       report.frames, report.msec);
+  }
+}
+
+/**
+ * @brief
+ * Open setting window of the AutoFocus plugin.
+ * @param state [in] ImageProcessingState
+ */
+void AutoFocus::OpenSettingWindow(ImageProcessingState state) {
+  if (wnd_ == NULL) {
+    DEBUG_PRINT("wnd_ == NULL\n");
+    return;
+  }
+  wxString window_title(plugin_name().c_str(), wxConvUTF8);
+  wnd_->SetTitle(window_title);
+  wnd_->InitDialog();
+  wnd_->Show(true);
+  wnd_->Raise();
+}
+
+/**
+ * @brief
+ * Close setting window of the AutoFocus plugin.
+ * @return If true, success close window
+ */
+bool AutoFocus::CloseSettingWindow() {
+  if (wnd_ == NULL) {
+    return false;
+  }
+  wnd_->Show(false);
+  return true;
+}
+
+/**
+ * @brief
+ * Set the list of parameter setting string for the AutoFocus plugin.
+ * @param params [in] settings string.
+ */
+void AutoFocus::SetPluginSettings(std::vector<wxString> params) {
+  wnd_->SetPluginSettings(params);
+}
+
+extern "C" PluginBase* Create(void) {
+  DEBUG_PRINT("Create AutoFocus plugins\n");
+  AutoFocus* plugin = new AutoFocus();
+  return plugin;
+}
+
+extern "C" void Destroy(PluginBase* plugin) { delete plugin; }
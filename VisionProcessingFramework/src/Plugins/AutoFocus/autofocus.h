@@ -0,0 +1,221 @@
+/**
+ * @file      autofocus.h
+ * @brief     AutoFocus plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _AUTOFOCUS_H_
+#define _AUTOFOCUS_H_
+
+#include <sys/time.h>
+#include <vector>
+#include "./async_frame_worker.h"
+#include "./autofocus_define.h"
+#include "./autofocus_wnd.h"
+#include "./common_param.h"
+#include "./focus_metric.h"
+#include "./focus_search.h"
+#include "./plugin_base.h"
+
+/**
+ * @struct AutoFocusReport
+ * @brief Result of a search.
+ */
+typedef struct {
+  /*! Whether the search converged */
+  bool is_converged;
+  /*! Best lens code */
+  int code;
+  /*! Sharpness at the best code */
+  double sharpness;
+  /*! Frames from the start to the request of the best code */
+  unsigned int frames;
+  /*! Time from the start to the request of the best code in msec */
+  double msec;
+  /*! Number of the frames measured */
+  int measurements;
+} AutoFocusReport;
+
+/**
+ * @class AutoFocus
+ * @brief Contrast autofocus: move the lens to the sharpest position.
+ * The plugin is placed on a branch of the flow. While a search runs, the
+ * ROI of a low resolution pyramid level of the gray frame (shared with the
+ * other outputs of the branch) is handed to a worker thread, which
+ * measures the sharpness and drives the search. The lens codes take the
+ * asynchronous register path of the sensor (SensorLink), so neither the
+ * branch nor the worker waits for the bus. A frame is measured only once
+ * the lens code in its metadata is the one requested and the lens settled.
+ * The ROI is the one-push rectangle if set, otherwise the center.
+ */
+class AutoFocus : public PluginBase, public AsyncFrameHandler {
+ private:
+  /*! Parameter setting window.*/
+  AutoFocusWnd* wnd_;
+  /*! Common parameter */
+  CommonParam* common_;
+  /*! Settings of the capture */
+  AutoFocusSettings settings_;
+  /*! Searches requested by Trigger() */
+  volatile unsigned int run_request_;
+  /*! Searches requested at the last poll */
+  unsigned int run_seen_;
+  /*! Whether a search runs (cleared by the worker) */
+  volatile bool is_searching_;
+  /*! Whether the worker starts the search with the next frame */
+  volatile bool is_start_pending_;
+  /*! Whether the frame format is not supported */
+  bool is_format_error_;
+
+  /*! Search (worker thread only) */
+  FocusSearch search_;
+  /*! Lens code requested last (worker thread only, kSensorLinkNone: none) */
+  int requested_code_;
+  /*! Frame number when the code was requested (worker thread only) */
+  unsigned int request_frame_;
+  /*! Frame number of the first frame with the code in effect (worker
+      thread only) */
+  unsigned int effect_frame_;
+  /*! Whether a frame with the code in effect was seen (worker thread
+      only) */
+  bool has_effect_frame_;
+  /*! Frame number at the start of the search (worker thread only) */
+  unsigned int start_frame_;
+  /*! Time at the start of the search (worker thread only) */
+  struct timeval start_time_;
+
+  /*! Result of the last search */
+  AutoFocusReport report_;
+  /*! Whether the result is not logged yet */
+  bool has_report_;
+  /*! Lock for the result */
+  wxMutex report_mutex_;
+
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  AutoFocus(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~AutoFocus(void);
+
+  /**
+   * @brief
+   * Initialize routine of the AutoFocus plugin.
+   * @param common [in] commom parameters.
+   * @return If true, successful initialization
+   */
+  virtual bool InitProcess(CommonParam* common);
+
+  /**
+   * @brief
+   * Finalize routine of the AutoFocus plugin.
+   * A search running is given up.
+   */
+  virtual void EndProcess(void);
+
+  /**
+   * @brief
+   * Post-processing routine of the AutoFocus plugin.
+   * This function is empty implementation.
+   */
+  virtual void DoPostProcess(void);
+
+  /**
+   * @brief
+   * Main routine of the AutoFocus plugin.
+   * Start the search requested, hand the ROI to the worker while the search
+   * runs, and log the result.
+   * @param src_image [in] src image data.
+   * @param dst_image [out] dst image data.
+   * @return If true, success in the main processing
+   */
+  virtual bool DoProcess(cv::Mat* src_image, cv::Mat* dst_image);
+
+  /**
+   * @brief
+   * Asynchronous routine of the AutoFocus plugin.
+   * Measure the sharpness of the ROI and move the lens to the next code.
+   * @param image [in] ROI of the gray frame owned by the worker.
+   * @param metadata [in] metadata of the frame owned by the worker.
+   * @return If true, the frame is measured.
+   */
+  virtual bool DoAsyncProcess(cv::Mat* image, FrameMetadata* metadata);
+
+  /**
+   * @brief
+   * The requests and the results are handled on every frame, so the
+   * framework never skips this plugin. The worker drops frames by itself.
+   * @return true.
+   */
+  virtual bool CanAcceptAsyncFrame(void);
+
+  /**
+   * @brief
+   * Request a search (any thread).
+   * The search starts with the next frame.
+   */
+  void Trigger(void);
+
+  /**
+   * @brief
+   * Open setting window of the AutoFocus plugin.
+   * @param state [in] ImageProcessingState
+   */
+  virtual void OpenSettingWindow(ImageProcessingState state);
+
+  /**
+   * @brief
+   * Close setting window of the AutoFocus plugin.
+   * @return If true, success close window
+   */
+  virtual bool CloseSettingWindow(void);
+
+  /**
+   * @brief
+   * Set the list of parameter setting string for the AutoFocus plugin.
+   * @param params [in] settings string.
+   */
+  virtual void SetPluginSettings(std::vector<wxString> params);
+
+ private:
+  /**
+   * @brief
+   * Get the ROI measured in a pyramid level.
+   * @param frame_size [in] size of the frame.
+   * @param level_size [in] size of the level.
+   * @param metadata [in] metadata of the frame (can be NULL).
+   * @return ROI in the level.
+   */
+  cv::Rect GetRoi(const cv::Size& frame_size, const cv::Size& level_size,
+                  const FrameMetadata* metadata);
+
+  /**
+   * @brief
+   * Request a lens code (worker thread).
+   * @param code [in] lens code.
+   * @param frame_number [in] number of the frame being processed.
+   */
+  void RequestCode(int code, unsigned int frame_number);
+
+  /**
+   * @brief
+   * End the search and keep the result (worker thread).
+   * @param is_converged [in] If true, the search converged.
+   * @param frame_number [in] number of the frame being processed.
+   */
+  void FinishSearch(bool is_converged, unsigned int frame_number);
+
+  /**
+   * @brief
+   * Log the result of the last search.
+   */
+  void LogReport(void);
+};
+#endif /* _AUTOFOCUS_H_*/
@@ -0,0 +1,101 @@
+/**
+ * @file      autofocus_define.h
+ * @brief     Definition of values for AutoFocus plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _AUTOFOCUS_DEFINE_H_
+#define _AUTOFOCUS_DEFINE_H_
+
+/* Identification ID of UI.*/
+#define kAutoFocusWndId                    91000
+#define kRadioAutoFocusMetricId            91001
+#define kTextCtrlAutoFocusRoiId            91002
+#define kTextCtrlAutoFocusWidthId          91003
+#define kTextCtrlAutoFocusMinId            91004
+#define kTextCtrlAutoFocusMaxId            91005
+#define kTextCtrlAutoFocusStepId           91006
+#define kTextCtrlAutoFocusSettleId         91007
+#define kCheckBoxAutoFocusAtStartId        91008
+#define kButtonAutoFocusRunId              91009
+#define kButtonAutoFocusApplyId            91010
+
+/* Main window definition*/
+#define kAutoFocusWndTitle "Auto focus"
+#define kAutoFocusWndPointX 0
+#define kAutoFocusWndPointY 0
+#define kAutoFocusWndSizeW 320
+#define kAutoFocusWndSizeH 440
+
+/* Metric radio box definition*/
+#define kRadioAutoFocusMetricName "Focus metric"
+#define kRadioAutoFocusMetricPointX 10
+#define kRadioAutoFocusMetricPointY 10
+#define kRadioAutoFocusMetricSizeW 290
+#define kRadioAutoFocusMetricSizeH 70
+
+/* Window settings definition (label x, value x, first y, line height)*/
+#define kStaticTextAutoFocusRoiName "ROI (% of the frame)"
+#define kStaticTextAutoFocusWidthName "Metric width (pixels)"
+#define kStaticTextAutoFocusMinName "Lens code min"
+#define kStaticTextAutoFocusMaxName "Lens code max"
+#define kStaticTextAutoFocusStepName "Coarse step"
+#define kStaticTextAutoFocusSettleName "Settle frames"
+#define kCheckBoxAutoFocusAtStartName "Focus at the start of the capture"
+#define kAutoFocusSettingsLabelPointX 10
+#define kAutoFocusSettingsValuePointX 200
+#define kAutoFocusSettingsPointY 95
+#define kAutoFocusSettingsLineH 35
+#define kAutoFocusSettingsLabelSizeW 180
+#define kAutoFocusSettingsValueSizeW 100
+#define kAutoFocusSettingsSizeH 25
+
+/* Run button definition*/
+#define kButtonAutoFocusRunName "Focus"
+#define kButtonAutoFocusRunPointX 10
+#define kButtonAutoFocusRunPointY 355
+#define kButtonAutoFocusRunSizeW 100
+#define kButtonAutoFocusRunSizeH 35
+
+/* Apply button definition*/
+#define kButtonAutoFocusApplyName "Apply"
+#define kButtonAutoFocusApplyPointX 220
+#define kButtonAutoFocusApplyPointY 355
+#define kButtonAutoFocusApplySizeW 80
+#define kButtonAutoFocusApplySizeH 35
+
+/* Settings (lines of the ini file and of the flow settings)*/
+#define kAutoFocusSettingsMetricIndex 0
+#define kAutoFocusSettingsRoiIndex 1
+#define kAutoFocusSettingsWidthIndex 2
+#define kAutoFocusSettingsMinIndex 3
+#define kAutoFocusSettingsMaxIndex 4
+#define kAutoFocusSettingsStepIndex 5
+#define kAutoFocusSettingsSettleIndex 6
+#define kAutoFocusSettingsAtStartIndex 7
+#define kAutoFocusSettingsNum 8
+#define kAutoFocusConfigFile "../lib/Plugins/output/AutoFocus.ini"
+
+/* Default settings*/
+#define kAutoFocusDefaultRoiPercent 30
+#define kAutoFocusDefaultWidth 320
+#define kAutoFocusDefaultMin 0
+#define kAutoFocusDefaultMax 0x03FF
+#define kAutoFocusDefaultStep 64
+#define kAutoFocusDefaultSettleFrames 1
+
+/* Search*/
+/* Interval where the golden section search stops (lens code)*/
+#define kAutoFocusFineStep 4
+/* Coarse steps past the peak before the peak is bracketed*/
+#define kAutoFocusMaxDrops 2
+/* Frames between a request and the first frame exposed with it, when the
+   input does not report the lens code in effect*/
+#define kAutoFocusDelayFrames 2
+/* A search which takes longer is given up*/
+#define kAutoFocusMaxFrames 300
+/* Frames in flight on the worker (a newer frame replaces the queued one)*/
+#define kAutoFocusMaxInFlight 2
+
+#endif /* _AUTOFOCUS_DEFINE_H_*/
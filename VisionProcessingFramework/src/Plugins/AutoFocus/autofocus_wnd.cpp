@@ -0,0 +1,396 @@
+/**
+ * @file      autofocus_wnd.cpp
+ * @brief     Setting window of AutoFocus plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./autofocus_wnd.h"
+#include <vector>
+#include "./../../logger.h"
+#include "./autofocus.h"
+
+BEGIN_DECLARE_EVENT_TYPES()
+DECLARE_LOCAL_EVENT_TYPE(CAPTURE_INITIALIZE, wxNewEventType())
+DECLARE_LOCAL_EVENT_TYPE(CAPTURE_END, wxNewEventType())
+END_DECLARE_EVENT_TYPES()
+DEFINE_LOCAL_EVENT_TYPE(CAPTURE_INITIALIZE)
+DEFINE_LOCAL_EVENT_TYPE(CAPTURE_END)
+BEGIN_EVENT_TABLE(AutoFocusWnd, wxFrame)
+EVT_CLOSE(AutoFocusWnd::OnClose)
+EVT_COMMAND(wxID_ANY, CAPTURE_INITIALIZE, AutoFocusWnd::OnCaptureInit)
+EVT_COMMAND(wxID_ANY, CAPTURE_END, AutoFocusWnd::OnCaptureEnd)
+EVT_BUTTON(kButtonAutoFocusRunId, AutoFocusWnd::OnRun)
+EVT_BUTTON(kButtonAutoFocusApplyId, AutoFocusWnd::OnApply)
+END_EVENT_TABLE()
+
+/**
+ * @brief
+ * Create a label and a text control on a line of the settings.
+ * @param parent [in] window.
+ * @param id [in] id of the text control.
+ * @param label [in] label.
+ * @param y [in] position of the line.
+ * @param static_text [out] label control.
+ * @param text_ctrl [out] text control.
+ */
+static void CreateSettingLine(wxWindow *parent, int id, const wxString &label,
+                              int y, wxStaticText **static_text,
+                              wxTextCtrl **text_ctrl) {
+  *static_text = new wxStaticText(
+      parent, wxID_ANY, label, wxPoint(kAutoFocusSettingsLabelPointX, y),
+      wxSize(kAutoFocusSettingsLabelSizeW, kAutoFocusSettingsSizeH));
+  *text_ctrl = new wxTextCtrl(
+      parent, id, wxT(""), wxPoint(kAutoFocusSettingsValuePointX, y),
+      wxSize(kAutoFocusSettingsValueSizeW, kAutoFocusSettingsSizeH));
+}
+
+/**
+ * @brief
+ * Constructor for this window.
+ * @param auto_focus [in] Pointer to the AutoFocus class
+ */
+AutoFocusWnd::AutoFocusWnd(AutoFocus *auto_focus)
+    : wxFrame(NULL, kAutoFocusWndId, wxT(kAutoFocusWndTitle),
+              wxPoint(kAutoFocusWndPointX, kAutoFocusWndPointY),
+              wxSize(kAutoFocusWndSizeW, kAutoFocusWndSizeH)) {
+  auto_focus_ = auto_focus;
+  settings_.metric = kFocusMetricTenengrad;
+  settings_.roi_percent = kAutoFocusDefaultRoiPercent;
+  settings_.metric_width = kAutoFocusDefaultWidth;
+  settings_.min_code = kAutoFocusDefaultMin;
+  settings_.max_code = kAutoFocusDefaultMax;
+  settings_.coarse_step = kAutoFocusDefaultStep;
+  settings_.settle_frames = kAutoFocusDefaultSettleFrames;
+  settings_.is_at_start = false;
+
+  // Create the metric radio box
+  wxString metric_tbl[kFocusMetricNum];
+  for (int i = 0; i < kFocusMetricNum; i++) {
+    metric_tbl[i] = wxString(
+        FocusMetricName(static_cast<FocusMetricType>(i)), wxConvUTF8);
+  }
+  radio_box_metric_ = new wxRadioBox(
+      this, kRadioAutoFocusMetricId, wxT(kRadioAutoFocusMetricName),
+      wxPoint(kRadioAutoFocusMetricPointX, kRadioAutoFocusMetricPointY),
+      wxSize(kRadioAutoFocusMetricSizeW, kRadioAutoFocusMetricSizeH),
+      kFocusMetricNum, metric_tbl, 0, wxRA_SPECIFY_ROWS);
+
+  // Create the ROI and the search controls
+  int y = kAutoFocusSettingsPointY;
+  CreateSettingLine(this, kTextCtrlAutoFocusRoiId,
+                    wxT(kStaticTextAutoFocusRoiName), y, &static_text_roi_,
+                    &text_ctrl_roi_);
+  y += kAutoFocusSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoFocusWidthId,
+                    wxT(kStaticTextAutoFocusWidthName), y,
+                    &static_text_width_, &text_ctrl_width_);
+  y += kAutoFocusSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoFocusMinId,
+                    wxT(kStaticTextAutoFocusMinName), y, &static_text_min_,
+                    &text_ctrl_min_);
+  y += kAutoFocusSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoFocusMaxId,
+                    wxT(kStaticTextAutoFocusMaxName), y, &static_text_max_,
+                    &text_ctrl_max_);
+  y += kAutoFocusSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoFocusStepId,
+                    wxT(kStaticTextAutoFocusStepName), y, &static_text_step_,
+                    &text_ctrl_step_);
+  y += kAutoFocusSettingsLineH;
+  CreateSettingLine(this, kTextCtrlAutoFocusSettleId,
+                    wxT(kStaticTextAutoFocusSettleName), y,
+                    &static_text_settle_, &text_ctrl_settle_);
+  y += kAutoFocusSettingsLineH;
+  check_box_at_start_ = new wxCheckBox(
+      this, kCheckBoxAutoFocusAtStartId, wxT(kCheckBoxAutoFocusAtStartName),
+      wxPoint(kAutoFocusSettingsLabelPointX, y),
+      wxSize(kAutoFocusSettingsLabelSizeW + kAutoFocusSettingsValueSizeW,
+             kAutoFocusSettingsSizeH));
+
+  // Create the run and the apply buttons
+  button_run_ = new wxButton(
+      this, kButtonAutoFocusRunId, wxT(kButtonAutoFocusRunName),
+      wxPoint(kButtonAutoFocusRunPointX, kButtonAutoFocusRunPointY),
+      wxSize(kButtonAutoFocusRunSizeW, kButtonAutoFocusRunSizeH));
+  button_run_->Enable(false);
+  button_apply_ = new wxButton(
+      this, kButtonAutoFocusApplyId, wxT(kButtonAutoFocusApplyName),
+      wxPoint(kButtonAutoFocusApplyPointX, kButtonAutoFocusApplyPointY),
+      wxSize(kButtonAutoFocusApplySizeW, kButtonAutoFocusApplySizeH));
+
+  LoadSettingsFromFile(wxT(kAutoFocusConfigFile));
+  UpdateControls();
+}
+
+/**
+ * @brief
+ * Destructor for this window.
+ */
+AutoFocusWnd::~AutoFocusWnd() {}
+
+/**
+ * @brief
+ * The handler function for EVT_CLOSE.
+ */
+void AutoFocusWnd::OnClose(wxCloseEvent &event) { Show(false); }
+
+/**
+ * @brief
+ * Post local event(CAPTURE_INITIALIZE) for initialize the screen settings on
+ * own thread.
+ */
+void AutoFocusWnd::PostCaptureInit(void) {
+  DEBUG_PRINT("AutoFocusWnd::PostCaptureInit\n");
+  wxCommandEvent event(CAPTURE_INITIALIZE);
+  event.SetString(wxT("This is the init"));
+  wxPostEvent(this, event);
+}
+
+/**
+ * @brief
+ * Post local event(CAPTURE_END) for destroy the screen on own thread.
+ */
+void AutoFocusWnd::PostCaptureEnd(void) {
+  DEBUG_PRINT("AutoFocusWnd::PostCaptureEnd\n");
+  wxCommandEvent event(CAPTURE_END);
+  event.SetString(wxT("This is the end"));
+  wxPostEvent(this, event);
+}
+
+/**
+ * @brief
+ * The handler function for local event(CAPTURE_INITIALIZE).
+ * Disable the settings taken at the start.
+ */
+void AutoFocusWnd::OnCaptureInit(wxCommandEvent &event) {
+  EnableSettings(false);
+  button_run_->Enable(true);
+}
+
+/**
+ * @brief
+ * The handler function for local event(CAPTURE_END).
+ * Enable the settings.
+ */
+void AutoFocusWnd::OnCaptureEnd(wxCommandEvent &event) {
+  EnableSettings(true);
+  button_run_->Enable(false);
+}
+
+/**
+ * @brief
+ * Enable or disable the settings taken at the start.
+ * @param enable [in] If true, the settings are enabled.
+ */
+void AutoFocusWnd::EnableSettings(bool enable) {
+  radio_box_metric_->Enable(enable);
+  text_ctrl_roi_->Enable(enable);
+  text_ctrl_width_->Enable(enable);
+  text_ctrl_min_->Enable(enable);
+  text_ctrl_max_->Enable(enable);
+  text_ctrl_step_->Enable(enable);
+  text_ctrl_settle_->Enable(enable);
+  check_box_at_start_->Enable(enable);
+  button_apply_->Enable(enable);
+}
+
+/**
+ * @brief
+ * The handler function for kButtonAutoFocusRunId.
+ * Start a search.
+ */
+void AutoFocusWnd::OnRun(wxCommandEvent &event) { auto_focus_->Trigger(); }
+
+/**
+ * @brief
+ * The handler function for kButtonAutoFocusApplyId.
+ * Reflect the settings, which are used from the next capture.
+ */
+void AutoFocusWnd::OnApply(wxCommandEvent &event) {
+  DEBUG_PRINT("AutoFocusWnd::OnApply\n");
+  std::vector<wxString> lines(kAutoFocusSettingsNum);
+  lines[kAutoFocusSettingsMetricIndex] << radio_box_metric_->GetSelection();
+  lines[kAutoFocusSettingsRoiIndex] = text_ctrl_roi_->GetValue();
+  lines[kAutoFocusSettingsWidthIndex] = text_ctrl_width_->GetValue();
+  lines[kAutoFocusSettingsMinIndex] = text_ctrl_min_->GetValue();
+  lines[kAutoFocusSettingsMaxIndex] = text_ctrl_max_->GetValue();
+  lines[kAutoFocusSettingsStepIndex] = text_ctrl_step_->GetValue();
+  lines[kAutoFocusSettingsSettleIndex] = text_ctrl_settle_->GetValue();
+  lines[kAutoFocusSettingsAtStartIndex] =
+      check_box_at_start_->GetValue() ? wxT("1") : wxT("0");
+  SetSettings(lines);
+  UpdateControls();
+  WriteSettingsToFile(wxT(kAutoFocusConfigFile));
+  this->Show(false);
+}
+
+/**
+ * @brief
+ * Show the settings in the controls.
+ */
+void AutoFocusWnd::UpdateControls(void) {
+  radio_box_metric_->SetSelection(settings_.metric);
+  text_ctrl_roi_->SetValue(wxString::Format(wxT("%d"), settings_.roi_percent));
+  text_ctrl_width_->SetValue(
+      wxString::Format(wxT("%d"), settings_.metric_width));
+  text_ctrl_min_->SetValue(wxString::Format(wxT("%d"), settings_.min_code));
+  text_ctrl_max_->SetValue(wxString::Format(wxT("%d"), settings_.max_code));
+  text_ctrl_step_->SetValue(
+      wxString::Format(wxT("%d"), settings_.coarse_step));
+  text_ctrl_settle_->SetValue(
+      wxString::Format(wxT("%d"), settings_.settle_frames));
+  check_box_at_start_->SetValue(settings_.is_at_start);
+}
+
+/**
+ * @brief
+ * Set the settings from a list of strings (lines of the settings file).
+ * Invalid values keep the current settings.
+ * @param lines [in] settings string.
+ */
+void AutoFocusWnd::SetSettings(const std::vector<wxString> &lines) {
+  long value;  // NOLINT
+  if (lines.size() > kAutoFocusSettingsMetricIndex &&
+      lines[kAutoFocusSettingsMetricIndex].ToLong(&value) && value >= 0 &&
+      value < kFocusMetricNum) {
+    settings_.metric = static_cast<FocusMetricType>(value);
+  }
+  if (lines.size() > kAutoFocusSettingsRoiIndex &&
+      lines[kAutoFocusSettingsRoiIndex].ToLong(&value) && value > 0 &&
+      value <= 100) {
+    settings_.roi_percent = static_cast<int>(value);
+  }
+  if (lines.size() > kAutoFocusSettingsWidthIndex &&
+      lines[kAutoFocusSettingsWidthIndex].ToLong(&value) && value > 0) {
+    settings_.metric_width = static_cast<int>(value);
+  }
+  if (lines.size() > kAutoFocusSettingsMinIndex &&
+      lines[kAutoFocusSettingsMinIndex].ToLong(&value) && value >= 0 &&
+      value <= kAutoFocusDefaultMax) {
+    settings_.min_code = static_cast<int>(value);
+  }
+  if (lines.size() > kAutoFocusSettingsMaxIndex &&
+      lines[kAutoFocusSettingsMaxIndex].ToLong(&value) && value >= 0 &&
+      value <= kAutoFocusDefaultMax) {
+    settings_.max_code = static_cast<int>(value);
+  }
+  if (settings_.max_code < settings_.min_code) {
+    settings_.max_code = settings_.min_code;
+  }
+  if (lines.size() > kAutoFocusSettingsStepIndex &&
+      lines[kAutoFocusSettingsStepIndex].ToLong(&value) && value > 0) {
+    settings_.coarse_step = static_cast<int>(value);
+  }
+  if (lines.size() > kAutoFocusSettingsSettleIndex &&
+      lines[kAutoFocusSettingsSettleIndex].ToLong(&value) && value >= 0) {
+    settings_.settle_frames = static_cast<int>(value);
+  }
+  if (lines.size() > kAutoFocusSettingsAtStartIndex &&
+      lines[kAutoFocusSettingsAtStartIndex].ToLong(&value)) {
+    settings_.is_at_start = (value != 0);
+  }
+}
+
+/**
+ * @brief
+ * Set the list of parameter setting string for the AutoFocus plugin.
+ * @param params [in] settings string.
+ */
+void AutoFocusWnd::SetPluginSettings(std::vector<wxString> params) {
+  SetSettings(params);
+  UpdateControls();
+  WriteSettingsToFile(wxT(kAutoFocusConfigFile));
+}
+
+/**
+ * @brief
+ * Load the parameters from the file.
+ * @param file_path [in] file path.
+ * @return If true, reading the file success
+ */
+bool AutoFocusWnd::LoadSettingsFromFile(wxString file_path) {
+  wxTextFile text_file;
+  bool ret = false;
+
+  ret = wxFile::Exists(file_path);
+  if (ret == true) {
+    ret = text_file.Open(file_path);
+    if (ret == false) {
+      DEBUG_PRINT("Could not open file =%s\n",
+                  (const char *)file_path.mb_str());
+      return false;
+    }
+  } else {
+    DEBUG_PRINT("File does not exist =%s\n", (const char *)file_path.mb_str());
+    return false;
+  }
+
+  ret = text_file.Eof();
+  if (ret == true) {
+    DEBUG_PRINT("Blank init file\n");
+    text_file.Close();
+    return false;
+  }
+  std::vector<wxString> lines;
+  lines.push_back(text_file.GetFirstLine());
+  while (text_file.Eof() == false) {
+    lines.push_back(text_file.GetNextLine());
+  }
+  SetSettings(lines);
+  text_file.Close();
+  return true;
+}
+
+/**
+ * @brief
+ * Write the parameters to the file.
+ * @param file_path [in] file path.
+ * @return If true, writing the file success
+ */
+bool AutoFocusWnd::WriteSettingsToFile(wxString file_path) {
+  wxTextFile text_file;
+  bool ret = false;
+
+  ret = wxFile::Exists(file_path);
+  if (ret == true) {
+    ret = text_file.Open(file_path);
+    if (ret == false) {
+      ret = text_file.Create(file_path);
+      if (ret == false) {
+        LOG_ERROR("[plugin:AutoFocus] Fail to create file = %s\n",
+                  (const char *)file_path.mb_str());
+        return false;
+      }
+    }
+  } else {
+    ret = text_file.Create(file_path);
+    if (ret == false) {
+      LOG_ERROR("[plugin:AutoFocus] Fail to create file = %s\n",
+                (const char *)file_path.mb_str());
+      return false;
+    }
+  }
+  text_file.Clear();
+  auto_focus_->ClearPluginSettings();
+
+  std::vector<wxString> lines(kAutoFocusSettingsNum);
+  lines[kAutoFocusSettingsMetricIndex] << static_cast<int>(settings_.metric);
+  lines[kAutoFocusSettingsRoiIndex] << settings_.roi_percent;
+  lines[kAutoFocusSettingsWidthIndex] << settings_.metric_width;
+  lines[kAutoFocusSettingsMinIndex] << settings_.min_code;
+  lines[kAutoFocusSettingsMaxIndex] << settings_.max_code;
+  lines[kAutoFocusSettingsStepIndex] << settings_.coarse_step;
+  lines[kAutoFocusSettingsSettleIndex] << settings_.settle_frames;
+  lines[kAutoFocusSettingsAtStartIndex] << (settings_.is_at_start ? 1 : 0);
+  for (unsigned int i = 0; i < lines.size(); i++) {
+    auto_focus_->AddLinePluginSettings(lines[i]);
+    text_file.AddLine(lines[i]);
+  }
+
+  if (auto_focus_->is_cloned() == false) {
+    text_file.Write();
+  }
+  text_file.Close();
+  return true;
+}
@@ -0,0 +1,190 @@
+/**
+ * @file      autofocus_wnd.h
+ * @brief     Setting window of AutoFocus plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+#ifndef _AUTOFOCUS_WND_H_
+#define _AUTOFOCUS_WND_H_
+
+#include <vector>
+
+#include "./include.h"
+#include "./autofocus_define.h"
+#include "./focus_metric.h"
+
+class AutoFocus;
+
+/**
+ * @struct AutoFocusSettings
+ * @brief Settings of the AutoFocus plugin.
+ */
+typedef struct {
+  /*! Sharpness metric */
+  FocusMetricType metric;
+  /*! Size of the centered ROI in percent of the frame (without one-push
+      rectangle) */
+  int roi_percent;
+  /*! Minimum width of the pyramid level measured */
+  int metric_width;
+  /*! Lowest lens code */
+  int min_code;
+  /*! Highest lens code */
+  int max_code;
+  /*! Step of the coarse climb */
+  int coarse_step;
+  /*! Frames skipped after the lens moved */
+  int settle_frames;
+  /*! Whether the lens is focused at the start of the capture */
+  bool is_at_start;
+} AutoFocusSettings;
+
+/**
+ * @class AutoFocusWnd
+ * @brief Setting window of AutoFocus plugin.
+ * The settings are taken at the start of the capture. The Focus button
+ * starts a search.
+ */
+class AutoFocusWnd : public wxFrame {
+ private:
+  /*! Settings */
+  AutoFocusSettings settings_;
+  /*! Pointer to the AutoFocus class */
+  AutoFocus* auto_focus_;
+
+ public:
+  /**
+   * @brief
+   * Constructor for this window.
+   * @param auto_focus [in] Pointer to the AutoFocus class
+   */
+  explicit AutoFocusWnd(AutoFocus* auto_focus);
+
+  /**
+   * @brief
+   * Destructor for this window.
+   */
+  virtual ~AutoFocusWnd(void);
+
+  /**
+   * @brief
+   * Get the settings.
+   * @return settings.
+   */
+  AutoFocusSettings settings(void) const { return settings_; }
+
+  /**
+   * @brief
+   * Post local event(CAPTURE_INITIALIZE) for initialize the screen settings on
+   * own thread.
+   */
+  virtual void PostCaptureInit(void);
+
+  /**
+   * @brief
+   * Post local event(CAPTURE_END) for destroy the screen on own thread.
+   */
+  virtual void PostCaptureEnd(void);
+
+  /**
+   * @brief
+   * The handler function for EVT_CLOSE.
+   */
+  virtual void OnClose(wxCloseEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * Set the list of parameter setting string for the AutoFocus plugin.
+   * @param params [in] settings string.
+   */
+  void SetPluginSettings(std::vector<wxString> params);
+
+ protected:
+  /*! UI*/
+  wxRadioBox* radio_box_metric_;
+  wxStaticText* static_text_roi_;
+  wxTextCtrl* text_ctrl_roi_;
+  wxStaticText* static_text_width_;
+  wxTextCtrl* text_ctrl_width_;
+  wxStaticText* static_text_min_;
+  wxTextCtrl* text_ctrl_min_;
+  wxStaticText* static_text_max_;
+  wxTextCtrl* text_ctrl_max_;
+  wxStaticText* static_text_step_;
+  wxTextCtrl* text_ctrl_step_;
+  wxStaticText* static_text_settle_;
+  wxTextCtrl* text_ctrl_settle_;
+  wxCheckBox* check_box_at_start_;
+  wxButton* button_run_;
+  wxButton* button_apply_;
+
+ private:
+  /*! Event table of wxWidgets.*/
+  DECLARE_EVENT_TABLE();
+
+  /**
+   * @brief
+   * The handler function for kButtonAutoFocusRunId.
+   * Start a search.
+   */
+  virtual void OnRun(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * The handler function for kButtonAutoFocusApplyId.
+   * Reflect the settings, which are used from the next capture.
+   */
+  virtual void OnApply(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * The handler function for local event(CAPTURE_INITIALIZE).
+   * Disable the settings taken at the start.
+   */
+  virtual void OnCaptureInit(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * The handler function for local event(CAPTURE_END).
+   * Enable the settings.
+   */
+  virtual void OnCaptureEnd(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * Enable or disable the settings taken at the start.
+   * @param enable [in] If true, the settings are enabled.
+   */
+  void EnableSettings(bool enable);
+
+  /**
+   * @brief
+   * Show the settings in the controls.
+   */
+  void UpdateControls(void);
+
+  /**
+   * @brief
+   * Set the settings from a list of strings (lines of the settings file).
+   * @param lines [in] settings string.
+   */
+  void SetSettings(const std::vector<wxString>& lines);
+
+  /**
+   * @brief
+   * Load the parameters from the file.
+   * @param file_path [in] file path.
+   * @return If true, reading the file success
+   */
+  bool LoadSettingsFromFile(wxString file_path);
+
+  /**
+   * @brief
+   * Write the parameters to the file.
+   * @param file_path [in] file path.
+   * @return If true, writing the file success
+   */
+  bool WriteSettingsToFile(wxString file_path);
+};
+
+#endif /* _AUTOFOCUS_WND_H_*/
@@ -0,0 +1,177 @@
+/**
+ * @file      focus_metric.cpp
+ * @brief     Sharpness metrics of AutoFocus plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./focus_metric.h"
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define FOCUS_METRIC_NEON
+#endif
+
+#ifdef FOCUS_METRIC_NEON
+/**
+ * @brief
+ * Load 8 pixels as 16 bit integers.
+ * @param src [in] pixels.
+ * @return pixels.
+ */
+static inline int16x8_t LoadPixels(const unsigned char* src) {
+  return vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src)));
+}
+
+/**
+ * @brief
+ * Add the squares of 8 values to the sum.
+ * @param value [in] values (|value| <= 1020).
+ * @param sum [in,out] sum.
+ * @return sum.
+ */
+static inline uint64x2_t AddSquares(int16x8_t value, uint64x2_t sum) {
+  int32x4_t low = vmull_s16(vget_low_s16(value), vget_low_s16(value));
+  int32x4_t high = vmull_s16(vget_high_s16(value), vget_high_s16(value));
+  sum = vpadalq_u32(sum, vreinterpretq_u32_s32(low));
+  return vpadalq_u32(sum, vreinterpretq_u32_s32(high));
+}
+#endif
+
+/**
+ * @brief
+ * Sum of the squared Sobel gradient magnitude of a row.
+ * @param p0 [in] previous row.
+ * @param p1 [in] row.
+ * @param p2 [in] next row.
+ * @param cols [in] width of the rows.
+ * @return sum over the pixels 1 - (cols - 2).
+ */
+static unsigned long long TenengradRow(  // NOLINT
+    const unsigned char* p0, const unsigned char* p1, const unsigned char* p2,
+    int cols) {
+  unsigned long long sum = 0;  // NOLINT
+  int x = 1;
+#ifdef FOCUS_METRIC_NEON
+  uint64x2_t sum_vec = vdupq_n_u64(0);
+  for (; x + 8 < cols; x += 8) {
+    int16x8_t a0 = LoadPixels(p0 + x - 1);
+    int16x8_t b0 = LoadPixels(p0 + x);
+    int16x8_t c0 = LoadPixels(p0 + x + 1);
+    int16x8_t a1 = LoadPixels(p1 + x - 1);
+    int16x8_t c1 = LoadPixels(p1 + x + 1);
+    int16x8_t a2 = LoadPixels(p2 + x - 1);
+    int16x8_t b2 = LoadPixels(p2 + x);
+    int16x8_t c2 = LoadPixels(p2 + x + 1);
+    int16x8_t gx = vaddq_s16(vsubq_s16(c0, a0), vsubq_s16(c2, a2));
+    gx = vaddq_s16(gx, vshlq_n_s16(vsubq_s16(c1, a1), 1));
+    int16x8_t gy = vsubq_s16(vaddq_s16(a2, c2), vaddq_s16(a0, c0));
+    gy = vaddq_s16(gy, vshlq_n_s16(vsubq_s16(b2, b0), 1));
+    sum_vec = AddSquares(gx, sum_vec);
+    sum_vec = AddSquares(gy, sum_vec);
+  }
+  sum = vgetq_lane_u64(sum_vec, 0) + vgetq_lane_u64(sum_vec, 1);
+#endif
+  for (; x < cols - 1; x++) {
+    int gx = (p0[x + 1] - p0[x - 1]) + 2 * (p1[x + 1] - p1[x - 1]) +
+             (p2[x + 1] - p2[x - 1]);
+    int gy = (p2[x - 1] + 2 * p2[x] + p2[x + 1]) -
+             (p0[x - 1] + 2 * p0[x] + p0[x + 1]);
+    sum += gx * gx + gy * gy;
+  }
+  return sum;
+}
+
+/**
+ * @brief
+ * Sum and sum of the squares of the Laplacian of a row.
+ * @param p0 [in] previous row.
+ * @param p1 [in] row.
+ * @param p2 [in] next row.
+ * @param cols [in] width of the rows.
+ * @param sum [in,out] sum over the pixels 1 - (cols - 2).
+ * @param square_sum [in,out] sum of the squares.
+ */
+static void LaplacianRow(const unsigned char* p0, const unsigned char* p1,
+                         const unsigned char* p2, int cols,
+                         long long* sum,                  // NOLINT
+                         unsigned long long* square_sum) {  // NOLINT
+  int x = 1;
+#ifdef FOCUS_METRIC_NEON
+  int32x4_t sum_vec = vdupq_n_s32(0);
+  uint64x2_t square_vec = vdupq_n_u64(0);
+  for (; x + 8 < cols; x += 8) {
+    int16x8_t b0 = LoadPixels(p0 + x);
+    int16x8_t a1 = LoadPixels(p1 + x - 1);
+    int16x8_t b1 = LoadPixels(p1 + x);
+    int16x8_t c1 = LoadPixels(p1 + x + 1);
+    int16x8_t b2 = LoadPixels(p2 + x);
+    int16x8_t lap = vaddq_s16(vaddq_s16(b0, b2), vaddq_s16(a1, c1));
+    lap = vsubq_s16(lap, vshlq_n_s16(b1, 2));
+    sum_vec = vpadalq_s16(sum_vec, lap);
+    square_vec = AddSquares(lap, square_vec);
+  }
+  int64x2_t sum_long = vpaddlq_s32(sum_vec);
+  *sum += vgetq_lane_s64(sum_long, 0) + vgetq_lane_s64(sum_long, 1);
+  *square_sum += vgetq_lane_u64(square_vec, 0) + vgetq_lane_u64(square_vec, 1);
+#endif
+  for (; x < cols - 1; x++) {
+    int lap = p0[x] + p2[x] + p1[x - 1] + p1[x + 1] - 4 * p1[x];
+    *sum += lap;
+    *square_sum += lap * lap;
+  }
+}
+
+/**
+ * @brief
+ * Compute the sharpness of an 8 bit gray image.
+ * The border pixels are not used. The sums are made with integers (NEON
+ * when available, 8 pixels at a time), so the result does not depend on
+ * the path taken.
+ * @param image [in] 8 bit gray image (an ROI may be given).
+ * @param type [in] metric.
+ * @return sharpness (higher is sharper), or -1 if the image is smaller than
+ * 3x3 or is not 8 bit gray.
+ */
+double FocusMetricCompute(const cv::Mat& image, FocusMetricType type) {
+  if (image.type() != CV_8UC1 || image.rows < 3 || image.cols < 3) {
+    return -1;
+  }
+  double count = static_cast<double>(image.rows - 2) * (image.cols - 2);
+  if (type == kFocusMetricLaplacianVariance) {
+    long long sum = 0;  // NOLINT
+    unsigned long long square_sum = 0;  // NOLINT
+    for (int y = 1; y < image.rows - 1; y++) {
+      LaplacianRow(image.ptr<unsigned char>(y - 1),
+                   image.ptr<unsigned char>(y),
+                   image.ptr<unsigned char>(y + 1), image.cols, &sum,
+                   &square_sum);
+    }
+    double mean = sum / count;
+    return square_sum / count - mean * mean;
+  }
+  unsigned long long sum = 0;  // NOLINT
+  for (int y = 1; y < image.rows - 1; y++) {
+    sum += TenengradRow(image.ptr<unsigned char>(y - 1),
+                        image.ptr<unsigned char>(y),
+                        image.ptr<unsigned char>(y + 1), image.cols);
+  }
+  return sum / count;
+}
+
+/**
+ * @brief
+ * Get the name of a metric for the logs.
+ * @param type [in] metric.
+ * @return name.
+ */
+const char* FocusMetricName(FocusMetricType type) {
+  switch (type) {
+    case kFocusMetricTenengrad:
+      return "Tenengrad";
+    case kFocusMetricLaplacianVariance:
+      return "Laplacian variance";
+    default:
+      return "unknown";
+  }
+}
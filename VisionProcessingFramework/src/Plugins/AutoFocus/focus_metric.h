@@ -0,0 +1,47 @@
+/**
+ * @file      focus_metric.h
+ * @brief     Sharpness metrics of AutoFocus plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _FOCUS_METRIC_H_
+#define _FOCUS_METRIC_H_
+
+#include "./include.h"
+
+/**
+ * @enum FocusMetricType
+ * @brief Sharpness metrics.
+ */
+typedef enum {
+  /*! Mean of the squared Sobel gradient magnitude */
+  kFocusMetricTenengrad = 0,
+  /*! Variance of the 4-neighbour Laplacian */
+  kFocusMetricLaplacianVariance,
+  /*! Number of the metrics */
+  kFocusMetricNum,
+} FocusMetricType;
+
+/**
+ * @brief
+ * Compute the sharpness of an 8 bit gray image.
+ * The border pixels are not used. The sums are made with integers (NEON
+ * when available, 8 pixels at a time), so the result does not depend on
+ * the path taken.
+ * @param image [in] 8 bit gray image (an ROI may be given).
+ * @param type [in] metric.
+ * @return sharpness (higher is sharper), or -1 if the image is smaller than
+ * 3x3 or is not 8 bit gray.
+ */
+double FocusMetricCompute(const cv::Mat& image, FocusMetricType type);
+
+/**
+ * @brief
+ * Get the name of a metric for the logs.
+ * @param type [in] metric.
+ * @return name.
+ */
+const char* FocusMetricName(FocusMetricType type);
+
+#endif /* _FOCUS_METRIC_H_*/
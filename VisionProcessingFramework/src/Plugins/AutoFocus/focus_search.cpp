@@ -0,0 +1,198 @@
+/**
+ * @file      focus_search.cpp
+ * @brief     Lens position search of AutoFocus plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./focus_search.h"
+#include "./autofocus_define.h"
+
+/* Ratio of the inner points of the golden section ((sqrt(5) - 1) / 2)*/
+#define kFocusSearchGoldenRatio 0.6180339887
+
+/**
+ * @brief
+ * Round the golden section of an interval.
+ * @param length [in] length of the interval.
+ * @return distance of an inner point from the opposite end.
+ */
+static int GoldenDistance(int length) {
+  return static_cast<int>(length * kFocusSearchGoldenRatio + 0.5);
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+FocusSearch::FocusSearch(void) {
+  Start(kAutoFocusDefaultMin, kAutoFocusDefaultMax, kAutoFocusDefaultStep,
+        kAutoFocusDefaultMin);
+}
+
+/**
+ * @brief
+ * Start a search.
+ * @param min_code [in] lowest lens code.
+ * @param max_code [in] highest lens code.
+ * @param coarse_step [in] step of the climb.
+ * @param start_code [in] code of the first measurement (clipped).
+ */
+void FocusSearch::Start(int min_code, int max_code, int coarse_step,
+                        int start_code) {
+  min_code_ = min_code;
+  max_code_ = (max_code > min_code) ? max_code : min_code;
+  coarse_step_ = (coarse_step > 0) ? coarse_step : 1;
+  if (start_code < min_code_) {
+    start_code = min_code_;
+  } else if (start_code > max_code_) {
+    start_code = max_code_;
+  }
+  start_code_ = start_code;
+  code_ = start_code;
+  direction_ = (start_code < max_code_) ? 1 : -1;
+  is_reversed_ = false;
+  drops_ = 0;
+  best_code_ = start_code;
+  best_sharpness_ = -1;
+  low_ = min_code_;
+  high_ = max_code_;
+  inner_low_ = low_;
+  inner_high_ = high_;
+  inner_low_sharpness_ = -1;
+  inner_high_sharpness_ = -1;
+  has_inner_low_ = false;
+  has_inner_high_ = false;
+  measurements_ = 0;
+  state_ = kStateClimb;
+}
+
+/**
+ * @brief
+ * Give the sharpness measured at the code asked.
+ * @param sharpness [in] sharpness at code().
+ * @return If true, the search is over: code() is the best code.
+ */
+bool FocusSearch::Update(double sharpness) {
+  if (state_ == kStateDone) {
+    return true;
+  }
+  measurements_++;
+  bool is_best = (sharpness > best_sharpness_);
+  if (is_best) {
+    best_code_ = code_;
+    best_sharpness_ = sharpness;
+  }
+  if (state_ == kStateClimb) {
+    drops_ = is_best ? 0 : drops_ + 1;
+    Climb();
+  } else {
+    Golden(sharpness);
+  }
+  return is_done();
+}
+
+/**
+ * @brief
+ * Update of the climb, from the drops and the best code set by Update().
+ */
+void FocusSearch::Climb(void) {
+  int next = code_ + direction_ * coarse_step_;
+  bool is_in_range = (next >= min_code_ && next <= max_code_);
+  // The first step away from the start lowered the sharpness: the peak is
+  // on the other side.
+  bool is_wrong_way = (!is_reversed_ && drops_ > 0 && best_code_ == start_code_);
+  if (is_in_range && drops_ < kAutoFocusMaxDrops && !is_wrong_way) {
+    code_ = next;
+    return;
+  }
+  if (!is_reversed_ && best_code_ == start_code_) {
+    is_reversed_ = true;
+    direction_ = -direction_;
+    drops_ = 0;
+    next = start_code_ + direction_ * coarse_step_;
+    if (next >= min_code_ && next <= max_code_) {
+      code_ = next;
+      return;
+    }
+  }
+
+  // The peak is within a step of the best code.
+  low_ = best_code_ - coarse_step_;
+  high_ = best_code_ + coarse_step_;
+  if (low_ < min_code_) {
+    low_ = min_code_;
+  }
+  if (high_ > max_code_) {
+    high_ = max_code_;
+  }
+  int distance = GoldenDistance(high_ - low_);
+  inner_low_ = high_ - distance;
+  inner_high_ = low_ + distance;
+  has_inner_low_ = false;
+  has_inner_high_ = false;
+  if (high_ - low_ <= kAutoFocusFineStep || inner_low_ >= inner_high_) {
+    Finish();
+    return;
+  }
+  NextGolden();
+}
+
+/**
+ * @brief
+ * Update of the golden section search.
+ * @param sharpness [in] sharpness at code_.
+ */
+void FocusSearch::Golden(double sharpness) {
+  if (state_ == kStateGoldenLow) {
+    inner_low_sharpness_ = sharpness;
+    has_inner_low_ = true;
+  } else {
+    inner_high_sharpness_ = sharpness;
+    has_inner_high_ = true;
+  }
+  NextGolden();
+}
+
+/**
+ * @brief
+ * Measure the next inner point of the golden section, or finish.
+ */
+void FocusSearch::NextGolden(void) {
+  if (has_inner_low_ && has_inner_high_) {
+    // Keep the side of the sharper point; its inner point is reused.
+    if (inner_low_sharpness_ >= inner_high_sharpness_) {
+      high_ = inner_high_;
+      inner_high_ = inner_low_;
+      inner_high_sharpness_ = inner_low_sharpness_;
+      inner_low_ = high_ - GoldenDistance(high_ - low_);
+      has_inner_low_ = false;
+    } else {
+      low_ = inner_low_;
+      inner_low_ = inner_high_;
+      inner_low_sharpness_ = inner_high_sharpness_;
+      inner_high_ = low_ + GoldenDistance(high_ - low_);
+      has_inner_high_ = false;
+    }
+    if (high_ - low_ <= kAutoFocusFineStep || inner_low_ >= inner_high_) {
+      Finish();
+      return;
+    }
+  }
+  if (!has_inner_low_) {
+    state_ = kStateGoldenLow;
+    code_ = inner_low_;
+  } else {
+    state_ = kStateGoldenHigh;
+    code_ = inner_high_;
+  }
+}
+
+/**
+ * @brief
+ * Finish the search at the best code measured.
+ */
+void FocusSearch::Finish(void) {
+  state_ = kStateDone;
+  code_ = best_code_;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file      focus_search.h
+ * @brief     Lens position search of AutoFocus plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _FOCUS_SEARCH_H_
+#define _FOCUS_SEARCH_H_
+
+/**
+ * @class FocusSearch
+ * @brief Search of the lens code of the highest sharpness.
+ * The search climbs from the start code by coarse steps, in the direction
+ * where the sharpness rises (it turns back once if the first step lowers
+ * it), until the sharpness falls for kAutoFocusMaxDrops steps or the range
+ * ends. The coarse peak and its neighbours bracket the maximum, which is
+ * then refined by a golden section search down to kAutoFocusFineStep.
+ * The class only decides the codes: the caller moves the lens, measures
+ * the sharpness of a frame taken at the code asked, and gives it back.
+ */
+class FocusSearch {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  FocusSearch(void);
+
+  /**
+   * @brief
+   * Start a search.
+   * @param min_code [in] lowest lens code.
+   * @param max_code [in] highest lens code.
+   * @param coarse_step [in] step of the climb.
+   * @param start_code [in] code of the first measurement (clipped).
+   */
+  void Start(int min_code, int max_code, int coarse_step, int start_code);
+
+  /**
+   * @brief
+   * Give the sharpness measured at the code asked.
+   * @param sharpness [in] sharpness at code().
+   * @return If true, the search is over: code() is the best code.
+   */
+  bool Update(double sharpness);
+
+  /**
+   * @brief
+   * Get the code to measure next, or the best code once the search is
+   * over.
+   * @return lens code.
+   */
+  int code(void) const { return code_; }
+
+  /**
+   * @brief
+   * Whether the search is over.
+   * @return If true, code() is the best code.
+   */
+  bool is_done(void) const { return state_ == kStateDone; }
+
+  /**
+   * @brief
+   * Get the highest sharpness measured.
+   * @return sharpness.
+   */
+  double best_sharpness(void) const { return best_sharpness_; }
+
+  /**
+   * @brief
+   * Get the number of the measurements of the search.
+   * @return number of the measurements.
+   */
+  int measurements(void) const { return measurements_; }
+
+ private:
+  /**
+   * @enum State
+   * @brief Phase of the search.
+   */
+  typedef enum {
+    kStateClimb = 0,
+    kStateGoldenLow,
+    kStateGoldenHigh,
+    kStateDone,
+  } State;
+
+  /**
+   * @brief
+   * Update of the climb, from the drops and the best code set by Update().
+   */
+  void Climb(void);
+
+  /**
+   * @brief
+   * Update of the golden section search.
+   * @param sharpness [in] sharpness at code_.
+   */
+  void Golden(double sharpness);
+
+  /**
+   * @brief
+   * Measure the next inner point of the golden section, or finish.
+   */
+  void NextGolden(void);
+
+  /**
+   * @brief
+   * Finish the search at the best code measured.
+   */
+  void Finish(void);
+
+  /*! Phase */
+  State state_;
+
+  /*! Range of the lens code */
+  int min_code_;
+  int max_code_;
+
+  /*! Step of the climb */
+  int coarse_step_;
+
+  /*! Code to measure, or the result */
+  int code_;
+
+  /*! Start code of the climb */
+  int start_code_;
+
+  /*! Direction of the climb (+1/-1) */
+  int direction_;
+
+  /*! Whether the climb turned back */
+  bool is_reversed_;
+
+  /*! Steps of the climb since the best one */
+  int drops_;
+
+  /*! Best code and sharpness measured */
+  int best_code_;
+  double best_sharpness_;
+
+  /*! Bracket of the golden section */
+  int low_;
+  int high_;
+
+  /*! Inner points of the golden section and their sharpness */
+  int inner_low_;
+  int inner_high_;
+  double inner_low_sharpness_;
+  double inner_high_sharpness_;
+
+  /*! Whether the sharpness of each inner point is known */
+  bool has_inner_low_;
+  bool has_inner_high_;
+
+  /*! Number of the measurements */
+  int measurements_;
+};
+
+#endif /* _FOCUS_SEARCH_H_*/
@@ -63,11 +63,24 @@ bool Avi::InitProcess(CommonParam* common) {
 /**
  * @brief
  * Finalize routine of the Avi plugin.
- * This function is empty implementation.
+ * Stop the decoder and log the pacing of the frames.
  */
 void Avi::EndProcess() {
   DEBUG_PRINT("Avi::EndProcess) \n");
-  /* Do nothing*/
+  const PipelineClock& clock = avi_wnd_->clock();
+  PLUGIN_LOG_MESSAGE("Clock - mode:%s speed:x%.2f fps:%.2f restarts:%u",
+                     PipelineClock::ModeName(clock.mode()), clock.multiple(),
+                     clock.actual_fps(), clock.restarts());
+  PLUGIN_LOG_MESSAGE("Clock - frames:%u dropped:%u lag avg:%.2fms max:%.2fms",
+                     clock.frames(), clock.dropped(), clock.mean_lag_msec(),
+                     clock.max_lag_msec());
+  const AviDecoder* decoder = avi_wnd_->decoder();
+  if (decoder != NULL) {
+    PLUGIN_LOG_MESSAGE("Decoder - frames:%u starved:%u loops:%u seeks:%u",
+                       decoder->decoded_frames(), decoder->starved_frames(),
+                       decoder->loops(), decoder->seeks());
+  }
+  avi_wnd_->StopDecoder();
 }
 
 /**
@@ -56,7 +56,7 @@ class Avi : public PluginBase {
   /**
    * @brief
    * Finalize routine of the Avi plugin.
-   * This function is empty implementation.
+   * Stop the decoder and log the pacing of the frames.
    */
   virtual void EndProcess(void);
 
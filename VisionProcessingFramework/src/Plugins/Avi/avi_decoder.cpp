@@ -0,0 +1,305 @@
+/**
+ * @file      avi_decoder.cpp
+ * @brief     Prefetching decoder thread of the Avi plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./avi_decoder.h"
+#include "./avi_define.h"
+
+/**
+ * @brief
+ * Constructor.
+ * @param capture [in] opened AVI file (NOT own it, used only by the thread
+ * while it runs).
+ * @param index [in] keyframe index of the file (NOT own it, can be empty).
+ * @param depth [in] number of the frames decoded ahead.
+ * @param loop [in] If true, play the file repeatedly.
+ */
+AviDecoder::AviDecoder(cv::VideoCapture* capture,
+                       const AviKeyframeIndex* index, int depth, bool loop)
+    : wxThread(wxTHREAD_JOINABLE),
+      frame_ready_(mutex_),
+      slot_free_(mutex_) {
+  capture_ = capture;
+  index_ = index;
+  loop_ = loop;
+  frame_count_ = index_->frame_count();
+  if (frame_count_ == 0) {
+    frame_count_ =
+        static_cast<int>(capture_->get(CV_CAP_PROP_FRAME_COUNT));
+  }
+  if (depth < 2) {
+    depth = 2;
+  }
+  for (int i = 0; i < depth; i++) {
+    AviDecodedFrame* slot = new AviDecodedFrame;
+    slot->index = 0;
+    slots_.push_back(slot);
+  }
+  head_ = 0;
+  tail_ = 0;
+  is_held_ = false;
+  is_end_ = false;
+  seek_frame_ = -1;
+  next_frame_ = 0;
+  is_exact_seek_ = true;
+  seek_generation_ = 0;
+  stop_flag_ = false;
+  is_started_ = false;
+  position_ = 0;
+  decoded_frames_ = 0;
+  starved_frames_ = 0;
+  loops_ = 0;
+  seeks_ = 0;
+}
+
+/**
+ * @brief
+ * Destructor. Stops the thread.
+ */
+AviDecoder::~AviDecoder(void) {
+  Stop();
+  for (unsigned int i = 0; i < slots_.size(); i++) {
+    delete slots_[i];
+  }
+}
+
+/**
+ * @brief
+ * Start to decode from a frame.
+ * @param frame [in] first frame.
+ * @return If true, the thread is running.
+ */
+bool AviDecoder::Start(int frame) {
+  if (is_started_) {
+    return true;
+  }
+  if (frame > 0) {
+    seek_frame_ = frame;
+    next_frame_ = frame;
+    is_exact_seek_ = true;
+  }
+  if (Create() != wxTHREAD_NO_ERROR) {
+    DEBUG_PRINT("[AviDecoder] Create failed\n");
+    return false;
+  }
+  if (Run() != wxTHREAD_NO_ERROR) {
+    DEBUG_PRINT("[AviDecoder] Run failed\n");
+    return false;
+  }
+  is_started_ = true;
+  return true;
+}
+
+/**
+ * @brief
+ * Stop to decode and wait for the thread.
+ */
+void AviDecoder::Stop(void) {
+  if (!is_started_) {
+    return;
+  }
+  {
+    wxMutexLocker lock(mutex_);
+    stop_flag_ = true;
+    frame_ready_.Broadcast();
+    slot_free_.Broadcast();
+  }
+  Wait();
+  is_started_ = false;
+}
+
+/**
+ * @brief
+ * Take the next decoded frame, waiting while the ring is empty.
+ * @return frame (give it back by Release()), or NULL at the end of the
+ * file or when stopped.
+ */
+const AviDecodedFrame* AviDecoder::Acquire(void) {
+  if (!is_started_) {
+    return NULL;
+  }
+  wxMutexLocker lock(mutex_);
+  if (head_ == tail_ && !is_end_ && !stop_flag_) {
+    // The decode did not keep up: the pipeline waits for it.
+    starved_frames_++;
+  }
+  while (head_ == tail_ && !is_end_ && !stop_flag_) {
+    frame_ready_.WaitTimeout(kAviDecoderWaitMsec);
+  }
+  if (head_ == tail_) {
+    return NULL;
+  }
+  is_held_ = true;
+  return slots_[tail_ % slots_.size()];
+}
+
+/**
+ * @brief
+ * Give the frame got by Acquire() back to the decoder.
+ */
+void AviDecoder::Release(void) {
+  wxMutexLocker lock(mutex_);
+  if (is_held_) {
+    tail_++;
+    is_held_ = false;
+    slot_free_.Signal();
+  }
+}
+
+/**
+ * @brief
+ * Discard the next frames. Decoded frames are dropped from the ring, and
+ * the rest is skipped by a seek.
+ * @param count [in] number of the frames.
+ */
+void AviDecoder::Skip(int count) {
+  if (count <= 0) {
+    return;
+  }
+  wxMutexLocker lock(mutex_);
+  if (is_held_) {
+    return;
+  }
+  unsigned int queued = head_ - tail_;
+  if (static_cast<unsigned int>(count) <= queued) {
+    tail_ += count;
+    slot_free_.Signal();
+    return;
+  }
+  int frame =
+      ((queued > 0) ? slots_[tail_ % slots_.size()]->index : next_frame_) +
+      count;
+  if (frame_count_ > 0 && frame >= frame_count_) {
+    if (!loop_) {
+      // Nothing is left to play.
+      tail_ = head_;
+      is_end_ = true;
+      seek_generation_++;
+      frame_ready_.Broadcast();
+      return;
+    }
+    frame %= frame_count_;
+  }
+  RequestSeek(frame, true);
+}
+
+/**
+ * @brief
+ * Continue from another frame. The frames in the ring are discarded.
+ * @param frame [in] frame index.
+ * @param is_exact [in] If false, start at the keyframe at or before frame
+ * (fast, for scrubbing).
+ */
+void AviDecoder::Seek(int frame, bool is_exact) {
+  wxMutexLocker lock(mutex_);
+  RequestSeek(frame, is_exact);
+}
+
+/**
+ * @brief
+ * Request a seek to the decoder thread (the mutex is locked).
+ * @param frame [in] frame index.
+ * @param is_exact [in] If false, start at the keyframe.
+ */
+void AviDecoder::RequestSeek(int frame, bool is_exact) {
+  if (frame < 0) {
+    frame = 0;
+  }
+  // Keep only the frame held by the consumer.
+  head_ = tail_ + (is_held_ ? 1 : 0);
+  seek_frame_ = frame;
+  is_exact_seek_ = is_exact;
+  seek_generation_++;
+  next_frame_ = frame;
+  is_end_ = false;
+  seeks_++;
+  slot_free_.Signal();
+}
+
+/**
+ * @brief
+ * Move the file to a frame through its keyframe (decoder thread only).
+ * @param frame [in] frame index.
+ * @param is_exact [in] If false, stop at the keyframe.
+ * @return index of the next frame read from the file.
+ */
+int AviDecoder::SeekFile(int frame, bool is_exact) {
+  int keyframe = index_->KeyframeAtOrBefore(frame);
+  if (keyframe > frame) {
+    keyframe = frame;
+  }
+  capture_->set(CV_CAP_PROP_POS_FRAMES, keyframe);
+  if (!is_exact) {
+    return keyframe;
+  }
+  // grab() decodes without converting the frame.
+  for (int i = keyframe; i < frame; i++) {
+    if (!capture_->grab()) {
+      return i;
+    }
+  }
+  return frame;
+}
+
+/**
+ * @brief
+ * Thread entry point.
+ * @return thread exit code.
+ */
+wxThread::ExitCode AviDecoder::Entry(void) {
+  DEBUG_PRINT("[AviDecoder] Start - tid:%d\n", this->GetId());
+  while (!stop_flag_) {
+    AviDecodedFrame* slot;
+    int seek_frame;
+    bool is_exact;
+    unsigned int generation;
+    {
+      wxMutexLocker lock(mutex_);
+      while (!stop_flag_ && seek_frame_ < 0 &&
+             (is_end_ || head_ - tail_ >= slots_.size())) {
+        slot_free_.WaitTimeout(kAviDecoderWaitMsec);
+      }
+      if (stop_flag_) {
+        break;
+      }
+      seek_frame = seek_frame_;
+      is_exact = is_exact_seek_;
+      seek_frame_ = -1;
+      generation = seek_generation_;
+      slot = slots_[head_ % slots_.size()];
+    }
+
+    // Decode outside the lock, straight into the pooled frame.
+    if (seek_frame >= 0) {
+      position_ = SeekFile(seek_frame, is_exact);
+    }
+    bool is_read = capture_->read(slot->image);
+    if (!is_read && loop_ && position_ > 0) {
+      // Rewind while the ring still feeds the pipeline.
+      position_ = SeekFile(0, true);
+      loops_++;
+      is_read = capture_->read(slot->image);
+    }
+
+    wxMutexLocker lock(mutex_);
+    if (generation != seek_generation_) {
+      // Seek() was called while decoding: the frame is stale.
+      continue;
+    }
+    if (!is_read || slot->image.empty()) {
+      is_end_ = true;
+      frame_ready_.Broadcast();
+      continue;
+    }
+    slot->index = position_++;
+    next_frame_ = position_;
+    decoded_frames_++;
+    head_++;
+    frame_ready_.Broadcast();
+  }
+  DEBUG_PRINT("[AviDecoder] end - tid:%d\n", this->GetId());
+  return (wxThread::ExitCode)0;
+}
@@ -0,0 +1,224 @@
+/**
+ * @file      avi_decoder.h
+ * @brief     Prefetching decoder thread of the Avi plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _AVI_DECODER_H_
+#define _AVI_DECODER_H_
+
+#include <wx/thread.h>
+#include <opencv2/highgui/highgui.hpp>
+#include <vector>
+#include "./avi_keyframe_index.h"
+#include "./include.h"
+
+/**
+ * @struct AviDecodedFrame
+ * @brief Pooled frame of the decoder ring.
+ */
+typedef struct {
+  /*! BGR888 image (reallocated only when the size changes) */
+  cv::Mat image;
+  /*! Index of the frame in the file */
+  int index;
+} AviDecodedFrame;
+
+/**
+ * @class AviDecoder
+ * @brief Thread which decodes the AVI file ahead of the processing thread
+ * into a bounded ring of pooled frames. At the end of the file it rewinds
+ * while the ring still feeds the pipeline, so looping does not stall it.
+ * A thread object runs only once: create a new one for every playback.
+ */
+class AviDecoder : public wxThread {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   * @param capture [in] opened AVI file (NOT own it, used only by the thread
+   * while it runs).
+   * @param index [in] keyframe index of the file (NOT own it, can be empty).
+   * @param depth [in] number of the frames decoded ahead.
+   * @param loop [in] If true, play the file repeatedly.
+   */
+  AviDecoder(cv::VideoCapture* capture, const AviKeyframeIndex* index,
+             int depth, bool loop);
+
+  /**
+   * @brief
+   * Destructor. Stops the thread.
+   */
+  virtual ~AviDecoder(void);
+
+  /**
+   * @brief
+   * Start to decode from a frame.
+   * @param frame [in] first frame.
+   * @return If true, the thread is running.
+   */
+  bool Start(int frame);
+
+  /**
+   * @brief
+   * Stop to decode and wait for the thread.
+   */
+  void Stop(void);
+
+  /**
+   * @brief
+   * Take the next decoded frame, waiting while the ring is empty.
+   * @return frame (give it back by Release()), or NULL at the end of the
+   * file or when stopped.
+   */
+  const AviDecodedFrame* Acquire(void);
+
+  /**
+   * @brief
+   * Give the frame got by Acquire() back to the decoder.
+   */
+  void Release(void);
+
+  /**
+   * @brief
+   * Discard the next frames. Decoded frames are dropped from the ring, and
+   * the rest is skipped by a seek.
+   * @param count [in] number of the frames.
+   */
+  void Skip(int count);
+
+  /**
+   * @brief
+   * Continue from another frame. The frames in the ring are discarded.
+   * @param frame [in] frame index.
+   * @param is_exact [in] If false, start at the keyframe at or before frame
+   * (fast, for scrubbing).
+   */
+  void Seek(int frame, bool is_exact);
+
+  /**
+   * @brief
+   * Get the number of the decoded frames.
+   * @return number of the frames.
+   */
+  unsigned int decoded_frames(void) const { return decoded_frames_; }
+
+  /**
+   * @brief
+   * Get the number of the times Acquire() found the ring empty.
+   * @return number of the times.
+   */
+  unsigned int starved_frames(void) const { return starved_frames_; }
+
+  /**
+   * @brief
+   * Get the number of the times the file was rewound to loop.
+   * @return number of the times.
+   */
+  unsigned int loops(void) const { return loops_; }
+
+  /**
+   * @brief
+   * Get the number of the seeks.
+   * @return number of the seeks.
+   */
+  unsigned int seeks(void) const { return seeks_; }
+
+ protected:
+  /**
+   * @brief
+   * Thread entry point.
+   * @return thread exit code.
+   */
+  virtual wxThread::ExitCode Entry(void);
+
+ private:
+  /**
+   * @brief
+   * Move the file to a frame through its keyframe (decoder thread only).
+   * @param frame [in] frame index.
+   * @param is_exact [in] If false, stop at the keyframe.
+   * @return index of the next frame read from the file.
+   */
+  int SeekFile(int frame, bool is_exact);
+
+  /**
+   * @brief
+   * Request a seek to the decoder thread (the mutex is locked).
+   * @param frame [in] frame index.
+   * @param is_exact [in] If false, start at the keyframe.
+   */
+  void RequestSeek(int frame, bool is_exact);
+
+  /*! Opened AVI file (NOT own it) */
+  cv::VideoCapture* capture_;
+
+  /*! Keyframe index of the file (NOT own it) */
+  const AviKeyframeIndex* index_;
+
+  /*! If true, play the file repeatedly */
+  bool loop_;
+
+  /*! Number of the frames in the file (0: unknown) */
+  int frame_count_;
+
+  /*! Pooled frames of the ring */
+  std::vector<AviDecodedFrame*> slots_;
+
+  /*! Lock of the ring */
+  wxMutex mutex_;
+
+  /*! Signaled when a frame is decoded or the state changes */
+  wxCondition frame_ready_;
+
+  /*! Signaled when a slot is released or the state changes */
+  wxCondition slot_free_;
+
+  /*! Count of the published frames */
+  unsigned int head_;
+
+  /*! Count of the consumed frames */
+  unsigned int tail_;
+
+  /*! Whether the consumer holds the slot at tail_ */
+  bool is_held_;
+
+  /*! Whether the end of the file was reached (without loop) */
+  bool is_end_;
+
+  /*! Frame requested by Seek() (-1: none) */
+  int seek_frame_;
+
+  /*! Index of the frame which follows the last published one */
+  int next_frame_;
+
+  /*! Whether the requested seek is exact */
+  bool is_exact_seek_;
+
+  /*! Incremented by every Seek() to discard the frame being decoded */
+  unsigned int seek_generation_;
+
+  /*! Stop request */
+  volatile bool stop_flag_;
+
+  /*! Whether the thread has been started */
+  bool is_started_;
+
+  /*! Index of the next frame read from the file (decoder thread only) */
+  int position_;
+
+  /*! Number of the decoded frames */
+  volatile unsigned int decoded_frames_;
+
+  /*! Number of the times Acquire() found the ring empty */
+  volatile unsigned int starved_frames_;
+
+  /*! Number of the rewinds */
+  volatile unsigned int loops_;
+
+  /*! Number of the seeks */
+  volatile unsigned int seeks_;
+};
+
+#endif /* _AVI_DECODER_H_*/
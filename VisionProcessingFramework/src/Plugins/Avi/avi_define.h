@@ -18,6 +18,10 @@
 #define kStaticTextAviFilePathId   90005
 #define kTextAviFilePathId         90006
 #define kBtnApplyId                90007
+#define kRboxClockModeId           90008
+#define kStaticTextClockMultipleId 90009
+#define kTextClockMultipleId       90010
+#define kCheckBoxLoopId            90011
 
 
 /* GUI*/
@@ -25,7 +29,7 @@
 #define kWndPointX 0
 #define kWndPointY 0
 #define kWndSizeW 220
-#define kWndSizeH 120
+#define kWndSizeH 290
 
 /* Open AVI file button */
 #define kBtnSelectAviFileWndText "Select AVI file ..."
@@ -46,16 +50,50 @@
 #define kTextAviFilePathSizeW 175
 #define kTextAviFilePathSizeH 25
 
+/* Playback radio box */
+#define kRboxClockModeText "Playback"
+#define kRboxClockModePointX 10
+#define kRboxClockModePointY 80
+#define kRboxClockModeSizeW 200
+#define kRboxClockModeSizeH 90
+
+/* Static Text speed multiple */
+#define kStaticTextClockMultipleText "Speed x"
+#define kStaticTextClockMultiplePointX 10
+#define kStaticTextClockMultiplePointY 180
+#define kStaticTextClockMultipleSizeW 60
+#define kStaticTextClockMultipleSizeH 25
+
+/* Text Ctrl speed multiple */
+#define kTextClockMultiplePointX kStaticTextClockMultiplePointX + 65
+#define kTextClockMultiplePointY 180
+#define kTextClockMultipleSizeW 60
+#define kTextClockMultipleSizeH 25
+
+/* Loop check box */
+#define kCheckBoxLoopText "Loop"
+#define kCheckBoxLoopPointX 10
+#define kCheckBoxLoopPointY 215
+#define kCheckBoxLoopSizeW 100
+#define kCheckBoxLoopSizeH 25
+
 /* Apply button */
 #define kBtnApplyText "Apply"
 #define kBtnApplyPointX 120
-#define kBtnApplyPointY 80
+#define kBtnApplyPointY 245
 #define kBtnApplySizeW 80
 #define kBtnApplySizeH 30
 
 /* Max file path*/
 #define kMaxFilePath 128
 #define kDefaultFps 60
+#define kDefaultClockMultiple 2.0
+
+/* Number of the frames decoded ahead of the pipeline. */
+#define kAviDecoderDepth 4
+
+/* Timeout of the waits of the decoder (to check the stop request). */
+#define kAviDecoderWaitMsec 100
 
 #define kAviConfigFile "../lib/Plugins/input/Avi.ini"
 
@@ -0,0 +1,133 @@
+/**
+ * @file      avi_keyframe_index.cpp
+ * @brief     Keyframe index of an AVI file.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./avi_keyframe_index.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+/* Flag of an idx1 entry: the chunk is a keyframe. */
+#define kAviIndexKeyframeFlag 0x00000010
+
+/* Size of an idx1 entry (chunk id, flags, offset, size). */
+#define kAviIndexEntrySize 16
+
+/**
+ * @brief
+ * Read a little endian 32 bit value.
+ * @param data [in] 4 bytes.
+ * @return value.
+ */
+static unsigned int ReadLe32(const unsigned char* data) {
+  return data[0] | (data[1] << 8) | (data[2] << 16) |
+         (static_cast<unsigned int>(data[3]) << 24);
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+AviKeyframeIndex::AviKeyframeIndex(void) {}
+
+/**
+ * @brief
+ * Destructor.
+ */
+AviKeyframeIndex::~AviKeyframeIndex(void) {}
+
+/**
+ * @brief
+ * Read the index of an AVI file.
+ * @param file_path [in] AVI file path.
+ * @return If false, the file has no usable index (the index is empty).
+ */
+bool AviKeyframeIndex::Load(const char* file_path) {
+  Clear();
+  FILE* file = fopen(file_path, "rb");
+  if (file == NULL) {
+    return false;
+  }
+
+  unsigned char header[12];
+  if (fread(header, 1, sizeof(header), file) != sizeof(header) ||
+      memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "AVI ", 4) != 0) {
+    fclose(file);
+    return false;
+  }
+
+  // Walk the top level chunks up to idx1 (it follows the movi list).
+  unsigned char chunk[8];
+  while (fread(chunk, 1, sizeof(chunk), file) == sizeof(chunk)) {
+    unsigned int size = ReadLe32(chunk + 4);
+    if (memcmp(chunk, "idx1", 4) != 0) {
+      long skip = static_cast<long>(size) + (size & 1);  // NOLINT
+      if (fseek(file, skip, SEEK_CUR) != 0) {
+        break;
+      }
+      continue;
+    }
+
+    // The video stream is the first one with compressed (dc) or
+    // uncompressed (db) video chunks.
+    char stream[2] = {0, 0};
+    unsigned char entry[kAviIndexEntrySize];
+    for (unsigned int i = 0; i < size / kAviIndexEntrySize; i++) {
+      if (fread(entry, 1, sizeof(entry), file) != sizeof(entry)) {
+        break;
+      }
+      if (entry[2] != 'd' || (entry[3] != 'c' && entry[3] != 'b')) {
+        continue;
+      }
+      if (stream[0] == 0) {
+        stream[0] = entry[0];
+        stream[1] = entry[1];
+      } else if (entry[0] != stream[0] || entry[1] != stream[1]) {
+        continue;
+      }
+      bool is_keyframe = (ReadLe32(entry + 4) & kAviIndexKeyframeFlag) != 0;
+      if (is_keyframe) {
+        keyframes_.push_back(static_cast<int>(is_keyframe_.size()));
+      }
+      is_keyframe_.push_back(is_keyframe);
+    }
+    break;
+  }
+  fclose(file);
+
+  if (keyframes_.empty()) {
+    Clear();
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Remove the index.
+ */
+void AviKeyframeIndex::Clear(void) {
+  is_keyframe_.clear();
+  keyframes_.clear();
+}
+
+/**
+ * @brief
+ * Get the keyframe at or before a frame.
+ * @param frame [in] frame index.
+ * @return keyframe index (frame itself if the index is empty).
+ */
+int AviKeyframeIndex::KeyframeAtOrBefore(int frame) const {
+  if (keyframes_.empty()) {
+    return frame;
+  }
+  std::vector<int>::const_iterator itr =
+      std::upper_bound(keyframes_.begin(), keyframes_.end(), frame);
+  if (itr == keyframes_.begin()) {
+    return keyframes_.front();
+  }
+  return *(itr - 1);
+}
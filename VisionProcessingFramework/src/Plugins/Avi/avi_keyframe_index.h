@@ -0,0 +1,80 @@
+/**
+ * @file      avi_keyframe_index.h
+ * @brief     Keyframe index of an AVI file.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _AVI_KEYFRAME_INDEX_H_
+#define _AVI_KEYFRAME_INDEX_H_
+
+#include <vector>
+
+/**
+ * @class AviKeyframeIndex
+ * @brief Keyframe flags of the video frames of an AVI file, read from the
+ * legacy index chunk (idx1). A seek lands on the nearest keyframe and decodes
+ * forward from it, which is much faster than decoding from the beginning.
+ * Files without idx1 (e.g. OpenDML only) give an empty index.
+ */
+class AviKeyframeIndex {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  AviKeyframeIndex(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~AviKeyframeIndex(void);
+
+  /**
+   * @brief
+   * Read the index of an AVI file.
+   * @param file_path [in] AVI file path.
+   * @return If false, the file has no usable index (the index is empty).
+   */
+  bool Load(const char* file_path);
+
+  /**
+   * @brief
+   * Remove the index.
+   */
+  void Clear(void);
+
+  /**
+   * @brief
+   * Get the keyframe at or before a frame.
+   * @param frame [in] frame index.
+   * @return keyframe index (frame itself if the index is empty).
+   */
+  int KeyframeAtOrBefore(int frame) const;
+
+  /**
+   * @brief
+   * Get the number of the video frames in the index.
+   * @return number of the frames (0: empty).
+   */
+  int frame_count(void) const { return static_cast<int>(is_keyframe_.size()); }
+
+  /**
+   * @brief
+   * Get the number of the keyframes in the index.
+   * @return number of the keyframes.
+   */
+  int keyframe_count(void) const {
+    return static_cast<int>(keyframes_.size());
+  }
+
+ private:
+  /*! Keyframe flag of each video frame */
+  std::vector<bool> is_keyframe_;
+
+  /*! Ascending frame indexes of the keyframes */
+  std::vector<int> keyframes_;
+};
+
+#endif /* _AVI_KEYFRAME_INDEX_H_*/
@@ -14,6 +14,7 @@ BEGIN_EVENT_TABLE(AviWnd, wxFrame)
 EVT_CLOSE(AviWnd::OnClose)
 EVT_BUTTON(kBtnSelectAviFileWndId, AviWnd::OnOpenAviFile)
 EVT_BUTTON(kBtnApplyId, AviWnd::OnUpdate)
+EVT_RADIOBOX(kRboxClockModeId, AviWnd::OnSelectClockMode)
 END_EVENT_TABLE();
 
 /**
@@ -43,6 +44,31 @@ AviWnd::AviWnd(Avi *parent)
       wxPoint(kTextAviFilePathPointX, kTextAviFilePathPointY),
       wxSize(kTextAviFilePathSizeW, kTextAviFilePathSizeH),
       wxTE_READONLY);
+  // Create playback radio box
+  wxString clock_mode_choice[kPipelineClockModeNum];
+  clock_mode_choice[kPipelineClockRealTime] = wxT("Real time");
+  clock_mode_choice[kPipelineClockFreeRun] = wxT("As fast as possible");
+  clock_mode_choice[kPipelineClockMultiple] = wxT("Fixed multiple");
+  wx_radio_box_clock_mode_ = new wxRadioBox(
+      this, kRboxClockModeId, wxT(kRboxClockModeText),
+      wxPoint(kRboxClockModePointX, kRboxClockModePointY),
+      wxSize(kRboxClockModeSizeW, kRboxClockModeSizeH), kPipelineClockModeNum,
+      clock_mode_choice, 1, wxRA_SPECIFY_COLS);
+  // Create static text(speed multiple)
+  wx_static_text_clock_multiple_ = new wxStaticText(
+      this, kStaticTextClockMultipleId, wxT(kStaticTextClockMultipleText),
+      wxPoint(kStaticTextClockMultiplePointX, kStaticTextClockMultiplePointY),
+      wxSize(kStaticTextClockMultipleSizeW, kStaticTextClockMultipleSizeH));
+  // Create text(speed multiple)
+  wx_text_ctrl_clock_multiple_ = new wxTextCtrl(
+      this, kTextClockMultipleId, wxT(""),
+      wxPoint(kTextClockMultiplePointX, kTextClockMultiplePointY),
+      wxSize(kTextClockMultipleSizeW, kTextClockMultipleSizeH));
+  // Create loop check box
+  wx_check_box_loop_ = new wxCheckBox(
+      this, kCheckBoxLoopId, wxT(kCheckBoxLoopText),
+      wxPoint(kCheckBoxLoopPointX, kCheckBoxLoopPointY),
+      wxSize(kCheckBoxLoopSizeW, kCheckBoxLoopSizeH));
   // Create apply button
   wx_button_setting_apply_ =
       new wxButton(this, kBtnApplyId, wxT(kBtnApplyText),
@@ -50,11 +76,12 @@ AviWnd::AviWnd(Avi *parent)
                    wxSize(kBtnApplySizeW, kBtnApplySizeH));
 
   parent_ = parent;
-  avi_image_ = NULL;
-  last_avi_image_ = NULL;
   capture_image_ = NULL;
   temp_capture_image_ = NULL;
   fps_ = kDefaultFps;
+  decoder_ = NULL;
+  loop_ = false;
+  SetClockSettings(kPipelineClockRealTime, kDefaultClockMultiple);
 
   LoadSettingsFromFile(wxT(kAviConfigFile));
 }
@@ -64,14 +91,7 @@ AviWnd::AviWnd(Avi *parent)
  * Destructor for this window.
  */
 AviWnd::~AviWnd() {
-  if (avi_image_ != NULL) {
-    delete avi_image_;
-    avi_image_ = NULL;
-  }
-  if (last_avi_image_ != NULL) {
-    delete last_avi_image_;
-    last_avi_image_ = NULL;
-  }
+  StopDecoder();
   if (temp_capture_image_ != NULL) {
     delete temp_capture_image_;
     temp_capture_image_ = NULL;
@@ -116,25 +136,38 @@ void AviWnd::OnUpdate(wxCommandEvent &event) {
     parent_->set_output_image_size(size);
     capture_image_ = temp_capture_image_;
   }
+  double multiple;
+  if (!wx_text_ctrl_clock_multiple_->GetValue().ToDouble(&multiple) ||
+      multiple <= 0.0) {
+    multiple = kDefaultClockMultiple;
+  }
+  SetClockSettings(
+      static_cast<PipelineClockMode>(wx_radio_box_clock_mode_->GetSelection()),
+      multiple);
+  loop_ = wx_check_box_loop_->GetValue();
   this->Show(false);
   WriteSettingsToFile(wxT(kAviConfigFile));
 }
 
+/**
+ * @brief
+ * The handler function for kRboxClockModeId.
+ * Enable the speed multiple only for kPipelineClockMultiple.
+ */
+void AviWnd::OnSelectClockMode(wxCommandEvent &event) {
+  wx_text_ctrl_clock_multiple_->Enable(
+      wx_radio_box_clock_mode_->GetSelection() == kPipelineClockMultiple);
+}
+
 /**
  * @brief
  * Read AVI file and generate image buffer.
  * @param image_file_path [in] AVI image file path
  */
 FileReadError AviWnd::LoadImageData(char *image_file_path) {
-  int image_width = 0;
-  int image_height = 0;
-
   DEBUG_PRINT("Avi::OpenFile str=%s\n", image_file_path);
-  /* If Image data is already allocated, release Image data.*/
-  if (avi_image_ != NULL) {
-    delete avi_image_;
-    avi_image_ = NULL;
-  }
+  /* The decoder reads the file being released.*/
+  StopDecoder();
   if (temp_capture_image_ != NULL) {
     delete temp_capture_image_;
     temp_capture_image_ = NULL;
@@ -155,17 +188,11 @@ FileReadError AviWnd::LoadImageData(char *image_file_path) {
     DEBUG_PRINT("AviWnd::InitializeAviImage is not read yet. get framerate\n");
     fps_ = kDefaultFps;
   }
-  fps_wait_ = static_cast<int>((1 / fps_) * 1000000);
-
-  /* Create Avi Bayer Image*/
-  DEBUG_PRINT("Create Avi Bayer Img\n");
 
-  image_width =
-          static_cast<int>(temp_capture_image_->get(CV_CAP_PROP_FRAME_WIDTH));
-  image_height =
-          static_cast<int>(temp_capture_image_->get(CV_CAP_PROP_FRAME_HEIGHT));
-
-  avi_image_ = new cv::Mat(cvSize(image_width, image_height), CV_8UC3);
+  /* Seek through the keyframes when the file has an index.*/
+  if (!keyframe_index_.Load(image_file_path)) {
+    DEBUG_PRINT("Avi::OpenFile no keyframe index\n");
+  }
 
   return kNoneError;
 }
@@ -182,6 +209,8 @@ bool AviWnd::InitializeAviImage() {
     DEBUG_PRINT("AviWnd::InitializeAviImage is not read yet. exit function\n");
     return false;
   }
+  /* The decoder of the previous playback uses the file.*/
+  StopDecoder();
   if (capture_image_->set(CV_CAP_PROP_POS_FRAMES, 0) == false) {
     DEBUG_PRINT("AviWnd::InitializeAviImage is not read yet. set frame\n");
     return false;
@@ -192,6 +221,17 @@ bool AviWnd::InitializeAviImage() {
     DEBUG_PRINT("AviWnd::InitializeAviImage is not read yet. get frame\n");
     return false;
   }
+  clock_.Configure(clock_mode_, fps_, clock_multiple_);
+  clock_.Start();
+
+  // Decode ahead on a thread, so that the decode overlaps the processing.
+  decoder_ = new AviDecoder(capture_image_, &keyframe_index_,
+                            kAviDecoderDepth, loop_);
+  if (decoder_->Start(0) == false) {
+    delete decoder_;
+    decoder_ = NULL;
+    return false;
+  }
   return true;
 }
 
@@ -207,28 +247,74 @@ bool AviWnd::GetImageBuffer(cv::Mat *image_buffer) {
     DEBUG_PRINT("CInput::getReadBuffer is not read yet. exit function\n");
     return false;
   }
-  usleep(fps_wait_);
+  if (decoder_ == NULL) {
+    DEBUG_PRINT("AviWnd::GetImageBuffer decoder is not started\n");
+    return false;
+  }
+  // Wait for the deadline of the frame instead of a fixed interval, and skip
+  // the frames the pipeline is too late for.
+  decoder_->Skip(clock_.WaitNextFrame());
 
-  *capture_image_ >> *avi_image_;
+  const AviDecodedFrame* frame = decoder_->Acquire();
 
   /* Last frame check.*/
-  if (avi_image_->empty()) {
+  if (frame == NULL) {
     wxString wx_log_info_msg(wxT("[Avi]Play completion - Blank frame grabbed"));
     wxLogInfo(wx_log_info_msg.c_str());
     DEBUG_PRINT("Play completion - Blank frame grabbed \n");
 
     return false;
-  } else {
-    if(last_avi_image_ == NULL) {
-      last_avi_image_ = new cv::Mat(image_buffer->size(), image_buffer->type());
-     }
-    *last_avi_image_ = avi_image_->clone();
-
-    *image_buffer = avi_image_->clone();
   }
+  frame->image.copyTo(*image_buffer);
+  decoder_->Release();
   return true;
 }
 
+/**
+ * @brief
+ * Stop the decoder thread.
+ */
+void AviWnd::StopDecoder(void) {
+  if (decoder_ != NULL) {
+    decoder_->Stop();
+    delete decoder_;
+    decoder_ = NULL;
+  }
+}
+
+/**
+ * @brief
+ * Continue the playback from another frame.
+ * @param frame [in] frame index.
+ * @param is_exact [in] If false, start at the keyframe at or before frame.
+ */
+void AviWnd::SeekFrame(int frame, bool is_exact) {
+  if (decoder_ != NULL) {
+    decoder_->Seek(frame, is_exact);
+  }
+}
+
+/**
+ * @brief
+ * Set the pacing of the playback to the UI.
+ * @param mode [in] pacing mode.
+ * @param multiple [in] speed of kPipelineClockMultiple.
+ */
+void AviWnd::SetClockSettings(PipelineClockMode mode, double multiple) {
+  if (mode < 0 || mode >= kPipelineClockModeNum) {
+    mode = kPipelineClockRealTime;
+  }
+  if (multiple <= 0.0) {
+    multiple = kDefaultClockMultiple;
+  }
+  clock_mode_ = mode;
+  clock_multiple_ = multiple;
+  wx_radio_box_clock_mode_->SetSelection(mode);
+  wx_text_ctrl_clock_multiple_->SetValue(
+      wxString::Format(wxT("%.2f"), multiple));
+  wx_text_ctrl_clock_multiple_->Enable(mode == kPipelineClockMultiple);
+}
+
 /**
  * @brief
  * Get AVI image size.
@@ -257,14 +343,20 @@ void AviWnd::UpdateUIForImageProcessingState(ImageProcessingState state) {
     case kRun:
       wx_button_open_avi_file_->Enable(false);
       wx_button_setting_apply_->Enable(false);
+      wx_radio_box_clock_mode_->Enable(false);
+      wx_check_box_loop_->Enable(false);
       break;
     case kStop:
       wx_button_open_avi_file_->Enable(true);
       wx_button_setting_apply_->Enable(true);
+      wx_radio_box_clock_mode_->Enable(true);
+      wx_check_box_loop_->Enable(true);
       break;
     case kPause:
       wx_button_open_avi_file_->Enable(false);
       wx_button_setting_apply_->Enable(false);
+      wx_radio_box_clock_mode_->Enable(false);
+      wx_check_box_loop_->Enable(false);
       break;
   }
 }
@@ -301,6 +393,20 @@ bool AviWnd::LoadSettingsFromFile(wxString file_path) {
   } else {
     line_str = text_file.GetFirstLine();
     wx_text_ctrl_file_path_->SetValue(line_str);
+
+    // The pacing lines are absent in the files of older versions.
+    long mode = kPipelineClockRealTime; /* NOLINT */
+    double multiple = kDefaultClockMultiple;
+    if (text_file.GetLineCount() > 1) {
+      text_file.GetLine(1).ToLong(&mode);
+    }
+    if (text_file.GetLineCount() > 2) {
+      text_file.GetLine(2).ToDouble(&multiple);
+    }
+    SetClockSettings(static_cast<PipelineClockMode>(mode), multiple);
+    loop_ =
+        (text_file.GetLineCount() > 3 && text_file.GetLine(3) == wxT("1"));
+    wx_check_box_loop_->SetValue(loop_);
   }
 
   text_file.Close();
@@ -354,6 +460,18 @@ bool AviWnd::WriteSettingsToFile(wxString file_path) {
   parent_->AddLinePluginSettings(line_str);
   text_file.AddLine(line_str);
 
+  line_str = wxString::Format(wxT("%d"), clock_mode_);
+  parent_->AddLinePluginSettings(line_str);
+  text_file.AddLine(line_str);
+
+  line_str = wxString::Format(wxT("%.2f"), clock_multiple_);
+  parent_->AddLinePluginSettings(line_str);
+  text_file.AddLine(line_str);
+
+  line_str = wxString::Format(wxT("%d"), loop_ ? 1 : 0);
+  parent_->AddLinePluginSettings(line_str);
+  text_file.AddLine(line_str);
+
   if (parent_->is_cloned() == false) {
     text_file.Write();
   }
@@ -375,6 +493,18 @@ void AviWnd::SetPluginSettings(std::vector<wxString> params) {
   line_str = params[0];
   wx_text_ctrl_file_path_->SetValue(line_str);
 
+  long mode = kPipelineClockRealTime; /* NOLINT */
+  double multiple = kDefaultClockMultiple;
+  if (params.size() > 1) {
+    params[1].ToLong(&mode);
+  }
+  if (params.size() > 2) {
+    params[2].ToDouble(&multiple);
+  }
+  SetClockSettings(static_cast<PipelineClockMode>(mode), multiple);
+  loop_ = (params.size() > 3 && params[3] == wxT("1"));
+  wx_check_box_loop_->SetValue(loop_);
+
   ret = OpenRawFile(wx_text_ctrl_file_path_->GetValue(), false);
   if (ret == true) {
     wxCommandEvent event =
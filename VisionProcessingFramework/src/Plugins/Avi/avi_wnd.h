@@ -10,8 +10,11 @@
 
 #include <opencv2/highgui/highgui.hpp>
 #include "./avi.h"
+#include "./avi_decoder.h"
 #include "./avi_define.h"
+#include "./avi_keyframe_index.h"
 #include "./include.h"
+#include "./pipeline_clock.h"
 
 class Avi;
 
@@ -30,12 +33,6 @@ typedef enum {
  */
 class AviWnd : public wxFrame {
  private:
-  /*! Avi image*/
-  cv::Mat* avi_image_;
-
-  /*! The last frame of the image*/
-  cv::Mat* last_avi_image_;
-
   /*! The last frame of the Avi for reading image*/
   cv::VideoCapture *capture_image_;
 
@@ -48,9 +45,23 @@ class AviWnd : public wxFrame {
   /*! Fps*/
   double fps_;
 
-  /*! Wait for Fps adjustment*/
-  int fps_wait_;
+  /*! Clock which paces the frames*/
+  PipelineClock clock_;
+
+  /*! Pacing mode of the playback*/
+  PipelineClockMode clock_mode_;
+
+  /*! Speed of the playback in kPipelineClockMultiple*/
+  double clock_multiple_;
 
+  /*! Decoder thread of the playback (NULL: stopped)*/
+  AviDecoder* decoder_;
+
+  /*! Keyframe index of the selected file*/
+  AviKeyframeIndex keyframe_index_;
+
+  /*! If true, play the file repeatedly*/
+  bool loop_;
  public:
   /**
    * @brief
@@ -84,6 +95,13 @@ class AviWnd : public wxFrame {
    */
   virtual void OnUpdate(wxCommandEvent& event); /* NOLINT */
 
+  /**
+   * @brief
+   * The handler function for kRboxClockModeId.
+   * Enable the speed multiple only for kPipelineClockMultiple.
+   */
+  virtual void OnSelectClockMode(wxCommandEvent& event); /* NOLINT */
+
   /**
    * @brief
    * initialize avi image.
@@ -102,6 +120,34 @@ class AviWnd : public wxFrame {
    */
   bool GetImageBuffer(cv::Mat* image_buffer);
 
+  /**
+   * @brief
+   * Stop the decoder thread.
+   */
+  void StopDecoder(void);
+
+  /**
+   * @brief
+   * Get the decoder thread of the playback.
+   * @return decoder (NULL: stopped).
+   */
+  const AviDecoder* decoder(void) const { return decoder_; }
+
+  /**
+   * @brief
+   * Continue the playback from another frame.
+   * @param frame [in] frame index.
+   * @param is_exact [in] If false, start at the keyframe at or before frame.
+   */
+  void SeekFrame(int frame, bool is_exact);
+
+  /**
+   * @brief
+   * Get the clock which paces the frames.
+   * @return clock.
+   */
+  const PipelineClock& clock(void) const { return clock_; }
+
   /**
    * @brief
    * Update the setting window UI to active or inactive 
@@ -132,6 +178,10 @@ class AviWnd : public wxFrame {
   wxStaticText* wx_static_text_file_path_;
   wxTextCtrl* wx_text_ctrl_file_path_;
   wxButton* wx_button_setting_apply_;
+  wxRadioBox* wx_radio_box_clock_mode_;
+  wxStaticText* wx_static_text_clock_multiple_;
+  wxTextCtrl* wx_text_ctrl_clock_multiple_;
+  wxCheckBox* wx_check_box_loop_;
 
  private:
   /*! Event table of wxWidgets.*/
@@ -169,6 +219,15 @@ class AviWnd : public wxFrame {
    *     false : if file can not open, not display any dialog.
    */
   bool OpenRawFile(wxString wxPathName, bool disp_error_dialog);
+
+  /**
+   * @brief
+   * Set the pacing of the playback to the UI.
+   * @param mode [in] pacing mode.
+   * @param multiple [in] speed of kPipelineClockMultiple.
+   */
+  void SetClockSettings(PipelineClockMode mode, double multiple);
+
 };
 
 #endif /* _AVI_WND_H_*/
@@ -82,8 +82,6 @@ bool BayerAddGain::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
   DEBUG_PRINT("BayerAddGain::DoProcess \n");
 
   int ob_clamp = common_->optical_black();
-  int max;
-  int bit_num;
   float value = bayer_add_gain_value();
 
   if (value < 0x00) {
@@ -91,50 +89,13 @@ bool BayerAddGain::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
     value = static_cast<float>(kBayerAddGainDefaultValue);
   }
 
-  if (src_image->depth() == 0) {
-    max = 0xFF;
-    bit_num = 1;
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i = 0; i < src_image->rows; i++) {
-      for (int j = 0; j < src_image->cols; j++) {
-        char* bayer_img_calc;
-        bayer_img_calc = reinterpret_cast<char*>(
-            &src_image->data[i * src_image->step + j * bit_num]);
-
-        if ((((*bayer_img_calc) - ob_clamp) * value + ob_clamp) <= 0x00) {
-          *bayer_img_calc = 0x00;
-        } else if ((((*bayer_img_calc) - ob_clamp) * value + ob_clamp) >= max) {
-          *bayer_img_calc = max;
-        } else {
-          *bayer_img_calc = ((*bayer_img_calc) - ob_clamp) * value + ob_clamp;
-        }
-      }
-    }
-  } else if (src_image->depth() == 2) {
-    max = 0x3FF;
-    bit_num = 2;
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i = 0; i < src_image->rows; i++) {
-      for (int j = 0; j < src_image->cols; j++) {
-        INT16* bayer_img_calc;
-        bayer_img_calc = reinterpret_cast<INT16*>(
-            &src_image->data[i * src_image->step + j * bit_num]);
-
-        if ((((*bayer_img_calc) - ob_clamp) * value + ob_clamp) <= 0x00) {
-          *bayer_img_calc = 0x00;
-        } else if (((*bayer_img_calc) - ob_clamp) * value + ob_clamp >= max) {
-          *bayer_img_calc = max;
-        } else {
-          *bayer_img_calc = ((*bayer_img_calc) - ob_clamp) * value + ob_clamp;
-        }
-      }
-    }
+  // (pixel - ob) * gain + ob, clamped, is looked up per pixel; the table is
+  // rebuilt only when the gain or the optical black changes.
+  gain_lut_.SetTransfer(ob_clamp, value, ob_clamp);
+  if (gain_lut_.Apply(src_image) == false) {
+    DEBUG_PRINT("BayerAddGain: unsupported image type:%d\n",
+                src_image->type());
+    return false;
   }
   return true;
 }
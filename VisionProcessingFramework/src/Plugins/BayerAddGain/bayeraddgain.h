@@ -9,6 +9,7 @@
 #define _BAYER_ADD_GAIN_H_
 
 #include <vector>
+#include "./bayer_gain_lut.h"
 #include "./bayeraddgain_define.h"
 #include "./bayeraddgain_wnd.h"
 #include "./plugin_base.h"
@@ -27,6 +28,8 @@ class BayerAddGain : public PluginBase {
   float bayer_add_gain_value_;
   /*! Common parameter */
   CommonParam* common_;
+  /*! Transfer function of the gain and the optical black clamp */
+  BayerGainLut gain_lut_;
 
  public:
   /**
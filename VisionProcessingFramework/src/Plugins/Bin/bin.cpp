@@ -49,17 +49,24 @@ bool Bin::InitProcess(CommonParam* common) {
   common_->set_optical_black(optical_black_);
   DEBUG_PRINT("optical_black_ init:%d \n", optical_black_);
 
+  bin_wnd_->StartClock();
   return true;
 }
 
 /**
  * @brief
  * Finalize routine of the Bin plugin.
- * This function is empty implementation.
+ * Log the pacing of the frames.
  */
 void Bin::EndProcess() {
   DEBUG_PRINT("Bin::EndProcess) \n");
-  /* Do nothing*/
+  const PipelineClock& clock = bin_wnd_->clock();
+  PLUGIN_LOG_MESSAGE("Clock - mode:%s speed:x%.2f fps:%.2f restarts:%u",
+                     PipelineClock::ModeName(clock.mode()), clock.multiple(),
+                     clock.actual_fps(), clock.restarts());
+  PLUGIN_LOG_MESSAGE("Clock - frames:%u dropped:%u lag avg:%.2fms max:%.2fms",
+                     clock.frames(), clock.dropped(), clock.mean_lag_msec(),
+                     clock.max_lag_msec());
 }
 
 /**
@@ -54,7 +54,7 @@ class Bin : public PluginBase {
   /**
    * @brief
    * Finalize routine of the Bin plugin.
-   * This function is empty implementation.
+   * Log the pacing of the frames.
    */
   virtual void EndProcess(void);
 
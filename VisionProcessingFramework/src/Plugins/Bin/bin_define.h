@@ -21,6 +21,9 @@
 #define STATIC_TEXT_RAW_FILE_PATH_ID 90005
 #define TEXT_RAW_FILE_PATH_ID 90006
 #define BTN_APPLY_ID 90007
+#define RBOX_CLOCK_MODE_ID 90008
+#define STATIC_TEXT_CLOCK_MULTIPLE_ID 90009
+#define TEXT_CLOCK_MULTIPLE_ID 90010
 
 /* GUI*/
 #define WND_TITLE "Open Raw File"
@@ -68,16 +71,40 @@
 #define BTN_SELECT_RAW_FILE_WND_SIZE_W 150
 #define BTN_SELECT_RAW_FILE_WND_SIZE_H 30
 
+/* Playback radio box */
+#define RBOX_CLOCK_MODE_TEXT "Playback"
+#define RBOX_CLOCK_MODE_POINT_X 10
+#define RBOX_CLOCK_MODE_POINT_Y 245
+#define RBOX_CLOCK_MODE_SIZE_W 200
+#define RBOX_CLOCK_MODE_SIZE_H 90
+
+/* Static Text speed multiple */
+#define STATIC_TEXT_CLOCK_MULTIPLE_TEXT "Speed x"
+#define STATIC_TEXT_CLOCK_MULTIPLE_POINT_X 10
+#define STATIC_TEXT_CLOCK_MULTIPLE_POINT_Y 345
+#define STATIC_TEXT_CLOCK_MULTIPLE_SIZE_W 60
+#define STATIC_TEXT_CLOCK_MULTIPLE_SIZE_H 25
+
+/* Text Ctrl speed multiple */
+#define TEXT_CLOCK_MULTIPLE_POINT_X STATIC_TEXT_CLOCK_MULTIPLE_POINT_X + 65
+#define TEXT_CLOCK_MULTIPLE_POINT_Y 345
+#define TEXT_CLOCK_MULTIPLE_SIZE_W 60
+#define TEXT_CLOCK_MULTIPLE_SIZE_H 25
+
 /* Apply button */
 #define BTN_APPLY_TEXT "Apply"
 #define BTN_APPLY_POINT_X 120
-#define BTN_APPLY_POINT_Y 250
+#define BTN_APPLY_POINT_Y 380
 #define BTN_APPLY_SIZE_W 80
 #define BTN_APPLY_SIZE_H 30
 
 /* Max file path*/
 #define MAX_FILE_PATH 128
 
+/* Pacing of the repeated image */
+#define BIN_DEFAULT_FPS 60
+#define BIN_DEFAULT_CLOCK_MULTIPLE 2.0
+
 /* Bin header information*/
 #define BIN_HEADER_WORD_SIZE 2
 #define BIN_HEADER_WIDTH_POS 0
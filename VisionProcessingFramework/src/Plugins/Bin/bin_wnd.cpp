@@ -16,6 +16,7 @@ EVT_RADIOBOX(RBOX_BIT_COUNT_ID, BinWnd::OnSelectBitCount)
 EVT_RADIOBOX(RBOX_FIRST_PIXEL_ID, BinWnd::OnSelectFirstPixel)
 EVT_BUTTON(BTN_SELECT_RAW_FILE_WND_ID, BinWnd::OnOpenRawFile)
 EVT_BUTTON(BTN_APPLY_ID, BinWnd::OnUpdate)
+EVT_RADIOBOX(RBOX_CLOCK_MODE_ID, BinWnd::OnSelectClockMode)
 END_EVENT_TABLE();
 
 /**
@@ -25,7 +26,7 @@ END_EVENT_TABLE();
 BinWnd::BinWnd(Bin *parent)
     : wxFrame(NULL, WND_ID, wxT(WND_TITLE), wxPoint(WND_POINT_X, WND_POINT_Y),
               //              wxSize(WND_SIZE_W, WND_SIZE_H)) {
-              wxSize(220, 300)) {
+              wxSize(220, 430)) {
   wxString bit_count_choice[2];
   wxString first_pixel_choice[4];
 
@@ -75,6 +76,29 @@ BinWnd::BinWnd(Bin *parent)
       wxPoint(TEXT_RAW_FILE_PATH_POINT_X, TEXT_RAW_FILE_PATH_POINT_Y),
       wxSize(TEXT_RAW_FILE_PATH_SIZE_W, TEXT_RAW_FILE_PATH_SIZE_H),
       wxTE_READONLY);
+  // Create playback radio box
+  wxString clock_mode_choice[kPipelineClockModeNum];
+  clock_mode_choice[kPipelineClockRealTime] = wxT("Real time");
+  clock_mode_choice[kPipelineClockFreeRun] = wxT("As fast as possible");
+  clock_mode_choice[kPipelineClockMultiple] = wxT("Fixed multiple");
+  wx_radio_box_clock_mode_ = new wxRadioBox(
+      this, RBOX_CLOCK_MODE_ID, wxT(RBOX_CLOCK_MODE_TEXT),
+      wxPoint(RBOX_CLOCK_MODE_POINT_X, RBOX_CLOCK_MODE_POINT_Y),
+      wxSize(RBOX_CLOCK_MODE_SIZE_W, RBOX_CLOCK_MODE_SIZE_H),
+      kPipelineClockModeNum, clock_mode_choice, 1, wxRA_SPECIFY_COLS);
+  // Create static text(speed multiple)
+  wx_static_text_clock_multiple_ = new wxStaticText(
+      this, STATIC_TEXT_CLOCK_MULTIPLE_ID, wxT(STATIC_TEXT_CLOCK_MULTIPLE_TEXT),
+      wxPoint(STATIC_TEXT_CLOCK_MULTIPLE_POINT_X,
+              STATIC_TEXT_CLOCK_MULTIPLE_POINT_Y),
+      wxSize(STATIC_TEXT_CLOCK_MULTIPLE_SIZE_W,
+             STATIC_TEXT_CLOCK_MULTIPLE_SIZE_H));
+  // Create text(speed multiple)
+  wx_text_ctrl_clock_multiple_ = new wxTextCtrl(
+      this, TEXT_CLOCK_MULTIPLE_ID, wxT(""),
+      wxPoint(TEXT_CLOCK_MULTIPLE_POINT_X, TEXT_CLOCK_MULTIPLE_POINT_Y),
+      wxSize(TEXT_CLOCK_MULTIPLE_SIZE_W, TEXT_CLOCK_MULTIPLE_SIZE_H));
+  SetClockSettings(kPipelineClockRealTime, BIN_DEFAULT_CLOCK_MULTIPLE);
   // Create apply button
   wx_button_setting_apply_ =
       new wxButton(this, BTN_APPLY_ID, wxT(BTN_APPLY_TEXT),
@@ -190,11 +214,60 @@ void BinWnd::OnUpdate(wxCommandEvent &event) {
     *raw_bayer_image_ = temp_raw_bayer_image_->clone();
     parent_->set_first_pixel(first_pixel_);
 
+    double multiple;
+    if (!wx_text_ctrl_clock_multiple_->GetValue().ToDouble(&multiple) ||
+        multiple <= 0.0) {
+      multiple = BIN_DEFAULT_CLOCK_MULTIPLE;
+    }
+    SetClockSettings(static_cast<PipelineClockMode>(
+                         wx_radio_box_clock_mode_->GetSelection()),
+                     multiple);
+
     this->Show(false);
     WriteSettingsToFile(wxT(BinConfigFile));
   }
 }
 
+/**
+ * @brief
+ * The handler function for radio box(id = RBOX_CLOCK_MODE_ID).
+ * Enable the speed multiple only for kPipelineClockMultiple.
+ */
+void BinWnd::OnSelectClockMode(wxCommandEvent &event) {
+  wx_text_ctrl_clock_multiple_->Enable(
+      wx_radio_box_clock_mode_->GetSelection() == kPipelineClockMultiple);
+}
+
+/**
+ * @brief
+ * Restart the clock which paces the frames.
+ */
+void BinWnd::StartClock(void) {
+  clock_.Configure(clock_mode_, BIN_DEFAULT_FPS, clock_multiple_);
+  clock_.Start();
+}
+
+/**
+ * @brief
+ * Set the pacing of the playback to the UI.
+ * @param mode [in] pacing mode.
+ * @param multiple [in] speed of kPipelineClockMultiple.
+ */
+void BinWnd::SetClockSettings(PipelineClockMode mode, double multiple) {
+  if (mode < 0 || mode >= kPipelineClockModeNum) {
+    mode = kPipelineClockRealTime;
+  }
+  if (multiple <= 0.0) {
+    multiple = BIN_DEFAULT_CLOCK_MULTIPLE;
+  }
+  clock_mode_ = mode;
+  clock_multiple_ = multiple;
+  wx_radio_box_clock_mode_->SetSelection(mode);
+  wx_text_ctrl_clock_multiple_->SetValue(
+      wxString::Format(wxT("%.2f"), multiple));
+  wx_text_ctrl_clock_multiple_->Enable(mode == kPipelineClockMultiple);
+}
+
 /**
  * @brief
  * Read RAW file and generate image buffer.
@@ -338,6 +411,8 @@ bool BinWnd::GetImageBuffer(cv::Mat *image_buffer) {
     DEBUG_PRINT("CInput::getReadBuffer is not read yet. exit function\n");
     return false;
   }
+  // The image is the same every frame, so the dropped frames cost nothing.
+  clock_.WaitNextFrame();
 
   *image_buffer = raw_bayer_image_->clone();
 
@@ -371,18 +446,21 @@ void BinWnd::UpdateUIForImageProcessingState(ImageProcessingState state) {
       wx_radio_box_bit_count_->Enable(false);
       wx_button_open_raw_file_->Enable(false);
       wx_button_setting_apply_->Enable(false);
+      wx_radio_box_clock_mode_->Enable(false);
       break;
     case kStop:
       wx_radio_box_first_pixel_->Enable(true);
       wx_radio_box_bit_count_->Enable(true);
       wx_button_open_raw_file_->Enable(true);
       wx_button_setting_apply_->Enable(true);
+      wx_radio_box_clock_mode_->Enable(true);
       break;
     case kPause:
       wx_radio_box_first_pixel_->Enable(false);
       wx_radio_box_bit_count_->Enable(false);
       wx_button_open_raw_file_->Enable(false);
       wx_button_setting_apply_->Enable(false);
+      wx_radio_box_clock_mode_->Enable(false);
       break;
   }
 }
@@ -434,6 +512,17 @@ bool BinWnd::LoadSettingsFromFile(wxString file_path) {
 
     line_str = text_file.GetNextLine();
     wx_text_ctrl_file_path_->SetValue(line_str);
+
+    // The pacing lines are absent in the files of older versions.
+    long mode = kPipelineClockRealTime; /* NOLINT */
+    double multiple = BIN_DEFAULT_CLOCK_MULTIPLE;
+    if (text_file.GetLineCount() > 3) {
+      text_file.GetLine(3).ToLong(&mode);
+    }
+    if (text_file.GetLineCount() > 4) {
+      text_file.GetLine(4).ToDouble(&multiple);
+    }
+    SetClockSettings(static_cast<PipelineClockMode>(mode), multiple);
   }
 
   text_file.Close();
@@ -497,6 +586,16 @@ bool BinWnd::WriteSettingsToFile(wxString file_path) {
   parent_->AddLinePluginSettings(line_str);
   text_file.AddLine(line_str);
 
+  // Pacing mode -> clock_mode_
+  line_str = wxString::Format(wxT("%d"), clock_mode_);
+  parent_->AddLinePluginSettings(line_str);
+  text_file.AddLine(line_str);
+
+  // Speed multiple -> clock_multiple_
+  line_str = wxString::Format(wxT("%.2f"), clock_multiple_);
+  parent_->AddLinePluginSettings(line_str);
+  text_file.AddLine(line_str);
+
   if (parent_->is_cloned() == false) {
     text_file.Write();
   }
@@ -532,6 +631,16 @@ void BinWnd::SetPluginSettings(std::vector<wxString> params) {
   line_str = params[2];
   wx_text_ctrl_file_path_->SetValue(line_str);
 
+  long mode = kPipelineClockRealTime; /* NOLINT */
+  double multiple = BIN_DEFAULT_CLOCK_MULTIPLE;
+  if (params.size() > 3) {
+    params[3].ToLong(&mode);
+  }
+  if (params.size() > 4) {
+    params[4].ToDouble(&multiple);
+  }
+  SetClockSettings(static_cast<PipelineClockMode>(mode), multiple);
+
   ret = OpenRawFile(wx_text_ctrl_file_path_->GetValue(), false);
   if (ret == true) {
     wxCommandEvent event =
@@ -12,6 +12,7 @@
 #include "./bin.h"
 #include "./bin_define.h"
 #include "./include.h"
+#include "./pipeline_clock.h"
 
 class Bin;
 
@@ -41,6 +42,15 @@ class BinWnd : public wxFrame {
   /*! Optical black value */
   int bit_count_;
 
+  /*! Clock which paces the frames */
+  PipelineClock clock_;
+
+  /*! Pacing mode of the playback */
+  PipelineClockMode clock_mode_;
+
+  /*! Speed of the playback in kPipelineClockMultiple */
+  double clock_multiple_;
+
  public:
   /**
    * @brief
@@ -88,6 +98,26 @@ class BinWnd : public wxFrame {
    */
   virtual void OnUpdate(wxCommandEvent& event); /* NOLINT */
 
+  /**
+   * @brief
+   * The handler function for radio box(id = RBOX_CLOCK_MODE_ID).
+   * Enable the speed multiple only for kPipelineClockMultiple.
+   */
+  virtual void OnSelectClockMode(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * Restart the clock which paces the frames.
+   */
+  void StartClock(void);
+
+  /**
+   * @brief
+   * Get the clock which paces the frames.
+   * @return clock.
+   */
+  const PipelineClock& clock(void) const { return clock_; }
+
   /**
    * @brief
    * Get RAW image burrer.
@@ -127,6 +157,9 @@ class BinWnd : public wxFrame {
   wxStaticText* wx_static_text_file_path_;
   wxTextCtrl* wx_text_ctrl_file_path_;
   wxButton* wx_button_setting_apply_;
+  wxRadioBox* wx_radio_box_clock_mode_;
+  wxStaticText* wx_static_text_clock_multiple_;
+  wxTextCtrl* wx_text_ctrl_clock_multiple_;
 
  private:
   /*! Event table of wxWidgets.*/
@@ -164,6 +197,14 @@ class BinWnd : public wxFrame {
    *     false : if file can not open, do not show any dialog.
    */
   bool OpenRawFile(wxString wxPathName, bool disp_error_dialog);
+
+  /**
+   * @brief
+   * Set the pacing of the playback to the UI.
+   * @param mode [in] pacing mode.
+   * @param multiple [in] speed of kPipelineClockMultiple.
+   */
+  void SetClockSettings(PipelineClockMode mode, double multiple);
 };
 
 #endif /* _BIN_WND_H_*/
@@ -7,6 +7,7 @@
 
 #include <vector>
 #include "./edge_enhancement.h"
+#include "./pixel_convert.h"
 
 /**
  * @brief
@@ -42,6 +43,8 @@ EdgeEnhancement::EdgeEnhancement() : PluginBase() {
   } else {
     is_success_initialized_ = true;
   }
+
+  set_is_use_dest_buffer(false);
 }
 
 /**
@@ -80,6 +83,7 @@ void EdgeEnhancement::DoPostProcess(void) {
 /**
  * @brief
  * Main routine of the EdgeEnhancement plugin.
+ * The frame is sharpened in place.
  * @param src_ipl [in] src image data.
  * @param dst_ipl [out] dst image data.
  */
@@ -89,50 +93,12 @@ bool EdgeEnhancement::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
     return false;
   }
 
-  *dst_image = src_image->clone();
-
-  float coeff = param_->GetCoeff();
-
-  /* edge filster*/
-  float FilterData[] = {-coeff / 9.0f, -coeff / 9.0f,          -coeff / 9.0f,
-                        -coeff / 9.0f, 1 + (8 * coeff) / 9.0f, -coeff / 9.0f,
-                        -coeff / 9.0f, -coeff / 9.0f,          -coeff / 9.0f};
-
-  cv::Mat kernel = cv::Mat(3, 3, CV_32F, FilterData);
-  cv::filter2D(*src_image, *dst_image, -1, kernel, cv::Point(-1, -1), 0, -0);
-
-  if (dst_image->depth() == CV_16U) {
-    int mat_step = dst_image->step;
-    int byte_per_pixel = 2;
-    for (int i = 0; i < dst_image->rows; i++) {
-      for (int j = 0; j < mat_step; j = j + (3 * byte_per_pixel)) {
-        int num = (i * mat_step) + j;
-
-        UINT16 dst_r = static_cast<UINT16>(dst_image->data[num]);
-        dst_r = dst_r | (static_cast<UINT16>(dst_image->data[num + 1] << 8));
-        UINT16 dst_g = static_cast<UINT16>(dst_image->data[num + 2]);
-        dst_g = dst_g | (static_cast<UINT16>(dst_image->data[num + 3] << 8));
-        UINT16 dst_b = static_cast<UINT16>(dst_image->data[num + 4]);
-        dst_b = dst_b | (static_cast<UINT16>(dst_image->data[num + 5] << 8));
-
-        if (dst_r > 1023) {
-          dst_r = 1023;
-        }
-        if (dst_g > 1023) {
-          dst_g = 1023;
-        }
-        if (dst_b > 1023) {
-          dst_b = 1023;
-        }
-
-        dst_image->data[num] = dst_r & 0x00FF;
-        dst_image->data[num + 1] = dst_r >> 8;
-        dst_image->data[num + 2] = dst_g & 0x00FF;
-        dst_image->data[num + 3] = dst_g >> 8;
-        dst_image->data[num + 4] = dst_b & 0x00FF;
-        dst_image->data[num + 5] = dst_b >> 8;
-      }
-    }
+  // 16 bit data is clamped to the bit depth of the sensor in the same pass.
+  if (sharpener_.Apply(*src_image, param_->GetCoeff(), kPixelConvertSensorBits,
+                       param_->GetLumaOnly(), dst_image) == false) {
+    DEBUG_PRINT("[EdgeEnhancement]unsupported image type:%d\n",
+                src_image->type());
+    return false;
   }
 
   return true;
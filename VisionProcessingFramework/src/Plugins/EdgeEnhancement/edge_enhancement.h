@@ -12,6 +12,7 @@
 #include "./edge_enhancement_define.h"
 #include "./edge_enhancement_param.h"
 #include "./edge_enhancement_wnd.h"
+#include "./edge_sharpen.h"
 #include "./include.h"
 #include "./plugin_base.h"
 
@@ -32,6 +33,9 @@ class EdgeEnhancement : public PluginBase {
   /*! Whether initialization has succeeded */
   bool is_success_initialized_;
 
+  /*! Fixed-point sharpening kernel.*/
+  EdgeSharpener sharpener_;
+
  public:
   /**
    * @brief
@@ -64,6 +68,7 @@ class EdgeEnhancement : public PluginBase {
   /**
    * @brief
    * Main routine of the EdgeEnhancement plugin.
+   * The frame is sharpened in place.
    * @param src_ipl [in] src image data.
    * @param dst_ipl [out] dst image data.
    * @return If true, success in the main processing
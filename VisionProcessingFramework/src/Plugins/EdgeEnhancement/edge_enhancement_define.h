@@ -17,13 +17,14 @@
 #define ST_COEFF_ID 10000
 #define TCTRL_COEFF_ID 20000
 #define BTN_APPLY_ID 30000
+#define CB_LUMA_ID 40000
 
 /* GUI*/
 #define WND_TITLE "Edge Enhancement"
 #define WND_POINT_X 0
 #define WND_POINT_Y 0
 #define WND_SIZE_W 350
-#define WND_SIZE_H 80
+#define WND_SIZE_H 110
 
 #define ST_COEFF_TEXT "Coefficient"
 #define ST_COEFF_POINT_X 30
@@ -42,8 +43,15 @@
 #define BTN_APPLY_SIZE_W 80
 #define BTN_APPLY_SIZE_H 30
 
+#define CB_LUMA_TEXT "Luma only"
+#define CB_LUMA_POINT_X 130
+#define CB_LUMA_POINT_Y 65
+#define CB_LUMA_SIZE_W 150
+#define CB_LUMA_SIZE_H 30
+
 /* Parameter names.*/
 #define PARAM_NAME_COEFF "Coefficient"
+#define PARAM_NAME_LUMA "LumaOnly"
 
 /* Parameter range.*/
 #define COEFF_DEFAULT 1
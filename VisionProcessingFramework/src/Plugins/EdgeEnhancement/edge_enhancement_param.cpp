@@ -11,7 +11,10 @@
  * @brief
  * Constructor.
  */
-EdgeEnhancementParam::EdgeEnhancementParam() { coeff_ = COEFF_DEFAULT; }
+EdgeEnhancementParam::EdgeEnhancementParam() {
+  coeff_ = COEFF_DEFAULT;
+  is_luma_only_ = false;
+}
 
 /**
  * @brief
@@ -44,3 +47,19 @@ float EdgeEnhancementParam::SetCoeff(float value) {
  * @return coeff value.
  */
 float EdgeEnhancementParam::GetCoeff(void) { return coeff_; }
+
+/**
+ * @brief
+ * Set whether only the luma is sharpened.
+ * @param is_luma_only [in] If true, sharpen the luma only.
+ */
+void EdgeEnhancementParam::SetLumaOnly(bool is_luma_only) {
+  is_luma_only_ = is_luma_only;
+}
+
+/**
+ * @brief
+ * Get whether only the luma is sharpened.
+ * @return If true, the luma only is sharpened.
+ */
+bool EdgeEnhancementParam::GetLumaOnly(void) { return is_luma_only_; }
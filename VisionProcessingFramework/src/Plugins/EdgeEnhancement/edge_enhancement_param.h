@@ -20,6 +20,9 @@ class EdgeEnhancementParam {
   /*! coefficient*/
   float coeff_;
 
+  /*! Whether only the luma is sharpened*/
+  bool is_luma_only_;
+
  public:
   /**
    * @brief
@@ -47,5 +50,19 @@ class EdgeEnhancementParam {
    * @return coeff value.
    */
   virtual float GetCoeff(void);
+
+  /**
+   * @brief
+   * Set whether only the luma is sharpened.
+   * @param is_luma_only [in] If true, sharpen the luma only.
+   */
+  virtual void SetLumaOnly(bool is_luma_only);
+
+  /**
+   * @brief
+   * Get whether only the luma is sharpened.
+   * @return If true, the luma only is sharpened.
+   */
+  virtual bool GetLumaOnly(void);
 };
 #endif /* _EDGE_ENHANCEMENT_PARAM_H_*/
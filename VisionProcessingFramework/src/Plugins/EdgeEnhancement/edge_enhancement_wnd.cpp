@@ -39,6 +39,11 @@ EdgeEnhancementWnd::EdgeEnhancementWnd(EdgeEnhancement *parent,
       new wxButton(this, BTN_APPLY_ID, wxT(BTN_APPLY_TEXT),
                    wxPoint(BTN_APPLY_POINT_X, BTN_APPLY_POINT_Y),
                    wxSize(BTN_APPLY_SIZE_W, BTN_APPLY_SIZE_H));
+  wx_check_box_luma_ =
+      new wxCheckBox(this, CB_LUMA_ID, wxT(CB_LUMA_TEXT),
+                     wxPoint(CB_LUMA_POINT_X, CB_LUMA_POINT_Y),
+                     wxSize(CB_LUMA_SIZE_W, CB_LUMA_SIZE_H));
+  wx_check_box_luma_->SetValue(param_->GetLumaOnly());
 
   LoadSettingsFromFile(wxT(EdgeConfigFile));
 }
@@ -72,6 +77,7 @@ void EdgeEnhancementWnd::OnUpdate(wxCommandEvent &event) {
     if (dialog.ShowModal() == wxID_OK) {
     }
   }
+  param_->SetLumaOnly(wx_check_box_luma_->GetValue());
 
   WriteSettingsToFile(wxT(EdgeConfigFile));
 }
@@ -91,6 +97,14 @@ void EdgeEnhancementWnd::SetPluginSettings(std::vector<wxString> params) {
   wx_textctrl_coeff_text_->SetValue(
       wxString::Format(wxT("%.3f"), param_->GetCoeff()));
 
+  // The luma only line is absent in the settings of older versions.
+  if (params.size() > 1) {
+    long temp_flag = 0; /* NOLINT */
+    params[1].ToLong(&temp_flag);
+    param_->SetLumaOnly(temp_flag != 0);
+    wx_check_box_luma_->SetValue(param_->GetLumaOnly());
+  }
+
   WriteSettingsToFile(wxT(EdgeConfigFile));
 }
 
@@ -130,6 +144,12 @@ bool EdgeEnhancementWnd::LoadSettingsFromFile(wxString file_path) {
     param_->SetCoeff(static_cast<float>(temp_value));
     wx_textctrl_coeff_text_->SetValue(
         wxString::Format(wxT("%.3f"), param_->GetCoeff()));
+    if (text_file.GetLineCount() > 1) {
+      long temp_flag = 0; /* NOLINT */
+      text_file.GetLine(1).ToLong(&temp_flag);
+      param_->SetLumaOnly(temp_flag != 0);
+      wx_check_box_luma_->SetValue(param_->GetLumaOnly());
+    }
   }
 
   text_file.Close();
@@ -174,6 +194,10 @@ bool EdgeEnhancementWnd::WriteSettingsToFile(wxString file_path) {
   parent_->AddLinePluginSettings(line_str);
   text_file.AddLine(line_str);
 
+  line_str = wxString::Format(wxT("%d"), param_->GetLumaOnly() ? 1 : 0);
+  parent_->AddLinePluginSettings(line_str);
+  text_file.AddLine(line_str);
+
   if (parent_->is_cloned() == false) {
     text_file.Write();
   }
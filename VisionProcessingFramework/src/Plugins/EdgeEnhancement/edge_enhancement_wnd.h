@@ -81,6 +81,7 @@ class EdgeEnhancementWnd : public wxFrame {
   wxStaticText* wx_static_coeff_text_;
   wxTextCtrl* wx_textctrl_coeff_text_;
   wxButton* wx_button_coeff_apply_;
+  wxCheckBox* wx_check_box_luma_;
 
  private:
   /*! Event table of wxWidgets.*/
@@ -0,0 +1,390 @@
+/**
+ * @file      edge_sharpen.cpp
+ * @brief     Fixed-point sharpening kernel of EdgeEnhancement plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./edge_sharpen.h"
+#include <limits.h>
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define EDGE_SHARPEN_NEON
+#endif
+
+/**
+ * @struct EdgeSharpenGain
+ * @brief Fixed-point parameters of the sharpening.
+ */
+typedef struct {
+  /*! coeff / 9 in fixed point */
+  int gain;
+  /*! fraction bits of the gain */
+  int shift;
+  /*! rounding offset of the shift */
+  int round;
+  /*! limit of the detail (9 * pixel - sum of 3x3), avoids an overflow */
+  int limit;
+  /*! maximum value of the data */
+  int max_value;
+} EdgeSharpenGain;
+
+/**
+ * @brief
+ * Reflect an index at the borders (101: the border pixel is not repeated).
+ * @param index [in] index (-1 - size).
+ * @param size [in] number of the elements.
+ * @return index inside 0 - (size - 1).
+ */
+static int Reflect101(int index, int size) {
+  if (size == 1) {
+    return 0;
+  }
+  if (index < 0) {
+    return -index;
+  }
+  if (index >= size) {
+    return 2 * size - 2 - index;
+  }
+  return index;
+}
+
+/**
+ * @brief
+ * Clamp a value.
+ * @param value [in] value.
+ * @param min_value [in] minimum.
+ * @param max_value [in] maximum.
+ * @return clamped value.
+ */
+static inline int Clamp(int value, int min_value, int max_value) {
+  value = (value < min_value) ? min_value : value;
+  return (value > max_value) ? max_value : value;
+}
+
+/**
+ * @brief
+ * Sum 3 horizontally adjacent elements of the same channel.
+ * @param src [in] source row.
+ * @param cols [in] number of the pixels.
+ * @param channels [in] number of the channels.
+ * @param sum [out] sums (cols * channels).
+ */
+template <typename T>
+static void HorizontalSum3(const T* src, int cols, int channels, int* sum) {
+  int count = cols * channels;
+  if (cols == 1) {
+    for (int i = 0; i < count; i++) {
+      sum[i] = 3 * src[i];
+    }
+    return;
+  }
+  for (int c = 0; c < channels; c++) {
+    sum[c] = src[c] + 2 * src[channels + c];
+  }
+  for (int i = channels; i < count - channels; i++) {
+    sum[i] = src[i - channels] + src[i] + src[i + channels];
+  }
+  for (int i = count - channels; i < count; i++) {
+    sum[i] = src[i] + 2 * src[i - channels];
+  }
+}
+
+/**
+ * @brief
+ * Get the luma of a BGR pixel (BT.601, 8 fraction bits).
+ * @param pixel [in] BGR pixel.
+ * @return luma.
+ */
+template <typename T>
+static inline int Luma(const T* pixel) {
+  return (29 * pixel[0] + 150 * pixel[1] + 77 * pixel[2] + 128) >> 8;
+}
+
+/**
+ * @brief
+ * Make the horizontal sums of a row.
+ * @param src [in] BGR row.
+ * @param cols [in] number of the pixels.
+ * @param is_luma_only [in] If true, sum the luma.
+ * @param luma [out] work row for the luma (cols).
+ * @param sum [out] sums (cols, or cols * 3).
+ */
+template <typename T>
+static void RowSum(const T* src, int cols, bool is_luma_only, int* luma,
+                   int* sum) {
+  if (is_luma_only) {
+    for (int x = 0; x < cols; x++) {
+      luma[x] = Luma(src + 3 * x);
+    }
+    HorizontalSum3(luma, cols, 1, sum);
+  } else {
+    HorizontalSum3(src, cols, 3, sum);
+  }
+}
+
+#ifdef EDGE_SHARPEN_NEON
+/**
+ * @brief
+ * Load 8 elements as 32 bit integers.
+ * @param src [in] source.
+ * @param low [out] elements 0 - 3.
+ * @param high [out] elements 4 - 7.
+ */
+static inline void Load8(const UINT16* src, int32x4_t* low, int32x4_t* high) {
+  uint16x8_t value = vld1q_u16(src);
+  *low = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(value)));
+  *high = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(value)));
+}
+
+static inline void Load8(const UINT8* src, int32x4_t* low, int32x4_t* high) {
+  uint16x8_t value = vmovl_u8(vld1_u8(src));
+  *low = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(value)));
+  *high = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(value)));
+}
+
+/**
+ * @brief
+ * Store 8 clamped elements.
+ * @param low [in] elements 0 - 3.
+ * @param high [in] elements 4 - 7.
+ * @param dst [out] destination.
+ */
+static inline void Store8(int32x4_t low, int32x4_t high, UINT16* dst) {
+  vst1q_u16(dst, vcombine_u16(vqmovun_s32(low), vqmovun_s32(high)));
+}
+
+static inline void Store8(int32x4_t low, int32x4_t high, UINT8* dst) {
+  vst1_u8(dst, vqmovn_u16(vcombine_u16(vqmovun_s32(low), vqmovun_s32(high))));
+}
+
+/**
+ * @brief
+ * Sharpen 4 elements.
+ * @param value [in] elements.
+ * @param sum [in] 3x3 sums of the elements.
+ * @param gain [in] fixed-point parameters.
+ * @return sharpened and clamped elements.
+ */
+static inline int32x4_t Sharpen4(int32x4_t value, int32x4_t sum,
+                                 const EdgeSharpenGain& gain) {
+  int32x4_t detail = vsubq_s32(vmulq_n_s32(value, 9), sum);
+  detail = vminq_s32(detail, vdupq_n_s32(gain.limit));
+  detail = vmaxq_s32(detail, vdupq_n_s32(-gain.limit));
+  int32x4_t delta =
+      vmlaq_n_s32(vdupq_n_s32(gain.round), detail, gain.gain);
+  delta = vshlq_s32(delta, vdupq_n_s32(-gain.shift));
+  value = vaddq_s32(value, delta);
+  value = vminq_s32(value, vdupq_n_s32(gain.max_value));
+  return vmaxq_s32(value, vdupq_n_s32(0));
+}
+#endif
+
+/**
+ * @brief
+ * Sharpen a row, each channel by its own detail.
+ * @param src [in] source row.
+ * @param sum0 [in] horizontal sums of the row above.
+ * @param sum1 [in] horizontal sums of the row.
+ * @param sum2 [in] horizontal sums of the row below.
+ * @param count [in] number of the elements (cols * 3).
+ * @param gain [in] fixed-point parameters.
+ * @param dst [out] destination row (may be src).
+ */
+template <typename T>
+static void SharpenRow(const T* src, const int* sum0, const int* sum1,
+                       const int* sum2, int count, const EdgeSharpenGain& gain,
+                       T* dst) {
+  int i = 0;
+#ifdef EDGE_SHARPEN_NEON
+  for (; i + 8 <= count; i += 8) {
+    int32x4_t low;
+    int32x4_t high;
+    Load8(src + i, &low, &high);
+    int32x4_t sum_low = vaddq_s32(vaddq_s32(vld1q_s32(sum0 + i),
+                                            vld1q_s32(sum1 + i)),
+                                  vld1q_s32(sum2 + i));
+    int32x4_t sum_high = vaddq_s32(vaddq_s32(vld1q_s32(sum0 + i + 4),
+                                             vld1q_s32(sum1 + i + 4)),
+                                   vld1q_s32(sum2 + i + 4));
+    Store8(Sharpen4(low, sum_low, gain), Sharpen4(high, sum_high, gain),
+           dst + i);
+  }
+#endif
+  for (; i < count; i++) {
+    int value = src[i];
+    int detail = Clamp(9 * value - (sum0[i] + sum1[i] + sum2[i]),
+                       -gain.limit, gain.limit);
+    value += (detail * gain.gain + gain.round) >> gain.shift;
+    dst[i] = static_cast<T>(Clamp(value, 0, gain.max_value));
+  }
+}
+
+/**
+ * @brief
+ * Sharpen a row by the detail of the luma.
+ * @param src [in] source BGR row.
+ * @param sum0 [in] horizontal sums of the luma of the row above.
+ * @param sum1 [in] horizontal sums of the luma of the row.
+ * @param sum2 [in] horizontal sums of the luma of the row below.
+ * @param cols [in] number of the pixels.
+ * @param gain [in] fixed-point parameters.
+ * @param dst [out] destination BGR row (may be src).
+ */
+template <typename T>
+static void SharpenRowLuma(const T* src, const int* sum0, const int* sum1,
+                           const int* sum2, int cols,
+                           const EdgeSharpenGain& gain, T* dst) {
+  for (int x = 0; x < cols; x++) {
+    const T* pixel = src + 3 * x;
+    int detail = Clamp(9 * Luma(pixel) - (sum0[x] + sum1[x] + sum2[x]),
+                       -gain.limit, gain.limit);
+    int delta = (detail * gain.gain + gain.round) >> gain.shift;
+    int blue = Clamp(pixel[0] + delta, 0, gain.max_value);
+    int green = Clamp(pixel[1] + delta, 0, gain.max_value);
+    int red = Clamp(pixel[2] + delta, 0, gain.max_value);
+    dst[3 * x] = static_cast<T>(blue);
+    dst[3 * x + 1] = static_cast<T>(green);
+    dst[3 * x + 2] = static_cast<T>(red);
+  }
+}
+
+/**
+ * @brief
+ * Sharpen an image in stripes of rows.
+ * @param src [in] BGR image.
+ * @param gain [in] fixed-point parameters.
+ * @param is_luma_only [in] If true, sharpen the luma only.
+ * @param work [in] work area (5 rows of sums per stripe).
+ * @param dst [out] BGR image (may be src).
+ */
+template <typename T>
+static void SharpenImage(const cv::Mat& src, const EdgeSharpenGain& gain,
+                         bool is_luma_only, int* work, cv::Mat* dst) {
+  int rows = src.rows;
+  int cols = src.cols;
+  int row_size = is_luma_only ? cols : cols * 3;
+  int stripe_size = 4 * row_size + cols;
+  int stripes = (rows + kEdgeSharpenStripeRows - 1) / kEdgeSharpenStripeRows;
+
+  // The rows just outside a stripe are written by the next stripes, so
+  // their sums are made before any row is written.
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (int s = 0; s < stripes; s++) {
+    int y0 = s * kEdgeSharpenStripeRows;
+    int y1 = std::min(y0 + kEdgeSharpenStripeRows, rows);
+    int* stripe = work + s * stripe_size;
+    int* luma = stripe + 4 * row_size;
+    int top = Reflect101(y0 - 1, rows);
+    int bottom = Reflect101(y1, rows);
+    RowSum(reinterpret_cast<const T*>(src.data + top * src.step), cols,
+           is_luma_only, luma, stripe);
+    RowSum(reinterpret_cast<const T*>(src.data + bottom * src.step), cols,
+           is_luma_only, luma, stripe + 3 * row_size);
+  }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (int s = 0; s < stripes; s++) {
+    int y0 = s * kEdgeSharpenStripeRows;
+    int y1 = std::min(y0 + kEdgeSharpenStripeRows, rows);
+    int* stripe = work + s * stripe_size;
+    int* luma = stripe + 4 * row_size;
+    int* sum0 = stripe;
+    int* sum1 = stripe + row_size;
+    int* sum2 = stripe + 2 * row_size;
+    RowSum(reinterpret_cast<const T*>(src.data + y0 * src.step), cols,
+           is_luma_only, luma, sum1);
+    for (int y = y0; y < y1; y++) {
+      const T* src_row = reinterpret_cast<const T*>(src.data + y * src.step);
+      T* dst_row = reinterpret_cast<T*>(dst->data + y * dst->step);
+      // The row below is read before this stripe writes it.
+      const int* below = stripe + 3 * row_size;
+      if (y + 1 < y1) {
+        RowSum(reinterpret_cast<const T*>(src.data + (y + 1) * src.step),
+               cols, is_luma_only, luma, sum2);
+        below = sum2;
+      }
+      if (is_luma_only) {
+        SharpenRowLuma(src_row, sum0, sum1, below, cols, gain, dst_row);
+      } else {
+        SharpenRow(src_row, sum0, sum1, below, row_size, gain, dst_row);
+      }
+      int* used = sum0;
+      sum0 = sum1;
+      sum1 = sum2;
+      sum2 = used;
+    }
+  }
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+EdgeSharpener::EdgeSharpener(void) {}
+
+/**
+ * @brief
+ * Destructor.
+ */
+EdgeSharpener::~EdgeSharpener(void) {}
+
+/**
+ * @brief
+ * Sharpen an image.
+ * @param src [in] 8U or 16U image of 3 channels (BGR).
+ * @param coeff [in] strength of the sharpening (0: copy).
+ * @param bits [in] significant bits of the data (8 for 8U).
+ * @param is_luma_only [in] If true, sharpen the luma only.
+ * @param dst [out] sharpened image (may be src).
+ * @return If false, the format is not supported.
+ */
+bool EdgeSharpener::Apply(const cv::Mat& src, float coeff, int bits,
+                          bool is_luma_only, cv::Mat* dst) {
+  if (dst == NULL || src.data == NULL || src.channels() != 3) {
+    return false;
+  }
+  if (src.depth() == CV_8U) {
+    bits = 8;
+  } else if (src.depth() != CV_16U || bits < 8 || bits > 16) {
+    return false;
+  }
+  if (dst != &src) {
+    dst->create(src.rows, src.cols, src.type());
+  }
+  if (coeff <= 0.0f) {
+    if (dst->data != src.data) {
+      src.copyTo(*dst);
+    }
+    return true;
+  }
+
+  EdgeSharpenGain gain;
+  gain.shift = kEdgeSharpenGainBits - bits;
+  gain.round = 1 << (gain.shift - 1);
+  gain.max_value = (1 << bits) - 1;
+  gain.limit = 8 * gain.max_value;
+  double fixed_gain = coeff * static_cast<double>(1 << gain.shift) / 9.0;
+  int max_gain = (INT_MAX - gain.round) / gain.limit;
+  gain.gain = static_cast<int>(std::min(fixed_gain + 0.5,
+                                        static_cast<double>(max_gain)));
+
+  int row_size = is_luma_only ? src.cols : src.cols * 3;
+  int stripes = (src.rows + kEdgeSharpenStripeRows - 1) /
+                kEdgeSharpenStripeRows;
+  size_t work_size = static_cast<size_t>(stripes) * (4 * row_size + src.cols);
+  if (work_.size() < work_size) {
+    work_.resize(work_size);
+  }
+
+  if (src.depth() == CV_8U) {
+    SharpenImage<UINT8>(src, gain, is_luma_only, &work_[0], dst);
+  } else {
+    SharpenImage<UINT16>(src, gain, is_luma_only, &work_[0], dst);
+  }
+  return true;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file      edge_sharpen.h
+ * @brief     Fixed-point sharpening kernel of EdgeEnhancement plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _EDGE_SHARPEN_H_
+#define _EDGE_SHARPEN_H_
+
+#include <vector>
+#include "./include.h"
+
+/* Number of the rows of a stripe processed by one thread. */
+#define kEdgeSharpenStripeRows 32
+
+/* Fraction bits of the gain are (kEdgeSharpenGainBits - bit depth). */
+#define kEdgeSharpenGainBits 24
+
+/**
+ * @class EdgeSharpener
+ * @brief Unsharp mask of a 3x3 box: dst = src + coeff * (src - mean3x3).
+ * This is the former filter2D kernel {-c/9 x 8, 1 + 8c/9}, computed with
+ * integers only: the 3x3 sums come from horizontal sums of 3 pixels kept
+ * for 3 rows, and the result is clamped to 0 - (2^bits - 1) in the same
+ * pass. The borders are reflected (101), as filter2D does.
+ * The rows are processed in stripes in parallel. The horizontal sums of the
+ * rows around the stripes are made first, so dst may be src.
+ * With the luma only option, the detail of the luma is added to the three
+ * channels, so the colors are not sharpened (no color fringes).
+ */
+class EdgeSharpener {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  EdgeSharpener(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~EdgeSharpener(void);
+
+  /**
+   * @brief
+   * Sharpen an image.
+   * @param src [in] 8U or 16U image of 3 channels (BGR).
+   * @param coeff [in] strength of the sharpening (0: copy).
+   * @param bits [in] significant bits of the data (8 for 8U).
+   * @param is_luma_only [in] If true, sharpen the luma only.
+   * @param dst [out] sharpened image (may be src).
+   * @return If false, the format is not supported.
+   */
+  bool Apply(const cv::Mat& src, float coeff, int bits, bool is_luma_only,
+             cv::Mat* dst);
+
+ private:
+  /*! Horizontal sums: 3 rows per stripe, then 2 rows around each stripe */
+  std::vector<int> work_;
+};
+
+#endif /* _EDGE_SHARPEN_H_*/
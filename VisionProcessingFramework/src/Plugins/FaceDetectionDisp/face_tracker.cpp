@@ -0,0 +1,149 @@
+/**
+ * @file      face_tracker.cpp
+ * @brief     Lightweight tracker which carries face boxes between detections.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./face_tracker.h"
+#include <algorithm>
+#include <vector>
+#include "./output_disp_faceDetection_define.h"
+
+/**
+ * @brief
+ * Overlap ratio (intersection over union) of two boxes.
+ * @param a [in] box.
+ * @param b [in] box.
+ * @return overlap ratio.
+ */
+static float OverlapRatio(const cv::Rect& a, const cv::Rect& b) {
+  int left = std::max(a.x, b.x);
+  int top = std::max(a.y, b.y);
+  int right = std::min(a.x + a.width, b.x + b.width);
+  int bottom = std::min(a.y + a.height, b.y + b.height);
+  if (right <= left || bottom <= top) {
+    return 0.0f;
+  }
+  float intersection = static_cast<float>((right - left) * (bottom - top));
+  float area_union =
+      static_cast<float>(a.width * a.height + b.width * b.height) -
+      intersection;
+  return intersection / area_union;
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+FaceTracker::FaceTracker(void) { max_age_ = kFaceTrackMaxAge; }
+
+/**
+ * @brief
+ * Destructor.
+ */
+FaceTracker::~FaceTracker(void) {}
+
+/**
+ * @brief
+ * Update the tracks with a detection result.
+ * @param faces [in] detected boxes (display coordinates).
+ * @param frame_number [in] frame number of the detected frame.
+ */
+void FaceTracker::Update(const std::vector<cv::Rect>& faces,
+                         unsigned int frame_number) {
+  std::vector<bool> matched(tracks_.size(), false);
+
+  for (unsigned int i = 0; i < faces.size(); i++) {
+    int best_index = -1;
+    float best_ratio = kFaceTrackMinOverlap;
+    for (unsigned int j = 0; j < tracks_.size(); j++) {
+      if (matched[j]) {
+        continue;
+      }
+      float ratio =
+          OverlapRatio(PredictRect(tracks_[j], frame_number), faces[i]);
+      if (ratio > best_ratio) {
+        best_ratio = ratio;
+        best_index = j;
+      }
+    }
+
+    if (best_index < 0) {
+      FaceTrack track;
+      track.rect = faces[i];
+      track.velocity_x = 0.0f;
+      track.velocity_y = 0.0f;
+      track.detected_frame = frame_number;
+      tracks_.push_back(track);
+      matched.push_back(true);
+      continue;
+    }
+
+    // Smooth the motion between the last two detections.
+    FaceTrack& track = tracks_[best_index];
+    unsigned int elapsed = frame_number - track.detected_frame;
+    if (elapsed > 0) {
+      float velocity_x =
+          static_cast<float>(faces[i].x - track.rect.x) / elapsed;
+      float velocity_y =
+          static_cast<float>(faces[i].y - track.rect.y) / elapsed;
+      track.velocity_x = (track.velocity_x + velocity_x) * 0.5f;
+      track.velocity_y = (track.velocity_y + velocity_y) * 0.5f;
+    }
+    track.rect = faces[i];
+    track.detected_frame = frame_number;
+    matched[best_index] = true;
+  }
+
+  // Drop the tracks which were not detected for a while.
+  std::vector<FaceTrack>::iterator itr = tracks_.begin();
+  while (itr != tracks_.end()) {
+    if (frame_number - itr->detected_frame > max_age_) {
+      itr = tracks_.erase(itr);
+    } else {
+      ++itr;
+    }
+  }
+}
+
+/**
+ * @brief
+ * Get the boxes predicted for a frame.
+ * @param frame_number [in] frame number of the displayed frame.
+ * @param boxes [out] predicted boxes.
+ */
+void FaceTracker::Predict(unsigned int frame_number,
+                          std::vector<cv::Rect>* boxes) {
+  boxes->clear();
+  for (unsigned int i = 0; i < tracks_.size(); i++) {
+    if (frame_number - tracks_[i].detected_frame > max_age_) {
+      continue;
+    }
+    boxes->push_back(PredictRect(tracks_[i], frame_number));
+  }
+}
+
+/**
+ * @brief
+ * Remove all tracks.
+ */
+void FaceTracker::Clear(void) { tracks_.clear(); }
+
+/**
+ * @brief
+ * Get the box of a track moved to a frame.
+ * @param track [in] track.
+ * @param frame_number [in] frame number.
+ * @return predicted box.
+ */
+cv::Rect FaceTracker::PredictRect(const FaceTrack& track,
+                                  unsigned int frame_number) {
+  cv::Rect rect = track.rect;
+  if (frame_number > track.detected_frame) {
+    unsigned int elapsed = frame_number - track.detected_frame;
+    rect.x += static_cast<int>(track.velocity_x * elapsed);
+    rect.y += static_cast<int>(track.velocity_y * elapsed);
+  }
+  return rect;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file      face_tracker.h
+ * @brief     Lightweight tracker which carries face boxes between detections.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _FACE_TRACKER_H_
+#define _FACE_TRACKER_H_
+
+#include <vector>
+#include "./include.h"
+
+/**
+ * @struct FaceTrack
+ * @brief State of one tracked face.
+ */
+typedef struct FaceTrack {
+  /*! Box at the last detection (display coordinates) */
+  cv::Rect rect;
+  /*! Horizontal motion in pixels per frame */
+  float velocity_x;
+  /*! Vertical motion in pixels per frame */
+  float velocity_y;
+  /*! Frame number of the last detection */
+  unsigned int detected_frame;
+} FaceTrack;
+
+/**
+ * @class FaceTracker
+ * @brief Constant velocity tracker of face boxes.
+ * Detection results update the tracks, and the boxes of the frames between
+ * two detections are predicted from the last motion.
+ */
+class FaceTracker {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  FaceTracker(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~FaceTracker(void);
+
+  /**
+   * @brief
+   * Update the tracks with a detection result.
+   * @param faces [in] detected boxes (display coordinates).
+   * @param frame_number [in] frame number of the detected frame.
+   */
+  void Update(const std::vector<cv::Rect>& faces, unsigned int frame_number);
+
+  /**
+   * @brief
+   * Get the boxes predicted for a frame.
+   * @param frame_number [in] frame number of the displayed frame.
+   * @param boxes [out] predicted boxes.
+   */
+  void Predict(unsigned int frame_number, std::vector<cv::Rect>* boxes);
+
+  /**
+   * @brief
+   * Remove all tracks.
+   */
+  void Clear(void);
+
+  /**
+   * @brief
+   * Set the number of frames a track survives without detection.
+   * @param max_age [in] number of frames.
+   */
+  void set_max_age(unsigned int max_age) { max_age_ = max_age; }
+
+ private:
+  /**
+   * @brief
+   * Get the box of a track moved to a frame.
+   * @param track [in] track.
+   * @param frame_number [in] frame number.
+   * @return predicted box.
+   */
+  cv::Rect PredictRect(const FaceTrack& track, unsigned int frame_number);
+
+  /*! Current tracks */
+  std::vector<FaceTrack> tracks_;
+
+  /*! Number of frames a track survives without detection */
+  unsigned int max_age_;
+};
+
+#endif /* _FACE_TRACKER_H_*/
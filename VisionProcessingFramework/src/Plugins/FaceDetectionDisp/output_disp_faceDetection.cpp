@@ -30,13 +30,21 @@ OutputDispFaceDetection::OutputDispFaceDetection() : PluginBase() {
   wxString wx_string(plugin_name().c_str(), wxConvUTF8);
   wnd_->InitDialog();
   current_image_size = cvSize(0, 0);
+  frame_counter_ = 0;
+  detection_interval_ = kFaceDetectionInterval;
+  detection_scale_ = static_cast<float>(DETECT_IMAGE_RATIO) / 100;
+  result_frame_ = 0;
+  has_new_result_ = false;
 }
 
 /**
  * @brief
  * Destructor.
  */
-OutputDispFaceDetection::~OutputDispFaceDetection() { delete wnd_; }
+OutputDispFaceDetection::~OutputDispFaceDetection() {
+  StopAsyncProcess(false);
+  delete wnd_;
+}
 
 /**
  * @brief
@@ -50,6 +58,24 @@ bool OutputDispFaceDetection::InitProcess(CommonParam* common) {
   wnd_->SetWindowName(plugin_name());
   DEBUG_PRINT("PostCaptureInit!!!!!!!!!!\n");
   wnd_->PostCaptureInit();
+
+  // The classifier is loaded once and reused by every detection.
+  if (face_cascade_.empty() && face_cascade_.load(kFaceCascadeFile) == false) {
+    PLUGIN_LOG_ERROR("Failed to load the cascade file");
+    return false;
+  }
+  frame_counter_ = 0;
+  tracker_.Clear();
+  {
+    wxMutexLocker lock(result_mutex_);
+    has_new_result_ = false;
+  }
+
+  if (StartAsyncProcess(this, kFaceDetectionMaxInFlight, kAsyncDropNewest) ==
+      false) {
+    PLUGIN_LOG_ERROR("Failed to start the detection thread");
+    return false;
+  }
   return true;
 }
 
@@ -61,6 +87,11 @@ bool OutputDispFaceDetection::InitProcess(CommonParam* common) {
 void OutputDispFaceDetection::EndProcess() {
   DEBUG_PRINT("OutputDispFaceDetection::EndProcess \n");
   DEBUG_PRINT("PostCaptureEnd!!!!!!!!!!\n");
+  StopAsyncProcess(false);
+  if (wnd_->mailbox() != NULL) {
+    PLUGIN_LOG_MESSAGE("Display - skipped frames:%u",
+                       wnd_->mailbox()->skipped());
+  }
   current_image_size = cvSize(0, 0);
   wnd_->PostCaptureEnd();
 }
@@ -77,16 +108,14 @@ void OutputDispFaceDetection::DoPostProcess(void) {
 /**
  * @brief
  * Main routine of the OutputDispFaceDetection plugin.
+ * The display copy is drawn with the tracked boxes on every frame, and a
+ * downscaled frame is handed to the detection worker every
+ * detection_interval_ frames.
  * @param src_ipl [in] src image data.
  * @param dst_ipl [out] dst image data.
  * @return If true, success in the main processing.
  */
 bool OutputDispFaceDetection::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
-  cv::Mat* temp_image = NULL;
-  cv::Mat small_image;
-
-  cv::CascadeClassifier face_cascade;
-
   if (src_image == NULL) {
     DEBUG_PRINT("[OutputDispFaceDetection]src_image == NULL\n");
     return false;
@@ -97,59 +126,136 @@ bool OutputDispFaceDetection::DoProcess(cv::Mat* src_image, cv::Mat* dst_image)
     return false;
   }
 
-  if (src_image->depth() == CV_16U) {
-    temp_image = UtilGetCvConvertScale(src_image, UTIL_CONVERT_10U_TO_8U, 0);
-  }
+  current_image_size = src_image->size();
+  frame_counter_++;
+  FrameMetadata* metadata = frame_metadata();
+  unsigned int frame_number =
+      (metadata != NULL) ? metadata->frame_number : frame_counter_;
 
-  float resize_scale_ = (float)20/100;
-  if (src_image->depth() == CV_16U) {
-	cv::resize(*temp_image, small_image, cv::Size(), resize_scale_, resize_scale_);
-  } else {
-    cv::resize(*src_image, small_image, cv::Size(), resize_scale_, resize_scale_);
+  // Display copy, drawn straight into the mailbox slot of the window (the
+  // source frame is never modified).
+  FrameMailbox* mailbox = wnd_->mailbox();
+  if (mailbox == NULL) {
+    DEBUG_PRINT("[OutputDispFaceDetection]mailbox == NULL\n");
+    return false;
   }
+  // The 8 bit and the gray frames are shared with the other outputs of the
+  // same branch.
+  const cv::Mat* image = GetDerivedImage(src_image, kFrameDerived8U);
+  if (image == NULL) {
+    DEBUG_PRINT("[OutputDispFaceDetection]convert failed\n");
+    return false;
+  }
+  FrameMailboxSlot* slot = mailbox->BeginPush();
+  cv::Mat& display_image = slot->image;
+  image->copyTo(display_image);
 
-  std::vector<cv::Rect> faces;
-  face_cascade.load( "/usr/share/opencv/haarcascades/haarcascade_frontalface_alt2.xml" );
-  face_cascade.detectMultiScale( small_image, faces, 1.1, 2, 0|CV_HAAR_SCALE_IMAGE, cv::Size(10, 10) );
-  //face_cascade.detectMultiScale( small_image, faces, 1.1, 2, 0|CV_HAAR_SCALE_IMAGE, cv::Size(30, 30) );
-
-  if (src_image->depth() == CV_16U) {
-	for ( int i = 0; i < (int)faces.size(); i++ ) {
-	  cv::Point lefttop ( faces[i].x*((float)1/resize_scale_), faces[i].y*((float)1/resize_scale_));
-	  cv::Point rightbottom ( (faces[i].x + faces[i].width)*((float)1/resize_scale_),(faces[i].y + faces[i].height)*((float)1/resize_scale_));
-	  cv::rectangle( *temp_image, lefttop, rightbottom, cv::Scalar( 255, 0,0 ), 1);
-	}
-  } else {
-    for ( int i = 0; i < (int)faces.size(); i++ ) {
-      cv::Point lefttop ( faces[i].x*((float)1/resize_scale_), faces[i].y*((float)1/resize_scale_));
-      cv::Point rightbottom ( (faces[i].x + faces[i].width)*((float)1/resize_scale_),(faces[i].y + faces[i].height)*((float)1/resize_scale_));
-      cv::rectangle( *src_image, lefttop, rightbottom, cv::Scalar( 255, 0,0 ), 1);
+  // Hand a downscaled gray frame to the worker when it is idle.
+  if ((frame_counter_ % detection_interval_) == 0 && in_flight_frames() == 0) {
+    // The nearest pyramid level of the gray frame is shared with the other
+    // outputs of the branch; only the last step is done here.
+    cv::Size small_size(
+        std::max(1, cvRound(image->cols * detection_scale_)),
+        std::max(1, cvRound(image->rows * detection_scale_)));
+    int level = FramePyramid::LevelFor(image->size(), small_size);
+    const cv::Mat* gray_image =
+        GetDerivedLevel(src_image, kFrameDerivedGray8U, level);
+    if (gray_image == NULL ||
+        !resizer_.Resize(*gray_image, small_size, &small_gray_image_)) {
+      DEBUG_PRINT("[OutputDispFaceDetection]convert failed\n");
+      return false;
     }
+    // The frame number travels to the worker with the frame metadata.
+    SubmitAsyncFrame(small_gray_image_);
   }
-  if (src_image->depth() == CV_16U) {
-    if (temp_image) {
-      if (wnd_->Enqueue(temp_image) == false) {
-        DEBUG_PRINT("Enqueue failed");
-        delete temp_image;
-        return false;
-      } else {
-        delete temp_image;
-      }
+
+  // Take the latest detection result, and carry the boxes to this frame.
+  {
+    wxMutexLocker lock(result_mutex_);
+    if (has_new_result_) {
+      tracker_.Update(result_faces_, result_frame_);
+      has_new_result_ = false;
     }
-  } else {
-    if (wnd_->Enqueue(src_image) == false) {
-      DEBUG_PRINT("Enqueue failed");
-      return false;
+  }
+  tracker_.Predict(frame_number, &draw_faces_);
+  for (unsigned int i = 0; i < draw_faces_.size(); i++) {
+    cv::rectangle(display_image, draw_faces_[i], cv::Scalar(255, 0, 0), 1);
+    if (metadata != NULL) {
+      FrameMetadataAddBox(metadata, draw_faces_[i], kFaceDetectionBoxLabel,
+                          1.0f);
     }
   }
 
-  current_image_size = src_image->size();
+  FrameMetadataCopy(&slot->metadata, metadata);
+  mailbox->EndPush();
 
   //  DEBUG_PRINT("PostCapture!!!!!!!!!!\n");
   wnd_->PostCapture();
   return true;
 }
 
+/**
+ * @brief
+ * Asynchronous routine of the OutputDispFaceDetection plugin.
+ * Detect faces on the downscaled frame and publish the boxes.
+ * @param image [in] downscaled gray frame owned by the worker.
+ * @param metadata [in] metadata of the frame owned by the worker.
+ * @return If true, success in the detection.
+ */
+bool OutputDispFaceDetection::DoAsyncProcess(cv::Mat* image,
+                                             FrameMetadata* metadata) {
+  if (face_cascade_.empty()) {
+    return false;
+  }
+
+  unsigned int frame_number = metadata->frame_number;
+  face_cascade_.detectMultiScale(*image, detect_faces_, 1.1, 2,
+                                 0 | CV_HAAR_SCALE_IMAGE, cv::Size(10, 10));
+
+  // Scale the boxes to the display coordinates.
+  float ratio = 1.0f / detection_scale_;
+  for (unsigned int i = 0; i < detect_faces_.size(); i++) {
+    detect_faces_[i].x = static_cast<int>(detect_faces_[i].x * ratio);
+    detect_faces_[i].y = static_cast<int>(detect_faces_[i].y * ratio);
+    detect_faces_[i].width = static_cast<int>(detect_faces_[i].width * ratio);
+    detect_faces_[i].height =
+        static_cast<int>(detect_faces_[i].height * ratio);
+  }
+
+  wxMutexLocker lock(result_mutex_);
+  result_faces_ = detect_faces_;
+  result_frame_ = frame_number;
+  has_new_result_ = true;
+  return true;
+}
+
+/**
+ * @brief
+ * The display path runs on every frame, so the framework never skips this
+ * plugin. The detection worker drops frames by itself.
+ * @return true.
+ */
+bool OutputDispFaceDetection::CanAcceptAsyncFrame(void) { return true; }
+
+/**
+ * @brief
+ * Set the list of parameter setting string for the OutputDispFaceDetection
+ * plugin.
+ * @param params [in] settings string. [0] detection interval (frames),
+ * [1] detection image ratio (percent).
+ */
+void OutputDispFaceDetection::SetPluginSettings(std::vector<wxString> params) {
+  long value;  // NOLINT
+  if (params.size() > 0 && params[0].ToLong(&value) && value > 0) {
+    detection_interval_ = static_cast<unsigned int>(value);
+  }
+  if (params.size() > 1 && params[1].ToLong(&value) && value > 0 &&
+      value <= 100) {
+    detection_scale_ = static_cast<float>(value) / 100;
+  }
+  PluginBase::SetPluginSettings(params);
+}
+
 /**
  * @brief
  * Set onepush rectangle for common param..
@@ -215,117 +321,6 @@ void OutputDispFaceDetection::SetOnepushRectangle(cv::Point start, cv::Point end
   common_->SetOnepushRectabgle(start_x, start_y, end_x, end_y);
 }
 
-/**
- * @brief
- * Convert the bit depth of image.
- * @param src_image [in] Pointer to the src image
- * @param cvt_mode [in] enum UtilConvertMode
- * @param shift [in] Value added to the scaled source array elements
- * @return Pointer to the converted image.
- */
-cv::Mat* OutputDispFaceDetection::UtilGetCvConvertScale(cv::Mat* src_image,
-                                                 int cvt_mode, double shift) {
-  cv::Mat* dst_image;
-  int src_channels = src_image->channels();
-  int max_width = src_image->size().width * src_channels;
-  double scale;
-
-  if (cvt_mode == UTIL_CONVERT_10U_TO_8U) {
-    switch (src_channels) {
-      case 1:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height), CV_8UC1);
-        break;
-      case 3:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height), CV_8UC3);
-        break;
-      default:
-        return NULL;
-    }
-    scale = 1.0 / 4.0;  // change scale 10bit -> 8bit
-  } else if (cvt_mode == UTIL_CONVERT_10U_TO_16U) {
-    switch (src_channels) {
-      case 1:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height),
-            CV_16UC1);
-        break;
-      case 3:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height),
-            CV_16UC3);
-        break;
-      default:
-        return NULL;
-    }
-    scale = 64.0;  // change scale 10bit -> 16bit
-  } else {
-    DEBUG_PRINT("Invalid convert mode =%d return NULL", cvt_mode);
-    return NULL;
-  }
-
-  if (cvt_mode == UTIL_CONVERT_10U_TO_8U) {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i = 0; i < dst_image->size().height; i++) {
-      for (int j = 0; j < max_width; j += src_channels) {
-        ((unsigned char*)(dst_image->data + dst_image->step * i))[j] =
-            (reinterpret_cast<INT16*>(src_image->data +
-                                      src_image->step * i))[j] *
-                scale +
-            shift;
-        if (src_channels == 3) {
-          ((unsigned char*)(dst_image->data + dst_image->step * i))[j + 1] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 1] *
-                  scale +
-              shift;
-          ((unsigned char*)(dst_image->data + dst_image->step * i))[j + 2] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 2] *
-                  scale +
-              shift;
-        }
-      }
-    }
-  } else if (cvt_mode == UTIL_CONVERT_10U_TO_16U) {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i = 0; i < dst_image->size().height; i++) {
-      for (int j = 0; j < max_width; j += src_channels) {
-        // 16bit code
-        (reinterpret_cast<INT16*>(dst_image->data + dst_image->step * i))[j] =
-            (reinterpret_cast<INT16*>(src_image->data +
-                                      src_image->step * i))[j] *
-                scale +
-            shift;
-        if (src_channels == 3) {
-          (reinterpret_cast<INT16*>(dst_image->data +
-                                    dst_image->step * i))[j + 1] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 1] *
-                  scale +
-              shift;
-          (reinterpret_cast<INT16*>(dst_image->data +
-                                    dst_image->step * i))[j + 2] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 2] *
-                  scale +
-              shift;
-        }
-      }
-    }
-  } else {
-    DEBUG_PRINT("Invalid convert mode =%d return NULL", cvt_mode);
-    return NULL;
-  }
-
-  return dst_image;
-}
-
 extern "C" PluginBase* Create(void) {
   DEBUG_PRINT("Create OutputDispFaceDetection plugins\n");
   OutputDispFaceDetection* plugin = new OutputDispFaceDetection();
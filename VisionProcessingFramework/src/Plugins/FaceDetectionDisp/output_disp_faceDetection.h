@@ -8,23 +8,22 @@
 #ifndef _OUTPUT_DISP_FACEDETECTION_H_
 #define _OUTPUT_DISP_FACEDETECTION_H_
 
+#include <vector>
+#include "./async_frame_worker.h"
 #include "./common_param.h"
+#include "./face_tracker.h"
+#include "./image_resizer.h"
 #include "./output_disp_faceDetection_define.h"
 #include "./output_disp_faceDetection_wnd.h"
 #include "./plugin_base.h"
 
 class OutputDispFaceDetectionWnd;
 
-enum UtilConvertMode {
-  UTIL_CONVERT_10U_TO_8U = 0,
-  UTIL_CONVERT_10U_TO_16U,
-};
-
 /**
  * @class OutputDispFaceDetection
  * @brief Display plugin by using Opencv.
  */
-class OutputDispFaceDetection : public PluginBase {
+class OutputDispFaceDetection : public PluginBase, public AsyncFrameHandler {
  private:
   /*! Common parameter */
   CommonParam* common_;
@@ -36,6 +35,45 @@ class OutputDispFaceDetection : public PluginBase {
       confirming the screen size in one push function. */
   CvSize current_image_size;
 
+  /*! Cascade classifier, loaded once */
+  cv::CascadeClassifier face_cascade_;
+
+  /*! Downscaled gray frame handed to the detection worker */
+  cv::Mat small_gray_image_;
+
+  /*! Resize from the nearest pyramid level to the detection size */
+  ImageResizer resizer_;
+
+  /*! Number of the frames received since InitProcess */
+  unsigned int frame_counter_;
+
+  /*! Run the detection every N frames */
+  unsigned int detection_interval_;
+
+  /*! Scale of the detection image */
+  float detection_scale_;
+
+  /*! Boxes detected by the worker (worker thread only) */
+  std::vector<cv::Rect> detect_faces_;
+
+  /*! Latest detection result */
+  std::vector<cv::Rect> result_faces_;
+
+  /*! Frame number of the latest detection result */
+  unsigned int result_frame_;
+
+  /*! Whether the latest detection result is not yet taken */
+  bool has_new_result_;
+
+  /*! Lock for the latest detection result */
+  wxMutex result_mutex_;
+
+  /*! Tracker which carries the boxes between detections */
+  FaceTracker tracker_;
+
+  /*! Boxes drawn on the current frame */
+  std::vector<cv::Rect> draw_faces_;
+
  public:
   /**
    * @brief
@@ -74,12 +112,42 @@ class OutputDispFaceDetection : public PluginBase {
   /**
    * @brief
    * Main routine of the OutputDispFaceDetection plugin.
+   * The display copy is drawn with the tracked boxes on every frame, and a
+   * downscaled frame is handed to the detection worker every
+   * detection_interval_ frames.
    * @param src_ipl [in] src image data.
    * @param dst_ipl [out] dst image data.
    * @return If true, success in the main processing.
    */
   virtual bool DoProcess(cv::Mat* src_image, cv::Mat* dst_image);
 
+  /**
+   * @brief
+   * Asynchronous routine of the OutputDispFaceDetection plugin.
+   * Detect faces on the downscaled frame and publish the boxes.
+   * @param image [in] downscaled gray frame owned by the worker.
+   * @param metadata [in] metadata of the frame owned by the worker.
+   * @return If true, success in the detection.
+   */
+  virtual bool DoAsyncProcess(cv::Mat* image, FrameMetadata* metadata);
+
+  /**
+   * @brief
+   * The display path runs on every frame, so the framework never skips this
+   * plugin. The detection worker drops frames by itself.
+   * @return true.
+   */
+  virtual bool CanAcceptAsyncFrame(void);
+
+  /**
+   * @brief
+   * Set the list of parameter setting string for the OutputDispFaceDetection
+   * plugin.
+   * @param params [in] settings string. [0] detection interval (frames),
+   * [1] detection image ratio (percent).
+   */
+  virtual void SetPluginSettings(std::vector<wxString> params);
+
   /**
    * @brief
    * Set onepush rectangle for common param.
@@ -88,16 +156,5 @@ class OutputDispFaceDetection : public PluginBase {
    */
   virtual void SetOnepushRectangle(cv::Point start, cv::Point end);
 
- private:
-  /**
-   * @brief
-   * Convert the bit depth of image.
-   * @param src_image [in] Pointer to the src image
-   * @param cvt_mode [in] enum UtilConvertMode
-   * @param shift [in] Value added to the scaled source array elements
-   * @return Pointer to the converted image.
-   */
-  virtual cv::Mat* UtilGetCvConvertScale(cv::Mat* src_image, int cvt_mode,
-                                         double shift);
 };
 #endif /* _OUTPUT_DISP_FACEDETECTION_H_*/
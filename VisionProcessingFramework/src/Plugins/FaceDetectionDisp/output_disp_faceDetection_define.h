@@ -32,4 +32,22 @@ typedef cv::Mat* data_t;
 
 #define DETECT_IMAGE_RATIO 20
 
+/* Frames in flight for the asynchronous detection path */
+#define kFaceDetectionMaxInFlight 1
+
+/* Cascade file loaded once at InitProcess */
+#define kFaceCascadeFile \
+  "/usr/share/opencv/haarcascades/haarcascade_frontalface_alt2.xml"
+
+/* Run the detection every N frames (first settings parameter) */
+#define kFaceDetectionInterval 5
+
+/* Tracker: frames a face survives without detection */
+#define kFaceTrackMaxAge 30
+/* Tracker: minimum overlap ratio to match a detection to a track */
+#define kFaceTrackMinOverlap 0.2f
+
+/* Label of the face boxes appended to the frame metadata */
+#define kFaceDetectionBoxLabel 1
+
 #endif /* _OUTPUT_DISP_FACEDETECTION_DEFINE_H_*/
@@ -52,7 +52,7 @@ OutputDispFaceDetectionWnd::OutputDispFaceDetectionWnd(OutputDispFaceDetection*
   is_drawing_rect = false;
   draw_rect_image = NULL;
 
-  que_manager_ = new QueManager();
+  mailbox_ = new FrameMailbox(kFrameMailboxLatestDepth);
 #ifdef _INHIBIT_POST_EVENT_
   is_send_capture_update = false;
 #endif /* _INHIBIT_POST_EVENT_ */
@@ -81,24 +81,14 @@ void OutputDispFaceDetectionWnd::OnClose(wxCloseEvent& event) { Show(false); }
 
 /**
  * @brief
- * Enqueue cv::Mat data.
- * @param enq_data [in] cv::Mat data.
+ * Delete the frame mailbox.
  */
-bool OutputDispFaceDetectionWnd::Enqueue(data_t enq_data) {
-  if (que_manager_ == NULL) {
-    DEBUG_PRINT("Enqueue Image data fail : que_manager_ is NULL\n");
-  } else {
-    return que_manager_->Enqueue(enq_data);
-  }
-  return false;
+void OutputDispFaceDetectionWnd::DeleteQueue() {
+  draw_rect_image = NULL;
+  delete mailbox_;
+  mailbox_ = NULL;
 }
 
-/**
- * @brief
- * Delete cv::Mat data queue.
- */
-void OutputDispFaceDetectionWnd::DeleteQueue() { delete que_manager_; }
-
 /**
  * @brief
  * The handler function for local event(CAPTURE_UPDATE).
@@ -107,8 +97,21 @@ void OutputDispFaceDetectionWnd::DeleteQueue() { delete que_manager_; }
 void OutputDispFaceDetectionWnd::OnCapture(wxCommandEvent& event) {
   //  DEBUG_PRINT("OutputDispFaceDetectionWnd::OnCapture\n");
   cv::Mat* que;
+  unsigned int skipped = 0;
 
-  que = que_manager_->Dequeue();
+  // Coalesced events find no new frame; the last one stays on the screen.
+  FrameMailboxSlot* slot = mailbox_->Acquire(&skipped);
+  if (slot == NULL) {
+#ifdef _INHIBIT_POST_EVENT_
+    is_send_capture_update = false;
+#endif /* _INHIBIT_POST_EVENT_ */
+    return;
+  }
+  if (skipped != 0) {
+    DEBUG_PRINT("OutputDispFaceDetectionWnd::OnCapture skipped:%u\n",
+                skipped);
+  }
+  que = &slot->image;
   draw_rect_image = que;
   if ((que->size().width == 0) || (que->size().height == 0)) {
     DEBUG_PRINT("size w:%d h:%d\n", que->size().width, que->size().height);
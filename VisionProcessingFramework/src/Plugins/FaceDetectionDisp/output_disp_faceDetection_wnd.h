@@ -17,7 +17,7 @@
 #include "./include.h"
 #include "./output_disp_faceDetection.h"
 #include "./output_disp_faceDetection_define.h"
-#include "./que_manager.h"
+#include "./frame_mailbox.h"
 
 class OutputDispFaceDetection;
 
@@ -27,8 +27,8 @@ class OutputDispFaceDetection;
  */
 class OutputDispFaceDetectionWnd : public wxFrame {
  private:
-  /*! Management OpenCV image que */
-  QueManager* que_manager_;
+  /*! Latest frame from the plugin (the flow thread writes it) */
+  FrameMailbox* mailbox_;
   /*! Frame counter of this plugin. use this for FPS calculation. */
   int frame_count_;
   /*! Set a current time by GetTickCount() in  FPS captureing process. */
@@ -94,10 +94,11 @@ class OutputDispFaceDetectionWnd : public wxFrame {
 
   /**
    * @brief
-   * Enqueue cv::Mat data.
-   * @param enq_data [in] cv::Mat data.
+   * Get the frame mailbox. The plugin draws the next frame straight into
+   * the slot given by BeginPush(), so the frame is not copied again.
+   * @return frame mailbox.
    */
-  bool Enqueue(data_t enq_data);
+  FrameMailbox* mailbox(void) { return mailbox_; }
 
   /**
    * @brief
@@ -112,7 +113,7 @@ class OutputDispFaceDetectionWnd : public wxFrame {
 
   /**
    * @brief
-   * Delete cv::Mat data queue.
+   * Delete the frame mailbox.
    */
   void DeleteQueue();
 
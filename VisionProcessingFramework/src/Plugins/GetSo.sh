@@ -21,3 +21,6 @@ cp OpenCVDisp/OpenCVDisp.so ../../lib/Plugins/output/
 cp OpenGLDisp/OpenGLDisp.so ../../lib/Plugins/output/
 cp SensorFocus/SensorFocus.so ../../lib/Plugins/output/
 cp SaveToAvi/SaveToAvi.so ../../lib/Plugins/output/
+cp RingRecorder/RingRecorder.so ../../lib/Plugins/output/
+cp AutoFocus/AutoFocus.so ../../lib/Plugins/output/
+cp AutoExposure/AutoExposure.so ../../lib/Plugins/output/
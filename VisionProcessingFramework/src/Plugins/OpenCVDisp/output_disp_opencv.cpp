@@ -7,6 +7,7 @@
 
 #include "./output_disp_opencv.h"
 #include <vector>
+#include "./pixel_convert.h"
 
 /**
  * @brief
@@ -30,13 +31,19 @@ OutputDispOpencv::OutputDispOpencv() : PluginBase() {
   wxString wx_string(plugin_name().c_str(), wxConvUTF8);
   wnd_->InitDialog();
   current_image_size = cvSize(0, 0);
+  display_downscale_ = 1;
+  shown_at_start_ = 0;
+  skipped_at_start_ = 0;
 }
 
 /**
  * @brief
  * Destructor.
  */
-OutputDispOpencv::~OutputDispOpencv() { delete wnd_; }
+OutputDispOpencv::~OutputDispOpencv() {
+  StopAsyncProcess(false);
+  delete wnd_;
+}
 
 /**
  * @brief
@@ -50,6 +57,16 @@ bool OutputDispOpencv::InitProcess(CommonParam* common) {
   wnd_->SetWindowName(plugin_name());
   DEBUG_PRINT("PostCaptureInit!!!!!!!!!!\n");
   wnd_->PostCaptureInit();
+  refresh_clock_.Configure(kPipelineClockRealTime, kOpenCVDispMaxFps, 1.0);
+  refresh_clock_.Start();
+  display_downscale_ = 1;
+  shown_at_start_ = wnd_->shown_frames();
+  skipped_at_start_ = wnd_->skipped_frames();
+  if (StartAsyncProcess(this, kOpenCVDispMaxInFlight, kAsyncDropOldest) ==
+      false) {
+    PLUGIN_LOG_ERROR("Failed to start the display thread");
+    return false;
+  }
   return true;
 }
 
@@ -61,6 +78,14 @@ bool OutputDispOpencv::InitProcess(CommonParam* common) {
 void OutputDispOpencv::EndProcess() {
   DEBUG_PRINT("OutputDispOpencv::EndProcess \n");
   DEBUG_PRINT("PostCaptureEnd!!!!!!!!!!\n");
+  StopAsyncProcess(false);
+  // Skipped: replaced while waiting for the refresh, or while the window
+  // was still drawing the previous frame.
+  unsigned int skipped_by_window = wnd_->skipped_frames() - skipped_at_start_;
+  PLUGIN_LOG_MESSAGE("Display - shown:%u skipped:%u (refresh:%u window:%u)",
+                     wnd_->shown_frames() - shown_at_start_,
+                     async_dropped_frames() + skipped_by_window,
+                     async_dropped_frames(), skipped_by_window);
   current_image_size = cvSize(0, 0);
   wnd_->PostCaptureEnd();
 }
@@ -82,8 +107,6 @@ void OutputDispOpencv::DoPostProcess(void) {
  * @return If true, success in the main processing.
  */
 bool OutputDispOpencv::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
-  cv::Mat* temp_image;
-
   if (src_image == NULL) {
     DEBUG_PRINT("[OutputDispOpencv]src_image == NULL\n");
     return false;
@@ -94,31 +117,71 @@ bool OutputDispOpencv::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
     return false;
   }
 
-  if (src_image->depth() == CV_16U) {
-    temp_image = UtilGetCvConvertScale(src_image, UTIL_CONVERT_10U_TO_8U, 0);
-    if (temp_image) {
-      if (wnd_->Enqueue(temp_image) == false) {
-        DEBUG_PRINT("Enqueue failed");
-        delete temp_image;
-        return false;
-      } else {
-        delete temp_image;
-      }
-    }
-  } else {
-    if (wnd_->Enqueue(src_image) == false) {
-      DEBUG_PRINT("Enqueue failed");
+  current_image_size = src_image->size();
+
+  const cv::Mat* image = src_image;
+  if (frame_derivatives() != NULL) {
+    // The 8 bit frame is shared with the other outputs of the same branch.
+    image = GetDerivedImage(src_image, kFrameDerived8U);
+    if (image == NULL) {
+      DEBUG_PRINT("[OutputDispOpencv]convert failed\n");
       return false;
     }
   }
 
-  current_image_size = src_image->size();
+  // The worker keeps only the newest frame: the processing thread never
+  // waits for the display.
+  SubmitAsyncFrame(*image);
+  return true;
+}
+
+/**
+ * @brief
+ * Asynchronous routine of the OutputDispOpencv plugin.
+ * Scale and convert the frame taken after the refresh wait (the newest) to
+ * 8bit in one pass straight into the mailbox of the displaying window.
+ * @param image [in] frame owned by the worker.
+ * @param metadata [in] metadata of the frame owned by the worker.
+ * @return If true, the frame was passed to the window.
+ */
+bool OutputDispOpencv::DoAsyncProcess(cv::Mat* image,
+                                      FrameMetadata* metadata) {
+  FrameMailbox* mailbox = wnd_->mailbox();
+  if (mailbox == NULL) {
+    DEBUG_PRINT("[OutputDispOpencv]mailbox == NULL\n");
+    return false;
+  }
+
+  FrameMailboxSlot* slot = mailbox->BeginPush();
+  if (slot == NULL) {
+    return false;
+  }
+  int downscale = DisplayDownscale(image->size());
+  if (PixelConvertTo8U(*image, kPixelConvertSensorBits, downscale,
+                       &slot->image) == false) {
+    DEBUG_PRINT("[OutputDispOpencv]convert failed\n");
+    return false;
+  }
+  FrameMetadataCopy(&slot->metadata, metadata);
+  mailbox->EndPush();
+  display_downscale_ = downscale;
 
   //  DEBUG_PRINT("PostCapture!!!!!!!!!!\n");
   wnd_->PostCapture();
   return true;
 }
 
+/**
+ * @brief
+ * Wait for the next refresh of the window (worker thread). The worker then
+ * takes the newest frame queued during the wait.
+ * @return true.
+ */
+bool OutputDispOpencv::PaceAsyncProcess(void) {
+  refresh_clock_.WaitNextFrame();
+  return true;
+}
+
 /**
  * @brief
  * Set onepush rectangle for common param..
@@ -136,6 +199,13 @@ void OutputDispOpencv::SetOnepushRectangle(cv::Point start, cv::Point end) {
     return;
   }
 
+  // The window shows the frame downscaled.
+  int downscale = display_downscale_;
+  start.x *= downscale;
+  start.y *= downscale;
+  end.x *= downscale;
+  end.y *= downscale;
+
   // If the mouse is clicked(or released) on the outside
   // of the screen(top or left side), correct x, y coordinate by 0.
   if (start.x < 0) {
@@ -186,113 +256,18 @@ void OutputDispOpencv::SetOnepushRectangle(cv::Point start, cv::Point end) {
 
 /**
  * @brief
- * Convert the bit depth of image.
- * @param src_image [in] Pointer to the src image
- * @param cvt_mode [in] enum UtilConvertMode
- * @param shift [in] Value added to the scaled source array elements
- * @return Pointer to the converted image.
+ * Get the downscale which fits a frame in the window.
+ * @param size [in] size of the frame.
+ * @return downscale (1, 2 or 4).
  */
-cv::Mat* OutputDispOpencv::UtilGetCvConvertScale(cv::Mat* src_image,
-                                                 int cvt_mode, double shift) {
-  cv::Mat* dst_image;
-  int src_channels = src_image->channels();
-  int max_width = src_image->size().width * src_channels;
-  double scale;
-
-  if (cvt_mode == UTIL_CONVERT_10U_TO_8U) {
-    switch (src_channels) {
-      case 1:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height), CV_8UC1);
-        break;
-      case 3:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height), CV_8UC3);
-        break;
-      default:
-        return NULL;
-    }
-    scale = 1.0 / 4.0;  // change scale 10bit -> 8bit
-  } else if (cvt_mode == UTIL_CONVERT_10U_TO_16U) {
-    switch (src_channels) {
-      case 1:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height),
-            CV_16UC1);
-        break;
-      case 3:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height),
-            CV_16UC3);
-        break;
-      default:
-        return NULL;
-    }
-    scale = 64.0;  // change scale 10bit -> 16bit
-  } else {
-    DEBUG_PRINT("Invalid convert mode =%d return NULL", cvt_mode);
-    return NULL;
+int OutputDispOpencv::DisplayDownscale(CvSize size) {
+  int downscale = 1;
+  while (downscale < kOpenCVDispMaxDownscale &&
+         (size.width / downscale > WND_SIZE_W ||
+          size.height / downscale > WND_SIZE_H)) {
+    downscale *= 2;
   }
-
-  if (cvt_mode == UTIL_CONVERT_10U_TO_8U) {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i = 0; i < dst_image->size().height; i++) {
-      for (int j = 0; j < max_width; j += src_channels) {
-        ((unsigned char*)(dst_image->data + dst_image->step * i))[j] =
-            (reinterpret_cast<INT16*>(src_image->data +
-                                      src_image->step * i))[j] *
-                scale +
-            shift;
-        if (src_channels == 3) {
-          ((unsigned char*)(dst_image->data + dst_image->step * i))[j + 1] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 1] *
-                  scale +
-              shift;
-          ((unsigned char*)(dst_image->data + dst_image->step * i))[j + 2] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 2] *
-                  scale +
-              shift;
-        }
-      }
-    }
-  } else if (cvt_mode == UTIL_CONVERT_10U_TO_16U) {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i = 0; i < dst_image->size().height; i++) {
-      for (int j = 0; j < max_width; j += src_channels) {
-        // 16bit code
-        (reinterpret_cast<INT16*>(dst_image->data + dst_image->step * i))[j] =
-            (reinterpret_cast<INT16*>(src_image->data +
-                                      src_image->step * i))[j] *
-                scale +
-            shift;
-        if (src_channels == 3) {
-          (reinterpret_cast<INT16*>(dst_image->data +
-                                    dst_image->step * i))[j + 1] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 1] *
-                  scale +
-              shift;
-          (reinterpret_cast<INT16*>(dst_image->data +
-                                    dst_image->step * i))[j + 2] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 2] *
-                  scale +
-              shift;
-        }
-      }
-    }
-  } else {
-    DEBUG_PRINT("Invalid convert mode =%d return NULL", cvt_mode);
-    return NULL;
-  }
-
-  return dst_image;
+  return downscale;
 }
 
 extern "C" PluginBase* Create(void) {
@@ -8,23 +8,20 @@
 #ifndef _OUTPUT_DISP_OPENCV_H_
 #define _OUTPUT_DISP_OPENCV_H_
 
+#include "./async_frame_worker.h"
 #include "./common_param.h"
 #include "./output_disp_opencv_define.h"
 #include "./output_disp_opencv_wnd.h"
+#include "./pipeline_clock.h"
 #include "./plugin_base.h"
 
 class OutputDispOpencvWnd;
 
-enum UtilConvertMode {
-  UTIL_CONVERT_10U_TO_8U = 0,
-  UTIL_CONVERT_10U_TO_16U,
-};
-
 /**
  * @class OutputDispOpencv
  * @brief Display plugin by using Opencv.
  */
-class OutputDispOpencv : public PluginBase {
+class OutputDispOpencv : public PluginBase, public AsyncFrameHandler {
  private:
   /*! Common parameter */
   CommonParam* common_;
@@ -36,6 +33,18 @@ class OutputDispOpencv : public PluginBase {
       confirming the screen size in one push function. */
   CvSize current_image_size;
 
+  /*! Paces the display to kOpenCVDispMaxFps (the worker thread waits) */
+  PipelineClock refresh_clock_;
+
+  /*! Downscale of the displayed frame (1, 2 or 4) */
+  volatile int display_downscale_;
+
+  /*! Frames shown by the window before InitProcess */
+  unsigned int shown_at_start_;
+
+  /*! Frames skipped by the window before InitProcess */
+  unsigned int skipped_at_start_;
+
  public:
   /**
    * @brief
@@ -80,6 +89,25 @@ class OutputDispOpencv : public PluginBase {
    */
   virtual bool DoProcess(cv::Mat* src_image, cv::Mat* dst_image);
 
+  /**
+   * @brief
+   * Asynchronous routine of the OutputDispOpencv plugin.
+   * Scale and convert the frame taken after the refresh wait (the newest)
+   * to 8bit in one pass straight into the mailbox of the displaying window.
+   * @param image [in] frame owned by the worker.
+   * @param metadata [in] metadata of the frame owned by the worker.
+   * @return If true, the frame was passed to the window.
+   */
+  virtual bool DoAsyncProcess(cv::Mat* image, FrameMetadata* metadata);
+
+  /**
+   * @brief
+   * Wait for the next refresh of the window (worker thread). The worker
+   * then takes the newest frame queued during the wait.
+   * @return true.
+   */
+  virtual bool PaceAsyncProcess(void);
+
   /**
    * @brief
    * Set onepush rectangle for common param.
@@ -91,13 +119,10 @@ class OutputDispOpencv : public PluginBase {
  private:
   /**
    * @brief
-   * Convert the bit depth of image.
-   * @param src_image [in] Pointer to the src image
-   * @param cvt_mode [in] enum UtilConvertMode
-   * @param shift [in] Value added to the scaled source array elements
-   * @return Pointer to the converted image.
+   * Get the downscale which fits a frame in the window.
+   * @param size [in] size of the frame.
+   * @return downscale (1, 2 or 4).
    */
-  virtual cv::Mat* UtilGetCvConvertScale(cv::Mat* src_image, int cvt_mode,
-                                         double shift);
+  static int DisplayDownscale(CvSize size);
 };
 #endif /* _OUTPUT_DISP_OPENCV_H_*/
@@ -30,4 +30,16 @@ typedef cv::Mat* data_t;
 #define kPutTextPointH 28
 #define kScalarMax 255
 
+/* Frames in flight for the asynchronous display path (latest frame wins) */
+#define kOpenCVDispMaxInFlight 2
+
+/* Refresh cap of the display (frames per second) */
+#define kOpenCVDispMaxFps 60.0
+
+/* Wait of cv::waitKey() which lets HighGUI draw the window (msec) */
+#define kOpenCVDispWaitKeyMsec 1
+
+/* Largest downscale to fit the frame in WND_SIZE_W x WND_SIZE_H */
+#define kOpenCVDispMaxDownscale 4
+
 #endif /* _OUTPUT_DISP_OPENCV_DEFINE_H_*/
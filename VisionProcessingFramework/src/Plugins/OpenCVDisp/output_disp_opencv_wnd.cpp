@@ -44,6 +44,7 @@ OutputDispOpencvWnd::OutputDispOpencvWnd(OutputDispOpencv* owner_plugin)
   owner_plugin_ = owner_plugin;
 
   frame_count_ = 0;
+  display_slot_ = NULL;
   now_time_ = 0;
   diff_time_ = 0;
   fps_ = 0;
@@ -52,10 +53,9 @@ OutputDispOpencvWnd::OutputDispOpencvWnd(OutputDispOpencv* owner_plugin)
   is_drawing_rect = false;
   draw_rect_image = NULL;
 
-  que_manager_ = new QueManager();
-#ifdef _INHIBIT_POST_EVENT_
-  is_send_capture_update = false;
-#endif /* _INHIBIT_POST_EVENT_ */
+  mailbox_ = new FrameMailbox(kFrameMailboxLatestDepth);
+  is_capture_pending_ = 0;
+  shown_frames_ = 0;
 }
 
 /**
@@ -81,23 +81,23 @@ void OutputDispOpencvWnd::OnClose(wxCloseEvent& event) { Show(false); }
 
 /**
  * @brief
- * Enqueue cv::Mat data.
- * @param enq_data [in] cv::Mat data.
+ * Get the number of the frames replaced before they were displayed.
+ * @return number of the frames.
  */
-bool OutputDispOpencvWnd::Enqueue(data_t enq_data) {
-  if (que_manager_ == NULL) {
-    DEBUG_PRINT("Enqueue Image data fail : que_manager_ is NULL\n");
-  } else {
-    return que_manager_->Enqueue(enq_data);
-  }
-  return false;
+unsigned int OutputDispOpencvWnd::skipped_frames(void) const {
+  return (mailbox_ != NULL) ? mailbox_->skipped() : 0;
 }
 
 /**
  * @brief
- * Delete cv::Mat data queue.
+ * Delete the frame mailbox.
  */
-void OutputDispOpencvWnd::DeleteQueue() { delete que_manager_; }
+void OutputDispOpencvWnd::DeleteQueue() {
+  draw_rect_image = NULL;
+  display_slot_ = NULL;
+  delete mailbox_;
+  mailbox_ = NULL;
+}
 
 /**
  * @brief
@@ -107,8 +107,22 @@ void OutputDispOpencvWnd::DeleteQueue() { delete que_manager_; }
 void OutputDispOpencvWnd::OnCapture(wxCommandEvent& event) {
   //  DEBUG_PRINT("OutputDispOpencvWnd::OnCapture\n");
   cv::Mat* que;
+  unsigned int skipped = 0;
 
-  que = que_manager_->Dequeue();
+  // A frame pushed from now on needs a new event.
+  __sync_lock_release(&is_capture_pending_);
+  __sync_synchronize();
+
+  // Coalesced events find no new frame; the last one stays on the screen.
+  FrameMailboxSlot* slot = mailbox_->Acquire(&skipped);
+  if (slot == NULL) {
+    return;
+  }
+  if (skipped != 0) {
+    DEBUG_PRINT("OutputDispOpencvWnd::OnCapture skipped:%u\n", skipped);
+  }
+  display_slot_ = slot;
+  que = &slot->image;
   draw_rect_image = que;
   if ((que->size().width == 0) || (que->size().height == 0)) {
     DEBUG_PRINT("size w:%d h:%d\n", que->size().width, que->size().height);
@@ -119,37 +133,36 @@ void OutputDispOpencvWnd::OnCapture(wxCommandEvent& event) {
     return;
   }
 
+  // Check the frame before the overlays are drawn on it.
+  owner_plugin_->RecordFrameLatency(&display_slot_->metadata, que);
+
   /* fps.*/
   CaptureFps(que);
   DrawOnepushRectangle(que);
   cv::imshow(display_window_name.c_str(), *que);
 
-  cv::waitKey(0);
+  // Only let HighGUI draw: never wait for a key on the GUI thread.
+  cv::waitKey(kOpenCVDispWaitKeyMsec);
 
   frame_count_++;
-#ifdef _INHIBIT_POST_EVENT_
-  is_send_capture_update = false;
-#endif /* _INHIBIT_POST_EVENT_ */
+  shown_frames_++;
 }
 
 /**
  * @brief
  * Post local event(CAPTURE_UPDATE) for refresh screen on own thread.
+ * Nothing is posted while an event is still queued: it shows the newest
+ * frame of the mailbox anyway.
  */
 void OutputDispOpencvWnd::PostCapture(void) {
   DEBUG_PRINT("OutputDispOpencvWnd::PostCapture\n");
 
-#ifdef _INHIBIT_POST_EVENT_
-  if (is_send_capture_update == false) {
-#endif /* _INHIBIT_POST_EVENT_ */
+  if (__sync_bool_compare_and_swap(&is_capture_pending_, 0, 1)) {
     wxCommandEvent event(CAPTURE_UPDATE);
 
     event.SetString(wxT("This is the data"));
     wxPostEvent(this, event);
-#ifdef _INHIBIT_POST_EVENT_
-    is_send_capture_update = true;
   }
-#endif /* _INHIBIT_POST_EVENT_ */
 }
 
 /**
@@ -166,6 +179,7 @@ void OutputDispOpencvWnd::OnCaptureInit(wxCommandEvent& event) {
   frame_count_ = 0;
   diff_time_ = 0;
   fps_ = 0;
+  is_capture_pending_ = 0;
   now_time_ = cv::getTickCount();
   start_time_ = now_time_;
 }
@@ -276,10 +290,8 @@ void OutputDispOpencvWnd::MouseCallback(int event, int x, int y, int flags,
 void OutputDispOpencvWnd::DrawOnepushRectangle(cv::Mat* img) {
   if (is_drawing_rect == true) {
     if (img != NULL) {
+      // The caller shows img.
       cv::rectangle(*img, start_point, end_point, cvScalar(0xff, 0x00, 0x00));
-      cv::imshow(display_window_name.c_str(), *img);
-
-      cv::waitKey(0);
     }
   }
 }
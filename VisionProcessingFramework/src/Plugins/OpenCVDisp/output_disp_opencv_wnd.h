@@ -15,7 +15,7 @@
 #include "./include.h"
 #include "./output_disp_opencv.h"
 #include "./output_disp_opencv_define.h"
-#include "./que_manager.h"
+#include "./frame_mailbox.h"
 
 class OutputDispOpencv;
 
@@ -25,8 +25,10 @@ class OutputDispOpencv;
  */
 class OutputDispOpencvWnd : public wxFrame {
  private:
-  /*! Management OpenCV image que */
-  QueManager* que_manager_;
+  /*! Latest frame from the plugin (the worker thread writes it) */
+  FrameMailbox* mailbox_;
+  /*! Frame being displayed (owned by mailbox_) */
+  FrameMailboxSlot* display_slot_;
   /*! Frame counter of this plugin. use this for FPS calculation. */
   int frame_count_;
   /*! Set a current time by GetTickCount() in  FPS captureing process. */
@@ -40,10 +42,10 @@ class OutputDispOpencvWnd : public wxFrame {
   /*! Set a start time to calculate FPS. */
   int64 start_time_;
 
-#ifdef _INHIBIT_POST_EVENT_
-  /*! Flag for suppressing the wxCommandEvent(CAPTURE_UPDATE) */
-  bool is_send_capture_update;
-#endif /* _INHIBIT_POST_EVENT_ */
+  /*! Whether a CAPTURE_UPDATE event is queued (coalesces the events) */
+  volatile unsigned int is_capture_pending_;
+  /*! Number of the frames shown */
+  volatile unsigned int shown_frames_;
 
  public:
   /**
@@ -61,6 +63,8 @@ class OutputDispOpencvWnd : public wxFrame {
   /**
    * @brief
    * Post local event(CAPTURE_UPDATE) for refresh screen on own thread.
+   * Nothing is posted while an event is still queued: it shows the newest
+   * frame of the mailbox anyway.
    */
   virtual void PostCapture(void);
 
@@ -92,10 +96,25 @@ class OutputDispOpencvWnd : public wxFrame {
 
   /**
    * @brief
-   * Enqueue cv::Mat data.
-   * @param enq_data [in] cv::Mat data.
+   * Get the frame mailbox. The plugin converts the next frame straight into
+   * the slot given by BeginPush(); an unread frame is replaced.
+   * @return frame mailbox.
    */
-  bool Enqueue(data_t enq_data);
+  FrameMailbox* mailbox(void) { return mailbox_; }
+
+  /**
+   * @brief
+   * Get the number of the frames replaced before they were displayed.
+   * @return number of the frames.
+   */
+  unsigned int skipped_frames(void) const;
+
+  /**
+   * @brief
+   * Get the number of the frames shown.
+   * @return number of the frames.
+   */
+  unsigned int shown_frames(void) const { return shown_frames_; }
 
   /**
    * @brief
@@ -110,7 +129,7 @@ class OutputDispOpencvWnd : public wxFrame {
 
   /**
    * @brief
-   * Delete cv::Mat data queue.
+   * Delete the frame mailbox.
    */
   void DeleteQueue();
 
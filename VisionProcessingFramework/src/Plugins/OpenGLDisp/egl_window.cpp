@@ -0,0 +1,416 @@
+/**
+ * @file      egl_window.cpp
+ * @brief     EGL surface of the OpenGLDisp plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./egl_window.h"
+#ifndef HAVE_LIBBCM_HOST
+#include <X11/Xutil.h>
+#endif
+
+#ifdef HAVE_LIBBCM_HOST
+/* Change flags of vc_dispmanx_element_change_attributes(). */
+#define kEglDispmanxChangeOpacity (1 << 1)
+#define kEglDispmanxChangeDestRect (1 << 2)
+#endif
+
+/**
+ * @brief
+ * Limit a size of the surface to 1 or more.
+ * @param size [in] size.
+ * @return size (1 - ).
+ */
+static int SurfaceSize(int size) { return (size > 0) ? size : 1; }
+
+/**
+ * @brief
+ * Constructor.
+ */
+EglWindow::EglWindow(void) {
+#ifdef HAVE_LIBBCM_HOST
+  backend_ = kEglWindowDispmanx;
+  dispman_display_ = 0;
+  dispman_element_ = 0;
+#else
+  backend_ = kEglWindowX11;
+  x_display_ = NULL;
+  x_window_ = 0;
+  x_colormap_ = None;
+  is_mapped_ = false;
+#endif
+  display_ = EGL_NO_DISPLAY;
+  config_ = NULL;
+  context_ = EGL_NO_CONTEXT;
+  surface_ = EGL_NO_SURFACE;
+  screen_width_ = 0;
+  screen_height_ = 0;
+  pbuffer_width_ = 0;
+  pbuffer_height_ = 0;
+}
+
+/**
+ * @brief
+ * Destructor. Closes the window.
+ */
+EglWindow::~EglWindow(void) { Close(); }
+
+/**
+ * @brief
+ * Create the surface and make the context current on the calling thread.
+ * @param disp_info [in] position, size and opacity of the surface.
+ * @return If true, successful creation.
+ */
+bool EglWindow::Open(const DisplayInfo& disp_info) {
+  Close();
+  if (!OpenNativeDisplay()) {
+    Close();
+    return false;
+  }
+  if (eglInitialize(display_, NULL, NULL) == EGL_FALSE) {
+    DEBUG_PRINT("[EglWindow] Failed EGL initialize\n");
+    Close();
+    return false;
+  }
+  eglBindAPI(EGL_OPENGL_ES_API);
+
+  EGLint surface_type =
+      (backend_ == kEglWindowPbuffer) ? EGL_PBUFFER_BIT : EGL_WINDOW_BIT;
+  const EGLint config_attributes[] = {
+      EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8,
+      EGL_SURFACE_TYPE, surface_type, EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,
+      EGL_NONE};
+  EGLint num_config = 0;
+  if (eglChooseConfig(display_, config_attributes, &config_, 1,
+                      &num_config) == EGL_FALSE ||
+      num_config < 1) {
+    DEBUG_PRINT("[EglWindow] Failed choose EGL Config\n");
+    Close();
+    return false;
+  }
+
+  // OpenGL ES 3.0 gives the pixel unpack buffers; 2.0 is enough to draw.
+  const EGLint es3_attributes[] = {EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE};
+  const EGLint es2_attributes[] = {EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE};
+  context_ = eglCreateContext(display_, config_, EGL_NO_CONTEXT,
+                              es3_attributes);
+  if (context_ == EGL_NO_CONTEXT) {
+    context_ = eglCreateContext(display_, config_, EGL_NO_CONTEXT,
+                                es2_attributes);
+  }
+  if (context_ == EGL_NO_CONTEXT) {
+    DEBUG_PRINT("[EglWindow] Failed create EGL Context\n");
+    Close();
+    return false;
+  }
+
+  if (!CreateSurface(disp_info)) {
+    Close();
+    return false;
+  }
+  // The processing thread must not wait for the vertical sync.
+  eglSwapInterval(display_, 0);
+  return true;
+}
+
+/**
+ * @brief
+ * Destroy the surface and the context.
+ */
+void EglWindow::Close(void) {
+  if (display_ != EGL_NO_DISPLAY) {
+    eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (surface_ != EGL_NO_SURFACE) {
+      eglDestroySurface(display_, surface_);
+    }
+    if (context_ != EGL_NO_CONTEXT) {
+      eglDestroyContext(display_, context_);
+    }
+    eglTerminate(display_);
+  }
+  surface_ = EGL_NO_SURFACE;
+  context_ = EGL_NO_CONTEXT;
+  display_ = EGL_NO_DISPLAY;
+  CloseNativeWindow();
+}
+
+/**
+ * @brief
+ * Change the position, the size and the opacity of the surface.
+ * @param disp_info [in] position, size and opacity of the surface.
+ * @return If true, successful change.
+ */
+bool EglWindow::Move(const DisplayInfo& disp_info) {
+  if (!is_open()) {
+    return false;
+  }
+  int width = SurfaceSize(disp_info.current_width);
+  int height = SurfaceSize(disp_info.current_height);
+  if (backend_ == kEglWindowPbuffer) {
+    if (width == pbuffer_width_ && height == pbuffer_height_) {
+      return true;
+    }
+    eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroySurface(display_, surface_);
+    surface_ = EGL_NO_SURFACE;
+    return CreateSurface(disp_info);
+  }
+
+#ifdef HAVE_LIBBCM_HOST
+  // The element is scaled by the display hardware: the surface is kept.
+  VC_RECT_T dst_rect;
+  dst_rect.x = disp_info.current_x;
+  dst_rect.y = disp_info.current_y;
+  dst_rect.width = width;
+  dst_rect.height = height;
+  DISPMANX_UPDATE_HANDLE_T update = vc_dispmanx_update_start(0);
+  int result = vc_dispmanx_element_change_attributes(
+      update, dispman_element_,
+      kEglDispmanxChangeOpacity | kEglDispmanxChangeDestRect, 0 /*layer*/,
+      static_cast<uint8_t>(disp_info.current_alpha), &dst_rect, NULL, 0,
+      DISPMANX_NO_ROTATE);
+  vc_dispmanx_update_submit_sync(update);
+  return result == 0;
+#else
+  // X11 has no per-window opacity here: opacity 0 hides the window.
+  if (disp_info.current_alpha == 0) {
+    if (is_mapped_) {
+      XUnmapWindow(x_display_, x_window_);
+      is_mapped_ = false;
+    }
+  } else {
+    XMoveResizeWindow(x_display_, x_window_, disp_info.current_x,
+                      disp_info.current_y, width, height);
+    if (!is_mapped_) {
+      XMapWindow(x_display_, x_window_);
+      is_mapped_ = true;
+    }
+  }
+  XFlush(x_display_);
+  return true;
+#endif
+}
+
+/**
+ * @brief
+ * Show the drawn frame.
+ * @return If true, successful swap.
+ */
+bool EglWindow::SwapBuffers(void) {
+  if (!is_open()) {
+    return false;
+  }
+  return eglSwapBuffers(display_, surface_) == EGL_TRUE;
+}
+
+/**
+ * @brief
+ * Get the current size of the surface.
+ * @param width [out] width of the surface.
+ * @param height [out] height of the surface.
+ */
+void EglWindow::GetSurfaceSize(int* width, int* height) const {
+  EGLint surface_width = 0;
+  EGLint surface_height = 0;
+  if (is_open()) {
+    eglQuerySurface(display_, surface_, EGL_WIDTH, &surface_width);
+    eglQuerySurface(display_, surface_, EGL_HEIGHT, &surface_height);
+  }
+  *width = surface_width;
+  *height = surface_height;
+}
+
+/**
+ * @brief
+ * Get the name of a kind of the native window for the logs.
+ * @param backend [in] kind of the window.
+ * @return name of the kind.
+ */
+const char* EglWindow::BackendName(EglWindowBackend backend) {
+  switch (backend) {
+    case kEglWindowDispmanx:
+      return "DispmanX";
+    case kEglWindowX11:
+      return "X11";
+    case kEglWindowPbuffer:
+      return "pbuffer";
+    default:
+      return "unknown";
+  }
+}
+
+/**
+ * @brief
+ * Get the EGL display of the backend.
+ * @return If true, successful connection.
+ */
+bool EglWindow::OpenNativeDisplay(void) {
+#ifdef HAVE_LIBBCM_HOST
+  static bool is_bcm_host_initialized = false;
+  if (!is_bcm_host_initialized) {
+    bcm_host_init();
+    is_bcm_host_initialized = true;
+  }
+  uint32_t width = 0;
+  uint32_t height = 0;
+  if (graphics_get_display_size(0 /* LCD */, &width, &height) < 0) {
+    DEBUG_PRINT("[EglWindow] Can not get graphics display size\n");
+    return false;
+  }
+  backend_ = kEglWindowDispmanx;
+  screen_width_ = width;
+  screen_height_ = height;
+  display_ = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+#else
+  x_display_ = XOpenDisplay(NULL);
+  if (x_display_ != NULL) {
+    backend_ = kEglWindowX11;
+    screen_width_ = DisplayWidth(x_display_, DefaultScreen(x_display_));
+    screen_height_ = DisplayHeight(x_display_, DefaultScreen(x_display_));
+    display_ = eglGetDisplay((EGLNativeDisplayType)x_display_);
+  } else {
+    // Headless (e.g. software rendering): draw off-screen.
+    backend_ = kEglWindowPbuffer;
+    screen_width_ = 0;
+    screen_height_ = 0;
+    display_ = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  }
+#endif
+  if (display_ == EGL_NO_DISPLAY) {
+    DEBUG_PRINT("[EglWindow] Can't get display\n");
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Create the native window and the EGL surface on it.
+ * @param disp_info [in] position, size and opacity of the window.
+ * @return If true, successful creation.
+ */
+bool EglWindow::CreateSurface(const DisplayInfo& disp_info) {
+  int width = SurfaceSize(disp_info.current_width);
+  int height = SurfaceSize(disp_info.current_height);
+  if (backend_ == kEglWindowPbuffer) {
+    const EGLint pbuffer_attributes[] = {EGL_WIDTH, width, EGL_HEIGHT, height,
+                                         EGL_NONE};
+    surface_ = eglCreatePbufferSurface(display_, config_, pbuffer_attributes);
+    pbuffer_width_ = width;
+    pbuffer_height_ = height;
+    if (screen_width_ == 0) {
+      screen_width_ = width;
+      screen_height_ = height;
+    }
+  } else {
+#ifdef HAVE_LIBBCM_HOST
+    // The surface covers the screen and the element scales it into place.
+    VC_RECT_T dst_rect;
+    dst_rect.x = disp_info.current_x;
+    dst_rect.y = disp_info.current_y;
+    dst_rect.width = width;
+    dst_rect.height = height;
+    VC_RECT_T src_rect;
+    src_rect.x = 0;
+    src_rect.y = 0;
+    src_rect.width = screen_width_ << 16;
+    src_rect.height = screen_height_ << 16;
+    VC_DISPMANX_ALPHA_T alpha = {DISPMANX_FLAGS_ALPHA_FIXED_ALL_PIXELS,
+                                 disp_info.current_alpha, 0};
+    dispman_display_ = vc_dispmanx_display_open(0 /* LCD */);
+    DISPMANX_UPDATE_HANDLE_T update = vc_dispmanx_update_start(0);
+    dispman_element_ = vc_dispmanx_element_add(
+        update, dispman_display_, 0 /*layer*/, &dst_rect, 0 /*src*/,
+        &src_rect, DISPMANX_PROTECTION_NONE, &alpha, 0 /*clamp*/,
+        DISPMANX_NO_ROTATE);
+    vc_dispmanx_update_submit_sync(update);
+    native_window_.element = dispman_element_;
+    native_window_.width = screen_width_;
+    native_window_.height = screen_height_;
+    surface_ = eglCreateWindowSurface(display_, config_, &native_window_,
+                                      NULL);
+#else
+    // The window needs the visual of the EGL configuration.
+    Window root = DefaultRootWindow(x_display_);
+    EGLint visual_id = 0;
+    eglGetConfigAttrib(display_, config_, EGL_NATIVE_VISUAL_ID, &visual_id);
+    XVisualInfo visual_template;
+    visual_template.visualid = visual_id;
+    int count = 0;
+    XVisualInfo* visual_info =
+        XGetVisualInfo(x_display_, VisualIDMask, &visual_template, &count);
+    if (visual_info != NULL) {
+      XSetWindowAttributes attributes;
+      x_colormap_ =
+          XCreateColormap(x_display_, root, visual_info->visual, AllocNone);
+      attributes.colormap = x_colormap_;
+      attributes.background_pixel = 0;
+      attributes.border_pixel = 0;
+      x_window_ = XCreateWindow(
+          x_display_, root, disp_info.current_x, disp_info.current_y, width,
+          height, 0, visual_info->depth, InputOutput, visual_info->visual,
+          CWColormap | CWBackPixel | CWBorderPixel, &attributes);
+      XFree(visual_info);
+    } else {
+      x_window_ = XCreateSimpleWindow(x_display_, root, disp_info.current_x,
+                                      disp_info.current_y, width, height, 0,
+                                      0, 0);
+    }
+    XStoreName(x_display_, x_window_, "OpenGLDisp");
+    if (disp_info.current_alpha != 0) {
+      XMapWindow(x_display_, x_window_);
+      is_mapped_ = true;
+    }
+    XFlush(x_display_);
+    surface_ = eglCreateWindowSurface(
+        display_, config_, (EGLNativeWindowType)x_window_, NULL);
+#endif
+  }
+  if (surface_ == EGL_NO_SURFACE) {
+    DEBUG_PRINT("[EglWindow] Failed EGL surface\n");
+    return false;
+  }
+  if (eglMakeCurrent(display_, surface_, surface_, context_) == EGL_FALSE) {
+    DEBUG_PRINT("[EglWindow] Can not make EGL current\n");
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Destroy the native window.
+ */
+void EglWindow::CloseNativeWindow(void) {
+#ifdef HAVE_LIBBCM_HOST
+  if (dispman_element_ != 0) {
+    DISPMANX_UPDATE_HANDLE_T update = vc_dispmanx_update_start(0);
+    if (vc_dispmanx_element_remove(update, dispman_element_) != 0) {
+      DEBUG_PRINT("[EglWindow] Failed remove dispmanx element\n");
+    }
+    vc_dispmanx_update_submit_sync(update);
+    dispman_element_ = 0;
+  }
+  if (dispman_display_ != 0) {
+    if (vc_dispmanx_display_close(dispman_display_) != 0) {
+      DEBUG_PRINT("[EglWindow] Failed close dispmanx display\n");
+    }
+    dispman_display_ = 0;
+  }
+#else
+  if (x_display_ != NULL) {
+    if (x_window_ != 0) {
+      XDestroyWindow(x_display_, x_window_);
+    }
+    if (x_colormap_ != None) {
+      XFreeColormap(x_display_, x_colormap_);
+    }
+    XCloseDisplay(x_display_);
+  }
+  x_display_ = NULL;
+  x_window_ = 0;
+  x_colormap_ = None;
+  is_mapped_ = false;
+#endif
+}
@@ -0,0 +1,197 @@
+/**
+ * @file      egl_window.h
+ * @brief     EGL surface of the OpenGLDisp plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _EGL_WINDOW_H_
+#define _EGL_WINDOW_H_
+
+#include <EGL/egl.h>
+#include "./event_handling_thread.h"
+#ifdef HAVE_LIBBCM_HOST
+#include "./bcm_host.h"
+#endif
+
+/**
+ * @enum EglWindowBackend
+ * @brief Kinds of the native window behind the EGL surface.
+ */
+typedef enum {
+  /*! DispmanX element of the Raspberry Pi firmware */
+  kEglWindowDispmanx = 0,
+  /*! Top level X11 window */
+  kEglWindowX11,
+  /*! Off-screen pbuffer (no display, e.g. software rendering) */
+  kEglWindowPbuffer,
+} EglWindowBackend;
+
+/**
+ * @class EglWindow
+ * @brief EGL display, OpenGL ES context and surface of the plugin.
+ * With libbcm_host the surface is a DispmanX element; otherwise it is an
+ * X11 window, or a pbuffer when no X server can be opened.
+ * Move() changes the position, the size and the opacity of the surface
+ * in place: the context, the textures and the programs are kept.
+ * An OpenGL ES 3.0 context is requested first, then 2.0.
+ */
+class EglWindow {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  EglWindow(void);
+
+  /**
+   * @brief
+   * Destructor. Closes the window.
+   */
+  ~EglWindow(void);
+
+  /**
+   * @brief
+   * Create the surface and make the context current on the calling thread.
+   * @param disp_info [in] position, size and opacity of the surface.
+   * @return If true, successful creation.
+   */
+  bool Open(const DisplayInfo& disp_info);
+
+  /**
+   * @brief
+   * Destroy the surface and the context.
+   */
+  void Close(void);
+
+  /**
+   * @brief
+   * Change the position, the size and the opacity of the surface.
+   * @param disp_info [in] position, size and opacity of the surface.
+   * @return If true, successful change.
+   */
+  bool Move(const DisplayInfo& disp_info);
+
+  /**
+   * @brief
+   * Show the drawn frame.
+   * @return If true, successful swap.
+   */
+  bool SwapBuffers(void);
+
+  /**
+   * @brief
+   * Get the current size of the surface.
+   * @param width [out] width of the surface.
+   * @param height [out] height of the surface.
+   */
+  void GetSurfaceSize(int* width, int* height) const;
+
+  /**
+   * @brief
+   * Check whether the window is open.
+   * @return If true, the window is open.
+   */
+  bool is_open(void) const { return surface_ != EGL_NO_SURFACE; }
+
+  /**
+   * @brief
+   * Get the kind of the native window.
+   * @return kind of the window.
+   */
+  EglWindowBackend backend(void) const { return backend_; }
+
+  /**
+   * @brief
+   * Get the width of the screen.
+   * @return width of the screen.
+   */
+  int screen_width(void) const { return screen_width_; }
+
+  /**
+   * @brief
+   * Get the height of the screen.
+   * @return height of the screen.
+   */
+  int screen_height(void) const { return screen_height_; }
+
+  /**
+   * @brief
+   * Get the name of a kind of the native window for the logs.
+   * @param backend [in] kind of the window.
+   * @return name of the kind.
+   */
+  static const char* BackendName(EglWindowBackend backend);
+
+ private:
+  /**
+   * @brief
+   * Get the EGL display of the backend.
+   * @return If true, successful connection.
+   */
+  bool OpenNativeDisplay(void);
+
+  /**
+   * @brief
+   * Create the native window and the EGL surface on it.
+   * @param disp_info [in] position, size and opacity of the window.
+   * @return If true, successful creation.
+   */
+  bool CreateSurface(const DisplayInfo& disp_info);
+
+  /**
+   * @brief
+   * Destroy the native window.
+   */
+  void CloseNativeWindow(void);
+
+  /*! Kind of the native window */
+  EglWindowBackend backend_;
+
+  /*! EGL display */
+  EGLDisplay display_;
+
+  /*! EGL frame buffer configuration */
+  EGLConfig config_;
+
+  /*! OpenGL ES context */
+  EGLContext context_;
+
+  /*! EGL surface */
+  EGLSurface surface_;
+
+  /*! Width of the screen */
+  int screen_width_;
+
+  /*! Height of the screen */
+  int screen_height_;
+
+  /*! Size of the pbuffer */
+  int pbuffer_width_;
+  int pbuffer_height_;
+
+#ifdef HAVE_LIBBCM_HOST
+  /*! DispmanX display */
+  DISPMANX_DISPLAY_HANDLE_T dispman_display_;
+
+  /*! DispmanX element showing the surface */
+  DISPMANX_ELEMENT_HANDLE_T dispman_element_;
+
+  /*! Native window given to EGL (must live as long as the surface) */
+  EGL_DISPMANX_WINDOW_T native_window_;
+#else
+  /*! Connection to the X server (own, not shared with the key thread) */
+  Display* x_display_;
+
+  /*! X11 window */
+  Window x_window_;
+
+  /*! Colormap of the X11 window (None: default) */
+  Colormap x_colormap_;
+
+  /*! Whether the X11 window is mapped */
+  bool is_mapped_;
+#endif
+};
+
+#endif /* _EGL_WINDOW_H_*/
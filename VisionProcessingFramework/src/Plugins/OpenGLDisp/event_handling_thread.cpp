@@ -6,6 +6,7 @@
  */
 
 #include "./event_handling_thread.h"
+#include <unistd.h>
 
 /**
  * @brief
@@ -118,6 +119,8 @@ wxThread::ExitCode EventHandlingThread::Entry() {
           break;
       }
     }
+    // Poll the keys without spinning on the CPU.
+    usleep(EVENT_POLL_USEC);
   }
   return (wxThread::ExitCode)0;
 } /* NOLINT */
\ No newline at end of file
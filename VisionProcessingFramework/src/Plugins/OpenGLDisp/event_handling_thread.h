@@ -42,6 +42,7 @@ typedef struct {
 #define MOVE_VERTICAL 100
 #define MINI_DISP_WIDTH 320
 #define MINI_DISP_HEIGHT 180
+#define EVENT_POLL_USEC 10000
 
 typedef bool ThreadFunc(void);
 
@@ -0,0 +1,457 @@
+/**
+ * @file      gles_renderer.cpp
+ * @brief     OpenGL ES 2.0 renderer of the OpenGLDisp plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./gles_renderer.h"
+#include <EGL/egl.h>
+#include <stdio.h>
+#include <string.h>
+#include "./pixel_convert.h"
+
+/* OpenGL ES 3.0 names which are not in the 2.0 headers. */
+#define kGlesPixelUnpackBuffer 0x88EC
+#define kGlesMapWriteBit 0x0002
+#define kGlesMapInvalidateBufferBit 0x0008
+
+/* Quad over the whole surface: x, y, u, v (row 0 of the image at the top). */
+static const GLfloat kQuad[] = {
+    -1.0f, -1.0f, 0.0f, 1.0f,
+    1.0f,  -1.0f, 1.0f, 1.0f,
+    -1.0f, 1.0f,  0.0f, 0.0f,
+    1.0f,  1.0f,  1.0f, 0.0f};
+
+static const char* kVertexShader =
+    "attribute vec2 a_position;\n"
+    "attribute vec2 a_texcoord;\n"
+    "varying vec2 v_texcoord;\n"
+    "void main() {\n"
+    "  v_texcoord = a_texcoord;\n"
+    "  gl_Position = vec4(a_position, 0.0, 1.0);\n"
+    "}\n";
+
+/*
+ * A 16 bit texel holds the low byte in r and the high byte in a, so
+ * (r + a * 256.0) * u_scale is the value in 0.0 - 1.0 (u_scale is
+ * 255 / maximum value). Such texels are fetched with NEAREST and the
+ * bilinear filter is done on the values.
+ */
+static const char* kFragmentShader =
+    "#ifdef GL_FRAGMENT_PRECISION_HIGH\n"
+    "precision highp float;\n"
+    "#else\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "uniform sampler2D u_texture;\n"
+    "uniform vec2 u_size;\n"
+    "uniform float u_scale;\n"
+    "varying vec2 v_texcoord;\n"
+    "#if defined(GRAY16) || defined(RGB16)\n"
+    "#ifdef RGB16\n"
+    "#define TEXELS 3.0\n"
+    "#else\n"
+    "#define TEXELS 1.0\n"
+    "#endif\n"
+    "float Fetch(vec2 pixel, float channel) {\n"
+    "  float u = (pixel.x * TEXELS + channel + 0.5) / (u_size.x * TEXELS);\n"
+    "  float v = (pixel.y + 0.5) / u_size.y;\n"
+    "  vec4 texel = texture2D(u_texture, vec2(u, v));\n"
+    "  return (texel.r + texel.a * 256.0) * u_scale;\n"
+    "}\n"
+    "vec3 Pixel(vec2 pixel) {\n"
+    "#ifdef RGB16\n"
+    "  return vec3(Fetch(pixel, 0.0), Fetch(pixel, 1.0), Fetch(pixel, 2.0));\n"
+    "#else\n"
+    "  return vec3(Fetch(pixel, 0.0));\n"
+    "#endif\n"
+    "}\n"
+    "void main() {\n"
+    "  vec2 position = v_texcoord * u_size - 0.5;\n"
+    "  vec2 base = floor(position);\n"
+    "  vec2 weight = position - base;\n"
+    "  vec2 p0 = clamp(base, vec2(0.0), u_size - 1.0);\n"
+    "  vec2 p1 = clamp(base + 1.0, vec2(0.0), u_size - 1.0);\n"
+    "  vec3 top = mix(Pixel(p0), Pixel(vec2(p1.x, p0.y)), weight.x);\n"
+    "  vec3 bottom = mix(Pixel(vec2(p0.x, p1.y)), Pixel(p1), weight.x);\n"
+    "  gl_FragColor = vec4(min(mix(top, bottom, weight.y), 1.0), 1.0);\n"
+    "}\n"
+    "#else\n"
+    "void main() {\n"
+    "  gl_FragColor = vec4(texture2D(u_texture, v_texcoord).rgb, 1.0);\n"
+    "}\n"
+    "#endif\n";
+
+/**
+ * @brief
+ * Compile a shader.
+ * @param type [in] GL_VERTEX_SHADER or GL_FRAGMENT_SHADER.
+ * @param defines [in] lines put before the source.
+ * @param source [in] source of the shader.
+ * @return shader name (0: failed).
+ */
+static GLuint CompileShader(GLenum type, const char* defines,
+                            const char* source) {
+  GLuint shader = glCreateShader(type);
+  if (shader == 0) {
+    return 0;
+  }
+  const char* sources[2] = {defines, source};
+  glShaderSource(shader, 2, sources, NULL);
+  glCompileShader(shader);
+  GLint is_compiled = GL_FALSE;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &is_compiled);
+  if (is_compiled == GL_FALSE) {
+    char log[512];
+    glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+    DEBUG_PRINT("[GlesRenderer] shader compile error: %s\n", log);
+    glDeleteShader(shader);
+    return 0;
+  }
+  return shader;
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+GlesRenderer::GlesRenderer(void) {
+  for (int i = 0; i < kGlesProgramNum; i++) {
+    programs_[i] = 0;
+    position_location_[i] = -1;
+    texcoord_location_[i] = -1;
+    texture_location_[i] = -1;
+    size_location_[i] = -1;
+    scale_location_[i] = -1;
+  }
+  for (int i = 0; i < kGlesRendererTextures; i++) {
+    textures_[i] = 0;
+    pbos_[i] = 0;
+  }
+  vertex_buffer_ = 0;
+  current_ = 0;
+  texture_width_ = 0;
+  texture_height_ = 0;
+  texture_format_ = 0;
+  program_ = kGlesProgram8U;
+  image_width_ = 0;
+  max_texture_size_ = 0;
+  is_pbo_ = false;
+  is_uploaded_ = false;
+  map_buffer_range_ = NULL;
+  unmap_buffer_ = NULL;
+  uploads_ = 0;
+  reallocations_ = 0;
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+GlesRenderer::~GlesRenderer(void) {}
+
+/**
+ * @brief
+ * Create the programs and the buffers.
+ * @return If true, successful initialization.
+ */
+bool GlesRenderer::Init(void) {
+  for (int i = 0; i < kGlesProgramNum; i++) {
+    programs_[i] = CreateProgram(static_cast<GlesProgram>(i));
+    if (programs_[i] == 0) {
+      Finalize();
+      return false;
+    }
+  }
+
+  glGenBuffers(1, &vertex_buffer_);
+  glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(kQuad), kQuad, GL_STATIC_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  glGenTextures(kGlesRendererTextures, textures_);
+  for (int i = 0; i < kGlesRendererTextures; i++) {
+    glBindTexture(GL_TEXTURE_2D, textures_[i]);
+    // NPOT textures of OpenGL ES 2.0 need CLAMP_TO_EDGE and no mipmap.
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  }
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_texture_size_);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glDisable(GL_DEPTH_TEST);
+  glDisable(GL_BLEND);
+  glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+  is_pbo_ = InitPbo();
+  current_ = 0;
+  texture_width_ = 0;
+  texture_height_ = 0;
+  texture_format_ = 0;
+  is_uploaded_ = false;
+  return true;
+}
+
+/**
+ * @brief
+ * Delete the programs, the textures and the buffers.
+ */
+void GlesRenderer::Finalize(void) {
+  for (int i = 0; i < kGlesProgramNum; i++) {
+    if (programs_[i] != 0) {
+      glDeleteProgram(programs_[i]);
+      programs_[i] = 0;
+    }
+  }
+  if (vertex_buffer_ != 0) {
+    glDeleteBuffers(1, &vertex_buffer_);
+    vertex_buffer_ = 0;
+  }
+  if (textures_[0] != 0) {
+    glDeleteTextures(kGlesRendererTextures, textures_);
+  }
+  if (pbos_[0] != 0) {
+    glDeleteBuffers(kGlesRendererTextures, pbos_);
+  }
+  for (int i = 0; i < kGlesRendererTextures; i++) {
+    textures_[i] = 0;
+    pbos_[i] = 0;
+  }
+  is_pbo_ = false;
+  is_uploaded_ = false;
+}
+
+/**
+ * @brief
+ * Check whether a frame can be uploaded without conversion.
+ * @param image [in] frame.
+ * @return If false, the frame must be converted to 8 bits first.
+ */
+bool GlesRenderer::IsSupported(const cv::Mat& image) const {
+  if (image.empty()) {
+    return false;
+  }
+  if (image.depth() != CV_8U && image.depth() != CV_16U) {
+    return false;
+  }
+  if (image.channels() != 1 && image.channels() != 3) {
+    return false;
+  }
+  // 16 bit RGB takes 3 texels per pixel.
+  int texture_width =
+      (image.depth() == CV_16U) ? image.cols * image.channels() : image.cols;
+  return texture_width <= max_texture_size_ && image.rows <= max_texture_size_;
+}
+
+/**
+ * @brief
+ * Upload a frame into the next texture.
+ * @param image [in] 8U or 16U frame of 1 or 3 channels.
+ * @return If true, successful upload.
+ */
+bool GlesRenderer::Upload(const cv::Mat& image) {
+  if (programs_[0] == 0 || !IsSupported(image)) {
+    return false;
+  }
+
+  GLenum format;
+  GlesProgram program;
+  int texture_width = image.cols;
+  if (image.depth() == CV_8U) {
+    format = (image.channels() == 1) ? GL_LUMINANCE : GL_RGB;
+    program = kGlesProgram8U;
+  } else {
+    format = GL_LUMINANCE_ALPHA;
+    program = (image.channels() == 1) ? kGlesProgramGray16 : kGlesProgramRGB16;
+    texture_width = image.cols * image.channels();
+  }
+  int row_size = static_cast<int>(image.cols * image.elemSize());
+
+  if (texture_width != texture_width_ || image.rows != texture_height_ ||
+      format != texture_format_) {
+    // Respecify the storage; the texture names stay the same.
+    GLint filter = (program == kGlesProgram8U) ? GL_LINEAR : GL_NEAREST;
+    for (int i = 0; i < kGlesRendererTextures; i++) {
+      glBindTexture(GL_TEXTURE_2D, textures_[i]);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+      glTexImage2D(GL_TEXTURE_2D, 0, format, texture_width, image.rows, 0,
+                   format, GL_UNSIGNED_BYTE, NULL);
+    }
+    texture_width_ = texture_width;
+    texture_height_ = image.rows;
+    texture_format_ = format;
+    reallocations_++;
+  }
+
+  int next = (current_ + 1) % kGlesRendererTextures;
+  glBindTexture(GL_TEXTURE_2D, textures_[next]);
+  bool is_uploaded = false;
+  if (is_pbo_) {
+    glBindBuffer(kGlesPixelUnpackBuffer, pbos_[next]);
+    if (FillPbo(image, row_size)) {
+      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texture_width_, texture_height_,
+                      format, GL_UNSIGNED_BYTE, NULL);
+      is_uploaded = true;
+    }
+    glBindBuffer(kGlesPixelUnpackBuffer, 0);
+  }
+  if (!is_uploaded) {
+    if (image.isContinuous()) {
+      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texture_width_, texture_height_,
+                      format, GL_UNSIGNED_BYTE, image.data);
+    } else {
+      // OpenGL ES 2.0 has no GL_UNPACK_ROW_LENGTH.
+      for (int y = 0; y < image.rows; y++) {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, texture_width_, 1, format,
+                        GL_UNSIGNED_BYTE, image.ptr(y));
+      }
+    }
+  }
+
+  current_ = next;
+  program_ = program;
+  image_width_ = image.cols;
+  is_uploaded_ = true;
+  uploads_++;
+  return true;
+}
+
+/**
+ * @brief
+ * Draw the last uploaded frame over the whole surface.
+ * @param width [in] width of the surface.
+ * @param height [in] height of the surface.
+ */
+void GlesRenderer::Draw(int width, int height) {
+  glViewport(0, 0, width, height);
+  glClear(GL_COLOR_BUFFER_BIT);
+  if (!is_uploaded_) {
+    return;
+  }
+
+  glUseProgram(programs_[program_]);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, textures_[current_]);
+  glUniform1i(texture_location_[program_], 0);
+  glUniform2f(size_location_[program_], static_cast<GLfloat>(image_width_),
+              static_cast<GLfloat>(texture_height_));
+  glUniform1f(scale_location_[program_],
+              255.0f / ((1 << kPixelConvertSensorBits) - 1));
+
+  GLint position = position_location_[program_];
+  GLint texcoord = texcoord_location_[program_];
+  glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
+  glVertexAttribPointer(position, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat),
+                        reinterpret_cast<const void*>(0));
+  glVertexAttribPointer(texcoord, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat),
+                        reinterpret_cast<const void*>(2 * sizeof(GLfloat)));
+  glEnableVertexAttribArray(position);
+  glEnableVertexAttribArray(texcoord);
+  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+  glDisableVertexAttribArray(position);
+  glDisableVertexAttribArray(texcoord);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+/**
+ * @brief
+ * Compile and link a program.
+ * @param program [in] kind of the program.
+ * @return program name (0: failed).
+ */
+GLuint GlesRenderer::CreateProgram(GlesProgram program) {
+  const char* defines = "";
+  if (program == kGlesProgramGray16) {
+    defines = "#define GRAY16\n";
+  } else if (program == kGlesProgramRGB16) {
+    defines = "#define RGB16\n";
+  }
+  GLuint vertex_shader = CompileShader(GL_VERTEX_SHADER, "", kVertexShader);
+  GLuint fragment_shader =
+      CompileShader(GL_FRAGMENT_SHADER, defines, kFragmentShader);
+  if (vertex_shader == 0 || fragment_shader == 0) {
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+    return 0;
+  }
+
+  GLuint name = glCreateProgram();
+  glAttachShader(name, vertex_shader);
+  glAttachShader(name, fragment_shader);
+  glLinkProgram(name);
+  // The shaders are freed with the program.
+  glDeleteShader(vertex_shader);
+  glDeleteShader(fragment_shader);
+  GLint is_linked = GL_FALSE;
+  glGetProgramiv(name, GL_LINK_STATUS, &is_linked);
+  if (is_linked == GL_FALSE) {
+    char log[512];
+    glGetProgramInfoLog(name, sizeof(log), NULL, log);
+    DEBUG_PRINT("[GlesRenderer] program link error: %s\n", log);
+    glDeleteProgram(name);
+    return 0;
+  }
+
+  position_location_[program] = glGetAttribLocation(name, "a_position");
+  texcoord_location_[program] = glGetAttribLocation(name, "a_texcoord");
+  texture_location_[program] = glGetUniformLocation(name, "u_texture");
+  size_location_[program] = glGetUniformLocation(name, "u_size");
+  scale_location_[program] = glGetUniformLocation(name, "u_scale");
+  return name;
+}
+
+/**
+ * @brief
+ * Find the entry points of the pixel unpack buffers (OpenGL ES 3.0).
+ * @return If true, the pixel unpack buffers can be used.
+ */
+bool GlesRenderer::InitPbo(void) {
+  // The entry points are looked up at run time, so the plugin still links
+  // with the OpenGL ES 2.0 only libraries (e.g. VideoCore IV).
+  const char* version =
+      reinterpret_cast<const char*>(glGetString(GL_VERSION));
+  int major = 0;
+  if (version == NULL || sscanf(version, "OpenGL ES %d", &major) != 1 ||
+      major < 3) {
+    return false;
+  }
+  map_buffer_range_ =
+      reinterpret_cast<void* (*)(GLenum, GLintptr, GLsizeiptr, GLbitfield)>(
+          eglGetProcAddress("glMapBufferRange"));
+  unmap_buffer_ = reinterpret_cast<GLboolean (*)(GLenum)>(
+      eglGetProcAddress("glUnmapBuffer"));
+  if (map_buffer_range_ == NULL || unmap_buffer_ == NULL) {
+    return false;
+  }
+  glGenBuffers(kGlesRendererTextures, pbos_);
+  return true;
+}
+
+/**
+ * @brief
+ * Copy the rows of a frame into the current pixel unpack buffer.
+ * @param image [in] frame.
+ * @param row_size [in] size of a row in bytes.
+ * @return If true, successful copy.
+ */
+bool GlesRenderer::FillPbo(const cv::Mat& image, int row_size) {
+  GLsizeiptr size = static_cast<GLsizeiptr>(row_size) * image.rows;
+  // A new store every frame: the driver never waits for the previous copy.
+  glBufferData(kGlesPixelUnpackBuffer, size, NULL, GL_STREAM_DRAW);
+  unsigned char* data = static_cast<unsigned char*>(map_buffer_range_(
+      kGlesPixelUnpackBuffer, 0, size,
+      kGlesMapWriteBit | kGlesMapInvalidateBufferBit));
+  if (data == NULL) {
+    return false;
+  }
+  if (image.isContinuous()) {
+    memcpy(data, image.data, size);
+  } else {
+    for (int y = 0; y < image.rows; y++) {
+      memcpy(data + y * row_size, image.ptr(y), row_size);
+    }
+  }
+  return unmap_buffer_(kGlesPixelUnpackBuffer) == GL_TRUE;
+}
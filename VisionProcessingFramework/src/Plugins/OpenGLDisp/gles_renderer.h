@@ -0,0 +1,209 @@
+/**
+ * @file      gles_renderer.h
+ * @brief     OpenGL ES 2.0 renderer of the OpenGLDisp plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _GLES_RENDERER_H_
+#define _GLES_RENDERER_H_
+
+#include <GLES2/gl2.h>
+#include "./include.h"
+
+/* Number of the textures (and pixel unpack buffers) used in turn. */
+#define kGlesRendererTextures 2
+
+/**
+ * @enum GlesProgram
+ * @brief Fragment programs for the formats of the uploaded frame.
+ */
+typedef enum {
+  /*! 8 bit gray or RGB: sampled by the texture unit */
+  kGlesProgram8U = 0,
+  /*! 16 bit gray: 2 bytes per texel, converted in the shader */
+  kGlesProgramGray16,
+  /*! 16 bit RGB: 3 texels per pixel, converted in the shader */
+  kGlesProgramRGB16,
+  kGlesProgramNum
+} GlesProgram;
+
+/**
+ * @class GlesRenderer
+ * @brief Draws the frames as a textured quad with OpenGL ES 2.0.
+ * The frame is uploaded as it is: the 16 to 8 bit conversion and the
+ * scaling to the surface run on the GPU, so the processing thread only
+ * copies the data. 16 bit data is uploaded as LUMINANCE_ALPHA (low byte,
+ * high byte) and filtered in the shader, because the texture unit would
+ * interpolate the two bytes separately.
+ * The textures are used in turn, so a frame is uploaded while the previous
+ * one may still be drawn, and their names are kept when the size changes.
+ * On OpenGL ES 3.0 the upload goes through pixel unpack buffers, which
+ * the driver copies asynchronously.
+ * All the functions must be called with the context current.
+ */
+class GlesRenderer {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  GlesRenderer(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~GlesRenderer(void);
+
+  /**
+   * @brief
+   * Create the programs and the buffers.
+   * @return If true, successful initialization.
+   */
+  bool Init(void);
+
+  /**
+   * @brief
+   * Delete the programs, the textures and the buffers.
+   */
+  void Finalize(void);
+
+  /**
+   * @brief
+   * Check whether a frame can be uploaded without conversion.
+   * @param image [in] frame.
+   * @return If false, the frame must be converted to 8 bits first.
+   */
+  bool IsSupported(const cv::Mat& image) const;
+
+  /**
+   * @brief
+   * Upload a frame into the next texture.
+   * @param image [in] 8U or 16U frame of 1 or 3 channels.
+   * @return If true, successful upload.
+   */
+  bool Upload(const cv::Mat& image);
+
+  /**
+   * @brief
+   * Draw the last uploaded frame over the whole surface.
+   * @param width [in] width of the surface.
+   * @param height [in] height of the surface.
+   */
+  void Draw(int width, int height);
+
+  /**
+   * @brief
+   * Check whether the frames go through pixel unpack buffers.
+   * @return If true, uploads use the pixel unpack buffers.
+   */
+  bool is_pbo(void) const { return is_pbo_; }
+
+  /**
+   * @brief
+   * Get the number of the uploaded frames.
+   * @return number of the frames.
+   */
+  unsigned int uploads(void) const { return uploads_; }
+
+  /**
+   * @brief
+   * Get the number of the times the texture storage was reallocated.
+   * @return number of the times.
+   */
+  unsigned int reallocations(void) const { return reallocations_; }
+
+ private:
+  /**
+   * @brief
+   * Compile and link a program.
+   * @param program [in] kind of the program.
+   * @return program name (0: failed).
+   */
+  GLuint CreateProgram(GlesProgram program);
+
+  /**
+   * @brief
+   * Find the entry points of the pixel unpack buffers (OpenGL ES 3.0).
+   * @return If true, the pixel unpack buffers can be used.
+   */
+  bool InitPbo(void);
+
+  /**
+   * @brief
+   * Copy the rows of a frame into the current pixel unpack buffer.
+   * @param image [in] frame.
+   * @param row_size [in] size of a row in bytes.
+   * @return If true, successful copy.
+   */
+  bool FillPbo(const cv::Mat& image, int row_size);
+
+  /*! Programs of the formats */
+  GLuint programs_[kGlesProgramNum];
+
+  /*! Attribute location of the position */
+  GLint position_location_[kGlesProgramNum];
+
+  /*! Attribute location of the texture coordinate */
+  GLint texcoord_location_[kGlesProgramNum];
+
+  /*! Uniform location of the sampler */
+  GLint texture_location_[kGlesProgramNum];
+
+  /*! Uniform location of the image size */
+  GLint size_location_[kGlesProgramNum];
+
+  /*! Uniform location of the scale to 0.0 - 1.0 */
+  GLint scale_location_[kGlesProgramNum];
+
+  /*! Vertex buffer of the quad */
+  GLuint vertex_buffer_;
+
+  /*! Textures used in turn */
+  GLuint textures_[kGlesRendererTextures];
+
+  /*! Pixel unpack buffers used in turn */
+  GLuint pbos_[kGlesRendererTextures];
+
+  /*! Index of the last uploaded texture */
+  int current_;
+
+  /*! Width of the textures (in texels) */
+  int texture_width_;
+
+  /*! Height of the textures */
+  int texture_height_;
+
+  /*! Format of the textures */
+  GLenum texture_format_;
+
+  /*! Program of the uploaded frames */
+  GlesProgram program_;
+
+  /*! Width of the uploaded frames (in pixels) */
+  int image_width_;
+
+  /*! Maximum texture size of the GPU */
+  GLint max_texture_size_;
+
+  /*! Whether uploads use the pixel unpack buffers */
+  bool is_pbo_;
+
+  /*! Whether a frame has been uploaded */
+  bool is_uploaded_;
+
+  /*! glMapBufferRange (NULL: OpenGL ES 2.0) */
+  void* (*map_buffer_range_)(GLenum, GLintptr, GLsizeiptr, GLbitfield);
+
+  /*! glUnmapBuffer (NULL: OpenGL ES 2.0) */
+  GLboolean (*unmap_buffer_)(GLenum);
+
+  /*! Number of the uploaded frames */
+  unsigned int uploads_;
+
+  /*! Number of the reallocations of the texture storage */
+  unsigned int reallocations_;
+};
+
+#endif /* _GLES_RENDERER_H_*/
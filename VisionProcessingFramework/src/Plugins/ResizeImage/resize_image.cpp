@@ -18,6 +18,8 @@ ResizeImage::ResizeImage() : PluginBase() {
   // Initialize
   resize_type_ = kResizeDefault;
   resize_scale_ = 1.0;
+  zoom_ = 1.0;
+  input_size_ = cvSize(0, 0);
   resize_image_wnd_ = new ResizeImageWnd(this);
 
   // Initialize base class(plugin_base.h)
@@ -67,9 +69,6 @@ bool ResizeImage::InitProcess(CommonParam* common) {
     DEBUG_PRINT("ResizeImage : is_success_initialized_ == false\n");
     return false;
   } else {
-    CvSize size;
-    size = cvSize(1280 * resize_scale_, 720 * resize_scale_);
-    set_output_image_size(size);
     return true;
   }
 }
@@ -80,8 +79,8 @@ bool ResizeImage::InitProcess(CommonParam* common) {
  * This function is empty implementation.
  */
 void ResizeImage::EndProcess() {
-  DEBUG_PRINT("ResizeImage::EndProcess) \n");
-  /* Do nothing*/
+  DEBUG_PRINT("ResizeImage::EndProcess) weight tables:%u\n",
+              resizer_.table_builds());
 }
 
 /**
@@ -104,8 +103,32 @@ void ResizeImage::DoPostProcess(void) {
 bool ResizeImage::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
   DEBUG_PRINT("ResizeImage::DoProcess \n");
 
-  cv::resize(*src_image, *dst_image, cv::Size(), resize_scale_,
-             resize_scale_);
+  // The sizes come from the frame itself, so they are right whatever the
+  // size notified before.
+  CvSize src_size = cvSize(src_image->cols, src_image->rows);
+  CvSize size = OutputSize(src_size);
+  cv::Rect crop = ImageResizer::ZoomRect(cv::Size(src_size), zoom_);
+  const cv::Mat* src = src_image;
+
+  // When the frame is shared at a branch, a reduction starts from the
+  // nearest pyramid level, which the other outputs reuse as well.
+  if (frame_derivatives() != NULL && src_image->depth() == CV_8U &&
+      crop.width == src_size.width && crop.height == src_size.height) {
+    int level = FramePyramid::LevelFor(cv::Size(src_size), cv::Size(size));
+    if (level > 0) {
+      const cv::Mat* level_image =
+          GetDerivedLevel(src_image, kFrameDerived8U, level);
+      if (level_image != NULL) {
+        src = level_image;
+        crop = cv::Rect(0, 0, src->cols, src->rows);
+      }
+    }
+  }
+  if (resizer_.Resize(*src, crop, cv::Size(size), dst_image) == false) {
+    DEBUG_PRINT("ResizeImage: can not resize %dx%d to %dx%d\n",
+                src_size.width, src_size.height, size.width, size.height);
+    return false;
+  }
 
   return true;
 }
@@ -138,7 +161,6 @@ void ResizeImage::set_resize_type(ResizeImageType resize_type) {
   resize_type_ = resize_type;
   DEBUG_PRINT("ResizeImage::set_resize_type = %d \n", resize_type_);
 
-  CvSize size;
   if (resize_type_ == kResizeDouble) {
     DEBUG_PRINT("set ResizeImage : Double size\n");
     resize_scale_ = 2.0;
@@ -156,8 +178,9 @@ void ResizeImage::set_resize_type(ResizeImageType resize_type) {
     // Same as default
     resize_scale_ = 1.0;
   }
-  size = cvSize(1280 * resize_scale_, 720 * resize_scale_);
-  set_output_image_size(size);
+  if (input_size_.width > 0 && input_size_.height > 0) {
+    set_output_image_size(OutputSize(input_size_));
+  }
 }
 
 /**
@@ -168,14 +191,48 @@ void ResizeImage::set_resize_type(ResizeImageType resize_type) {
  * @param resize_value [in] resize value.
  */
 void ResizeImage::set_resize_value(double resize_value) {
-  CvSize size;
   DEBUG_PRINT("ResizeImage::set_resize_value = %lf \n", resize_value);
 
   resize_scale_ = resize_value;
 
-  size = cvSize(1280 * resize_scale_, 720 * resize_scale_);
+  if (input_size_.width > 0 && input_size_.height > 0) {
+    set_output_image_size(OutputSize(input_size_));
+  }
+}
+
+/**
+ * @brief
+ * Set the digital zoom factor.
+ * @param zoom [in] zoom factor (1.0: whole frame).
+ */
+void ResizeImage::set_zoom(double zoom) {
+  DEBUG_PRINT("ResizeImage::set_zoom = %lf \n", zoom);
+  zoom_ = (zoom < 1.0) ? 1.0 : zoom;
+}
+
+/**
+ * @brief
+ * Set input image size.
+ * The output size is derived from it.
+ * @param input_size [in] input image size.
+ */
+void ResizeImage::set_input_image_size(CvSize input_size) {
+  PluginBase::set_input_image_size(input_size);
+  input_size_ = input_size;
+  set_output_image_size(OutputSize(input_size));
+}
 
-  set_output_image_size(size);
+/**
+ * @brief
+ * Get the output size for an input size.
+ * @param input_size [in] size of the input frame.
+ * @return size of the output frame.
+ */
+CvSize ResizeImage::OutputSize(CvSize input_size) {
+  double scale = resize_scale_;
+  int width = static_cast<int>(input_size.width * scale + 0.5);
+  int height = static_cast<int>(input_size.height * scale + 0.5);
+  return cvSize((width < 1) ? 1 : width, (height < 1) ? 1 : height);
 }
 
 /**
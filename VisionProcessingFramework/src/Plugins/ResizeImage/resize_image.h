@@ -9,6 +9,7 @@
 #define _RESIZE_IMAGE_H_
 
 #include <vector>
+#include "./image_resizer.h"
 #include "./plugin_base.h"
 #include "./resize_image_define.h"
 #include "./resize_image_wnd.h"
@@ -16,6 +17,8 @@
 /**
  * @class ResizeImage
  * @brief Plugin to resize image.
+ * The output size is the size of the input frame multiplied by the scale,
+ * and the digital zoom crops the center of the frame before the resize.
  */
 class ResizeImage : public PluginBase {
  private:
@@ -29,6 +32,20 @@ class ResizeImage : public PluginBase {
   double resize_scale_;
   /*! Resize value.use when "percent" has been selected. */
   double resize_value_;
+  /*! Digital zoom factor (1.0: whole frame). */
+  double zoom_;
+  /*! Size of the input frames notified by the previous plugin. */
+  CvSize input_size_;
+  /*! Resize engine (keeps the weights of the sizes). */
+  ImageResizer resizer_;
+
+  /**
+   * @brief
+   * Get the output size for an input size.
+   * @param input_size [in] size of the input frame.
+   * @return size of the output frame.
+   */
+  CvSize OutputSize(CvSize input_size);
 
  public:
   /**
@@ -99,6 +116,21 @@ class ResizeImage : public PluginBase {
    */
   virtual void set_resize_value(double resize_value);
 
+  /**
+   * @brief
+   * Set the digital zoom factor.
+   * @param zoom [in] zoom factor (1.0: whole frame).
+   */
+  virtual void set_zoom(double zoom);
+
+  /**
+   * @brief
+   * Set input image size.
+   * The output size is derived from it.
+   * @param input_size [in] input image size.
+   */
+  virtual void set_input_image_size(CvSize input_size);
+
   /**
    * @brief
    * Set the list of parameter setting string for the Resize plugin.
@@ -18,13 +18,15 @@
 #define kRboxHowToResizeId 70003
 #define kSliderResizeId 70004
 #define kSliderResizeTextId 70005
+#define kSliderZoomId 70006
+#define kSliderZoomTextId 70007
 
 /* GUI*/
 #define kWndTitle "ResizeImage"
 #define kWndPointX 0
 #define kWndPointY 0
 #define kWndSizeW 240
-#define kWndSizeH 270
+#define kWndSizeH 330
 
 // Resize Type Radio  box
 #define kRadioResizeText "Type"
@@ -43,6 +45,12 @@
 #define kHowToResizeDefault 0
 #define kSliderDefault 100
 
+// Digital zoom slider (percent)
+#define kStaticTextZoomText "Zoom"
+#define kSliderZoomDefault 100
+#define kSliderZoomMin 100
+#define kSliderZoomMax 400
+
 typedef enum {
   kResizeDouble = 0,
   kResizeDefault,
@@ -15,6 +15,7 @@ EVT_BUTTON(kButtonApplyId, ResizeImageWnd::OnApply)
 EVT_RADIOBOX(kRboxResizeId, ResizeImageWnd::OnSelectResizeValue)
 EVT_RADIOBOX(kRboxHowToResizeId, ResizeImageWnd::OnSelectResizeMode)
 EVT_COMMAND_SCROLL(kSliderResizeId, ResizeImageWnd::OnSliderResize)
+EVT_COMMAND_SCROLL(kSliderZoomId, ResizeImageWnd::OnSliderZoom)
 END_EVENT_TABLE();
 
 /**
@@ -77,7 +78,21 @@ ResizeImageWnd::ResizeImageWnd(ResizeImage *parent)
   wx_static_text_slider_resize_ = new wxStaticText(
       this, kSliderResizeTextId, label, wxPoint(170, 80), wxSize(50, 30));
 
+  // ------------------------zoom slider----------------------------
+  wx_static_text_zoom_ = new wxStaticText(
+      this, -1, wxT(kStaticTextZoomText), wxPoint(20, 270), wxSize(45, 30));
+  slider_zoom_value_ = kSliderZoomDefault;
+  wx_slider_zoom_ = new wxSlider(this, kSliderZoomId, slider_zoom_value_,
+                                 kSliderZoomMin, kSliderZoomMax,
+                                 wxPoint(65, 260), wxSize(110, -1));
+  wx_slider_zoom_->SetLineSize(10);
+  wx_slider_zoom_->SetPageSize(10);
+  label = wxString::Format(wxT("%d%%"), slider_zoom_value_);
+  wx_static_text_slider_zoom_ = new wxStaticText(
+      this, kSliderZoomTextId, label, wxPoint(180, 270), wxSize(50, 30));
+
   LoadSettingsFromFile(wxT(ResizeConfigFile));
+  UpdateSliderZoomValue();
 
   if (how_to_resize_ == 0) {
     wx_radio_select_resize_->Enable();
@@ -192,6 +207,34 @@ void ResizeImageWnd::UpdateSliderResizeValue(void) {
   WriteSettingsToFile(wxT(ResizeConfigFile));
 }
 
+/**
+ * @brief
+ * The handler function for slider(id = kSliderZoomId).
+ */
+void ResizeImageWnd::OnSliderZoom(wxScrollEvent &event) {
+  DEBUG_PRINT("ResizeImageWnd::OnSliderZoom\n");
+  UpdateSliderZoomValue();
+  WriteSettingsToFile(wxT(ResizeConfigFile));
+}
+
+/**
+ * @brief
+ * Apply zoom slider value.
+ */
+void ResizeImageWnd::UpdateSliderZoomValue(void) {
+  wxString label;
+
+  // rounds the value to multiple of 10
+  int value = wx_slider_zoom_->GetValue();
+  value = ((value + 5) / 10) * 10;
+  wx_slider_zoom_->SetValue(value);
+  slider_zoom_value_ = value;
+
+  label = wxString::Format(wxT("%d%%"), slider_zoom_value_);
+  wx_static_text_slider_zoom_->SetLabel(label);
+  parent_->set_zoom(static_cast<double>(slider_zoom_value_) / 100.0);
+}
+
 /**
  * @brief
  * Set the list of parameter setting string for the Resize plugin.
@@ -217,6 +260,13 @@ void ResizeImageWnd::SetPluginSettings(std::vector<wxString> params) {
   slider_resize_value_ = static_cast<int>(temp_value);
   wx_slider_resize_->SetValue(slider_resize_value_);
 
+  // The zoom line is absent in the settings of older versions.
+  if (params.size() > 3) {
+    params[3].ToLong(&temp_value);
+    wx_slider_zoom_->SetValue(static_cast<int>(temp_value));
+  }
+  UpdateSliderZoomValue();
+
   if (how_to_resize_ == 0) {
     wx_radio_select_resize_->Enable();
     wx_button_setting_apply_->Enable();
@@ -282,6 +332,12 @@ bool ResizeImageWnd::LoadSettingsFromFile(wxString file_path) {
     line_str.ToLong(&temp_value);
     slider_resize_value_ = static_cast<int>(temp_value);
     wx_slider_resize_->SetValue(slider_resize_value_);
+
+    // The zoom line is absent in the settings of older versions.
+    if (text_file.GetLineCount() > 3) {
+      text_file.GetLine(3).ToLong(&temp_value);
+      wx_slider_zoom_->SetValue(static_cast<int>(temp_value));
+    }
   }
 
   text_file.Close();
@@ -334,6 +390,10 @@ bool ResizeImageWnd::WriteSettingsToFile(wxString file_path) {
   parent_->AddLinePluginSettings(line_str);
   text_file.AddLine(line_str);
 
+  line_str = wxString::Format(wxT("%d"), slider_zoom_value_);
+  parent_->AddLinePluginSettings(line_str);
+  text_file.AddLine(line_str);
+
   if (parent_->is_cloned() == false) {
     text_file.Write();
   }
@@ -31,6 +31,8 @@ class ResizeImageWnd : public wxFrame {
   int slider_resize_value_;
   /*! It manages the selected value of how to resize. */
   int how_to_resize_;
+  /*! It manages the selected value of the digital zoom (percent). */
+  int slider_zoom_value_;
 
  protected:
   wxRadioBox* wx_radio_select_how_to_resize_;
@@ -39,6 +41,9 @@ class ResizeImageWnd : public wxFrame {
   wxStaticBox* wx_static_box_slider_resize_;
   wxSlider* wx_slider_resize_;
   wxStaticText* wx_static_text_slider_resize_;
+  wxStaticText* wx_static_text_zoom_;
+  wxSlider* wx_slider_zoom_;
+  wxStaticText* wx_static_text_slider_zoom_;
 
  public:
   /**
@@ -89,6 +94,18 @@ class ResizeImageWnd : public wxFrame {
    */
   void UpdateSliderResizeValue(void);
 
+  /**
+   * @brief
+   * The handler function for slider(id = kSliderZoomId).
+   */
+  void OnSliderZoom(wxScrollEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * Apply zoom slider value.
+   */
+  void UpdateSliderZoomValue(void);
+
   /**
    * @brief
    * Set the list of parameter setting string for the Resize plugin.
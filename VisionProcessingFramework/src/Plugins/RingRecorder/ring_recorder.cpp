@@ -0,0 +1,352 @@
+/**
+ * @file      ring_recorder.cpp
+ * @brief     RingRecorder plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./ring_recorder.h"
+#include <string.h>
+#include <vector>
+#include "./frame_trigger.h"
+
+/**
+ * @brief
+ * Constructor.
+ */
+RingRecorder::RingRecorder() : PluginBase() {
+  DEBUG_PRINT("RingRecorder::RingRecorder()\n");
+
+  set_plugin_name("RingRecorder");
+
+  AddInputPortCandidateSpec(kGRAY8);  /* Bayer 8bit */
+  AddInputPortCandidateSpec(kGRAY16); /* Bayer 10bit in 16bit */
+
+  set_is_use_dest_buffer(false);
+
+  common_ = NULL;
+  writer_ = NULL;
+  trigger_request_ = 0;
+  trigger_seen_ = 0;
+  event_ = 0;
+  event_count_ = 0;
+  timerclear(&trigger_time_);
+  timerclear(&post_end_time_);
+  pre_frames_ = 0;
+  post_frames_ = 0;
+  frames_ = 0;
+  dropped_ = 0;
+  is_format_error_ = false;
+
+  // Initialize
+  wnd_ = new RingRecorderWnd(this);
+  settings_ = wnd_->settings();
+  wnd_->InitDialog();
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+RingRecorder::~RingRecorder() {
+  if (writer_ != NULL) {
+    writer_->Stop(false);
+    delete writer_;
+    writer_ = NULL;
+  }
+  delete wnd_;
+}
+
+/**
+ * @brief
+ * Initialize routine of the RingRecorder plugin.
+ * @param common [in] commom parameters.
+ * @return If true, successful initialization
+ */
+bool RingRecorder::InitProcess(CommonParam* common) {
+  DEBUG_PRINT("RingRecorder::InitProcess \n");
+  common_ = common;
+  wnd_->PostCaptureInit();
+
+  // The settings are taken at the start, the pool at the first frame.
+  settings_ = wnd_->settings();
+  if (writer_ != NULL) {
+    writer_->Stop(false);
+    delete writer_;
+    writer_ = NULL;
+  }
+  buffer_.Reset();
+  trigger_request_ = 0;
+  trigger_seen_ = FrameTrigger::Instance()->count();
+  event_ = 0;
+  pre_frames_ = 0;
+  post_frames_ = 0;
+  frames_ = 0;
+  dropped_ = 0;
+  is_format_error_ = false;
+
+  writer_ = new RingRecorderWriter(&buffer_);
+  writer_->set_thread_name(plugin_name() + kThreadPlacementWriterSuffix);
+  if (writer_->Start(settings_.output_dir) == false) {
+    PLUGIN_LOG_ERROR("Failed to start the writer thread");
+    delete writer_;
+    writer_ = NULL;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Finalize routine of the RingRecorder plugin.
+ * The event being recorded is closed and flushed.
+ */
+void RingRecorder::EndProcess() {
+  DEBUG_PRINT("RingRecorder::EndProcess \n");
+  if (writer_ != NULL) {
+    EndEvent();
+    writer_->Stop(true);
+    LogReports();
+    const ThreadPlacer &placer = writer_->placer();
+    if (placer.error().empty() == false) {
+      PLUGIN_LOG_WARNING("Failed to place thread - thread:%s %s",
+                         placer.name().c_str(), placer.error().c_str());
+    }
+    ThreadSchedCounts counts = placer.counts();
+    if (counts.frames > 0) {
+      PLUGIN_LOG_MESSAGE(
+          "Thread schedule - thread:%s placement:%s frames:%u "
+          "migrations:%u preempted:%u switches:%u",
+          placer.name().c_str(), placer.Describe().c_str(), counts.frames,
+          counts.migrations, counts.preempted_frames, counts.preemptions);
+    }
+    delete writer_;
+    writer_ = NULL;
+  }
+  buffer_.Reset();
+  PLUGIN_LOG_MESSAGE("Stop - frames:%u events:%u dropped:%u", frames_,
+                     event_count_, dropped_);
+  wnd_->PostCaptureEnd();
+}
+
+/**
+ * @brief
+ * Post-processing routine of the RingRecorder plugin.
+ * This function is empty implementation.
+ */
+void RingRecorder::DoPostProcess(void) {}
+
+/**
+ * @brief
+ * Main routine of the RingRecorder plugin.
+ * @param src_image [in] src image data.
+ * @param dst_image [out] dst image data.
+ * @return If true, success in the main processing
+ */
+bool RingRecorder::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
+  if (src_image == NULL) {
+    DEBUG_PRINT("[RingRecorder]src_image == NULL\n");
+    return false;
+  }
+  if (writer_ == NULL) {
+    DEBUG_PRINT("[RingRecorder]writer_ == NULL\n");
+    return false;
+  }
+  frames_++;
+  LogReports();
+
+  // The pool is allocated once, for the format of the first frame.
+  if (buffer_.count() == 0 && is_format_error_ == false) {
+    long budget_bytes = settings_.budget_mb * 1024L * 1024L;  // NOLINT
+    int slots =
+        buffer_.Configure(*src_image, settings_.is_pack_raw10, budget_bytes);
+    if (slots == 0) {
+      PLUGIN_LOG_ERROR("Memory budget %dMB is too small for %dx%d frames",
+                       settings_.budget_mb, src_image->cols, src_image->rows);
+      is_format_error_ = true;
+    } else {
+      PLUGIN_LOG_MESSAGE("Start - slots:%d (%.1fMB) format:%s", slots,
+                         static_cast<double>(slots) * buffer_.slot_bytes() /
+                             (1024 * 1024),
+                         buffer_.format_name());
+    }
+  }
+  if (is_format_error_ || !buffer_.IsConfigured(*src_image)) {
+    dropped_++;
+    return true;
+  }
+
+  FrameMetadata* metadata = frame_metadata();
+  unsigned int frame_number = frames_;
+  struct timeval capture_time;
+  timerclear(&capture_time);
+  if (metadata != NULL) {
+    frame_number = metadata->frame_number;
+    capture_time = metadata->capture_time;
+  }
+  if (!timerisset(&capture_time)) {
+    gettimeofday(&capture_time, NULL);
+  }
+
+  // The event is over once a frame is past its post-trigger duration.
+  if (event_ != 0 && timercmp(&capture_time, &post_end_time_, >)) {
+    EndEvent();
+  }
+
+  // Triggers of this plugin and of the other plugins.
+  bool is_trigger = (__sync_lock_test_and_set(&trigger_request_, 0) != 0);
+  unsigned int fired = FrameTrigger::Instance()->count();
+  if (fired != trigger_seen_) {
+    DEBUG_PRINT("[RingRecorder]trigger from %s\n",
+                FrameTrigger::Instance()->last_source());
+    trigger_seen_ = fired;
+    is_trigger = true;
+  }
+
+  // The frame is stored before the event takes the ring, so that the
+  // trigger frame can recycle the oldest pre-trigger frame.
+  int slot = buffer_.Store(*src_image, frame_number, capture_time);
+  if (is_trigger) {
+    BeginEvent(capture_time);
+  }
+  if (slot < 0) {
+    // The writer is behind: every slot is waiting to be written.
+    dropped_++;
+    return true;
+  }
+  if (event_ != 0) {
+    Flush(slot);
+    post_frames_++;
+  } else {
+    buffer_.KeepInRing(slot, settings_.pre_msec);
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Request a trigger (any thread).
+ * The trigger is handled with the next frame.
+ */
+void RingRecorder::Trigger(void) {
+  __sync_add_and_fetch(&trigger_request_, 1);
+}
+
+/**
+ * @brief
+ * Start an event, or extend the event being recorded.
+ * @param capture_time [in] capture time of the frame of the trigger.
+ */
+void RingRecorder::BeginEvent(const struct timeval& capture_time) {
+  struct timeval post;
+  post.tv_sec = settings_.post_msec / 1000;
+  post.tv_usec = (settings_.post_msec % 1000) * 1000;
+  timeradd(&capture_time, &post, &post_end_time_);
+  if (event_ != 0) {
+    return;
+  }
+
+  event_count_++;
+  event_ = event_count_;
+  trigger_time_ = capture_time;
+  post_frames_ = 0;
+
+  // The frames of the ring are the pre-trigger frames of the event.
+  std::vector<int> slots;
+  buffer_.TakeRing(&slots);
+  pre_frames_ = static_cast<unsigned int>(slots.size());
+  for (unsigned int i = 0; i < slots.size(); i++) {
+    Flush(slots[i]);
+  }
+}
+
+/**
+ * @brief
+ * Close the event being recorded.
+ */
+void RingRecorder::EndEvent(void) {
+  if (event_ == 0) {
+    return;
+  }
+  Flush(kRingRecorderJobEnd);
+  PLUGIN_LOG_MESSAGE("Event %u - pre:%u post:%u pending:%d", event_,
+                     pre_frames_, post_frames_, writer_->pending());
+  event_ = 0;
+}
+
+/**
+ * @brief
+ * Queue a frame of the event being recorded to the writer.
+ * @param slot [in] index of the slot.
+ */
+void RingRecorder::Flush(int slot) {
+  RingRecorderJob job;
+  job.slot = slot;
+  job.event = event_;
+  job.trigger_time = trigger_time_;
+  writer_->Submit(job);
+}
+
+/**
+ * @brief
+ * Log the report of the events flushed.
+ */
+void RingRecorder::LogReports(void) {
+  RingRecorderEventReport report;
+  while (writer_->TakeReport(&report)) {
+    if (report.is_failed) {
+      PLUGIN_LOG_ERROR("Event %u - write failed in %s", report.event,
+                       settings_.output_dir.c_str());
+    }
+    PLUGIN_LOG_MESSAGE("Event %u - written frames:%u %.1fMB in %.1fms",
+                       report.event, report.frames,
+                       report.bytes / (1024 * 1024), report.flush_msec);
+  }
+}
+
+/**
+ * @brief
+ * Open setting window of the RingRecorder plugin.
+ * @param state [in] ImageProcessingState
+ */
+void RingRecorder::OpenSettingWindow(ImageProcessingState state) {
+  if (wnd_ == NULL) {
+    DEBUG_PRINT("wnd_ == NULL\n");
+    return;
+  }
+  wxString window_title(plugin_name().c_str(), wxConvUTF8);
+  wnd_->SetTitle(window_title);
+  wnd_->InitDialog();
+  wnd_->Show(true);
+  wnd_->Raise();
+}
+
+/**
+ * @brief
+ * Close setting window of the RingRecorder plugin.
+ * @return If true, success close window
+ */
+bool RingRecorder::CloseSettingWindow() {
+  if (wnd_ == NULL) {
+    return false;
+  }
+  wnd_->Show(false);
+  return true;
+}
+
+/**
+ * @brief
+ * Set the list of parameter setting string for the RingRecorder plugin.
+ * @param params [in] settings string.
+ */
+void RingRecorder::SetPluginSettings(std::vector<wxString> params) {
+  wnd_->SetPluginSettings(params);
+}
+
+extern "C" PluginBase* Create(void) {
+  DEBUG_PRINT("Create RingRecorder plugins\n");
+  RingRecorder* plugin = new RingRecorder();
+  return plugin;
+}
+
+extern "C" void Destroy(PluginBase* plugin) { delete plugin; }
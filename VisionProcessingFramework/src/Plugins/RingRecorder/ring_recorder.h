@@ -0,0 +1,166 @@
+/**
+ * @file      ring_recorder.h
+ * @brief     RingRecorder plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _RING_RECORDER_H_
+#define _RING_RECORDER_H_
+
+#include <sys/time.h>
+#include <string>
+#include <vector>
+#include "./common_param.h"
+#include "./plugin_base.h"
+#include "./ring_recorder_buffer.h"
+#include "./ring_recorder_define.h"
+#include "./ring_recorder_wnd.h"
+#include "./ring_recorder_writer.h"
+
+/**
+ * @class RingRecorder
+ * @brief Keep the last raw frames in memory and write them to the disk
+ * around a trigger.
+ * The raw frames of the last pre-trigger duration are kept in a bounded
+ * pool. On a trigger (Trigger(), the Trigger button or a key of the
+ * setting window, or FrameTrigger fired by another plugin), these frames
+ * and the frames of the post-trigger duration are flushed on the writer
+ * thread while the capture continues. A trigger during the post-trigger
+ * duration extends the event.
+ */
+class RingRecorder : public PluginBase {
+ private:
+  /*! Parameter setting window.*/
+  RingRecorderWnd* wnd_;
+  /*! Common parameter */
+  CommonParam* common_;
+  /*! Settings of the capture */
+  RingRecorderSettings settings_;
+  /*! Frame pool */
+  RingRecorderBuffer buffer_;
+  /*! Writer thread */
+  RingRecorderWriter* writer_;
+  /*! Triggers requested by Trigger() and not handled yet */
+  volatile unsigned int trigger_request_;
+  /*! Count of FrameTrigger at the last poll */
+  unsigned int trigger_seen_;
+  /*! Event being recorded (0: none) */
+  unsigned int event_;
+  /*! Number of the events since the start */
+  unsigned int event_count_;
+  /*! Trigger time of the event being recorded */
+  struct timeval trigger_time_;
+  /*! End of the post-trigger duration of the event being recorded */
+  struct timeval post_end_time_;
+  /*! Frames before the trigger of the event being recorded */
+  unsigned int pre_frames_;
+  /*! Frames after the trigger of the event being recorded */
+  unsigned int post_frames_;
+  /*! Frames received since the start */
+  unsigned int frames_;
+  /*! Frames dropped since the start (all the slots pending) */
+  unsigned int dropped_;
+  /*! Whether the frame format is not supported by the pool */
+  bool is_format_error_;
+
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  RingRecorder(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~RingRecorder(void);
+
+  /**
+   * @brief
+   * Initialize routine of the RingRecorder plugin.
+   * @param common [in] commom parameters.
+   * @return If true, successful initialization
+   */
+  virtual bool InitProcess(CommonParam* common);
+
+  /**
+   * @brief
+   * Finalize routine of the RingRecorder plugin.
+   * The event being recorded is closed and flushed.
+   */
+  virtual void EndProcess(void);
+
+  /**
+   * @brief
+   * Post-processing routine of the RingRecorder plugin.
+   * This function is empty implementation.
+   */
+  virtual void DoPostProcess(void);
+
+  /**
+   * @brief
+   * Main routine of the RingRecorder plugin.
+   * @param src_image [in] src image data.
+   * @param dst_image [out] dst image data.
+   * @return If true, success in the main processing
+   */
+  virtual bool DoProcess(cv::Mat* src_image, cv::Mat* dst_image);
+
+  /**
+   * @brief
+   * Request a trigger (any thread).
+   * The trigger is handled with the next frame.
+   */
+  void Trigger(void);
+
+  /**
+   * @brief
+   * Open setting window of the RingRecorder plugin.
+   * @param state [in] ImageProcessingState
+   */
+  virtual void OpenSettingWindow(ImageProcessingState state);
+
+  /**
+   * @brief
+   * Close setting window of the RingRecorder plugin.
+   * @return If true, success close window
+   */
+  virtual bool CloseSettingWindow(void);
+
+  /**
+   * @brief
+   * Set the list of parameter setting string for the RingRecorder plugin.
+   * @param params [in] settings string.
+   */
+  virtual void SetPluginSettings(std::vector<wxString> params);
+
+ private:
+  /**
+   * @brief
+   * Start an event, or extend the event being recorded.
+   * @param capture_time [in] capture time of the frame of the trigger.
+   */
+  void BeginEvent(const struct timeval& capture_time);
+
+  /**
+   * @brief
+   * Close the event being recorded.
+   */
+  void EndEvent(void);
+
+  /**
+   * @brief
+   * Queue a frame of the event being recorded to the writer.
+   * @param slot [in] index of the slot.
+   */
+  void Flush(int slot);
+
+  /**
+   * @brief
+   * Log the report of the events flushed.
+   */
+  void LogReports(void);
+};
+#endif /* _RING_RECORDER_H_*/
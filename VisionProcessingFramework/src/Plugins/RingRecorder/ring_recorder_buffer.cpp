@@ -0,0 +1,229 @@
+/**
+ * @file      ring_recorder_buffer.cpp
+ * @brief     Frame pool of the RingRecorder plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./ring_recorder_buffer.h"
+#include <string.h>
+#include <vector>
+
+/**
+ * @brief
+ * Constructor.
+ */
+RingRecorderBuffer::RingRecorderBuffer(void) {
+  size_ = cvSize(0, 0);
+  type_ = -1;
+  is_packed_ = false;
+  slot_bytes_ = 0;
+}
+
+/**
+ * @brief
+ * Allocate the slots for a frame format.
+ * @param image [in] first frame (8bit or 16bit, one channel).
+ * @param is_pack_raw10 [in] If true, 16bit frames are packed as RAW10.
+ * @param budget_bytes [in] memory budget of all the slots.
+ * @return number of the slots (0: the budget is too small).
+ */
+int RingRecorderBuffer::Configure(const cv::Mat &image, bool is_pack_raw10,
+                                  long budget_bytes) {  // NOLINT
+  Reset();
+  size_ = cvSize(image.cols, image.rows);
+  type_ = image.type();
+  is_packed_ = is_pack_raw10 && (image.depth() == CV_16U);
+  int pixels = image.cols * image.rows;
+  if (is_packed_) {
+    slot_bytes_ = (pixels + 3) / 4 * 5;
+  } else {
+    slot_bytes_ = pixels * static_cast<int>(image.elemSize());
+  }
+  if (slot_bytes_ <= 0) {
+    return 0;
+  }
+
+  long count = budget_bytes / slot_bytes_;  // NOLINT
+  if (count < kRingRecorderMinSlots) {
+    return 0;
+  }
+  if (count > kRingRecorderMaxSlots) {
+    count = kRingRecorderMaxSlots;
+  }
+  slots_.resize(count);
+  wxMutexLocker lock(free_mutex_);
+  for (int i = 0; i < count; i++) {
+    slots_[i].data.resize(slot_bytes_);
+    slots_[i].frame_number = 0;
+    timerclear(&slots_[i].capture_time);
+    free_.push_back(i);
+  }
+  return static_cast<int>(count);
+}
+
+/**
+ * @brief
+ * Free all the slots (no frame may be pending).
+ */
+void RingRecorderBuffer::Reset(void) {
+  wxMutexLocker lock(free_mutex_);
+  free_.clear();
+  ring_.clear();
+  slots_.clear();
+  size_ = cvSize(0, 0);
+  type_ = -1;
+  slot_bytes_ = 0;
+}
+
+/**
+ * @brief
+ * Whether the slots fit a frame.
+ * @param image [in] frame.
+ * @return If true, the pool is configured for the frame format.
+ */
+bool RingRecorderBuffer::IsConfigured(const cv::Mat &image) const {
+  return !slots_.empty() && image.cols == size_.width &&
+         image.rows == size_.height && image.type() == type_;
+}
+
+/**
+ * @brief
+ * Store a frame in a slot (flow thread).
+ * A free slot is used first, then the oldest frame of the ring.
+ * @param image [in] frame.
+ * @param frame_number [in] frame number.
+ * @param capture_time [in] capture time.
+ * @return index of the slot (-1: all the slots are pending).
+ */
+int RingRecorderBuffer::Store(const cv::Mat &image, unsigned int frame_number,
+                              const struct timeval &capture_time) {
+  int slot = -1;
+  {
+    wxMutexLocker lock(free_mutex_);
+    if (!free_.empty()) {
+      slot = free_.back();
+      free_.pop_back();
+    }
+  }
+  if (slot < 0) {
+    if (ring_.empty()) {
+      return -1;
+    }
+    slot = ring_.front();
+    ring_.pop_front();
+  }
+
+  RingRecorderSlot *target = &slots_[slot];
+  unsigned char *dst = &target->data[0];
+  int row_bytes = image.cols * static_cast<int>(image.elemSize());
+  if (is_packed_ && image.isContinuous()) {
+    PackRaw10(reinterpret_cast<const unsigned short *>(image.data),
+              image.cols * image.rows, dst);
+  } else if (is_packed_) {
+    std::vector<unsigned short> pixels(image.cols * image.rows);
+    for (int y = 0; y < image.rows; y++) {
+      memcpy(&pixels[y * image.cols], image.ptr(y), row_bytes);
+    }
+    PackRaw10(&pixels[0], image.cols * image.rows, dst);
+  } else if (image.isContinuous()) {
+    memcpy(dst, image.data, slot_bytes_);
+  } else {
+    for (int y = 0; y < image.rows; y++) {
+      memcpy(dst + y * row_bytes, image.ptr(y), row_bytes);
+    }
+  }
+  target->frame_number = frame_number;
+  target->capture_time = capture_time;
+  return slot;
+}
+
+/**
+ * @brief
+ * Keep a stored frame in the ring, and free the frames of the ring older
+ * than the pre-trigger duration (flow thread).
+ * @param slot [in] index of the slot.
+ * @param pre_msec [in] pre-trigger duration in msec.
+ */
+void RingRecorderBuffer::KeepInRing(int slot, int pre_msec) {
+  ring_.push_back(slot);
+  const struct timeval &latest = slots_[slot].capture_time;
+  while (ring_.size() > 1) {
+    const struct timeval &oldest = slots_[ring_.front()].capture_time;
+    double age_msec = (latest.tv_sec - oldest.tv_sec) * 1000.0 +
+                      (latest.tv_usec - oldest.tv_usec) / 1000.0;
+    if (age_msec <= pre_msec) {
+      break;
+    }
+    Release(ring_.front());
+    ring_.pop_front();
+  }
+}
+
+/**
+ * @brief
+ * Take all the frames of the ring, oldest first (flow thread).
+ * @param slots [out] index of the slots.
+ */
+void RingRecorderBuffer::TakeRing(std::vector<int> *slots) {
+  slots->assign(ring_.begin(), ring_.end());
+  ring_.clear();
+}
+
+/**
+ * @brief
+ * Return a slot to the free list (any thread).
+ * @param slot [in] index of the slot.
+ */
+void RingRecorderBuffer::Release(int slot) {
+  wxMutexLocker lock(free_mutex_);
+  free_.push_back(slot);
+}
+
+/**
+ * @brief
+ * Get the name of the frame format of the slots.
+ * @return "RAW8", "RAW16" or "RAW10" (packed).
+ */
+const char *RingRecorderBuffer::format_name(void) const {
+  if (is_packed_) {
+    return "RAW10";
+  }
+  return (CV_MAT_DEPTH(type_) == CV_8U) ? "RAW8" : "RAW16";
+}
+
+/**
+ * @brief
+ * Pack 10bit pixels as RAW10 (MIPI CSI-2: 4 pixels in 5 bytes, the high
+ * 8 bits of each pixel, then the low 2 bits of the 4 pixels).
+ * @param src [in] pixels (10bit in 16bit).
+ * @param pixels [in] number of the pixels (a partial group is padded).
+ * @param dst [out] packed data of (pixels + 3) / 4 * 5 bytes.
+ */
+void RingRecorderBuffer::PackRaw10(const unsigned short *src, int pixels,
+                                   unsigned char *dst) {
+  int groups = pixels / 4;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (int i = 0; i < groups; i++) {
+    const unsigned short *p = src + i * 4;
+    unsigned char *q = dst + i * 5;
+    q[0] = static_cast<unsigned char>((p[0] >> 2) & 0xFF);
+    q[1] = static_cast<unsigned char>((p[1] >> 2) & 0xFF);
+    q[2] = static_cast<unsigned char>((p[2] >> 2) & 0xFF);
+    q[3] = static_cast<unsigned char>((p[3] >> 2) & 0xFF);
+    q[4] = static_cast<unsigned char>((p[0] & 0x03) | ((p[1] & 0x03) << 2) |
+                                      ((p[2] & 0x03) << 4) |
+                                      ((p[3] & 0x03) << 6));
+  }
+
+  int rest = pixels - groups * 4;
+  if (rest > 0) {
+    unsigned short tail[4] = {0, 0, 0, 0};
+    for (int i = 0; i < rest; i++) {
+      tail[i] = src[groups * 4 + i];
+    }
+    PackRaw10(tail, 4, dst + groups * 5);
+  }
+}
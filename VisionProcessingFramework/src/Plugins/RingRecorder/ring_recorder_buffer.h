@@ -0,0 +1,180 @@
+/**
+ * @file      ring_recorder_buffer.h
+ * @brief     Frame pool of the RingRecorder plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _RING_RECORDER_BUFFER_H_
+#define _RING_RECORDER_BUFFER_H_
+
+#include <sys/time.h>
+#include <deque>
+#include <vector>
+#include "./include.h"
+#include "./ring_recorder_define.h"
+
+/**
+ * @struct RingRecorderSlot
+ * @brief Frame held by the pool.
+ */
+typedef struct {
+  /*! Frame data (a copy of the frame, or the packed RAW10 frame) */
+  std::vector<unsigned char> data;
+  /*! Frame number */
+  unsigned int frame_number;
+  /*! Capture time */
+  struct timeval capture_time;
+} RingRecorderSlot;
+
+/**
+ * @class RingRecorderBuffer
+ * @brief Bounded pool of the raw frames kept before a trigger.
+ * All the slots are allocated when the frame format is known, within the
+ * memory budget, so that no allocation happens on the flow. A slot is
+ * either free, in the ring (the frames before a trigger, oldest first),
+ * or pending until the writer has flushed it. The ring is only used on the
+ * flow thread; the free list is shared with the writer thread.
+ */
+class RingRecorderBuffer {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  RingRecorderBuffer(void);
+
+  /**
+   * @brief
+   * Allocate the slots for a frame format.
+   * @param image [in] first frame (8bit or 16bit, one channel).
+   * @param is_pack_raw10 [in] If true, 16bit frames are packed as RAW10.
+   * @param budget_bytes [in] memory budget of all the slots.
+   * @return number of the slots (0: the budget is too small).
+   */
+  int Configure(const cv::Mat &image, bool is_pack_raw10,
+                long budget_bytes);  // NOLINT
+
+  /**
+   * @brief
+   * Free all the slots (no frame may be pending).
+   */
+  void Reset(void);
+
+  /**
+   * @brief
+   * Whether the slots fit a frame.
+   * @param image [in] frame.
+   * @return If true, the pool is configured for the frame format.
+   */
+  bool IsConfigured(const cv::Mat &image) const;
+
+  /**
+   * @brief
+   * Store a frame in a slot (flow thread).
+   * A free slot is used first, then the oldest frame of the ring.
+   * @param image [in] frame.
+   * @param frame_number [in] frame number.
+   * @param capture_time [in] capture time.
+   * @return index of the slot (-1: all the slots are pending).
+   */
+  int Store(const cv::Mat &image, unsigned int frame_number,
+            const struct timeval &capture_time);
+
+  /**
+   * @brief
+   * Keep a stored frame in the ring, and free the frames of the ring older
+   * than the pre-trigger duration (flow thread).
+   * @param slot [in] index of the slot.
+   * @param pre_msec [in] pre-trigger duration in msec.
+   */
+  void KeepInRing(int slot, int pre_msec);
+
+  /**
+   * @brief
+   * Take all the frames of the ring, oldest first (flow thread).
+   * @param slots [out] index of the slots.
+   */
+  void TakeRing(std::vector<int> *slots);
+
+  /**
+   * @brief
+   * Return a slot to the free list (any thread).
+   * @param slot [in] index of the slot.
+   */
+  void Release(int slot);
+
+  /**
+   * @brief
+   * Get a slot.
+   * @param slot [in] index of the slot.
+   * @return slot.
+   */
+  const RingRecorderSlot &slot(int slot) const { return slots_[slot]; }
+
+  /**
+   * @brief
+   * Get the number of the slots.
+   * @return number of the slots.
+   */
+  int count(void) const { return static_cast<int>(slots_.size()); }
+
+  /**
+   * @brief
+   * Get the frame size of the slots.
+   * @return frame size.
+   */
+  CvSize size(void) const { return size_; }
+
+  /**
+   * @brief
+   * Get the data size of a slot.
+   * @return size in bytes.
+   */
+  int slot_bytes(void) const { return slot_bytes_; }
+
+  /**
+   * @brief
+   * Get the name of the frame format of the slots.
+   * @return "RAW8", "RAW16" or "RAW10" (packed).
+   */
+  const char *format_name(void) const;
+
+  /**
+   * @brief
+   * Pack 10bit pixels as RAW10 (MIPI CSI-2: 4 pixels in 5 bytes, the high
+   * 8 bits of each pixel, then the low 2 bits of the 4 pixels).
+   * @param src [in] pixels (10bit in 16bit).
+   * @param pixels [in] number of the pixels (a partial group is padded).
+   * @param dst [out] packed data of (pixels + 3) / 4 * 5 bytes.
+   */
+  static void PackRaw10(const unsigned short *src, int pixels,
+                        unsigned char *dst);
+
+ private:
+  /*! Slots */
+  std::vector<RingRecorderSlot> slots_;
+
+  /*! Free slots */
+  std::vector<int> free_;
+
+  /*! Slots of the ring, oldest first */
+  std::deque<int> ring_;
+
+  /*! Lock for the free list */
+  wxMutex free_mutex_;
+
+  /*! Frame size of the slots */
+  CvSize size_;
+
+  /*! Frame type of the slots */
+  int type_;
+
+  /*! Whether the slots hold packed RAW10 frames */
+  bool is_packed_;
+
+  /*! Data size of a slot */
+  int slot_bytes_;
+};
+
+#endif /* _RING_RECORDER_BUFFER_H_*/
@@ -0,0 +1,96 @@
+/**
+ * @file      ring_recorder_define.h
+ * @brief     Definition of values for RingRecorder plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _RING_RECORDER_DEFINE_H_
+#define _RING_RECORDER_DEFINE_H_
+
+/* Identification ID of UI.*/
+#define kRingRecorderWndId                 90000
+#define kTextCtrlRingDirId                 90001
+#define kButtonRingDirDialogId             90002
+#define kTextCtrlRingPreMsecId             90003
+#define kTextCtrlRingPostMsecId            90004
+#define kTextCtrlRingBudgetId              90005
+#define kCheckBoxRingPackRaw10Id           90006
+#define kButtonRingTriggerId               90007
+#define kButtonRingApplyId                 90008
+
+/* Main window definition*/
+#define kRingRecorderWndTitle "Ring recorder"
+#define kRingRecorderWndPointX 0
+#define kRingRecorderWndPointY 0
+#define kRingRecorderWndSizeW 320
+#define kRingRecorderWndSizeH 300
+
+/* Directory definition*/
+#define kStaticTextRingDirName "Directory:"
+#define kStaticTextRingDirPointX 10
+#define kStaticTextRingDirPointY 10
+#define kTextCtrlRingDirPointX 10
+#define kTextCtrlRingDirPointY 35
+#define kTextCtrlRingDirSizeW 240
+#define kTextCtrlRingDirSizeH 25
+#define kButtonRingDirDialogName "..."
+#define kButtonRingDirDialogPointX 260
+#define kButtonRingDirDialogPointY 35
+#define kButtonRingDirDialogSizeW 40
+#define kButtonRingDirDialogSizeH 25
+#define kDirDialogRingName "Choose a directory of the recordings"
+
+/* Window settings definition (label x, value x, first y, line height)*/
+#define kStaticTextRingPreMsecName "Pre-trigger (ms)"
+#define kStaticTextRingPostMsecName "Post-trigger (ms)"
+#define kStaticTextRingBudgetName "Memory budget (MB)"
+#define kCheckBoxRingPackRaw10Name "Pack 10bit frames as RAW10"
+#define kRingSettingsLabelPointX 10
+#define kRingSettingsValuePointX 180
+#define kRingSettingsPointY 75
+#define kRingSettingsLineH 35
+#define kRingSettingsLabelSizeW 160
+#define kRingSettingsValueSizeW 100
+#define kRingSettingsSizeH 25
+
+/* Trigger button definition*/
+#define kButtonRingTriggerName "Trigger"
+#define kButtonRingTriggerPointX 10
+#define kButtonRingTriggerPointY 220
+#define kButtonRingTriggerSizeW 100
+#define kButtonRingTriggerSizeH 35
+
+/* Apply button definition*/
+#define kButtonRingApplyName "Apply"
+#define kButtonRingApplyPointX 220
+#define kButtonRingApplyPointY 220
+#define kButtonRingApplySizeW 80
+#define kButtonRingApplySizeH 35
+
+/* Settings (lines of the ini file and of the flow settings)*/
+#define kRingSettingsDirIndex 0
+#define kRingSettingsPreMsecIndex 1
+#define kRingSettingsPostMsecIndex 2
+#define kRingSettingsBudgetIndex 3
+#define kRingSettingsPackRaw10Index 4
+#define kRingSettingsNum 5
+#define kRingRecorderConfigFile "../lib/Plugins/output/RingRecorder.ini"
+
+/* Default settings*/
+#define kRingDefaultDir "."
+#define kRingDefaultPreMsec 2000
+#define kRingDefaultPostMsec 1000
+#define kRingDefaultBudgetMB 256
+
+/* Frame pool*/
+#define kRingRecorderMinSlots 4
+#define kRingRecorderMaxSlots 4096
+/* Slot of a job which is not a frame*/
+#define kRingRecorderJobEnd -1
+
+/* Writer thread*/
+#define kRingRecorderWriterIdleMsec 100
+#define kRingRecorderFilePrefix "ring"
+
+#endif /* _RING_RECORDER_DEFINE_H_*/
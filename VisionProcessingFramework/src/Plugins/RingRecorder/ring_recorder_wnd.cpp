@@ -0,0 +1,375 @@
+/**
+ * @file      ring_recorder_wnd.cpp
+ * @brief     Setting window of RingRecorder plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./ring_recorder_wnd.h"
+#include <string>
+#include <vector>
+#include "./../../logger.h"
+#include "./ring_recorder.h"
+
+BEGIN_DECLARE_EVENT_TYPES()
+DECLARE_LOCAL_EVENT_TYPE(CAPTURE_INITIALIZE, wxNewEventType())
+DECLARE_LOCAL_EVENT_TYPE(CAPTURE_END, wxNewEventType())
+END_DECLARE_EVENT_TYPES()
+DEFINE_LOCAL_EVENT_TYPE(CAPTURE_INITIALIZE)
+DEFINE_LOCAL_EVENT_TYPE(CAPTURE_END)
+BEGIN_EVENT_TABLE(RingRecorderWnd, wxFrame)
+EVT_CLOSE(RingRecorderWnd::OnClose)
+EVT_COMMAND(wxID_ANY, CAPTURE_INITIALIZE, RingRecorderWnd::OnCaptureInit)
+EVT_COMMAND(wxID_ANY, CAPTURE_END, RingRecorderWnd::OnCaptureEnd)
+EVT_BUTTON(kButtonRingDirDialogId, RingRecorderWnd::OnDirDialog)
+EVT_BUTTON(kButtonRingTriggerId, RingRecorderWnd::OnTrigger)
+EVT_BUTTON(kButtonRingApplyId, RingRecorderWnd::OnApply)
+EVT_CHAR_HOOK(RingRecorderWnd::OnCharHook)
+END_EVENT_TABLE()
+
+/**
+ * @brief
+ * Constructor for this window.
+ * @param ring_recorder [in] Pointer to the RingRecorder class
+ */
+RingRecorderWnd::RingRecorderWnd(RingRecorder *ring_recorder)
+    : wxFrame(NULL, kRingRecorderWndId, wxT(kRingRecorderWndTitle),
+              wxPoint(kRingRecorderWndPointX, kRingRecorderWndPointY),
+              wxSize(kRingRecorderWndSizeW, kRingRecorderWndSizeH)) {
+  ring_recorder_ = ring_recorder;
+  settings_.output_dir = kRingDefaultDir;
+  settings_.pre_msec = kRingDefaultPreMsec;
+  settings_.post_msec = kRingDefaultPostMsec;
+  settings_.budget_mb = kRingDefaultBudgetMB;
+  settings_.is_pack_raw10 = false;
+
+  // Create the directory controls
+  static_text_dir_ = new wxStaticText(
+      this, wxID_ANY, wxT(kStaticTextRingDirName),
+      wxPoint(kStaticTextRingDirPointX, kStaticTextRingDirPointY));
+  text_ctrl_dir_ = new wxTextCtrl(
+      this, kTextCtrlRingDirId, wxT(""),
+      wxPoint(kTextCtrlRingDirPointX, kTextCtrlRingDirPointY),
+      wxSize(kTextCtrlRingDirSizeW, kTextCtrlRingDirSizeH), wxTE_READONLY);
+  button_dir_dialog_ = new wxButton(
+      this, kButtonRingDirDialogId, wxT(kButtonRingDirDialogName),
+      wxPoint(kButtonRingDirDialogPointX, kButtonRingDirDialogPointY),
+      wxSize(kButtonRingDirDialogSizeW, kButtonRingDirDialogSizeH));
+
+  // Create the duration and the memory controls
+  int y = kRingSettingsPointY;
+  static_text_pre_msec_ = new wxStaticText(
+      this, wxID_ANY, wxT(kStaticTextRingPreMsecName),
+      wxPoint(kRingSettingsLabelPointX, y),
+      wxSize(kRingSettingsLabelSizeW, kRingSettingsSizeH));
+  text_ctrl_pre_msec_ = new wxTextCtrl(
+      this, kTextCtrlRingPreMsecId, wxT(""),
+      wxPoint(kRingSettingsValuePointX, y),
+      wxSize(kRingSettingsValueSizeW, kRingSettingsSizeH));
+  y += kRingSettingsLineH;
+  static_text_post_msec_ = new wxStaticText(
+      this, wxID_ANY, wxT(kStaticTextRingPostMsecName),
+      wxPoint(kRingSettingsLabelPointX, y),
+      wxSize(kRingSettingsLabelSizeW, kRingSettingsSizeH));
+  text_ctrl_post_msec_ = new wxTextCtrl(
+      this, kTextCtrlRingPostMsecId, wxT(""),
+      wxPoint(kRingSettingsValuePointX, y),
+      wxSize(kRingSettingsValueSizeW, kRingSettingsSizeH));
+  y += kRingSettingsLineH;
+  static_text_budget_ = new wxStaticText(
+      this, wxID_ANY, wxT(kStaticTextRingBudgetName),
+      wxPoint(kRingSettingsLabelPointX, y),
+      wxSize(kRingSettingsLabelSizeW, kRingSettingsSizeH));
+  text_ctrl_budget_ = new wxTextCtrl(
+      this, kTextCtrlRingBudgetId, wxT(""),
+      wxPoint(kRingSettingsValuePointX, y),
+      wxSize(kRingSettingsValueSizeW, kRingSettingsSizeH));
+  y += kRingSettingsLineH;
+  check_box_pack_raw10_ = new wxCheckBox(
+      this, kCheckBoxRingPackRaw10Id, wxT(kCheckBoxRingPackRaw10Name),
+      wxPoint(kRingSettingsLabelPointX, y),
+      wxSize(kRingSettingsLabelSizeW + kRingSettingsValueSizeW,
+             kRingSettingsSizeH));
+
+  // Create the trigger and the apply buttons
+  button_trigger_ = new wxButton(
+      this, kButtonRingTriggerId, wxT(kButtonRingTriggerName),
+      wxPoint(kButtonRingTriggerPointX, kButtonRingTriggerPointY),
+      wxSize(kButtonRingTriggerSizeW, kButtonRingTriggerSizeH));
+  button_trigger_->Enable(false);
+  button_apply_ = new wxButton(
+      this, kButtonRingApplyId, wxT(kButtonRingApplyName),
+      wxPoint(kButtonRingApplyPointX, kButtonRingApplyPointY),
+      wxSize(kButtonRingApplySizeW, kButtonRingApplySizeH));
+
+  LoadSettingsFromFile(wxT(kRingRecorderConfigFile));
+  UpdateControls();
+}
+
+/**
+ * @brief
+ * Destructor for this window.
+ */
+RingRecorderWnd::~RingRecorderWnd() {}
+
+/**
+ * @brief
+ * The handler function for EVT_CLOSE.
+ */
+void RingRecorderWnd::OnClose(wxCloseEvent &event) { Show(false); }
+
+/**
+ * @brief
+ * Post local event(CAPTURE_INITIALIZE) for initialize the screen settings on
+ * own thread.
+ */
+void RingRecorderWnd::PostCaptureInit(void) {
+  DEBUG_PRINT("RingRecorderWnd::PostCaptureInit\n");
+  wxCommandEvent event(CAPTURE_INITIALIZE);
+  event.SetString(wxT("This is the init"));
+  wxPostEvent(this, event);
+}
+
+/**
+ * @brief
+ * Post local event(CAPTURE_END) for destroy the screen on own thread.
+ */
+void RingRecorderWnd::PostCaptureEnd(void) {
+  DEBUG_PRINT("RingRecorderWnd::PostCaptureEnd\n");
+  wxCommandEvent event(CAPTURE_END);
+  event.SetString(wxT("This is the end"));
+  wxPostEvent(this, event);
+}
+
+/**
+ * @brief
+ * The handler function for local event(CAPTURE_INITIALIZE).
+ * Disable the settings taken at the start.
+ */
+void RingRecorderWnd::OnCaptureInit(wxCommandEvent &event) {
+  button_dir_dialog_->Enable(false);
+  text_ctrl_pre_msec_->Enable(false);
+  text_ctrl_post_msec_->Enable(false);
+  text_ctrl_budget_->Enable(false);
+  check_box_pack_raw10_->Enable(false);
+  button_apply_->Enable(false);
+  button_trigger_->Enable(true);
+}
+
+/**
+ * @brief
+ * The handler function for local event(CAPTURE_END).
+ * Enable the settings.
+ */
+void RingRecorderWnd::OnCaptureEnd(wxCommandEvent &event) {
+  button_dir_dialog_->Enable(true);
+  text_ctrl_pre_msec_->Enable(true);
+  text_ctrl_post_msec_->Enable(true);
+  text_ctrl_budget_->Enable(true);
+  check_box_pack_raw10_->Enable(true);
+  button_apply_->Enable(true);
+  button_trigger_->Enable(false);
+}
+
+/**
+ * @brief
+ * The handler function for kButtonRingDirDialogId.
+ * Select the directory of the recordings.
+ */
+void RingRecorderWnd::OnDirDialog(wxCommandEvent &event) {
+  wxDirDialog dialog(this, wxT(kDirDialogRingName),
+                     text_ctrl_dir_->GetValue());
+  if (dialog.ShowModal() == wxID_OK) {
+    text_ctrl_dir_->SetValue(dialog.GetPath());
+  }
+}
+
+/**
+ * @brief
+ * The handler function for kButtonRingTriggerId.
+ * Trigger an event.
+ */
+void RingRecorderWnd::OnTrigger(wxCommandEvent &event) {
+  ring_recorder_->Trigger();
+}
+
+/**
+ * @brief
+ * The handler function for EVT_CHAR_HOOK.
+ * Trigger an event with the space key.
+ */
+void RingRecorderWnd::OnCharHook(wxKeyEvent &event) {
+  if (event.GetKeyCode() == WXK_SPACE && button_trigger_->IsEnabled()) {
+    ring_recorder_->Trigger();
+    return;
+  }
+  event.Skip();
+}
+
+/**
+ * @brief
+ * The handler function for kButtonRingApplyId.
+ * Reflect the settings, which are used from the next capture.
+ */
+void RingRecorderWnd::OnApply(wxCommandEvent &event) {
+  DEBUG_PRINT("RingRecorderWnd::OnApply\n");
+  std::vector<wxString> lines(kRingSettingsNum);
+  lines[kRingSettingsDirIndex] = text_ctrl_dir_->GetValue();
+  lines[kRingSettingsPreMsecIndex] = text_ctrl_pre_msec_->GetValue();
+  lines[kRingSettingsPostMsecIndex] = text_ctrl_post_msec_->GetValue();
+  lines[kRingSettingsBudgetIndex] = text_ctrl_budget_->GetValue();
+  lines[kRingSettingsPackRaw10Index] =
+      check_box_pack_raw10_->GetValue() ? wxT("1") : wxT("0");
+  SetSettings(lines);
+  UpdateControls();
+  WriteSettingsToFile(wxT(kRingRecorderConfigFile));
+  this->Show(false);
+}
+
+/**
+ * @brief
+ * Show the settings in the controls.
+ */
+void RingRecorderWnd::UpdateControls(void) {
+  text_ctrl_dir_->SetValue(
+      wxString(settings_.output_dir.c_str(), wxConvUTF8));
+  text_ctrl_pre_msec_->SetValue(
+      wxString::Format(wxT("%d"), settings_.pre_msec));
+  text_ctrl_post_msec_->SetValue(
+      wxString::Format(wxT("%d"), settings_.post_msec));
+  text_ctrl_budget_->SetValue(
+      wxString::Format(wxT("%d"), settings_.budget_mb));
+  check_box_pack_raw10_->SetValue(settings_.is_pack_raw10);
+}
+
+/**
+ * @brief
+ * Set the settings from a list of strings (lines of the settings file).
+ * Invalid values keep the current settings.
+ * @param lines [in] settings string.
+ */
+void RingRecorderWnd::SetSettings(const std::vector<wxString> &lines) {
+  long value;  // NOLINT
+  if (lines.size() > kRingSettingsDirIndex &&
+      lines[kRingSettingsDirIndex].IsEmpty() == false) {
+    settings_.output_dir =
+        std::string((const char *)lines[kRingSettingsDirIndex].mb_str());
+  }
+  if (lines.size() > kRingSettingsPreMsecIndex &&
+      lines[kRingSettingsPreMsecIndex].ToLong(&value) && value >= 0) {
+    settings_.pre_msec = static_cast<int>(value);
+  }
+  if (lines.size() > kRingSettingsPostMsecIndex &&
+      lines[kRingSettingsPostMsecIndex].ToLong(&value) && value >= 0) {
+    settings_.post_msec = static_cast<int>(value);
+  }
+  if (lines.size() > kRingSettingsBudgetIndex &&
+      lines[kRingSettingsBudgetIndex].ToLong(&value) && value > 0) {
+    settings_.budget_mb = static_cast<int>(value);
+  }
+  if (lines.size() > kRingSettingsPackRaw10Index &&
+      lines[kRingSettingsPackRaw10Index].ToLong(&value)) {
+    settings_.is_pack_raw10 = (value != 0);
+  }
+}
+
+/**
+ * @brief
+ * Set the list of parameter setting string for the RingRecorder plugin.
+ * @param params [in] settings string.
+ */
+void RingRecorderWnd::SetPluginSettings(std::vector<wxString> params) {
+  SetSettings(params);
+  UpdateControls();
+  WriteSettingsToFile(wxT(kRingRecorderConfigFile));
+}
+
+/**
+ * @brief
+ * Load the parameters from the file.
+ * @param file_path [in] file path.
+ * @return If true, reading the file success
+ */
+bool RingRecorderWnd::LoadSettingsFromFile(wxString file_path) {
+  wxTextFile text_file;
+  bool ret = false;
+
+  ret = wxFile::Exists(file_path);
+  if (ret == true) {
+    ret = text_file.Open(file_path);
+    if (ret == false) {
+      DEBUG_PRINT("Could not open file =%s\n",
+                  (const char *)file_path.mb_str());
+      return false;
+    }
+  } else {
+    DEBUG_PRINT("File does not exist =%s\n", (const char *)file_path.mb_str());
+    return false;
+  }
+
+  ret = text_file.Eof();
+  if (ret == true) {
+    DEBUG_PRINT("Blank init file\n");
+    text_file.Close();
+    return false;
+  }
+  std::vector<wxString> lines;
+  lines.push_back(text_file.GetFirstLine());
+  while (text_file.Eof() == false) {
+    lines.push_back(text_file.GetNextLine());
+  }
+  SetSettings(lines);
+  text_file.Close();
+  return true;
+}
+
+/**
+ * @brief
+ * Write the parameters to the file.
+ * @param file_path [in] file path.
+ * @return If true, writing the file success
+ */
+bool RingRecorderWnd::WriteSettingsToFile(wxString file_path) {
+  wxTextFile text_file;
+  bool ret = false;
+
+  ret = wxFile::Exists(file_path);
+  if (ret == true) {
+    ret = text_file.Open(file_path);
+    if (ret == false) {
+      ret = text_file.Create(file_path);
+      if (ret == false) {
+        LOG_ERROR("[plugin:RingRecorder] Fail to create file = %s\n",
+                  (const char *)file_path.mb_str());
+        return false;
+      }
+    }
+  } else {
+    ret = text_file.Create(file_path);
+    if (ret == false) {
+      LOG_ERROR("[plugin:RingRecorder] Fail to create file = %s\n",
+                (const char *)file_path.mb_str());
+      return false;
+    }
+  }
+  text_file.Clear();
+  ring_recorder_->ClearPluginSettings();
+
+  std::vector<wxString> lines(kRingSettingsNum);
+  lines[kRingSettingsDirIndex] =
+      wxString(settings_.output_dir.c_str(), wxConvUTF8);
+  lines[kRingSettingsPreMsecIndex] << settings_.pre_msec;
+  lines[kRingSettingsPostMsecIndex] << settings_.post_msec;
+  lines[kRingSettingsBudgetIndex] << settings_.budget_mb;
+  lines[kRingSettingsPackRaw10Index] << (settings_.is_pack_raw10 ? 1 : 0);
+  for (unsigned int i = 0; i < lines.size(); i++) {
+    ring_recorder_->AddLinePluginSettings(lines[i]);
+    text_file.AddLine(lines[i]);
+  }
+
+  if (ring_recorder_->is_cloned() == false) {
+    text_file.Write();
+  }
+  text_file.Close();
+  return true;
+}
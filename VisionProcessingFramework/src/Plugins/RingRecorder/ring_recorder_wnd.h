@@ -0,0 +1,186 @@
+/**
+ * @file      ring_recorder_wnd.h
+ * @brief     Setting window of RingRecorder plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+#ifndef _RING_RECORDER_WND_H_
+#define _RING_RECORDER_WND_H_
+
+#include <string>
+#include <vector>
+
+#include "./include.h"
+#include "./ring_recorder_define.h"
+
+class RingRecorder;
+
+/**
+ * @struct RingRecorderSettings
+ * @brief Settings of the RingRecorder plugin.
+ */
+typedef struct {
+  /*! Directory of the recordings */
+  std::string output_dir;
+  /*! Pre-trigger duration in msec */
+  int pre_msec;
+  /*! Post-trigger duration in msec */
+  int post_msec;
+  /*! Memory budget of the frame pool in MB */
+  int budget_mb;
+  /*! Whether 16bit frames are packed as RAW10 */
+  bool is_pack_raw10;
+} RingRecorderSettings;
+
+/**
+ * @class RingRecorderWnd
+ * @brief Setting window of RingRecorder plugin.
+ * The settings are taken at the start of the capture. The Trigger button,
+ * and the space key while the window has the focus, trigger an event.
+ */
+class RingRecorderWnd : public wxFrame {
+ private:
+  /*! Settings */
+  RingRecorderSettings settings_;
+  /*! Pointer to the RingRecorder class */
+  RingRecorder* ring_recorder_;
+
+ public:
+  /**
+   * @brief
+   * Constructor for this window.
+   * @param ring_recorder [in] Pointer to the RingRecorder class
+   */
+  explicit RingRecorderWnd(RingRecorder* ring_recorder);
+
+  /**
+   * @brief
+   * Destructor for this window.
+   */
+  virtual ~RingRecorderWnd(void);
+
+  /**
+   * @brief
+   * Get the settings.
+   * @return settings.
+   */
+  RingRecorderSettings settings(void) const { return settings_; }
+
+  /**
+   * @brief
+   * Post local event(CAPTURE_INITIALIZE) for initialize the screen settings on
+   * own thread.
+   */
+  virtual void PostCaptureInit(void);
+
+  /**
+   * @brief
+   * Post local event(CAPTURE_END) for destroy the screen on own thread.
+   */
+  virtual void PostCaptureEnd(void);
+
+  /**
+   * @brief
+   * The handler function for EVT_CLOSE.
+   */
+  virtual void OnClose(wxCloseEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * Set the list of parameter setting string for the RingRecorder plugin.
+   * @param params [in] settings string.
+   */
+  void SetPluginSettings(std::vector<wxString> params);
+
+ protected:
+  /*! UI*/
+  wxStaticText* static_text_dir_;
+  wxTextCtrl* text_ctrl_dir_;
+  wxButton* button_dir_dialog_;
+  wxStaticText* static_text_pre_msec_;
+  wxTextCtrl* text_ctrl_pre_msec_;
+  wxStaticText* static_text_post_msec_;
+  wxTextCtrl* text_ctrl_post_msec_;
+  wxStaticText* static_text_budget_;
+  wxTextCtrl* text_ctrl_budget_;
+  wxCheckBox* check_box_pack_raw10_;
+  wxButton* button_trigger_;
+  wxButton* button_apply_;
+
+ private:
+  /*! Event table of wxWidgets.*/
+  DECLARE_EVENT_TABLE();
+
+  /**
+   * @brief
+   * The handler function for kButtonRingDirDialogId.
+   * Select the directory of the recordings.
+   */
+  virtual void OnDirDialog(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * The handler function for kButtonRingTriggerId.
+   * Trigger an event.
+   */
+  virtual void OnTrigger(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * The handler function for EVT_CHAR_HOOK.
+   * Trigger an event with the space key.
+   */
+  virtual void OnCharHook(wxKeyEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * The handler function for kButtonRingApplyId.
+   * Reflect the settings, which are used from the next capture.
+   */
+  virtual void OnApply(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * The handler function for local event(CAPTURE_INITIALIZE).
+   * Disable the settings taken at the start.
+   */
+  virtual void OnCaptureInit(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * The handler function for local event(CAPTURE_END).
+   * Enable the settings.
+   */
+  virtual void OnCaptureEnd(wxCommandEvent& event); /* NOLINT */
+
+  /**
+   * @brief
+   * Show the settings in the controls.
+   */
+  void UpdateControls(void);
+
+  /**
+   * @brief
+   * Set the settings from a list of strings (lines of the settings file).
+   * @param lines [in] settings string.
+   */
+  void SetSettings(const std::vector<wxString>& lines);
+
+  /**
+   * @brief
+   * Load the parameters from the file.
+   * @param file_path [in] file path.
+   * @return If true, reading the file success
+   */
+  bool LoadSettingsFromFile(wxString file_path);
+
+  /**
+   * @brief
+   * Write the parameters to the file.
+   * @param file_path [in] file path.
+   * @return If true, writing the file success
+   */
+  bool WriteSettingsToFile(wxString file_path);
+};
+
+#endif /* _RING_RECORDER_WND_H_*/
@@ -0,0 +1,271 @@
+/**
+ * @file      ring_recorder_writer.cpp
+ * @brief     Writer thread of the RingRecorder plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./ring_recorder_writer.h"
+#include <string.h>
+#include <string>
+
+/**
+ * @brief
+ * Constructor.
+ * @param buffer [in] frame pool (NOT own it).
+ */
+RingRecorderWriter::RingRecorderWriter(RingRecorderBuffer *buffer)
+    : wxThread(wxTHREAD_JOINABLE), jobs_sem_(0, 0) {
+  buffer_ = buffer;
+  raw_file_ = NULL;
+  index_file_ = NULL;
+  event_ = 0;
+  timerclear(&trigger_time_);
+  memset(&current_, 0, sizeof(current_));
+  stop_flag_ = false;
+  is_drain_ = true;
+  is_started_ = false;
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+RingRecorderWriter::~RingRecorderWriter(void) { Stop(false); }
+
+/**
+ * @brief
+ * Start the thread.
+ * @param output_dir [in] directory of the recordings.
+ * @return If true, the thread is running.
+ */
+bool RingRecorderWriter::Start(const std::string &output_dir) {
+  if (is_started_) {
+    return true;
+  }
+  output_dir_ = output_dir;
+  stop_flag_ = false;
+  is_drain_ = true;
+  {
+    wxMutexLocker lock(report_mutex_);
+    reports_.clear();
+  }
+  if (Create() != wxTHREAD_NO_ERROR) {
+    DEBUG_PRINT("[RingRecorderWriter] Create failed\n");
+    return false;
+  }
+  if (Run() != wxTHREAD_NO_ERROR) {
+    DEBUG_PRINT("[RingRecorderWriter] Run failed\n");
+    return false;
+  }
+  is_started_ = true;
+  return true;
+}
+
+/**
+ * @brief
+ * Stop the thread.
+ * @param is_drain [in] If true, the pending jobs are written first,
+ * else their slots are released.
+ */
+void RingRecorderWriter::Stop(bool is_drain) {
+  if (!is_started_) {
+    return;
+  }
+  is_drain_ = is_drain;
+  stop_flag_ = true;
+  jobs_sem_.Post();
+  Wait();
+  is_started_ = false;
+}
+
+/**
+ * @brief
+ * Queue a job (flow thread).
+ * @param job [in] job.
+ */
+void RingRecorderWriter::Submit(const RingRecorderJob &job) {
+  {
+    wxMutexLocker lock(jobs_mutex_);
+    jobs_.push_back(job);
+  }
+  jobs_sem_.Post();
+}
+
+/**
+ * @brief
+ * Take the report of the oldest event flushed and not taken yet.
+ * @param report [out] report.
+ * @return If true, a report was taken.
+ */
+bool RingRecorderWriter::TakeReport(RingRecorderEventReport *report) {
+  wxMutexLocker lock(report_mutex_);
+  if (reports_.empty()) {
+    return false;
+  }
+  *report = reports_.front();
+  reports_.pop_front();
+  return true;
+}
+
+/**
+ * @brief
+ * Get the number of the jobs queued.
+ * @return number of the jobs.
+ */
+int RingRecorderWriter::pending(void) {
+  wxMutexLocker lock(jobs_mutex_);
+  return static_cast<int>(jobs_.size());
+}
+
+/**
+ * @brief
+ * Thread entry point.
+ * @return thread exit code.
+ */
+wxThread::ExitCode RingRecorderWriter::Entry(void) {
+  DEBUG_PRINT("[RingRecorderWriter] Start - tid:%d\n", this->GetId());
+  placer_.ResetCounts();
+  placer_.Update();
+  while (true) {
+    RingRecorderJob job;
+    bool is_job = false;
+    {
+      wxMutexLocker lock(jobs_mutex_);
+      if (!jobs_.empty()) {
+        job = jobs_.front();
+        jobs_.pop_front();
+        is_job = true;
+      }
+    }
+    if (!is_job) {
+      if (stop_flag_) {
+        break;
+      }
+      jobs_sem_.WaitTimeout(kRingRecorderWriterIdleMsec);
+      continue;
+    }
+
+    if (stop_flag_ && !is_drain_) {
+      if (job.slot != kRingRecorderJobEnd) {
+        buffer_->Release(job.slot);
+      }
+      continue;
+    }
+    placer_.BeginFrame();
+    Write(job);
+    placer_.EndFrame();
+  }
+  CloseEvent();
+  DEBUG_PRINT("[RingRecorderWriter] end - tid:%d\n", this->GetId());
+  return (wxThread::ExitCode)0;
+}
+
+/**
+ * @brief
+ * Write a job.
+ * @param job [in] job.
+ */
+void RingRecorderWriter::Write(const RingRecorderJob &job) {
+  if (job.slot == kRingRecorderJobEnd) {
+    if (job.event == event_) {
+      CloseEvent();
+    }
+    return;
+  }
+  if (job.event != event_) {
+    CloseEvent();
+    OpenEvent(job);
+  }
+
+  const RingRecorderSlot &slot = buffer_->slot(job.slot);
+  if (raw_file_ != NULL) {
+    size_t size = slot.data.size();
+    if (fwrite(&slot.data[0], 1, size, raw_file_) == size) {
+      long offset_usec =  // NOLINT
+          (slot.capture_time.tv_sec - trigger_time_.tv_sec) * 1000000L +
+          (slot.capture_time.tv_usec - trigger_time_.tv_usec);
+      fprintf(index_file_, "%u,%ld,%lu\n", slot.frame_number,
+              offset_usec, static_cast<unsigned long>(size));  // NOLINT
+      current_.frames++;
+      current_.bytes += size;
+    } else {
+      current_.is_failed = true;
+    }
+  }
+  buffer_->Release(job.slot);
+}
+
+/**
+ * @brief
+ * Open the files of an event.
+ * @param job [in] first job of the event.
+ * @return If true, the files are open.
+ */
+bool RingRecorderWriter::OpenEvent(const RingRecorderJob &job) {
+  event_ = job.event;
+  trigger_time_ = job.trigger_time;
+  memset(&current_, 0, sizeof(current_));
+  current_.event = job.event;
+
+  char file_name[64];
+  snprintf(file_name, sizeof(file_name), "/%s_%ld_%03u",
+           kRingRecorderFilePrefix,
+           static_cast<long>(trigger_time_.tv_sec), event_);  // NOLINT
+  std::string base_path = output_dir_ + file_name;
+  raw_file_ = fopen((base_path + ".raw").c_str(), "wb");
+  index_file_ = fopen((base_path + ".csv").c_str(), "w");
+  if (raw_file_ == NULL || index_file_ == NULL) {
+    DEBUG_PRINT("[RingRecorderWriter] can not open %s\n", base_path.c_str());
+    if (raw_file_ != NULL) {
+      fclose(raw_file_);
+      raw_file_ = NULL;
+    }
+    if (index_file_ != NULL) {
+      fclose(index_file_);
+      index_file_ = NULL;
+    }
+    current_.is_failed = true;
+    return false;
+  }
+
+  // The layout of the frames is given once, the offsets are relative to
+  // the trigger (negative: before the trigger).
+  const RingRecorderSlot &slot = buffer_->slot(job.slot);
+  fprintf(index_file_,
+          "# width,%d,height,%d,format,%s,bytes,%lu,trigger,%ld.%06ld\n",
+          buffer_->size().width, buffer_->size().height,
+          buffer_->format_name(),
+          static_cast<unsigned long>(slot.data.size()),  // NOLINT
+          static_cast<long>(trigger_time_.tv_sec),       // NOLINT
+          static_cast<long>(trigger_time_.tv_usec));     // NOLINT
+  fprintf(index_file_, "frame_number,offset_usec,bytes\n");
+  return true;
+}
+
+/**
+ * @brief
+ * Close the files of the event and publish its report.
+ */
+void RingRecorderWriter::CloseEvent(void) {
+  if (event_ == 0) {
+    return;
+  }
+  if (raw_file_ != NULL) {
+    fclose(raw_file_);
+    raw_file_ = NULL;
+  }
+  if (index_file_ != NULL) {
+    fclose(index_file_);
+    index_file_ = NULL;
+  }
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  current_.flush_msec = (now.tv_sec - trigger_time_.tv_sec) * 1000.0 +
+                        (now.tv_usec - trigger_time_.tv_usec) / 1000.0;
+  {
+    wxMutexLocker lock(report_mutex_);
+    reports_.push_back(current_);
+  }
+  event_ = 0;
+}
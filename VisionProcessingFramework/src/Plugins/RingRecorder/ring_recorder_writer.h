@@ -0,0 +1,205 @@
+/**
+ * @file      ring_recorder_writer.h
+ * @brief     Writer thread of the RingRecorder plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _RING_RECORDER_WRITER_H_
+#define _RING_RECORDER_WRITER_H_
+
+#include <stdio.h>
+#include <sys/time.h>
+#include <deque>
+#include <string>
+#include "./include.h"
+#include "./ring_recorder_buffer.h"
+#include "./ring_recorder_define.h"
+#include "./thread_placement.h"
+
+/**
+ * @struct RingRecorderJob
+ * @brief Frame to flush, or end of an event.
+ */
+typedef struct {
+  /*! Index of the slot (kRingRecorderJobEnd: end of the event) */
+  int slot;
+  /*! Event number */
+  unsigned int event;
+  /*! Trigger time of the event */
+  struct timeval trigger_time;
+} RingRecorderJob;
+
+/**
+ * @struct RingRecorderEventReport
+ * @brief Result of the flush of an event.
+ */
+typedef struct {
+  /*! Event number */
+  unsigned int event;
+  /*! Frames written */
+  unsigned int frames;
+  /*! Bytes written */
+  double bytes;
+  /*! Time from the trigger to the end of the flush in msec */
+  double flush_msec;
+  /*! Whether a write failed */
+  bool is_failed;
+} RingRecorderEventReport;
+
+/**
+ * @class RingRecorderWriter
+ * @brief Thread which flushes the frames of the events to the disk.
+ * Each event is written as one raw file (the frames one after another, in
+ * the order of the capture) and a CSV index of the frames, named after the
+ * event number and the trigger time. A slot is returned to the pool as
+ * soon as it is written, so the capture continues during the flush.
+ */
+class RingRecorderWriter : public wxThread {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   * @param buffer [in] frame pool (NOT own it).
+   */
+  explicit RingRecorderWriter(RingRecorderBuffer *buffer);
+
+  /**
+   * @brief
+   * Set the name of the thread (key of the ThreadPlacementTable).
+   * Called before Start().
+   * @param name [in] thread name.
+   */
+  void set_thread_name(const std::string &name) { placer_.set_name(name); }
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~RingRecorderWriter(void);
+
+  /**
+   * @brief
+   * Start the thread.
+   * @param output_dir [in] directory of the recordings.
+   * @return If true, the thread is running.
+   */
+  bool Start(const std::string &output_dir);
+
+  /**
+   * @brief
+   * Stop the thread.
+   * @param is_drain [in] If true, the pending jobs are written first,
+   * else their slots are released.
+   */
+  void Stop(bool is_drain);
+
+  /**
+   * @brief
+   * Queue a job (flow thread).
+   * @param job [in] job.
+   */
+  void Submit(const RingRecorderJob &job);
+
+  /**
+   * @brief
+   * Take the report of the oldest event flushed and not taken yet.
+   * @param report [out] report.
+   * @return If true, a report was taken.
+   */
+  bool TakeReport(RingRecorderEventReport *report);
+
+  /**
+   * @brief
+   * Get the number of the jobs queued.
+   * @return number of the jobs.
+   */
+  int pending(void);
+
+  /**
+   * @brief
+   * Get the placement and the scheduling events of the thread (one frame per
+   * job written). Read after Stop().
+   * @return placer of the thread.
+   */
+  const ThreadPlacer &placer(void) const { return placer_; }
+
+ private:
+  /**
+   * @brief
+   * Thread entry point.
+   * @return thread exit code.
+   */
+  virtual wxThread::ExitCode Entry(void);
+
+  /**
+   * @brief
+   * Write a job.
+   * @param job [in] job.
+   */
+  void Write(const RingRecorderJob &job);
+
+  /**
+   * @brief
+   * Open the files of an event.
+   * @param job [in] first job of the event.
+   * @return If true, the files are open.
+   */
+  bool OpenEvent(const RingRecorderJob &job);
+
+  /**
+   * @brief
+   * Close the files of the event and publish its report.
+   */
+  void CloseEvent(void);
+
+  /*! Frame pool (NOT own it) */
+  RingRecorderBuffer *buffer_;
+
+  /*! Directory of the recordings */
+  std::string output_dir_;
+
+  /*! Jobs */
+  std::deque<RingRecorderJob> jobs_;
+
+  /*! Lock for the jobs */
+  wxMutex jobs_mutex_;
+
+  /*! Posted for each job */
+  wxSemaphore jobs_sem_;
+
+  /*! Raw file of the event */
+  FILE *raw_file_;
+
+  /*! Index file of the event */
+  FILE *index_file_;
+
+  /*! Event being written (0: none) */
+  unsigned int event_;
+
+  /*! Trigger time of the event being written */
+  struct timeval trigger_time_;
+
+  /*! Report of the event being written */
+  RingRecorderEventReport current_;
+
+  /*! Reports of the events flushed and not taken yet (oldest first) */
+  std::deque<RingRecorderEventReport> reports_;
+
+  /*! Lock for the reports */
+  wxMutex report_mutex_;
+
+  /*! Stop request */
+  volatile bool stop_flag_;
+
+  /*! Whether the pending jobs are written at the stop */
+  volatile bool is_drain_;
+
+  /*! Whether the thread is running */
+  bool is_started_;
+
+  /*! Placement and scheduling monitor of the thread */
+  ThreadPlacer placer_;
+};
+
+#endif /* _RING_RECORDER_WRITER_H_*/
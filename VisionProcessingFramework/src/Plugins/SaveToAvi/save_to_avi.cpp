@@ -32,7 +32,10 @@ SaveToAvi::SaveToAvi() : PluginBase() {
  * @brief
  * Destructor.
  */
-SaveToAvi::~SaveToAvi() { delete wnd_; }
+SaveToAvi::~SaveToAvi() {
+  StopAsyncProcess(false);
+  delete wnd_;
+}
 
 /**
  * @brief
@@ -47,16 +50,22 @@ bool SaveToAvi::InitProcess(CommonParam* common) {
   wnd_->PostCaptureInit();
   wnd_->InitAvi();
 
+  if (StartAsyncProcess(this, kSaveToAviMaxInFlight, kAsyncDropNewest) ==
+      false) {
+    PLUGIN_LOG_ERROR("Failed to start the writer thread");
+    return false;
+  }
   return true;
 }
 
 /**
  * @brief
  * Finalize routine of the SaveToAvi plugin.
- * This function is empty implementation.
+ * Pending frames are written before the AVI file is closed.
  */
 void SaveToAvi::EndProcess() {
   DEBUG_PRINT("OutputDispOpencv::EndProcess \n");
+  StopAsyncProcess(true);
   wnd_->PostCaptureEnd();
 }
 
@@ -75,8 +84,6 @@ void SaveToAvi::DoPostProcess(void) {}
  * @return If true, success in the main processing
  */
 bool SaveToAvi::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
-  cv::Mat* temp_image;
-
   if (src_image == NULL) {
     DEBUG_PRINT("[SaveToAvi]src_image == NULL\n");
     return false;
@@ -87,28 +94,37 @@ bool SaveToAvi::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
     return false;
   }
 
-  if (src_image->depth() == CV_16U) {
-    temp_image = UtilGetCvConvertScale(src_image, UTIL_CONVERT_10U_TO_8U, 0);
-    if (temp_image) {
-      if (wnd_->Enqueue(temp_image) == false) {
-        DEBUG_PRINT("Enqueue failed");
-        delete temp_image;
-        return false;
-      } else {
-        delete temp_image;
-      }
-    }
-  } else {
-    if (wnd_->Enqueue(src_image) == false) {
-      DEBUG_PRINT("Enqueue failed");
-      return false;
-    }
+  // The 8 bit frame is shared with the other outputs of the same branch.
+  const cv::Mat* image = GetDerivedImage(src_image, kFrameDerived8U);
+  if (image == NULL) {
+    DEBUG_PRINT("[SaveToAvi]convert failed\n");
+    return false;
   }
 
-  wnd_->PostCapture();
+  // The frame is pending until the worker has written it.
+  if (SubmitAsyncFrame(*image) == false) {
+    DEBUG_PRINT("[SaveToAvi]frame dropped\n");
+  }
   return true;
 }
 
+/**
+ * @brief
+ * Asynchronous routine of the SaveToAvi plugin.
+ * Write the 8bit frame to the AVI file.
+ * @param image [in] frame owned by the worker.
+ * @param metadata [in] metadata of the frame owned by the worker.
+ * @return If true, the frame was written.
+ */
+bool SaveToAvi::DoAsyncProcess(cv::Mat* image,
+                               FrameMetadata* metadata) {
+  bool ret = wnd_->WriteFrame(image);
+  if (ret) {
+    RecordFrameLatency(metadata, image);
+  }
+  return ret;
+}
+
 /**
  * @brief
  * Open setting window of the SaveToAvi plugin.
@@ -139,116 +155,6 @@ bool SaveToAvi::CloseSettingWindow() {
   return true;
 }
 
-/**
- * @brief
- * Convert the bit depth of image.
- * @param src_image [in] Pointer to the src image
- * @param cvt_mode [in] enum UtilConvertMode
- * @param shift [in] Value added to the scaled source array elements
- * @return Pointer to the converted image.
- */
-cv::Mat* SaveToAvi::UtilGetCvConvertScale(cv::Mat* src_image, int cvt_mode,
-                                          double shift) {
-  cv::Mat* dst_image;
-  int src_channels = src_image->channels();
-  int max_width = src_image->size().width * src_channels;
-  double scale;
-
-  if (cvt_mode == UTIL_CONVERT_10U_TO_8U) {
-    switch (src_channels) {
-      case 1:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height), CV_8UC1);
-        break;
-      case 3:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height), CV_8UC3);
-        break;
-      default:
-        return NULL;
-    }
-    scale = 1.0 / 4.0;  // change scale 10bit -> 8bit
-  } else if (cvt_mode == UTIL_CONVERT_10U_TO_16U) {
-    switch (src_channels) {
-      case 1:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height),
-            CV_16UC1);
-        break;
-      case 3:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height),
-            CV_16UC3);
-        break;
-      default:
-        return NULL;
-    }
-    scale = 64.0;  // change scale 10bit -> 16bit
-  } else {
-    DEBUG_PRINT("Invalid convert mode =%d return NULL", cvt_mode);
-    return NULL;
-  }
-
-  if (cvt_mode == UTIL_CONVERT_10U_TO_8U) {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i = 0; i < dst_image->size().height; i++) {
-      for (int j = 0; j < max_width; j += src_channels) {
-        ((unsigned char*)(dst_image->data + dst_image->step * i))[j] =
-            (reinterpret_cast<INT16*>(src_image->data +
-                                      src_image->step * i))[j] *
-                scale +
-            shift;
-        if (src_channels == 3) {
-          ((unsigned char*)(dst_image->data + dst_image->step * i))[j + 1] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 1] *
-                  scale +
-              shift;
-          ((unsigned char*)(dst_image->data + dst_image->step * i))[j + 2] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 2] *
-                  scale +
-              shift;
-        }
-      }
-    }
-  } else if (cvt_mode == UTIL_CONVERT_10U_TO_16U) {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i = 0; i < dst_image->size().height; i++) {
-      for (int j = 0; j < max_width; j += src_channels) {
-        // 16bit code
-        (reinterpret_cast<INT16*>(dst_image->data + dst_image->step * i))[j] =
-            (reinterpret_cast<INT16*>(src_image->data +
-                                      src_image->step * i))[j] *
-                scale +
-            shift;
-        if (src_channels == 3) {
-          (reinterpret_cast<INT16*>(dst_image->data +
-                                    dst_image->step * i))[j + 1] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 1] *
-                  scale +
-              shift;
-          (reinterpret_cast<INT16*>(dst_image->data +
-                                    dst_image->step * i))[j + 2] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 2] *
-                  scale +
-              shift;
-        }
-      }
-    }
-  } else {
-    DEBUG_PRINT("Invalid convert mode =%d return NULL", cvt_mode);
-    return NULL;
-  }
-  return dst_image;
-}
-
 /**
  * @brief
  * Set the list of parameter setting string for the SaveToAvi plugin.
@@ -9,6 +9,7 @@
 #define _SAVE_TO_AVI_H_
 
 #include <vector>
+#include "./async_frame_worker.h"
 #include "./common_param.h"
 #include "./plugin_base.h"
 #include "./save_to_avi_define.h"
@@ -16,16 +17,13 @@
 
 class SaveToAviWnd;
 
-enum UtilConvertMode {
-  UTIL_CONVERT_10U_TO_8U = 0,
-  UTIL_CONVERT_10U_TO_16U,
-};
-
 /**
  * @class SaveToAvi
  * @brief Load the AVI file in RGB format.
+ * Frames are written on an asynchronous worker so that disk writes never
+ * stall the main flow.
  */
-class SaveToAvi : public PluginBase {
+class SaveToAvi : public PluginBase, public AsyncFrameHandler {
  private:
   /*! Parameter setting window.*/
   SaveToAviWnd* wnd_;
@@ -76,6 +74,16 @@ class SaveToAvi : public PluginBase {
    */
   virtual bool DoProcess(cv::Mat* src_image, cv::Mat* dst_image);
 
+  /**
+   * @brief
+   * Asynchronous routine of the SaveToAvi plugin.
+   * Convert the frame to 8bit and write it to the AVI file.
+   * @param image [in] frame owned by the worker.
+   * @param metadata [in] metadata of the frame owned by the worker.
+   * @return If true, the frame was written.
+   */
+  virtual bool DoAsyncProcess(cv::Mat* image, FrameMetadata* metadata);
+
   /**
    * @brief
    * Open setting window of the SaveToAvi plugin.
@@ -96,17 +104,5 @@ class SaveToAvi : public PluginBase {
    * @param params [in] settings string.
    */
   virtual void SetPluginSettings(std::vector<wxString> params);
-
- private:
-  /**
-   * @brief
-   * Convert the bit depth of image.
-   * @param src_image [in] Pointer to the src image
-   * @param cvt_mode [in] enum UtilConvertMode
-   * @param shift [in] Value added to the scaled source array elements
-   * @return Pointer to the converted image.
-   */
-  virtual cv::Mat* UtilGetCvConvertScale(cv::Mat* src_image, int cvt_mode,
-                                         double shift);
 };
 #endif /* _OUTPUT_DISP_OPENCV_H_*/
@@ -70,6 +70,9 @@ typedef cv::Mat* data_t;
 #define kVideoWriterNoCodec 0
 #define kVideoWriterDefaultFps 60
 
+/* Frames queued for the asynchronous writer before new frames are dropped */
+#define kSaveToAviMaxInFlight 8
+
 #define kSaveToAviConfigFile "../lib/Plugins/output/SaveToAvi.ini"
 
 #endif /* _SAVE_TO_AVI_DEFINE_H_*/
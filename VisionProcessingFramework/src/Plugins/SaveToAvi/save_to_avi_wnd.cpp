@@ -11,16 +11,13 @@
 #include "./../../logger.h"
 
 BEGIN_DECLARE_EVENT_TYPES()
-DECLARE_LOCAL_EVENT_TYPE(CAPTURE_UPDATE, wxNewEventType())
 DECLARE_LOCAL_EVENT_TYPE(CAPTURE_INITIALIZE, wxNewEventType())
 DECLARE_LOCAL_EVENT_TYPE(CAPTURE_END, wxNewEventType())
 END_DECLARE_EVENT_TYPES()
-DEFINE_LOCAL_EVENT_TYPE(CAPTURE_UPDATE)
 DEFINE_LOCAL_EVENT_TYPE(CAPTURE_INITIALIZE)
 DEFINE_LOCAL_EVENT_TYPE(CAPTURE_END)
 BEGIN_EVENT_TABLE(SaveToAviWnd, wxFrame)
 EVT_CLOSE(SaveToAviWnd::OnClose)
-EVT_COMMAND(wxID_ANY, CAPTURE_UPDATE, SaveToAviWnd::OnCapture)
 EVT_COMMAND(wxID_ANY, CAPTURE_INITIALIZE, SaveToAviWnd::OnCaptureInit)
 EVT_COMMAND(wxID_ANY, CAPTURE_END, SaveToAviWnd::OnCaptureEnd)
 EVT_BUTTON(BTN_SELECT_AVI_FILE_WND_ID, SaveToAviWnd::OpenAviFile)
@@ -82,7 +79,6 @@ SaveToAviWnd::SaveToAviWnd(SaveToAvi *save_to_avi)
                    wxSize(BTN_APPLY_SIZE_W, BTN_APPLY_SIZE_H));
 
   LoadSettingsFromFile(wxT(kSaveToAviConfigFile));
-  que_manager_ = new QueManager();
   writer_width_ = 0;
   writer_height_ = 0;
   writer_ = NULL;
@@ -94,7 +90,6 @@ SaveToAviWnd::SaveToAviWnd(SaveToAvi *save_to_avi)
  * Destructor for this window.
  */
 SaveToAviWnd::~SaveToAviWnd() {
-  DeleteQueue();
   if (writer_ != NULL) {
     delete writer_;
     writer_ = NULL;
@@ -118,7 +113,10 @@ void SaveToAviWnd::OnClose(wxCloseEvent &event) { Show(false); }
  * @brief
  * Initialize routine for SaveToAviWnd.
  */
-void SaveToAviWnd::InitAvi() { video_writer_flag_ = true; }
+void SaveToAviWnd::InitAvi() {
+  wxMutexLocker lock(writer_mutex_);
+  video_writer_flag_ = true;
+}
 
 /**
  * @brief
@@ -150,72 +148,41 @@ void SaveToAviWnd::InitVideoWriter(int width, int height) {
 
 /**
  * @brief
- * Enqueue cv::Mat data.
- * @param enq_data [in] cv::Mat data.
- */
-bool SaveToAviWnd::Enqueue(data_t enq_data) {
-  if (que_manager_ == NULL) {
-    DEBUG_PRINT("Enqueue Image data fail : que_manager_ is NULL\n");
-  } else {
-    return que_manager_->Enqueue(enq_data);
-  }
-  return false;
-}
-
-/**
- * @brief
- * Delete cv::Mat data queue.
+ * Write a frame to the AVI file.
+ * This function is called on the asynchronous worker thread.
+ * @param image [in] 8bit BGR frame.
+ * @return If true, the frame was written.
  */
-void SaveToAviWnd::DeleteQueue() { delete que_manager_; }
-
-/**
- * @brief
- * The handler function for local event(CAPTURE_UPDATE).
- * Display an image by using cv::imshow.
- */
-void SaveToAviWnd::OnCapture(wxCommandEvent &event) {
-  cv::Mat *que;
-
-  que = que_manager_->Dequeue();
-  if ((que->size().width == 0) || (que->size().height == 0)) {
-    DEBUG_PRINT("size w:%d h:%d\n", que->size().width, que->size().height);
-    return;
-  }
-  if (que->cols == 0 || que->rows == 0) {
-    DEBUG_PRINT("size cols:%d rows:%d\n", que->cols, que->rows);
-    return;
+bool SaveToAviWnd::WriteFrame(cv::Mat *image) {
+  if ((image->size().width == 0) || (image->size().height == 0)) {
+    DEBUG_PRINT("size w:%d h:%d\n", image->size().width,
+                image->size().height);
+    return false;
   }
 
+  wxMutexLocker lock(writer_mutex_);
   if (video_writer_flag_ == true) {
-    DEBUG_PRINT("Init video writer :%d rows:%d\n", que->cols, que->rows);
-    InitVideoWriter(static_cast<int>(que->cols), static_cast<int>(que->rows));
+    DEBUG_PRINT("Init video writer :%d rows:%d\n", image->cols, image->rows);
+    InitVideoWriter(static_cast<int>(image->cols),
+                    static_cast<int>(image->rows));
     video_writer_flag_ = false;
   }
 
-  if (que->cols != writer_width_ || que->rows != writer_height_) {
-    DEBUG_PRINT("size error. size cols:%d rows:%d\n", que->cols, que->rows);
-    return;
+  if (image->cols != writer_width_ || image->rows != writer_height_) {
+    DEBUG_PRINT("size error. size cols:%d rows:%d\n", image->cols,
+                image->rows);
+    return false;
   }
 
   if (writer_ == NULL) {
-    return;
+    return false;
   }
 
   if (!writer_->isOpened()) {
-    return;
+    return false;
   }
-  *writer_ << *que;
-}
-
-/**
- * @brief
- * Post local event(CAPTURE_END) for destroy the screen on own thread.
- */
-void SaveToAviWnd::PostCapture(void) {
-  DEBUG_PRINT("SaveToAviWnd::PostCapture\n");
-  wxCommandEvent event(CAPTURE_UPDATE);
-  event.SetString(wxT("This is the data"));
-  wxPostEvent(this, event);
+  *writer_ << *image;
+  return true;
 }
 
 /**
@@ -246,6 +213,7 @@ void SaveToAviWnd::PostCaptureInit(void) {
  * destroy the screen.
  */
 void SaveToAviWnd::OnCaptureEnd(wxCommandEvent &event) {
+  wxMutexLocker lock(writer_mutex_);
   if (writer_ != NULL) {
     delete writer_;
     writer_ = NULL;
@@ -302,8 +270,11 @@ void SaveToAviWnd::OnSliderFps(wxScrollEvent &event) {
  */
 void SaveToAviWnd::OnUpdate(wxCommandEvent &event) {
   DEBUG_PRINT("SaveToAviWnd::OnUpdate\n");
-  static_text_fps_->GetLabel().ToDouble(&fps_);
-  video_writer_flag_ = true;
+  {
+    wxMutexLocker lock(writer_mutex_);
+    static_text_fps_->GetLabel().ToDouble(&fps_);
+    video_writer_flag_ = true;
+  }
   WriteSettingsToFile(wxT(kSaveToAviConfigFile));
   this->Show(false);
 }
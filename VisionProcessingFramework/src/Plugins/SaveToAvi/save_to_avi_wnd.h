@@ -13,7 +13,6 @@
 #include <opencv2/highgui/highgui.hpp>
 
 #include "./include.h"
-#include "./que_manager.h"
 #include "./save_to_avi.h"
 #include "./save_to_avi_define.h"
 
@@ -25,8 +24,6 @@ class SaveToAvi;
  */
 class SaveToAviWnd : public wxFrame {
  private:
-  /*! Pointer to the QueManager class */
-  QueManager* que_manager_;
   /*! whether can be created the AVI file. */
   bool video_writer_flag_;
   /*! Output path of the AVI file */
@@ -41,6 +38,8 @@ class SaveToAviWnd : public wxFrame {
   int writer_height_;
   /*! Pointer to the SaveToAvi class */
   SaveToAvi* save_to_avi_;
+  /*! Lock for the writer shared by the GUI and the asynchronous worker */
+  wxMutex writer_mutex_;
 
  public:
   /**
@@ -62,12 +61,6 @@ class SaveToAviWnd : public wxFrame {
    */
   virtual void InitAvi(void);
 
-  /**
-   * @brief
-   * Post local event(CAPTURE_UPDATE) for refresh screen on own thread.
-   */
-  virtual void PostCapture(void);
-
   /**
    * @brief
    * Post local event(CAPTURE_INITIALIZE) for initialize the screen settings on
@@ -89,10 +82,12 @@ class SaveToAviWnd : public wxFrame {
 
   /**
    * @brief
-   * Enqueue cv::Mat data.
-   * @param enq_data [in] cv::Mat data.
+   * Write a frame to the AVI file.
+   * This function is called on the asynchronous worker thread.
+   * @param image [in] 8bit BGR frame.
+   * @return If true, the frame was written.
    */
-  bool Enqueue(data_t enq_data);
+  bool WriteFrame(cv::Mat* image);
 
   /**
    * @brief
@@ -152,19 +147,6 @@ class SaveToAviWnd : public wxFrame {
    */
   virtual void InitVideoWriter(int width, int height);
 
-  /**
-   * @brief
-   * Delete cv::Mat data queue.
-   */
-  void DeleteQueue();
-
-  /**
-   * @brief
-   * The handler function for local event(CAPTURE_UPDATE).
-   * Display an image by using cv::imshow.
-   */
-  virtual void OnCapture(wxCommandEvent& event); /* NOLINT */
-
   /**
    * @brief
    * The handler function for local event(CAPTURE_INITIALIZE).
@@ -7,14 +7,13 @@
 
 #include "./sensor.h"
 #include <vector>
+#include "./sensor_frame_sync.h"
 #include "./sensor_settings_wnd.h"
 #include "./sensor_wnd.h"
+#include "./simulated_sensor.h"
 
 #include <unistd.h>
 
-static wxMutex mutex_finalize;
-Sensor *gloval_sensor_;
-
 extern "C" {
   int __CCIRegRead(struct ssp_handle *handle, int address, int *data);
   int __CCIRegWrite(struct ssp_handle *handle, int address, int data);
@@ -31,7 +30,6 @@ Sensor::Sensor() : PluginBase() {
   /* Initialize*/
   common_ = NULL;
   finalize_on_ = false;
-  gloval_sensor_ = this;
   frame_buffer_ = NULL;
   temp_frame_buffer_ = NULL;
   last_image_ = NULL;
@@ -40,18 +38,54 @@ Sensor::Sensor() : PluginBase() {
   start_streaming_ = false;
 
   first_pixel_ = 0;
-  analog_gain_param_ = kRegisterNone;
-  digital_gain_param_ = kRegisterNone;
-  coarse_integration_time_ = kRegisterNone;
-  orien_reg_ = kRegisterNone;
+  group_hold_addr_ = kRegisterNone;
   analog_gain_param_temp_ = kRegisterNone;
   digital_gain_param_temp_ = kRegisterNone;
   coarse_integration_time_temp_ = kRegisterNone;
   orien_reg_temp_ = kRegisterNone;
+  focus_code_ = kRegisterNone;
+  frame_sequence_ = 0;
+  last_frame_number_ = 0;
+  timerclear(&frame_time_);
+  timerclear(&last_frame_time_);
+  simulated_sensor_ = NULL;
+  is_simulated_ = false;
+  test_pattern_ = false;
+  frame_has_code_ = false;
+  last_frame_has_code_ = false;
+  is_frame_unread_ = false;
+  memset(&stats_, 0, sizeof(stats_));
+  stats_.first_frame_msec = -1;
+  timerclear(&stream_start_time_);
+  has_streamed_ = false;
+  start_kind_ = "cold";
+  timerclear(&start_request_time_);
+  is_first_frame_pending_ = false;
+  is_first_frame_report_ = false;
+  still_capture_ = NULL;
+  preview_profile_ = NULL;
+  is_still_mode_ = false;
+  timerclear(&preview_gap_start_);
+  is_preview_gap_pending_ = false;
+  preview_gap_msec_ = -1;
+  memset(&still_report_, 0, sizeof(still_report_));
+  is_still_report_ = false;
+  sync_tolerance_usec_ = 0;
+  sync_member_ = -1;
+  last_set_number_ = 0;
 
   sensor_on_init_ = false;
   buffer_lock_ = new wxMutex(wxMUTEX_DEFAULT);
+  finalize_lock_ = new wxMutex(wxMUTEX_DEFAULT);
   callback_wait_sem_ = new wxSemaphore(1, 3);
+  control_lock_ = new wxMutex(wxMUTEX_DEFAULT);
+
+  /* The control thread runs for the plugin lifetime, so the settings
+     changed while stopped are kept until the next stream.*/
+  control_ = new SensorControl(this);
+  if (control_->Start() == false) {
+    DEBUG_PRINT("Can not start sensor control.\n");
+  }
 
   sensor_config_file_path_ = NULL;
 
@@ -75,6 +109,11 @@ Sensor::Sensor() : PluginBase() {
 
   sensor_wnd_ = new SensorWnd(this);
   sensor_settings_wnd_ = new SensorSettingsWnd(this);
+
+  /* The auto-algorithm plugins reach the first sensor of the process.*/
+  if (SensorLink::Instance()->Attach(this) == false) {
+    DEBUG_PRINT("Another sensor takes the auto-algorithm requests.\n");
+  }
 }
 
 /**
@@ -82,7 +121,16 @@ Sensor::Sensor() : PluginBase() {
  * Destructor.
  */
 Sensor::~Sensor() {
+  SensorLink::Instance()->Detach(this);
+  if (still_capture_ != NULL) {
+    still_capture_->Stop();
+    delete still_capture_;
+  }
+  control_->Stop();
   Finalize();
+  delete control_;
+  delete control_lock_;
+  delete finalize_lock_;
   delete sensor_wnd_;
   delete sensor_settings_wnd_;
 }
@@ -90,6 +138,9 @@ Sensor::~Sensor() {
 /**
  * @brief
  * Make the initial process of the sensor to the SSP.
+ * An initialized handle of the same sensor is kept: the same profile is
+ * not applied again, and a mode of the same geometry is switched to by
+ * writing the registers which differ.
  * @param bit_count_type [in] bit count.
  * @param sensor_config_file_path [in] sensor config file path.
  * @param size [in] image size.
@@ -99,37 +150,82 @@ bool Sensor::SensorConfig(int bit_count_type,
                           char *sensor_config_file_path, CvSize size) {
   DEBUG_PRINT("Sensor::SensorConfig \n");
   int retval;
-
-  if (sensor_on_init_ == true) {
-    if (Finalize() == false) {
-      DEBUG_PRINT("Failed to sensor finalize \n");
+  struct timeval config_time;
+  gettimeofday(&config_time, NULL);
+
+  /* The simulated sensor needs neither the SSP nor the registers.*/
+  bool is_simulated = (sensor_config_type_ == wxT(kSimulatedSensorName));
+  struct ssp_profile *profile = NULL;
+  if (!is_simulated) {
+    /* Read the sensor file to the SSP (parsed once per file).*/
+    profile = profile_cache_.Load(sensor_config_file_path);
+    if (profile == NULL) {
+      return false;
     }
   }
-  sensor_config_file_path_ = sensor_config_file_path;
 
-  /* Read the sensor file to the SSP.*/
-  if ((retval = ssp_read_profile(sensor_config_file_path,
-                                 &ssp_profile_)) != SSP_SUCCESS) {
-    return false;
+  /* Keep the handle when only the registers of the mode differ.*/
+  const char *kind = "cold";
+  bool is_cold = true;
+  if (!is_simulated && sensor_on_init_ == true && ssp_handle_ != NULL &&
+      start_streaming_ == false && bit_count_type == bit_count_type_) {
+    if (profile == ssp_profile_) {
+      kind = "warm";
+      is_cold = false;
+    } else if (SensorProfileCache::IsWarmSwitchable(ssp_profile_, profile)) {
+      wxMutexLocker lock(*control_lock_);
+      retval = SensorProfileCache::WriteDelta(ssp_handle_, ssp_profile_,
+                                              profile);
+      if (retval >= 0) {
+        DEBUG_PRINT("mode switch: %d registers\n", retval);
+        ssp_profile_ = profile;
+        kind = "switch";
+        is_cold = false;
+      }
+    }
   }
+  sensor_config_file_path_ = sensor_config_file_path;
 
-  //ssp_settings_.lib_settings.NumFrameFIFOSize = 5;
-  ssp_settings_.lib_settings.NumFrameFIFOSize = 2;
-  ssp_settings_.lib_settings.NumThreadForBuildInPreprocess = 1;
-  ssp_settings_.lib_settings.frame_drop_cam_user_func = frame_drop_preprocess;
-  ssp_settings_.lib_settings.frame_drop_pre_user_func = frame_drop;
-  ssp_settings_.lib_settings.fame_preprocess_user_func = frame_preprocess;
-  ssp_settings_.frame_preprocess_options.FormatConvertType = bit_count_type;
-  ssp_settings_.camera_settings.PowerOnResetUsec = 1000000;
-
-  /* Make the initial process of the sensor to the SSP.*/
-  if ((retval = ssp_initialize(&ssp_handle_, ssp_profile_, &ssp_settings_)) !=
-      SSP_SUCCESS) {
-    DEBUG_PRINT("initialize failure = %d\n", retval);
-    return false;
-  }
-  if((retval = ssp_stop_streaming(ssp_handle_)) != SSP_SUCCESS){
-    DEBUG_PRINT("Can not stop streaming. %x\n",retval);
+  if (is_cold) {
+    if (sensor_on_init_ == true) {
+      if (Finalize() == false) {
+        DEBUG_PRINT("Failed to sensor finalize \n");
+      }
+    }
+    is_simulated_ = is_simulated;
+    if (is_simulated_) {
+      frequency_ = SimulatedSensor::ReadFrequency(sensor_config_file_path);
+      coarse_regvalue_ = 0;
+      line_length_regvalue_ = 0;
+      DEBUG_PRINT("simulated sensor %dx%d %dHz\n", size.width, size.height,
+                  frequency_);
+    } else {
+      ssp_profile_ = profile;
+
+      //ssp_settings_.lib_settings.NumFrameFIFOSize = 5;
+      ssp_settings_.lib_settings.NumFrameFIFOSize = 2;
+      ssp_settings_.lib_settings.NumThreadForBuildInPreprocess = 1;
+      ssp_settings_.lib_settings.frame_drop_cam_user_func =
+          frame_drop_preprocess;
+      ssp_settings_.lib_settings.frame_drop_pre_user_func = frame_drop;
+      ssp_settings_.lib_settings.fame_preprocess_user_func = frame_preprocess;
+      ssp_settings_.frame_preprocess_options.FormatConvertType =
+          bit_count_type;
+      ssp_settings_.camera_settings.PowerOnResetUsec = 1000000;
+
+      /* Make the initial process of the sensor to the SSP.*/
+      if ((retval = ssp_initialize(&ssp_handle_, ssp_profile_,
+                                   &ssp_settings_)) != SSP_SUCCESS) {
+        DEBUG_PRINT("initialize failure = %d\n", retval);
+        return false;
+      }
+      /* The callbacks find this instance by the handle.*/
+      ssp_handle_->user_data = this;
+      if((retval = ssp_stop_streaming(ssp_handle_)) != SSP_SUCCESS){
+        DEBUG_PRINT("Can not stop streaming. %x\n",retval);
+      }
+      has_streamed_ = false;
+    }
   }
 
   /*To set the size*/
@@ -146,9 +242,38 @@ bool Sensor::SensorConfig(int bit_count_type,
 
   sensor_on_init_ = true;
 
-  /*To set the frequency*/
-  frequency_ = ssp_profile_->ImageProperty.Frequency;
+  if (!is_simulated_) {
+    /*To set the frequency*/
+    frequency_ = ssp_profile_->ImageProperty.Frequency;
+    ReadStreamRegisters();
+    DEBUG_PRINT("initialize success\n");
+  }
+
+  /*Time of the configuration; the next start reports its first frame*/
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  PLUGIN_LOG_MESSAGE("Config - %s %.1fms", kind,
+                     (now.tv_sec - config_time.tv_sec) * 1000.0 +
+                         (now.tv_usec - config_time.tv_usec) / 1000.0);
+  start_kind_ = kind;
+  return true;
+}
+
+/**
+ * @brief
+ * Parse a sensor profile ahead, so that applying it is fast.
+ * @param sensor_config_file_path [in] sensor config file path.
+ * @return If true, the profile is parsed.
+ */
+bool Sensor::PreloadProfile(const char *sensor_config_file_path) {
+  return profile_cache_.Load(sensor_config_file_path) != NULL;
+}
 
+/**
+ * @brief
+ * Read the coarse integration time and the line length from the sensor.
+ */
+void Sensor::ReadStreamRegisters(void) {
   int etime_regdata1 = 0x00;
   int etime_regdata2 = 0x00;
   if (__CCIRegRead(ssp_handle_, etime_addr1_, &etime_regdata1) == 0) {
@@ -159,8 +284,6 @@ bool Sensor::SensorConfig(int bit_count_type,
   }
   coarse_regvalue_ = (etime_regdata1 << 8) + etime_regdata2;
 
-  DEBUG_PRINT("initialize success\n");
-
   int line_length_regdata1 = 0x00;
   int line_length_regdata2 = 0x00;
   int line_length_regadd2191 = 0x0160;
@@ -187,7 +310,29 @@ bool Sensor::SensorConfig(int bit_count_type,
     }
     line_length_regvalue_ = (line_length_regdata1 << 8) + line_length_regdata2;
   }
+}
 
+/**
+ * @brief
+ * Start and stop the stream once after the initialization (IMX378).
+ * @return If false, the streaming can not be started.
+ */
+bool Sensor::PrimeStreaming(void) {
+  int retval;
+  /* Only the first stream of the handle needs it.*/
+  if (this->sensor_type_ != wxT("IMX378") || has_streamed_) {
+    return true;
+  }
+  if((retval = ssp_start_streaming(ssp_handle_)) != SSP_SUCCESS){
+  	DEBUG_PRINT("Can not start streaming. %x\n",retval);
+    return false;
+  }
+  usleep(1000);
+  ssp_flush_event(ssp_handle_);
+  if((retval = ssp_stop_streaming(ssp_handle_)) != SSP_SUCCESS){
+  	DEBUG_PRINT("Can not stop streaming. %x\n",retval);
+    return false;
+  }
   return true;
 }
 
@@ -224,51 +369,103 @@ void Sensor::SetBinningMode() {
 bool Sensor::InitProcess(CommonParam *common) {
   DEBUG_PRINT("Sensor::InitProcess \n");
   int retval;
-  int optical_black;
+  SensorControlBatch in_effect;
 
   finalize_on_ = false;
   common_ = common;
   common_->set_first_pixel(first_pixel_);
 
+  /* The threads are placed per flow (ThreadPlacementTable).*/
+  control_->Place(plugin_name() + kThreadPlacementControlSuffix);
+  preprocess_placer_.set_name(plugin_name() +
+                              kThreadPlacementPreprocessSuffix);
+  preprocess_placer_.ResetCounts();
+
   if (sensor_on_init_ == false) {
     DEBUG_PRINT("Sensor none init. please on apply \n");
     return false;
   }
 
-  /* To start the streaming of the sensor to the SSP.(IMX378) */
-  if (this->sensor_type_ == wxT("IMX378")) {
-    if((retval = ssp_start_streaming(ssp_handle_)) != SSP_SUCCESS){
-    	DEBUG_PRINT("Can not start streaming. %x\n",retval);
-      return false;
-    }
-    usleep(1000);
-    ssp_flush_event(ssp_handle_);
-    if((retval = ssp_stop_streaming(ssp_handle_)) != SSP_SUCCESS){
-    	DEBUG_PRINT("Can not stop streaming. %x\n",retval);
+  /* A still capture of the previous stream ends before this one.*/
+  if (still_capture_ != NULL) {
+    still_capture_->Stop();
+    delete still_capture_;
+    still_capture_ = NULL;
+  }
+
+  /* Time to the first frame of this start.*/
+  buffer_lock_->Lock();
+  gettimeofday(&start_request_time_, NULL);
+  is_first_frame_report_ = false;
+  is_first_frame_pending_ = true;
+  buffer_lock_->Unlock();
+
+  /* The buffers of the previous stream are kept if the format is same.*/
+  AllocateFrameBuffers();
+  common_->set_optical_black((bit_count_type_ == 0x02) ? 16 : 64);
+
+  if (is_simulated_) {
+    SensorControlBatchClear(&in_effect);
+    in_effect.focus = focus_code_;
+    control_->Reset(in_effect, kSensorControlSimulatedDelayFrames);
+    StartFrameSync();
+    StartStats();
+    start_streaming_ = true;
+    simulated_sensor_ = new SimulatedSensor(this);
+    if (simulated_sensor_->Start(size_, bit_count_type_, frequency_) ==
+        false) {
+      DEBUG_PRINT("Can not start simulated sensor.\n");
       return false;
     }
+    return true;
+  }
+
+  /* To start the streaming of the sensor to the SSP.(IMX378)*/
+  if (PrimeStreaming() == false) {
+    return false;
   }
 
+  /* Settings in effect until the first batch of the stream.*/
+  SensorControlBatchClear(&in_effect);
+  in_effect.exposure = static_cast<int>(coarse_regvalue_);
+  in_effect.focus = focus_code_;
+  control_->Reset(in_effect, kSensorControlDelayFrames);
+  StartFrameSync();
+  StartStats();
+
   /* To start the streaming of the sensor to the SSP.*/
   if ((retval = ssp_start_streaming(ssp_handle_)) != SSP_SUCCESS) {
     DEBUG_PRINT("Can not start streaming. %x\n", retval);
     return false;
   }
+  has_streamed_ = true;
   start_streaming_ = true;
-  if (bit_count_type_ == 0x02) {
-    optical_black = 16;
-    common_->set_optical_black(optical_black);
-    frame_buffer_ = new cv::Mat(size_, CV_8UC1);
-    temp_frame_buffer_ = new cv::Mat(size_, CV_8UC1);
-    last_image_ = new cv::Mat(size_, CV_8UC1);
+  return true;
+}
+
+/**
+ * @brief
+ * Allocate the frame buffers, keeping the ones of the same format.
+ */
+void Sensor::AllocateFrameBuffers(void) {
+  int type = (bit_count_type_ == 0x02) ? CV_8UC1 : CV_16UC1;
+  buffer_lock_->Lock();
+  if (frame_buffer_ == NULL) {
+    frame_buffer_ = new cv::Mat(size_, type);
   } else {
-    optical_black = 64;
-    common_->set_optical_black(optical_black);
-    frame_buffer_ = new cv::Mat(size_, CV_16UC1);
-    temp_frame_buffer_ = new cv::Mat(size_, CV_16UC1);
-    last_image_ = new cv::Mat(size_, CV_16UC1);
+    frame_buffer_->create(size_, type);
   }
-  return true;
+  if (temp_frame_buffer_ == NULL) {
+    temp_frame_buffer_ = new cv::Mat(size_, type);
+  } else {
+    temp_frame_buffer_->create(size_, type);
+  }
+  if (last_image_ == NULL) {
+    last_image_ = new cv::Mat(size_, type);
+  } else {
+    last_image_->create(size_, type);
+  }
+  buffer_lock_->Unlock();
 }
 
 /**
@@ -279,11 +476,12 @@ bool Sensor::InitProcess(CommonParam *common) {
 void Sensor::EndProcess() {
   DEBUG_PRINT("Sensor::EndProcess \n");
   finalize_on_ = true;
-  wxMutexLocker lock(mutex_finalize);
+  wxMutexLocker lock(*finalize_lock_);
 
   if (StopStreaming() == false) {
     DEBUG_PRINT("Failed to sensor finalize \n");
   }
+  LogThreadSchedules();
   DEBUG_PRINT("Sensor::EndProcess success \n");
   return;
 }
@@ -291,16 +489,123 @@ void Sensor::EndProcess() {
 /**
  * @brief
  * Post-processing routine of the Sensor plugin.
- * This function is empty implementation.
+ * The register settings are applied by the control thread.
  */
 void Sensor::DoPostProcess(void) {
   DEBUG_PRINT("Sensor::DoPostProcess \n");
+  return;
+}
+
+/**
+ * @brief
+ * Queue register values to be applied after the next frame.
+ * The values of a batch are applied together (any thread, never blocks).
+ * @param batch [in] batch (kRegisterNone: unchanged).
+ * @return If false, the queue is full and the batch is dropped.
+ */
+bool Sensor::SubmitControl(const SensorControlBatch &batch) {
+  return control_->Submit(batch);
+}
+
+/**
+ * @brief
+ * Queue an analog gain register value.
+ * @param value [in] register value.
+ */
+void Sensor::QueueAnalogGain(int value) {
+  SensorControlBatch batch;
+  SensorControlBatchClear(&batch);
+  batch.analog_gain = value;
+  SubmitControl(batch);
+}
+
+/**
+ * @brief
+ * Queue a digital gain register value.
+ * @param value [in] register value.
+ */
+void Sensor::QueueDigitalGain(int value) {
+  SensorControlBatch batch;
+  SensorControlBatchClear(&batch);
+  batch.digital_gain = value;
+  SubmitControl(batch);
+}
+
+/**
+ * @brief
+ * Queue a coarse integration time register value.
+ * @param value [in] register value.
+ */
+void Sensor::QueueExposureTime(int value) {
+  SensorControlBatch batch;
+  SensorControlBatchClear(&batch);
+  batch.exposure = value;
+  SubmitControl(batch);
+}
+
+/**
+ * @brief
+ * Queue an image orientation register value.
+ * @param value [in] register value.
+ */
+void Sensor::QueueImageOrientation(int value) {
+  SensorControlBatch batch;
+  SensorControlBatchClear(&batch);
+  batch.orientation = value;
+  SubmitControl(batch);
+}
+
+/**
+ * @brief
+ * Queue a request of an auto-algorithm plugin (SensorLinkTarget).
+ * @param request [in] request (kSensorLinkNone: unchanged).
+ * @return If false, the queue is full and the request is dropped.
+ */
+bool Sensor::SubmitSensorRequest(const SensorLinkRequest &request) {
+  SensorControlBatch batch;
+  SensorControlBatchClear(&batch);
+  batch.analog_gain = request.analog_gain;
+  batch.digital_gain = request.digital_gain;
+  batch.exposure = request.exposure;
+  batch.focus = request.focus;
+  return SubmitControl(batch);
+}
+
+/**
+ * @brief
+ * Write a batch to the sensor under the grouped parameter hold
+ * (control thread).
+ * @param batch [in] batch (kRegisterNone: unchanged).
+ * @return If false, the sensor is not streaming.
+ */
+bool Sensor::ApplyControl(const SensorControlBatch &batch) {
+  wxMutexLocker lock(*control_lock_);
+  if (start_streaming_ == false) {
+    return false;
+  }
+  /* The simulated sensor takes the settings without registers.*/
+  if (is_simulated_) {
+    if (batch.focus != kRegisterNone) {
+      focus_code_ = batch.focus;
+    }
+    return true;
+  }
+  if (ssp_handle_ == NULL) {
+    return false;
+  }
+
+  /* Hold the grouped parameters until the whole batch is written.*/
+  if (group_hold_addr_ != kRegisterNone) {
+    if (__CCIRegWrite(ssp_handle_, group_hold_addr_, 1) == 0) {
+      DEBUG_PRINT("Group hold Writing register error.\n");
+    }
+  }
 
   /* To reflect the register of the analog gain.*/
-  if (analog_gain_param_ != kRegisterNone) {
+  if (batch.analog_gain != kRegisterNone) {
     if (this->sensor_type_ == wxT("IMX378")) {
       int RegParam = 0;
-      ushort Reg = (ushort)analog_gain_param_;
+      ushort Reg = (ushort)batch.analog_gain;
       RegParam = Reg >> 8;
       if (__CCIRegWrite(ssp_handle_, again_addr_, RegParam) == 0) {
         DEBUG_PRINT("Analog Gain Writing register error.\n");
@@ -309,20 +614,18 @@ void Sensor::DoPostProcess(void) {
       if (__CCIRegWrite(ssp_handle_, again_addr1_, RegParam) == 0) {
         DEBUG_PRINT("Analog Gain Writing register error1.\n");
       }
-      analog_gain_param_ = kRegisterNone;
     } else {
-      if (__CCIRegWrite(ssp_handle_, again_addr_, analog_gain_param_) == 0) {
+      if (__CCIRegWrite(ssp_handle_, again_addr_, batch.analog_gain) == 0) {
         DEBUG_PRINT("Analog Gain Writing register error.\n");
       }
-      analog_gain_param_ = kRegisterNone;
     }
   }
 
   /* To reflect the register of the digital gain.*/
-  if (digital_gain_param_ != kRegisterNone) {
+  if (batch.digital_gain != kRegisterNone) {
     if (this->sensor_type_ == wxT("IMX378")) {
       int RegParam = 0;
-      ushort Reg = (ushort)digital_gain_param_;
+      ushort Reg = (ushort)batch.digital_gain;
       RegParam = Reg >> 8;
       if (__CCIRegWrite(ssp_handle_, dgain_addr1_, RegParam) == 0) {
         DEBUG_PRINT("Digital Gain Writing register error.\n");
@@ -331,22 +634,20 @@ void Sensor::DoPostProcess(void) {
       if (__CCIRegWrite(ssp_handle_, dgain_addr2_, RegParam) == 0) {
         DEBUG_PRINT("Digital Gain Writing register error.1.\n");
       }
-      digital_gain_param_ = kRegisterNone;
     } else {
       std::vector<int>::iterator itr;
       for (itr = dgain_addr_.begin(); itr != dgain_addr_.end(); itr++) {
-        if (__CCIRegWrite(ssp_handle_, *itr, digital_gain_param_) == 0) {
+        if (__CCIRegWrite(ssp_handle_, *itr, batch.digital_gain) == 0) {
           DEBUG_PRINT("Digital Gain Writing register error.\n");
         }
       }
-      digital_gain_param_ = kRegisterNone;
-	}
+    }
   }
 
   /* To reflect the register of the coarse integration time.*/
-  if (coarse_integration_time_ != kRegisterNone) {
+  if (batch.exposure != kRegisterNone) {
     int RegParam = 0;
-    ushort Reg = (ushort)coarse_integration_time_;
+    ushort Reg = (ushort)batch.exposure;
 
     RegParam = Reg >> 8;
 
@@ -359,17 +660,322 @@ void Sensor::DoPostProcess(void) {
     if (__CCIRegWrite(ssp_handle_, etime_addr2_, RegParam) == 0) {
       DEBUG_PRINT("Coarse Integration Time Writing register error2.\n");
     }
-    coarse_integration_time_ = kRegisterNone;
   }
 
   /* To reflect the register of the image orientation.*/
-  if (orien_reg_ != kRegisterNone) {
-    if (__CCIRegWrite(ssp_handle_, image_addr_, orien_reg_) == 0) {
+  if (batch.orientation != kRegisterNone) {
+    if (__CCIRegWrite(ssp_handle_, image_addr_, batch.orientation) == 0) {
       DEBUG_PRINT("image orientation register error1.\n");
     }
-    orien_reg_ = kRegisterNone;
   }
-  return;
+
+  /* Release the hold: the sensor takes the batch at the next frame.*/
+  if (group_hold_addr_ != kRegisterNone) {
+    if (__CCIRegWrite(ssp_handle_, group_hold_addr_, 0) == 0) {
+      DEBUG_PRINT("Group hold Writing register error.\n");
+    }
+  }
+
+  /* To reflect the lens actuator code (not held by the sensor).*/
+  if (batch.focus != kRegisterNone) {
+    WriteFocusCode(batch.focus);
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Write a lens actuator code in the direct mode (control thread).
+ * The actuator of the IMX378 module is the only one supported.
+ * @param code [in] actuator code (0 - kSensorFocusCodeMax).
+ * @return If false, the code is not written.
+ */
+bool Sensor::WriteFocusCode(int code) {
+  if (this->sensor_type_ != wxT("IMX378")) {
+    DEBUG_PRINT("Focus is not supported by %s.\n",
+                (const char *)sensor_type_.mb_str());
+    return false;
+  }
+  if (code < 0 || code > kSensorFocusCodeMax) {
+    DEBUG_PRINT("Focus code out of range. %d\n", code);
+    return false;
+  }
+  /* The mode is set each time: the SensorFocusOIS window may change it.*/
+  if (__CCIRegWriteBySlaveAddress(kSensorFocusSlaveAddress,
+                                  kSensorFocusModeAddr,
+                                  kSensorFocusModeDirect) <= 0) {
+    DEBUG_PRINT("Focus mode Writing register error.\n");
+    return false;
+  }
+  if (__CCIRegWriteBySlaveAddress(kSensorFocusSlaveAddress,
+                                  kSensorFocusCodeAddr1,
+                                  (code >> 8) & 0xFF) <= 0 ||
+      __CCIRegWriteBySlaveAddress(kSensorFocusSlaveAddress,
+                                  kSensorFocusCodeAddr2, code & 0xFF) <= 0) {
+    DEBUG_PRINT("Focus code Writing register error.\n");
+    return false;
+  }
+  focus_code_ = code;
+  return true;
+}
+
+/**
+ * @brief
+ * Capture full resolution frames while the preview streams.
+ * The stream switches to the still profile, and back to the preview as
+ * soon as the frames are received. The frames are developed and written
+ * on a background thread; the result is logged by the preview flow.
+ * @param profile_path [in] sensor profile of the still mode.
+ * @param count [in] number of the frames (kSensorStillMaxCount at most).
+ * @param output_dir [in] directory of the image files.
+ * @return If false, the capture is not started.
+ */
+bool Sensor::CaptureStill(const char *profile_path, int count,
+                          const char *output_dir) {
+  if (start_streaming_ == false || profile_path == NULL) {
+    PLUGIN_LOG_WARNING("Still - the preview is not streaming");
+    return false;
+  }
+  /* The still frames would break the sets of the other sensors.*/
+  if (sync_member_ >= 0) {
+    PLUGIN_LOG_WARNING("Still - not available for synchronized sensors");
+    return false;
+  }
+  if (count < 1 || count > kSensorStillMaxCount) {
+    return false;
+  }
+  if (still_capture_ != NULL) {
+    if (still_capture_->is_done() == false) {
+      PLUGIN_LOG_WARNING("Still - a capture is running");
+      return false;
+    }
+    still_capture_->Stop();
+    delete still_capture_;
+    still_capture_ = NULL;
+  }
+
+  /* The still mode of the simulated sensor is its image size.*/
+  CvSize size;
+  if (is_simulated_) {
+    if (SimulatedSensor::ReadImageSize(profile_path, &size) == false) {
+      return false;
+    }
+  } else {
+    struct ssp_profile *profile = profile_cache_.Load(profile_path);
+    if (profile == NULL) {
+      return false;
+    }
+    size = cvSize(profile->ImageProperty.Width, profile->ImageProperty.Height);
+  }
+
+  std::string directory = (output_dir != NULL && output_dir[0] != '\0')
+                              ? output_dir : ".";
+  still_capture_ = new SensorStillCapture(this);
+  return still_capture_->Start(profile_path, size, bit_count_type_,
+                               first_pixel_,
+                               (bit_count_type_ == 0x02) ? 16 : 64, count,
+                               directory);
+}
+
+/**
+ * @brief
+ * Switch the stream to the still mode (still capture thread).
+ * @param profile_path [in] sensor profile of the still mode.
+ * @param size [in] image size of the still mode.
+ * @return If false, the stream is not switched.
+ */
+bool Sensor::EnterStillMode(const char *profile_path, CvSize size) {
+  if (is_simulated_) {
+    return SwitchStream(NULL, size,
+                        SimulatedSensor::ReadFrequency(profile_path), true);
+  }
+  struct ssp_profile *profile = profile_cache_.Load(profile_path);
+  if (profile == NULL) {
+    return false;
+  }
+  return SwitchStream(profile, size, 0, true);
+}
+
+/**
+ * @brief
+ * Switch the stream back to the preview (still capture thread).
+ * @return If false, the preview does not stream.
+ */
+bool Sensor::LeaveStillMode(void) {
+  bool is_streaming = SwitchStream(preview_profile_, size_, frequency_, false);
+  if (is_streaming) {
+    /* The registers of the preview profile were written again.*/
+    SensorControlBatch batch;
+    SensorControlBatchClear(&batch);
+    batch.analog_gain = analog_gain_param_temp_;
+    batch.digital_gain = digital_gain_param_temp_;
+    batch.exposure = coarse_integration_time_temp_;
+    batch.orientation = orien_reg_temp_;
+    SubmitControl(batch);
+  } else {
+    is_preview_gap_pending_ = false;
+  }
+  return is_streaming;
+}
+
+/**
+ * @brief
+ * Switch the running stream to another profile.
+ * When the stream is stopped meanwhile, the handle only returns to the
+ * preview profile for the next start.
+ * @param profile [in] profile (NULL: simulated sensor).
+ * @param size [in] image size of the profile.
+ * @param frequency [in] frame rate of the simulated sensor.
+ * @param is_still [in] If true, the frames go to the still capture.
+ * @return If false, the stream is not running.
+ */
+bool Sensor::SwitchStream(struct ssp_profile *profile, CvSize size,
+                          int frequency, bool is_still) {
+  int retval;
+  SensorControlBatch in_effect;
+  SensorControlBatchClear(&in_effect);
+  /* The lens is not moved by a mode switch.*/
+  in_effect.focus = focus_code_;
+  wxMutexLocker lock(*control_lock_);
+  bool is_streaming = start_streaming_;
+  if (is_still && is_streaming == false) {
+    return false;
+  }
+  if (!is_still && !is_still_mode_) {
+    return is_streaming;
+  }
+  if (is_still) {
+    preview_profile_ = ssp_profile_;
+  }
+
+  if (is_simulated_) {
+    if (simulated_sensor_ != NULL) {
+      delete simulated_sensor_;
+      simulated_sensor_ = NULL;
+    }
+    SetStillMode(is_still);
+    if (is_streaming == false) {
+      return false;
+    }
+    if (!is_still) {
+      control_->Reset(in_effect, kSensorControlSimulatedDelayFrames);
+    }
+    simulated_sensor_ = new SimulatedSensor(this);
+    if (simulated_sensor_->Start(size, bit_count_type_, frequency) == false) {
+      DEBUG_PRINT("Can not start simulated sensor.\n");
+      return false;
+    }
+    return true;
+  }
+
+  if (ssp_handle_ == NULL || profile == NULL) {
+    SetStillMode(false);
+    return false;
+  }
+  if (is_streaming) {
+    if ((retval = ssp_stop_streaming(ssp_handle_)) != SSP_SUCCESS) {
+      DEBUG_PRINT("Can not stop streaming. %x\n", retval);
+      return false;
+    }
+    ssp_flush_event(ssp_handle_);
+  }
+  /* No frame is delivered from here to the next start.*/
+  SetStillMode(is_still);
+
+  if (SensorProfileCache::IsWarmSwitchable(ssp_profile_, profile)) {
+    if (SensorProfileCache::WriteDelta(ssp_handle_, ssp_profile_, profile) <
+        0) {
+      start_streaming_ = false;
+      return false;
+    }
+  } else {
+    /* The receiver buffers are sized for the geometry: cold start.*/
+    if (ssp_finalize(ssp_handle_) != SSP_SUCCESS) {
+      start_streaming_ = false;
+      return false;
+    }
+    ssp_handle_ = NULL;
+    if ((retval = ssp_initialize(&ssp_handle_, profile, &ssp_settings_)) !=
+        SSP_SUCCESS) {
+      DEBUG_PRINT("initialize failure = %d\n", retval);
+      ssp_handle_ = NULL;
+      ssp_profile_ = NULL;
+      sensor_on_init_ = false;
+      start_streaming_ = false;
+      return false;
+    }
+    ssp_handle_->user_data = this;
+    has_streamed_ = false;
+  }
+  ssp_profile_ = profile;
+  if (is_streaming == false) {
+    return false;
+  }
+
+  if (PrimeStreaming() == false) {
+    start_streaming_ = false;
+    return false;
+  }
+  if (!is_still) {
+    ReadStreamRegisters();
+    in_effect.exposure = static_cast<int>(coarse_regvalue_);
+    control_->Reset(in_effect, kSensorControlDelayFrames);
+  }
+  if ((retval = ssp_start_streaming(ssp_handle_)) != SSP_SUCCESS) {
+    DEBUG_PRINT("Can not start streaming. %x\n", retval);
+    start_streaming_ = false;
+    return false;
+  }
+  has_streamed_ = true;
+  return true;
+}
+
+/**
+ * @brief
+ * Route the frames to the still capture or back to the preview.
+ * @param is_still [in] If true, the frames go to the still capture.
+ */
+void Sensor::SetStillMode(bool is_still) {
+  buffer_lock_->Lock();
+  if (is_still && !is_still_mode_) {
+    preview_gap_start_ = frame_time_;
+    preview_gap_msec_ = -1;
+  }
+  /* The gap ends with the first preview frame.*/
+  is_preview_gap_pending_ = (!is_still && is_still_mode_);
+  is_still_mode_ = is_still;
+  buffer_lock_->Unlock();
+}
+
+/**
+ * @brief
+ * Take the result of a still capture (still capture thread).
+ * @param report [in] result.
+ */
+void Sensor::StillCaptured(const SensorStillReport &report) {
+  still_report_ = report;
+  __sync_synchronize();
+  is_still_report_ = true;
+}
+
+/**
+ * @brief
+ * Log the result of the last still capture.
+ */
+void Sensor::LogStillReport(void) {
+  is_still_report_ = false;
+  /* Preview frames which the sensor did not deliver during the gap.*/
+  unsigned int dropped = 0;
+  if (preview_gap_msec_ > 0 && frequency_ > 0) {
+    double periods = preview_gap_msec_ * frequency_ / 1000.0;
+    dropped = (periods > 1) ? static_cast<unsigned int>(periods + 0.5) - 1 : 0;
+  }
+  PLUGIN_LOG_MESSAGE(
+      "Still - frames:%u saved:%u time to still:%.1fms develop:%.1fms "
+      "preview gap:%.1fms dropped preview:%u",
+      still_report_.frames, still_report_.saved,
+      still_report_.time_to_still_msec, still_report_.develop_msec,
+      preview_gap_msec_, dropped);
 }
 
 /**
@@ -383,15 +989,56 @@ bool Sensor::DoProcess(cv::Mat *src_image, cv::Mat *dst_image) {
   DEBUG_PRINT("Sensor::DoProcess \n");
   /* Wait for a call back from the SSP.*/
   wxSemaError retval;
-  if ((retval = callback_wait_sem_->WaitTimeout(10000)) == wxSEMA_TIMEOUT) {
+  if (sync_member_ >= 0) {
+    TakeSyncedFrame(dst_image);
+  } else if ((retval = callback_wait_sem_->WaitTimeout(10000)) ==
+             wxSEMA_TIMEOUT) {
     *dst_image = *last_image_;
   } else {
     buffer_lock_->Lock();
     /* Frame data copy.*/
     *last_image_ = frame_buffer_->clone();
     *dst_image = frame_buffer_->clone();
+    last_frame_number_ = frame_sequence_;
+    last_frame_time_ = frame_time_;
+    last_frame_has_code_ = frame_has_code_;
+    is_frame_unread_ = false;
     buffer_lock_->Unlock();
   }
+
+  /* Time to the first frame (logged from this thread, not the callback).*/
+  buffer_lock_->Lock();
+  bool is_first_frame_report = is_first_frame_report_;
+  double first_frame_msec = stats_.first_frame_msec;
+  is_first_frame_report_ = false;
+  buffer_lock_->Unlock();
+  if (is_first_frame_report) {
+    PLUGIN_LOG_MESSAGE("Start - %s first frame:%.1fms", start_kind_,
+                       first_frame_msec);
+    start_kind_ = "restart";
+  }
+  if (is_still_report_ && !is_preview_gap_pending_) {
+    LogStillReport();
+  }
+
+  /* Frame metadata (the frame and the settings in effect).*/
+  FrameMetadata *metadata = frame_metadata();
+  if (metadata != NULL) {
+    /* kRegisterNone of the history is kFrameMetadataUnknown.*/
+    SensorControlBatch settings;
+    control_->GetInEffect(last_frame_number_, &settings);
+    /* The frames of a synchronized set have the same number.*/
+    metadata->frame_number =
+        (sync_member_ >= 0) ? last_set_number_ : last_frame_number_;
+    if (timerisset(&last_frame_time_)) {
+      metadata->capture_time = last_frame_time_;
+    }
+    metadata->has_frame_code = last_frame_has_code_;
+    metadata->exposure = settings.exposure;
+    metadata->analog_gain = settings.analog_gain;
+    metadata->digital_gain = settings.digital_gain;
+    metadata->focus = settings.focus;
+  }
   return true;
 }
 
@@ -492,8 +1139,16 @@ void Sensor::set_image_processing_state(ImageProcessingState state) {
  */
 bool Sensor::Finalize() {
   int retval;
+  if (still_capture_ != NULL) {
+    still_capture_->Cancel();
+  }
+  wxMutexLocker lock(*control_lock_);
   sensor_on_init_ = false;
   frame_count_ = 0;
+  if (start_streaming_ == true) {
+    LogStats();
+  }
+  StopFrameSync();
 
   if (ssp_handle_ != NULL) {
     if (start_streaming_ == true) {
@@ -513,6 +1168,12 @@ bool Sensor::Finalize() {
     ssp_profile_ = NULL;
   }
 
+  if (simulated_sensor_ != NULL) {
+    start_streaming_ = false;
+    delete simulated_sensor_;
+    simulated_sensor_ = NULL;
+  }
+
   /* Delete image buffer*/
   if (frame_buffer_ != NULL) {
     delete frame_buffer_;
@@ -536,7 +1197,16 @@ bool Sensor::Finalize() {
  */
 bool Sensor::StopStreaming() {
   int retval;
+  /* The still capture returns the handle to the preview profile.*/
+  if (still_capture_ != NULL) {
+    still_capture_->Cancel();
+  }
+  wxMutexLocker lock(*control_lock_);
   frame_count_ = 0;
+  if (start_streaming_ == true) {
+    LogStats();
+  }
+  StopFrameSync();
 
   if (ssp_handle_ != NULL) {
     if (start_streaming_ == true) {
@@ -550,19 +1220,13 @@ bool Sensor::StopStreaming() {
     }
   }
 
-  // delete image buffer
-  if (frame_buffer_ != NULL) {
-    delete frame_buffer_;
-    frame_buffer_ = NULL;
-  }
-  if (temp_frame_buffer_ != NULL) {
-    delete temp_frame_buffer_;
-    temp_frame_buffer_ = NULL;
-  }
-  if (last_image_ != NULL) {
-    delete last_image_;
-    last_image_ = NULL;
+  if (simulated_sensor_ != NULL) {
+    start_streaming_ = false;
+    delete simulated_sensor_;
+    simulated_sensor_ = NULL;
   }
+
+  /* The image buffers are kept for the next start (see Finalize).*/
   return true;
 }
 
@@ -575,55 +1239,290 @@ bool Sensor::StopStreaming() {
 void Sensor::frame_preprocess(struct ssp_handle *handle,
                               struct ssp_frame *frame) {
   DEBUG_PRINT("Sensor::frame_preprocess start \n");
+  struct timeval capture_time;
+  gettimeofday(&capture_time, NULL);
 
-  if (static_cast<Sensor *>(gloval_sensor_)->finalize_on_ == true) {
+  Sensor *sensor = static_cast<Sensor *>(handle->user_data);
+  if (sensor == NULL) {
+    ssp_release_frame(frame);
+    return;
+  }
+  if (sensor->finalize_on_ == true) {
     DEBUG_PRINT("Sensor::finalize_on \n");
     return;
   }
-  wxMutexLocker lock(mutex_finalize);
-
-//  if (static_cast<Sensor *>(gloval_sensor_)->frame_count_ <= 5) {
-    /*Release frame*/
-//    ssp_release_frame(frame);
-  static_cast<Sensor *>(gloval_sensor_)->frame_count_++;
-//    return;
-//  }
-//  DEBUG_PRINT("Sensor::frame_preprocess frame shori\n");
-  if (static_cast<Sensor *>(gloval_sensor_)->start_streaming_ == false) {
-	 DEBUG_PRINT("Sensor::frame_preprocess start_streaming_ == false\n");
-     return;
-  }
-  if (static_cast<Sensor *>(gloval_sensor_)->temp_frame_buffer_ == NULL) {
-	DEBUG_PRINT("Sensor::temp_frame_buffer_ == NULL\n");
+  wxMutexLocker lock(*sensor->finalize_lock_);
+
+  sensor->frame_count_++;
+  if (sensor->start_streaming_ == false) {
+    DEBUG_PRINT("Sensor::frame_preprocess start_streaming_ == false\n");
+    return;
+  }
+  if (sensor->temp_frame_buffer_ == NULL) {
+    DEBUG_PRINT("Sensor::temp_frame_buffer_ == NULL\n");
     return;
   }
 
-  static_cast<Sensor *>(gloval_sensor_)->buffer_lock_->Lock();
+  /*The callback runs on the SSP preprocessing thread, so the thread is
+    named and placed from here.*/
+  sensor->preprocess_placer_.Update();
+  sensor->preprocess_placer_.BeginFrame();
 
   /*Get frame*/
   unsigned char *frame_data = ssp_get_frame_data(frame);
   int frame_size = 0;
   /*Get frame size*/
-  ssp_get_frame_size(frame, &frame_size);//
-  // frame data copy
-  memcpy(static_cast<Sensor *>(gloval_sensor_)->temp_frame_buffer_->data,
-         frame_data, frame_size);
+  ssp_get_frame_size(frame, &frame_size);
+  sensor->ReceiveFrame(frame_data, frame_size, capture_time);
+  sensor->preprocess_placer_.EndFrame();
 
   /*Release frame*/
   ssp_release_frame(frame);
+  DEBUG_PRINT("Sensor::frame_preprocess success \n");
+}
 
-  /*Frame copy*/
-  cv::Mat *temp = static_cast<Sensor *>(gloval_sensor_)->temp_frame_buffer_;
-  static_cast<Sensor *>(gloval_sensor_)->temp_frame_buffer_ =
-      static_cast<Sensor *>(gloval_sensor_)->frame_buffer_;
-  static_cast<Sensor *>(gloval_sensor_)->frame_buffer_ = temp;
+/**
+ * @brief
+ * Take a frame delivered by the SSP or the simulated sensor.
+ * @param data [in] frame data.
+ * @param size [in] frame data size in bytes.
+ * @param capture_time [in] capture time of the frame.
+ */
+void Sensor::ReceiveFrame(const unsigned char *data, int size,
+                          const struct timeval &capture_time) {
+  if (start_streaming_ == false || temp_frame_buffer_ == NULL) {
+    return;
+  }
 
-  static_cast<Sensor *>(gloval_sensor_)->buffer_lock_->Unlock();
+  /*The frames of the still mode go to the still capture only
+    (the mode changes while the stream is stopped)*/
+  if (is_still_mode_) {
+    if (still_capture_ != NULL) {
+      still_capture_->AddFrame(data, size, capture_time);
+    }
+    return;
+  }
 
-  // sem_post
-  static_cast<Sensor *>(gloval_sensor_)->callback_wait_sem_->Post();
-  static_cast<Sensor *>(gloval_sensor_)->frame_count_ = 0;
-  DEBUG_PRINT("Sensor::frame_preprocess success \n");
+  buffer_lock_->Lock();
+
+  /*Time without preview frames for the still capture*/
+  if (is_preview_gap_pending_) {
+    preview_gap_msec_ =
+        (capture_time.tv_sec - preview_gap_start_.tv_sec) * 1000.0 +
+        (capture_time.tv_usec - preview_gap_start_.tv_usec) / 1000.0;
+    is_preview_gap_pending_ = false;
+  }
+
+  /*Capture time and sequence of the frame*/
+  frame_time_ = capture_time;
+  frame_sequence_++;
+  unsigned int frame_number = frame_sequence_;
+  stats_.frames++;
+  if (is_first_frame_pending_) {
+    stats_.first_frame_msec =
+        (capture_time.tv_sec - start_request_time_.tv_sec) * 1000.0 +
+        (capture_time.tv_usec - start_request_time_.tv_usec) / 1000.0;
+    is_first_frame_pending_ = false;
+    is_first_frame_report_ = true;
+  }
+
+  /*A synchronized sensor keeps the last frames for the sets*/
+  int sync_member = sync_member_;
+  bool is_synced = (sync_member >= 0 && !sync_slots_.empty());
+  SensorSyncSlot *slot = NULL;
+  cv::Mat *target = temp_frame_buffer_;
+  if (is_synced) {
+    slot = &sync_slots_[frame_number % sync_slots_.size()];
+    target = &slot->image;
+  }
+
+  // frame data copy
+  int buffer_size = target->step * target->rows;
+  memcpy(target->data, data, (size < buffer_size) ? size : buffer_size);
+
+  /*Frame counter of the test pattern*/
+  bool has_code = false;
+  if (is_simulated_ && test_pattern_) {
+    FrameCounterCodeEncode(target, frame_number,
+                           (target->depth() == CV_8U) ? 0xFF : 0x3FF);
+    has_code = true;
+  }
+
+  if (is_synced) {
+    slot->sequence = frame_number;
+    slot->time = capture_time;
+    slot->has_code = has_code;
+  } else {
+    frame_has_code_ = has_code;
+    if (is_frame_unread_) {
+      stats_.overwritten++;
+    }
+    is_frame_unread_ = true;
+
+    /*Frame copy*/
+    cv::Mat *temp = temp_frame_buffer_;
+    temp_frame_buffer_ = frame_buffer_;
+    frame_buffer_ = temp;
+  }
+
+  buffer_lock_->Unlock();
+
+  // sem_post (the synchronizer posts when a set is complete)
+  if (is_synced) {
+    SensorFrameSync::Instance()->AddFrame(sync_member, frame_number,
+                                          capture_time);
+  } else {
+    callback_wait_sem_->Post();
+  }
+  frame_count_ = 0;
+
+  /*The control thread writes the pending settings after this frame*/
+  control_->NotifyFrame(frame_number);
+}
+
+/**
+ * @brief
+ * Join the frame synchronizer if the tolerance is set.
+ */
+void Sensor::StartFrameSync(void) {
+  sync_member_ = -1;
+  last_set_number_ = 0;
+  sync_slots_.clear();
+  if (sync_tolerance_usec_ <= 0) {
+    return;
+  }
+  int type = (bit_count_type_ == 0x02) ? CV_8UC1 : CV_16UC1;
+  sync_slots_.resize(kSensorFrameSyncDepth);
+  for (unsigned int i = 0; i < sync_slots_.size(); i++) {
+    sync_slots_[i].image.create(size_, type);
+    sync_slots_[i].sequence = 0;
+    timerclear(&sync_slots_[i].time);
+    sync_slots_[i].has_code = false;
+  }
+  sync_member_ = SensorFrameSync::Instance()->Join(callback_wait_sem_,
+                                                   sync_tolerance_usec_);
+  if (sync_member_ < 0) {
+    DEBUG_PRINT("Can not join the frame synchronizer.\n");
+    PLUGIN_LOG_WARNING("Frame sync - no free member, not synchronized");
+    sync_slots_.clear();
+  }
+}
+
+/**
+ * @brief
+ * Leave the frame synchronizer.
+ */
+void Sensor::StopFrameSync(void) {
+  if (sync_member_ < 0) {
+    return;
+  }
+  SensorFrameSync::Instance()->Leave(sync_member_);
+  buffer_lock_->Lock();
+  sync_member_ = -1;
+  sync_slots_.clear();
+  buffer_lock_->Unlock();
+}
+
+/**
+ * @brief
+ * Take the frame of the last set of the frame synchronizer.
+ * @param dst_image [out] dst image data.
+ */
+void Sensor::TakeSyncedFrame(cv::Mat *dst_image) {
+  unsigned int set_number;
+  unsigned int sequence;
+  bool is_taken = false;
+  if (callback_wait_sem_->WaitTimeout(10000) != wxSEMA_TIMEOUT &&
+      SensorFrameSync::Instance()->GetSet(sync_member_, &set_number,
+                                          &sequence) &&
+      set_number != last_set_number_) {
+    buffer_lock_->Lock();
+    if (!sync_slots_.empty()) {
+      SensorSyncSlot *slot = &sync_slots_[sequence % sync_slots_.size()];
+      /* The frame of the set may be replaced by a newer one already.*/
+      if (slot->sequence == sequence) {
+        *last_image_ = slot->image.clone();
+        *dst_image = slot->image.clone();
+        last_frame_number_ = sequence;
+        last_frame_time_ = slot->time;
+        last_frame_has_code_ = slot->has_code;
+        last_set_number_ = set_number;
+        is_taken = true;
+      }
+    }
+    buffer_lock_->Unlock();
+  }
+  if (!is_taken) {
+    *dst_image = *last_image_;
+  }
+}
+
+/**
+ * @brief
+ * Start the throughput and drop statistics.
+ */
+void Sensor::StartStats(void) {
+  memset(&stats_, 0, sizeof(stats_));
+  stats_.first_frame_msec = -1;
+  is_frame_unread_ = false;
+  gettimeofday(&stream_start_time_, NULL);
+}
+
+/**
+ * @brief
+ * Log the throughput and drop statistics of the stream.
+ */
+void Sensor::LogStats(void) {
+  if (sync_member_ >= 0) {
+    stats_.unmatched = SensorFrameSync::Instance()->unmatched(sync_member_);
+  }
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  double elapsed = (now.tv_sec - stream_start_time_.tv_sec) +
+                   (now.tv_usec - stream_start_time_.tv_usec) / 1000000.0;
+  double fps = (elapsed > 0) ? stats_.frames / elapsed : 0;
+  PLUGIN_LOG_MESSAGE(
+      "Stream - frames:%u fps:%.2f first frame:%.1fms overwritten:%u "
+      "dropped fifo:%u preprocess:%u unmatched:%u",
+      stats_.frames, fps, stats_.first_frame_msec, stats_.overwritten,
+      stats_.fifo_drops, stats_.preprocess_drops, stats_.unmatched);
+}
+
+/**
+ * @brief
+ * Log the placement and the scheduling events of the control thread and of
+ * the SSP preprocessing thread.
+ */
+void Sensor::LogThreadSchedules(void) {
+  std::string name = plugin_name() + kThreadPlacementControlSuffix;
+  std::string placement;
+  if (control_->GetPlacement(&placement) == false) {
+    PLUGIN_LOG_WARNING("Failed to place thread - thread:%s %s", name.c_str(),
+                       placement.c_str());
+  }
+  ThreadSchedCounts counts = control_->sched_counts();
+  if (counts.frames > 0) {
+    PLUGIN_LOG_MESSAGE(
+        "Thread schedule - thread:%s placement:%s frames:%u migrations:%u "
+        "preempted:%u switches:%u",
+        name.c_str(), placement.c_str(), counts.frames, counts.migrations,
+        counts.preempted_frames, counts.preemptions);
+  }
+
+  if (preprocess_placer_.error().empty() == false) {
+    PLUGIN_LOG_WARNING("Failed to place thread - thread:%s %s",
+                       preprocess_placer_.name().c_str(),
+                       preprocess_placer_.error().c_str());
+  }
+  counts = preprocess_placer_.counts();
+  if (counts.frames > 0) {
+    PLUGIN_LOG_MESSAGE(
+        "Thread schedule - thread:%s placement:%s frames:%u migrations:%u "
+        "preempted:%u switches:%u",
+        preprocess_placer_.name().c_str(),
+        preprocess_placer_.Describe().c_str(), counts.frames,
+        counts.migrations, counts.preempted_frames, counts.preemptions);
+  }
 }
 
 /**
@@ -635,6 +1534,10 @@ void Sensor::frame_preprocess(struct ssp_handle *handle,
  */
 void Sensor::frame_drop(struct ssp_handle *handle) {
   DEBUG_PRINT("Sensor::frame_drop \n");
+  Sensor *sensor = static_cast<Sensor *>(handle->user_data);
+  if (sensor != NULL) {
+    __sync_fetch_and_add(&sensor->stats_.fifo_drops, 1);
+  }
 }
 
 /**
@@ -645,6 +1548,10 @@ void Sensor::frame_drop(struct ssp_handle *handle) {
  */
 void Sensor::frame_drop_preprocess(struct ssp_handle *handle) {
   DEBUG_PRINT("Sensor::frame_drop_preprocess \n");
+  Sensor *sensor = static_cast<Sensor *>(handle->user_data);
+  if (sensor != NULL) {
+    __sync_fetch_and_add(&sensor->stats_.preprocess_drops, 1);
+  }
 }
 
 /**
@@ -653,6 +1560,15 @@ void Sensor::frame_drop_preprocess(struct ssp_handle *handle) {
  * @param params [in] settings string.
  */
 void Sensor::SetPluginSettings(std::vector<wxString> params) {
+  set_test_pattern(params.size() > kSensorSettingsTestPatternIndex &&
+                   params[kSensorSettingsTestPatternIndex] ==
+                       wxT(kSensorTestPatternOn));
+  long tolerance_usec = 0;  // NOLINT
+  if (params.size() > kSensorSettingsFrameSyncIndex &&
+      params[kSensorSettingsFrameSyncIndex].ToLong(&tolerance_usec) == false) {
+    tolerance_usec = 0;
+  }
+  set_sync_tolerance_usec(tolerance_usec);
   sensor_wnd_->SetSensorConfig(params);
   sensor_settings_wnd_->SetSensorSettings(params);
 }
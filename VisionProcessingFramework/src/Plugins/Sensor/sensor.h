@@ -12,7 +12,11 @@
 #include <vector>
 #include <sys/time.h>
 #include "./plugin_base.h"
+#include "./sensor_control.h"
 #include "./sensor_define.h"
+#include "./sensor_link.h"
+#include "./sensor_profile_cache.h"
+#include "./sensor_still_capture.h"
 
 extern "C" {
   #include "./include/libssp.h"
@@ -20,12 +24,47 @@ extern "C" {
 
 class SensorWnd;
 class SensorSettingsWnd;
+class SimulatedSensor;
+
+/**
+ * @struct SensorStats
+ * @brief Throughput and drops of a Sensor instance since streaming start.
+ */
+typedef struct {
+  /*! Frames received */
+  unsigned int frames;
+  /*! Frames replaced by the next one before DoProcess took them */
+  unsigned int overwritten;
+  /*! Frames dropped by the SSP (FIFO full or memory allocation) */
+  unsigned int fifo_drops;
+  /*! Frames dropped by the SSP preprocessing (memory allocation) */
+  unsigned int preprocess_drops;
+  /*! Frames never in a set of the frame synchronizer */
+  unsigned int unmatched;
+  /*! Time from the start request to the first frame in msec (-1: none) */
+  double first_frame_msec;
+} SensorStats;
+
+/**
+ * @struct SensorSyncSlot
+ * @brief Frame kept for the frame synchronizer.
+ */
+typedef struct {
+  /*! Image */
+  cv::Mat image;
+  /*! Frame number */
+  unsigned int sequence;
+  /*! Capture time */
+  struct timeval time;
+  /*! Whether the image has the frame counter drawn */
+  bool has_code;
+} SensorSyncSlot;
 
 /**
  * @class Sensor
  * @brief Using the SPP, obtains a frame data from the sensor.
  */
-class Sensor : public PluginBase {
+class Sensor : public PluginBase, public SensorLinkTarget {
  private:
   /*! Sensor window class object.*/
   SensorWnd *sensor_wnd_;
@@ -60,6 +99,9 @@ class Sensor : public PluginBase {
   /*! Frame buffer mutex.*/
   wxMutex *buffer_lock_;
 
+  /*! Mutex of the frame callback against the SSP end processing.*/
+  wxMutex *finalize_lock_;
+
   /*! Semaphore to wait for a call back.*/
   wxSemaphore *callback_wait_sem_;
 
@@ -81,6 +123,190 @@ class Sensor : public PluginBase {
   /*! SSP end processing flag.*/
   bool finalize_on_;
 
+  /*! Number of frames received from the SSP since streaming start.*/
+  unsigned int frame_sequence_;
+
+  /*! Capture time of frame_buffer_.*/
+  struct timeval frame_time_;
+
+  /*! Frame number of last_image_.*/
+  unsigned int last_frame_number_;
+
+  /*! Capture time of last_image_.*/
+  struct timeval last_frame_time_;
+
+  /*! Sensor control thread (applies the queued register batches).*/
+  SensorControl *control_;
+
+  /*! Register write mutex (control thread against the SSP stop).*/
+  wxMutex *control_lock_;
+
+  /*! Placement and scheduling monitor of the SSP preprocessing thread
+      (frame callback only).*/
+  ThreadPlacer preprocess_placer_;
+
+  /*! Simulated sensor backend (NULL: not streaming).*/
+  SimulatedSensor *simulated_sensor_;
+
+  /*! Whether the profile selects the simulated sensor backend.*/
+  bool is_simulated_;
+
+  /*! Whether the simulated sensor draws the frame counter.*/
+  bool test_pattern_;
+
+  /*! Whether frame_buffer_ has the frame counter drawn.*/
+  bool frame_has_code_;
+
+  /*! Whether last_image_ has the frame counter drawn.*/
+  bool last_frame_has_code_;
+
+  /*! Whether frame_buffer_ was not taken by DoProcess yet.*/
+  bool is_frame_unread_;
+
+  /*! Throughput and drops since streaming start.*/
+  SensorStats stats_;
+
+  /*! Streaming start time.*/
+  struct timeval stream_start_time_;
+
+  /*! Frame synchronization tolerance in usec (0: not synchronized).*/
+  long sync_tolerance_usec_;  // NOLINT
+
+  /*! Member index of the frame synchronizer (-1: not synchronized).*/
+  int sync_member_;
+
+  /*! Number of the last set output.*/
+  unsigned int last_set_number_;
+
+  /*! Last frames kept for the frame synchronizer.*/
+  std::vector<SensorSyncSlot> sync_slots_;
+
+  /*! Parsed sensor profiles (sensor modes).*/
+  SensorProfileCache profile_cache_;
+
+  /*! Whether the SSP handle streamed since its initialization.*/
+  bool has_streamed_;
+
+  /*! Kind of the next start (cold, warm, switch or restart).*/
+  const char *start_kind_;
+
+  /*! Time of the start request.*/
+  struct timeval start_request_time_;
+
+  /*! Whether the first frame since the start request is awaited
+      (under buffer_lock_).*/
+  bool is_first_frame_pending_;
+
+  /*! Whether the time to the first frame is not logged yet
+      (under buffer_lock_).*/
+  bool is_first_frame_report_;
+
+  /*! Still capture (NULL: none since streaming start).*/
+  SensorStillCapture *still_capture_;
+
+  /*! Profile of the preview while the still mode streams.*/
+  struct ssp_profile *preview_profile_;
+
+  /*! Whether the stream is in the still mode (frames go to still_capture_).*/
+  volatile bool is_still_mode_;
+
+  /*! Capture time of the last preview frame before the still mode.*/
+  struct timeval preview_gap_start_;
+
+  /*! Whether the first preview frame after the still mode is awaited.*/
+  volatile bool is_preview_gap_pending_;
+
+  /*! Time without preview frames for the last still capture in msec.*/
+  double preview_gap_msec_;
+
+  /*! Result of the last still capture.*/
+  SensorStillReport still_report_;
+
+  /*! Whether the result of the last still capture is not logged yet.*/
+  volatile bool is_still_report_;
+
+  /**
+   * @brief
+   * Allocate the frame buffers, keeping the ones of the same format.
+   */
+  void AllocateFrameBuffers(void);
+
+  /**
+   * @brief
+   * Read the coarse integration time and the line length from the sensor.
+   */
+  void ReadStreamRegisters(void);
+
+  /**
+   * @brief
+   * Start and stop the stream once after the initialization (IMX378).
+   * @return If false, the streaming can not be started.
+   */
+  bool PrimeStreaming(void);
+
+  /**
+   * @brief
+   * Switch the running stream to another profile.
+   * @param profile [in] profile (NULL: simulated sensor).
+   * @param size [in] image size of the profile.
+   * @param frequency [in] frame rate of the simulated sensor.
+   * @param is_still [in] If true, the frames go to the still capture.
+   * @return If false, the stream is not running.
+   */
+  bool SwitchStream(struct ssp_profile *profile, CvSize size, int frequency,
+                    bool is_still);
+
+  /**
+   * @brief
+   * Route the frames to the still capture or back to the preview.
+   * @param is_still [in] If true, the frames go to the still capture.
+   */
+  void SetStillMode(bool is_still);
+
+  /**
+   * @brief
+   * Log the result of the last still capture.
+   */
+  void LogStillReport(void);
+
+  /**
+   * @brief
+   * Join the frame synchronizer if the tolerance is set.
+   */
+  void StartFrameSync(void);
+
+  /**
+   * @brief
+   * Leave the frame synchronizer.
+   */
+  void StopFrameSync(void);
+
+  /**
+   * @brief
+   * Take the frame of the last set of the frame synchronizer.
+   * @param dst_image [out] dst image data.
+   */
+  void TakeSyncedFrame(cv::Mat *dst_image);
+
+  /**
+   * @brief
+   * Start the throughput and drop statistics.
+   */
+  void StartStats(void);
+
+  /**
+   * @brief
+   * Log the throughput and drop statistics of the stream.
+   */
+  void LogStats(void);
+
+  /**
+   * @brief
+   * Log the placement and the scheduling events of the control thread and
+   * of the SSP preprocessing thread.
+   */
+  void LogThreadSchedules(void);
+
  public:
   /*! Sensor config file path.*/
   char *sensor_config_file_path_;
@@ -124,17 +350,8 @@ class Sensor : public PluginBase {
   /*! Binning mode register value.*/
   std::vector<int> binning_mode_value_;
 
-  /*! Analog gain register value.*/
-  int analog_gain_param_;
-
-  /*! Digital gain register value.*/
-  int digital_gain_param_;
-
-  /*! Coarse integration time register value.*/
-  int coarse_integration_time_;
-
-  /*! Image orientation register value.*/
-  int orien_reg_;
+  /*! Grouped parameter hold register address (kRegisterNone: none).*/
+  int group_hold_addr_;
 
   /*! Temporary analog gain register value.*/
   int analog_gain_param_temp_;
@@ -148,6 +365,9 @@ class Sensor : public PluginBase {
   /*! Temporary image orientation register value.*/
   int orien_reg_temp_;
 
+  /*! Lens actuator code written last (kRegisterNone: never written).*/
+  int focus_code_;
+
   /*! Frame count.*/
   int frame_count_;
 
@@ -189,6 +409,14 @@ class Sensor : public PluginBase {
   virtual bool SensorConfig(int bit_count_type,
                             char *sensor_config_file_path, CvSize size);
 
+  /**
+   * @brief
+   * Parse a sensor profile ahead, so that applying it is fast.
+   * @param sensor_config_file_path [in] sensor config file path.
+   * @return If true, the profile is parsed.
+   */
+  bool PreloadProfile(const char *sensor_config_file_path);
+
   /**
    * @brief
    * To set a common the first pixel.
@@ -293,6 +521,146 @@ class Sensor : public PluginBase {
    */
   virtual bool StopStreaming(void);
 
+  /**
+   * @brief
+   * Take a frame delivered by the SSP or the simulated sensor.
+   * @param data [in] frame data.
+   * @param size [in] frame data size in bytes.
+   * @param capture_time [in] capture time of the frame.
+   */
+  void ReceiveFrame(const unsigned char *data, int size,
+                    const struct timeval &capture_time);
+
+  /**
+   * @brief
+   * Queue register values to be applied after the next frame.
+   * The values of a batch are applied together (any thread, never blocks).
+   * @param batch [in] batch (kRegisterNone: unchanged).
+   * @return If false, the queue is full and the batch is dropped.
+   */
+  bool SubmitControl(const SensorControlBatch &batch);
+
+  /**
+   * @brief
+   * Queue an analog gain register value.
+   * @param value [in] register value.
+   */
+  void QueueAnalogGain(int value);
+
+  /**
+   * @brief
+   * Queue a digital gain register value.
+   * @param value [in] register value.
+   */
+  void QueueDigitalGain(int value);
+
+  /**
+   * @brief
+   * Queue a coarse integration time register value.
+   * @param value [in] register value.
+   */
+  void QueueExposureTime(int value);
+
+  /**
+   * @brief
+   * Queue an image orientation register value.
+   * @param value [in] register value.
+   */
+  void QueueImageOrientation(int value);
+
+  /**
+   * @brief
+   * Queue a request of an auto-algorithm plugin (SensorLinkTarget).
+   * @param request [in] request (kSensorLinkNone: unchanged).
+   * @return If false, the queue is full and the request is dropped.
+   */
+  virtual bool SubmitSensorRequest(const SensorLinkRequest &request);
+
+  /**
+   * @brief
+   * Write a batch to the sensor under the grouped parameter hold
+   * (control thread).
+   * @param batch [in] batch (kRegisterNone: unchanged).
+   * @return If false, the sensor is not streaming.
+   */
+  bool ApplyControl(const SensorControlBatch &batch);
+
+  /**
+   * @brief
+   * Write a lens actuator code in the direct mode (control thread).
+   * The actuator of the IMX378 module is the only one supported.
+   * @param code [in] actuator code (0 - kSensorFocusCodeMax).
+   * @return If false, the code is not written.
+   */
+  bool WriteFocusCode(int code);
+
+  /**
+   * @brief
+   * Capture full resolution frames while the preview streams.
+   * The stream switches to the still profile, and back to the preview as
+   * soon as the frames are received. The frames are developed and written
+   * on a background thread; the result is logged by the preview flow.
+   * @param profile_path [in] sensor profile of the still mode.
+   * @param count [in] number of the frames (kSensorStillMaxCount at most).
+   * @param output_dir [in] directory of the image files.
+   * @return If false, the capture is not started.
+   */
+  bool CaptureStill(const char *profile_path, int count,
+                    const char *output_dir);
+
+  /**
+   * @brief
+   * Switch the stream to the still mode (still capture thread).
+   * @param profile_path [in] sensor profile of the still mode.
+   * @param size [in] image size of the still mode.
+   * @return If false, the stream is not switched.
+   */
+  bool EnterStillMode(const char *profile_path, CvSize size);
+
+  /**
+   * @brief
+   * Switch the stream back to the preview (still capture thread).
+   * @return If false, the preview does not stream.
+   */
+  bool LeaveStillMode(void);
+
+  /**
+   * @brief
+   * Take the result of a still capture (still capture thread).
+   * @param report [in] result.
+   */
+  void StillCaptured(const SensorStillReport &report);
+
+  /**
+   * @brief
+   * Get the throughput and drop statistics since streaming start.
+   * @return statistics.
+   */
+  SensorStats stats(void) { return stats_; }
+
+  /**
+   * @brief
+   * Set the frame synchronization tolerance (applied at streaming start).
+   * @param tolerance_usec [in] tolerance in usec (0: not synchronized).
+   */
+  void set_sync_tolerance_usec(long tolerance_usec) {  // NOLINT
+    sync_tolerance_usec_ = tolerance_usec;
+  }
+
+  /**
+   * @brief
+   * Set the test pattern mode of the simulated sensor.
+   * @param test_pattern [in] If true, the frame counter is drawn.
+   */
+  void set_test_pattern(bool test_pattern) { test_pattern_ = test_pattern; }
+
+  /**
+   * @brief
+   * Whether the simulated sensor draws the frame counter.
+   * @return true, test pattern mode.
+   */
+  bool test_pattern(void) { return test_pattern_; }
+
   /**
    * @brief
    * Callback function for the acquisition SSP of the frame.
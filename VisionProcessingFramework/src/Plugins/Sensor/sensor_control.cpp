@@ -0,0 +1,320 @@
+/**
+ * @file      sensor_control.cpp
+ * @brief     Sensor control queue and thread of the Sensor plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./sensor_control.h"
+#include "./sensor.h"
+
+/**
+ * @brief
+ * Constructor.
+ */
+SensorControlQueue::SensorControlQueue(void) {
+  for (unsigned int i = 0; i < kSensorControlQueueSize; i++) {
+    cells_[i].sequence = i;
+    SensorControlBatchClear(&cells_[i].batch);
+  }
+  enqueue_pos_ = 0;
+  dequeue_pos_ = 0;
+  dropped_ = 0;
+}
+
+/**
+ * @brief
+ * Add a batch (any thread).
+ * @param batch [in] batch.
+ * @return If false, the queue is full and the batch is dropped.
+ */
+bool SensorControlQueue::Push(const SensorControlBatch &batch) {
+  Cell *cell;
+  unsigned int pos = enqueue_pos_;
+  for (;;) {
+    cell = &cells_[pos & (kSensorControlQueueSize - 1)];
+    unsigned int sequence = cell->sequence;
+    __sync_synchronize();
+    int diff = static_cast<int>(sequence - pos);
+    if (diff == 0) {
+      // The cell is free: claim the position.
+      if (__sync_bool_compare_and_swap(&enqueue_pos_, pos, pos + 1)) {
+        break;
+      }
+      pos = enqueue_pos_;
+    } else if (diff < 0) {
+      // The consumer has not taken the cell of the previous lap.
+      __sync_fetch_and_add(&dropped_, 1);
+      return false;
+    } else {
+      // Another producer took the position.
+      pos = enqueue_pos_;
+    }
+  }
+  cell->batch = batch;
+  __sync_synchronize();
+  cell->sequence = pos + 1;
+  return true;
+}
+
+/**
+ * @brief
+ * Take the oldest batch (consumer thread only).
+ * @param batch [out] batch.
+ * @return If false, the queue is empty.
+ */
+bool SensorControlQueue::Pop(SensorControlBatch *batch) {
+  Cell *cell = &cells_[dequeue_pos_ & (kSensorControlQueueSize - 1)];
+  unsigned int sequence = cell->sequence;
+  __sync_synchronize();
+  if (static_cast<int>(sequence - (dequeue_pos_ + 1)) < 0) {
+    return false;
+  }
+  *batch = cell->batch;
+  __sync_synchronize();
+  cell->sequence = dequeue_pos_ + kSensorControlQueueSize;
+  dequeue_pos_++;
+  return true;
+}
+
+/**
+ * @brief
+ * Constructor.
+ * @param sensor [in] Sensor plugin which writes the registers (NOT own it).
+ */
+SensorControl::SensorControl(Sensor *sensor)
+    : wxThread(wxTHREAD_JOINABLE), frame_sem_(0, 1) {
+  sensor_ = sensor;
+  SensorControlBatchClear(&pending_);
+  frame_count_ = 0;
+  frame_number_ = 0;
+  history_count_ = 0;
+  delay_frames_ = kSensorControlDelayFrames;
+  applied_ = 0;
+  stop_flag_ = false;
+  is_started_ = false;
+  place_request_ = 0;
+  place_seen_ = 0;
+  ThreadSchedCountsClear(&sched_counts_);
+  is_placed_ = true;
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+SensorControl::~SensorControl(void) { Stop(); }
+
+/**
+ * @brief
+ * Start the thread (nothing if it is running).
+ * @return If true, the thread is running.
+ */
+bool SensorControl::Start(void) {
+  if (is_started_) {
+    return true;
+  }
+  stop_flag_ = false;
+  if (Create() != wxTHREAD_NO_ERROR) {
+    DEBUG_PRINT("[SensorControl] Create failed\n");
+    return false;
+  }
+  if (Run() != wxTHREAD_NO_ERROR) {
+    DEBUG_PRINT("[SensorControl] Run failed\n");
+    return false;
+  }
+  is_started_ = true;
+  return true;
+}
+
+/**
+ * @brief
+ * Stop the thread and wait for it.
+ */
+void SensorControl::Stop(void) {
+  if (!is_started_) {
+    return;
+  }
+  stop_flag_ = true;
+  frame_sem_.Post();
+  Wait();
+  is_started_ = false;
+}
+
+/**
+ * @brief
+ * Queue a batch (any thread, never blocks).
+ * @param batch [in] batch.
+ * @return If false, the queue is full and the batch is dropped.
+ */
+bool SensorControl::Submit(const SensorControlBatch &batch) {
+  if (SensorControlBatchIsEmpty(batch)) {
+    return true;
+  }
+  if (queue_.Push(batch) == false) {
+    DEBUG_PRINT("[SensorControl] queue full, batch dropped\n");
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Restart the history for a new stream.
+ * @param in_effect [in] settings of the sensor at the stream start.
+ * @param delay_frames [in] frames between a write and its first frame.
+ */
+void SensorControl::Reset(const SensorControlBatch &in_effect,
+                          int delay_frames) {
+  wxMutexLocker lock(history_mutex_);
+  delay_frames_ = delay_frames;
+  history_[0].first_frame = frame_number_;
+  history_[0].settings = in_effect;
+  history_count_ = 1;
+}
+
+/**
+ * @brief
+ * Name the thread and apply its placement (key of the ThreadPlacementTable),
+ * and restart its scheduling events. The thread takes the request on its
+ * next wake-up.
+ * @param name [in] thread name.
+ */
+void SensorControl::Place(const std::string &name) {
+  wxMutexLocker lock(history_mutex_);
+  thread_name_ = name;
+  ThreadSchedCountsClear(&sched_counts_);
+  __sync_fetch_and_add(&place_request_, 1);
+  frame_sem_.Post();
+}
+
+/**
+ * @brief
+ * Get the scheduling events of the thread since Place() (one frame per batch
+ * applied).
+ * @return scheduling events.
+ */
+ThreadSchedCounts SensorControl::sched_counts(void) {
+  wxMutexLocker lock(history_mutex_);
+  return sched_counts_;
+}
+
+/**
+ * @brief
+ * Get the placement of the thread.
+ * @param placement [out] placement, or the reason why it failed.
+ * @return If false, the placement failed.
+ */
+bool SensorControl::GetPlacement(std::string *placement) {
+  wxMutexLocker lock(history_mutex_);
+  *placement = placement_;
+  return is_placed_;
+}
+
+/**
+ * @brief
+ * Notify a frame callback (frame callback thread).
+ * @param frame_number [in] number of the frame received.
+ */
+void SensorControl::NotifyFrame(unsigned int frame_number) {
+  frame_number_ = frame_number;
+  __sync_fetch_and_add(&frame_count_, 1);
+  frame_sem_.Post();
+}
+
+/**
+ * @brief
+ * Get the settings in effect for a frame.
+ * @param frame_number [in] frame number.
+ * @param settings [out] settings (kRegisterNone: unknown).
+ */
+void SensorControl::GetInEffect(unsigned int frame_number,
+                                SensorControlBatch *settings) {
+  wxMutexLocker lock(history_mutex_);
+  SensorControlBatchClear(settings);
+  for (int i = history_count_ - 1; i >= 0; i--) {
+    if (static_cast<int>(frame_number - history_[i].first_frame) >= 0) {
+      *settings = history_[i].settings;
+      return;
+    }
+  }
+}
+
+/**
+ * @brief
+ * Apply the pending batch after a frame and record it.
+ * @param frame_number [in] number of the last frame received.
+ */
+void SensorControl::Apply(unsigned int frame_number) {
+  if (sensor_->ApplyControl(pending_) == false) {
+    // Not streaming: keep the batch for the next stream.
+    return;
+  }
+  applied_++;
+
+  wxMutexLocker lock(history_mutex_);
+  HistoryEntry entry;
+  entry.first_frame = frame_number + delay_frames_;
+  SensorControlBatchClear(&entry.settings);
+  if (history_count_ > 0) {
+    entry.settings = history_[history_count_ - 1].settings;
+  }
+  SensorControlBatchMerge(pending_, &entry.settings);
+  if (history_count_ == kSensorControlHistorySize) {
+    for (int i = 1; i < history_count_; i++) {
+      history_[i - 1] = history_[i];
+    }
+    history_count_--;
+  }
+  history_[history_count_] = entry;
+  history_count_++;
+  SensorControlBatchClear(&pending_);
+}
+
+/**
+ * @brief
+ * Thread entry point.
+ * @return thread exit code.
+ */
+wxThread::ExitCode SensorControl::Entry(void) {
+  DEBUG_PRINT("[SensorControl] Start - tid:%d\n", this->GetId());
+  unsigned int last_count = frame_count_;
+  while (!stop_flag_) {
+    frame_sem_.WaitTimeout(kSensorControlIdleMsec);
+
+    unsigned int place_request = place_request_;
+    if (place_request != place_seen_) {
+      place_seen_ = place_request;
+      {
+        wxMutexLocker lock(history_mutex_);
+        placer_.set_name(thread_name_);
+      }
+      placer_.ResetCounts();
+      bool is_placed = placer_.Update();
+      wxMutexLocker lock(history_mutex_);
+      is_placed_ = is_placed;
+      placement_ = is_placed ? placer_.Describe() : placer_.error();
+    }
+
+    SensorControlBatch batch;
+    while (queue_.Pop(&batch)) {
+      SensorControlBatchMerge(batch, &pending_);
+    }
+
+    // Write only right after a frame, so the batch lands in one frame.
+    unsigned int count = frame_count_;
+    if (count == last_count) {
+      continue;
+    }
+    last_count = count;
+    if (!SensorControlBatchIsEmpty(pending_)) {
+      placer_.BeginFrame();
+      Apply(frame_number_);
+      placer_.EndFrame();
+      wxMutexLocker lock(history_mutex_);
+      sched_counts_ = placer_.counts();
+    }
+  }
+  DEBUG_PRINT("[SensorControl] end - tid:%d\n", this->GetId());
+  return (wxThread::ExitCode)0;
+}
@@ -0,0 +1,345 @@
+/**
+ * @file      sensor_control.h
+ * @brief     Sensor control queue and thread of the Sensor plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _SENSOR_CONTROL_H_
+#define _SENSOR_CONTROL_H_
+
+#include <string>
+#include "./include.h"
+#include "./sensor_define.h"
+#include "./thread_placement.h"
+
+class Sensor;
+
+/**
+ * @struct SensorControlBatch
+ * @brief Register values changed together (kRegisterNone: unchanged).
+ */
+typedef struct {
+  /*! Analog gain register value */
+  int analog_gain;
+  /*! Digital gain register value */
+  int digital_gain;
+  /*! Coarse integration time register value */
+  int exposure;
+  /*! Image orientation register value */
+  int orientation;
+  /*! Lens actuator code */
+  int focus;
+} SensorControlBatch;
+
+/**
+ * @brief
+ * Clear a batch (all the values unchanged).
+ * @param batch [out] batch.
+ */
+inline void SensorControlBatchClear(SensorControlBatch *batch) {
+  batch->analog_gain = kRegisterNone;
+  batch->digital_gain = kRegisterNone;
+  batch->exposure = kRegisterNone;
+  batch->orientation = kRegisterNone;
+  batch->focus = kRegisterNone;
+}
+
+/**
+ * @brief
+ * Overwrite the values of a batch with the changed values of another one.
+ * @param src [in] newer batch.
+ * @param dst [in,out] older batch.
+ */
+inline void SensorControlBatchMerge(const SensorControlBatch &src,
+                                    SensorControlBatch *dst) {
+  if (src.analog_gain != kRegisterNone) {
+    dst->analog_gain = src.analog_gain;
+  }
+  if (src.digital_gain != kRegisterNone) {
+    dst->digital_gain = src.digital_gain;
+  }
+  if (src.exposure != kRegisterNone) {
+    dst->exposure = src.exposure;
+  }
+  if (src.orientation != kRegisterNone) {
+    dst->orientation = src.orientation;
+  }
+  if (src.focus != kRegisterNone) {
+    dst->focus = src.focus;
+  }
+}
+
+/**
+ * @brief
+ * Whether a batch changes nothing.
+ * @param batch [in] batch.
+ * @return If true, all the values are unchanged.
+ */
+inline bool SensorControlBatchIsEmpty(const SensorControlBatch &batch) {
+  return batch.analog_gain == kRegisterNone &&
+         batch.digital_gain == kRegisterNone &&
+         batch.exposure == kRegisterNone &&
+         batch.orientation == kRegisterNone && batch.focus == kRegisterNone;
+}
+
+/**
+ * @class SensorControlQueue
+ * @brief Bounded lock-free queue of batches, many producers (GUI and
+ * auto-algorithms) and one consumer (the control thread).
+ * Each cell has a sequence number: a producer claims the enqueue position
+ * by compare-and-swap and publishes the cell by its sequence, so neither
+ * side ever blocks. When the queue is full, the batch is dropped.
+ */
+class SensorControlQueue {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  SensorControlQueue(void);
+
+  /**
+   * @brief
+   * Add a batch (any thread).
+   * @param batch [in] batch.
+   * @return If false, the queue is full and the batch is dropped.
+   */
+  bool Push(const SensorControlBatch &batch);
+
+  /**
+   * @brief
+   * Take the oldest batch (consumer thread only).
+   * @param batch [out] batch.
+   * @return If false, the queue is empty.
+   */
+  bool Pop(SensorControlBatch *batch);
+
+  /**
+   * @brief
+   * Get the number of the batches dropped because the queue was full.
+   * @return number of the batches.
+   */
+  unsigned int dropped(void) const { return dropped_; }
+
+ private:
+  /**
+   * @struct Cell
+   * @brief Entry of the ring.
+   */
+  typedef struct {
+    /*! Position the cell is ready for (push: pos, pop: pos + 1) */
+    volatile unsigned int sequence;
+    /*! Batch */
+    SensorControlBatch batch;
+  } Cell;
+
+  /*! Ring (kSensorControlQueueSize, power of 2) */
+  Cell cells_[kSensorControlQueueSize];
+
+  /*! Next position to push */
+  volatile unsigned int enqueue_pos_;
+
+  /*! Next position to pop */
+  unsigned int dequeue_pos_;
+
+  /*! Number of the dropped batches */
+  volatile unsigned int dropped_;
+};
+
+/**
+ * @class SensorControl
+ * @brief Thread which applies the queued batches to the sensor.
+ * The thread wakes on each frame callback, merges the batches queued since
+ * the last frame into one and writes it right after the frame, so a batch
+ * never straddles a frame (the sensor holds the grouped parameters until
+ * all the registers are written). Each application is recorded with the
+ * first frame exposed with it, so the metadata of a frame reports the
+ * settings actually in effect.
+ */
+class SensorControl : public wxThread {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   * @param sensor [in] Sensor plugin which writes the registers (NOT own it).
+   */
+  explicit SensorControl(Sensor *sensor);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~SensorControl(void);
+
+  /**
+   * @brief
+   * Start the thread (nothing if it is running).
+   * @return If true, the thread is running.
+   */
+  bool Start(void);
+
+  /**
+   * @brief
+   * Stop the thread and wait for it.
+   */
+  void Stop(void);
+
+  /**
+   * @brief
+   * Queue a batch (any thread, never blocks).
+   * @param batch [in] batch.
+   * @return If false, the queue is full and the batch is dropped.
+   */
+  bool Submit(const SensorControlBatch &batch);
+
+  /**
+   * @brief
+   * Restart the history for a new stream.
+   * @param in_effect [in] settings of the sensor at the stream start.
+   * @param delay_frames [in] frames between a write and its first frame.
+   */
+  void Reset(const SensorControlBatch &in_effect, int delay_frames);
+
+  /**
+   * @brief
+   * Name the thread and apply its placement (key of the
+   * ThreadPlacementTable), and restart its scheduling events. The thread
+   * takes the request on its next wake-up.
+   * @param name [in] thread name.
+   */
+  void Place(const std::string &name);
+
+  /**
+   * @brief
+   * Get the scheduling events of the thread since Place() (one frame per
+   * batch applied).
+   * @return scheduling events.
+   */
+  ThreadSchedCounts sched_counts(void);
+
+  /**
+   * @brief
+   * Get the placement of the thread.
+   * @param placement [out] placement, or the reason why it failed.
+   * @return If false, the placement failed.
+   */
+  bool GetPlacement(std::string *placement);
+
+  /**
+   * @brief
+   * Notify a frame callback (frame callback thread).
+   * @param frame_number [in] number of the frame received.
+   */
+  void NotifyFrame(unsigned int frame_number);
+
+  /**
+   * @brief
+   * Get the settings in effect for a frame.
+   * @param frame_number [in] frame number.
+   * @param settings [out] settings (kRegisterNone: unknown).
+   */
+  void GetInEffect(unsigned int frame_number, SensorControlBatch *settings);
+
+  /**
+   * @brief
+   * Get the number of the batches applied to the sensor.
+   * @return number of the batches.
+   */
+  unsigned int applied(void) const { return applied_; }
+
+  /**
+   * @brief
+   * Get the number of the batches dropped because the queue was full.
+   * @return number of the batches.
+   */
+  unsigned int dropped(void) const { return queue_.dropped(); }
+
+ private:
+  /**
+   * @brief
+   * Thread entry point.
+   * @return thread exit code.
+   */
+  virtual wxThread::ExitCode Entry(void);
+
+  /**
+   * @brief
+   * Apply the pending batch after a frame and record it.
+   * @param frame_number [in] number of the last frame received.
+   */
+  void Apply(unsigned int frame_number);
+
+  /**
+   * @struct HistoryEntry
+   * @brief Settings in effect from a frame.
+   */
+  typedef struct {
+    /*! First frame exposed with the settings */
+    unsigned int first_frame;
+    /*! Settings */
+    SensorControlBatch settings;
+  } HistoryEntry;
+
+  /*! Sensor plugin (NOT own it) */
+  Sensor *sensor_;
+
+  /*! Queued batches */
+  SensorControlQueue queue_;
+
+  /*! Batches merged since the last application (control thread only) */
+  SensorControlBatch pending_;
+
+  /*! Posted by each frame callback */
+  wxSemaphore frame_sem_;
+
+  /*! Number of the frame callbacks */
+  volatile unsigned int frame_count_;
+
+  /*! Number of the last frame received */
+  volatile unsigned int frame_number_;
+
+  /*! Mutex of the history */
+  wxMutex history_mutex_;
+
+  /*! Applications, oldest first */
+  HistoryEntry history_[kSensorControlHistorySize];
+
+  /*! Number of the entries of history_ */
+  int history_count_;
+
+  /*! Frames between a write and its first frame */
+  int delay_frames_;
+
+  /*! Number of the applied batches */
+  unsigned int applied_;
+
+  /*! Stop request */
+  volatile bool stop_flag_;
+
+  /*! Whether the thread is running */
+  bool is_started_;
+
+  /*! Placement and scheduling monitor (control thread only) */
+  ThreadPlacer placer_;
+
+  /*! Thread name requested by Place() */
+  std::string thread_name_;
+
+  /*! Number of the requests of Place() */
+  volatile unsigned int place_request_;
+
+  /*! Number of the requests taken by the thread (control thread only) */
+  unsigned int place_seen_;
+
+  /*! Scheduling events (copied from placer_ after every batch) */
+  ThreadSchedCounts sched_counts_;
+
+  /*! Placement of the thread */
+  std::string placement_;
+
+  /*! Whether the placement succeeded */
+  bool is_placed_;
+};
+
+#endif /* _SENSOR_CONTROL_H_*/
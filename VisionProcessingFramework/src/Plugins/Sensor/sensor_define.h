@@ -32,6 +32,7 @@
 #define kButtonApplyAnalogGainId             10019
 #define kButtonApplyDigitalGainId            10020
 #define kButtonApplyExposureTimeId           10021
+#define kButtonStillCaptureId                10022
 
 /* Main window definition*/
 #define kWndTitle "Sensor config"
@@ -129,6 +130,14 @@
 #define kButtonSensorSettingsSizeW 150
 #define kButtonSensorSettingsSizeH 40
 
+/* Still capture button definition*/
+#define kButtonStillCaptureName "Still..."
+#define kButtonStillCapturePointX 195
+#define kButtonStillCapturePointY 380
+#define kButtonStillCaptureSizeW 80
+#define kButtonStillCaptureSizeH 40
+#define kDirDialogStillCaptureName "Choose a directory of the still images"
+
 /* Apply button definition*/
 #define kButtonApplyName "Apply"
 #define kButtonApplyPointX 280
@@ -193,6 +202,53 @@
 #define kCreateOpenFile 2
 #define kSensorParamFilePath "../lib/Plugins/input/Sensor.ini"
 
+/* Simulated sensor backend (profile whose comment starts with this name)*/
+#define kSimulatedSensorName "SIMULATED"
+#define kSimulatedSensorDefaultFrequency 30
+#define kSimulatedSensorImagePropertyNode "ImageProperty"
+#define kSimulatedSensorFrequencyNode "Frequency"
+#define kSimulatedSensorWidthNode "Width"
+#define kSimulatedSensorHeightNode "Height"
+#define kSimulatedSensorBarWidth 16
+#define kSimulatedSensorBarStep 8
+
+/* Sensor control (register batches applied by the control thread)*/
+#define kSensorControlQueueSize 64
+#define kSensorControlHistorySize 8
+#define kSensorControlIdleMsec 100
+/* Frames between the write of a batch and the first frame exposed with it*/
+#define kSensorControlDelayFrames 2
+#define kSensorControlSimulatedDelayFrames 1
+/* Grouped parameter hold register of the IMX sensors*/
+#define kSensorGroupHoldAddress 0x0104
+/* Lens actuator of the IMX378 module (direct mode, 10bit code)*/
+#define kSensorFocusSlaveAddress ((0x7c) >> 1)
+#define kSensorFocusModeAddr 0x60D6
+#define kSensorFocusModeDirect 0x04
+#define kSensorFocusCodeAddr1 0x60E4
+#define kSensorFocusCodeAddr2 0x60E5
+#define kSensorFocusCodeMax 0x03FF
+
+/* Frame synchronizer of the Sensor instances (stereo and multi-view)*/
+#define kSensorFrameSyncMaxMembers 4
+#define kSensorFrameSyncDepth 4
+
+/* Still capture (full resolution frames taken while the preview streams)*/
+#define kSensorStillDefaultCount 1
+#define kSensorStillMaxCount 8
+/* Frames skipped after the switch to the still mode*/
+#define kSensorStillSkipFrames 1
+#define kSensorStillFrameTimeoutMsec 3000
+#define kSensorStillJpegQuality 95
+#define kSensorStillFilePrefix "still"
+
+/* Test pattern setting (frame counter drawn by the simulated sensor)*/
+#define kSensorSettingsTestPatternIndex 8
+/* Frame synchronization tolerance setting (usec, empty or 0: off)*/
+#define kSensorSettingsFrameSyncIndex 9
+#define kSensorSettingsNum 10
+#define kSensorTestPatternOn "test_pattern"
+
 #define kImx219AnalogGainDBFile \
   "../config/sensor/register_settings/param/IMX219_AnalogGainDB.csv"
 #define kImx219DigitalGainDBFile \
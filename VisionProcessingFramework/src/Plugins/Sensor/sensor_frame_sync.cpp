@@ -0,0 +1,230 @@
+/**
+ * @file      sensor_frame_sync.cpp
+ * @brief     Frame synchronizer of the Sensor plugin instances.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./sensor_frame_sync.h"
+
+/**
+ * @brief
+ * Get the synchronizer shared by the instances of the process.
+ * @return synchronizer.
+ */
+SensorFrameSync *SensorFrameSync::Instance(void) {
+  static SensorFrameSync instance;
+  return &instance;
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+SensorFrameSync::SensorFrameSync(void) {
+  for (int i = 0; i < kSensorFrameSyncMaxMembers; i++) {
+    members_[i].is_active = false;
+    members_[i].wake_sem = NULL;
+    members_[i].tolerance_usec = 0;
+    members_[i].count = 0;
+    members_[i].next = 0;
+    members_[i].set_number = 0;
+    members_[i].set_sequence = 0;
+    members_[i].unmatched = 0;
+  }
+  set_number_ = 0;
+}
+
+/**
+ * @brief
+ * Join the synchronized members.
+ * @param wake_sem [in] semaphore posted when a set is complete.
+ * @param tolerance_usec [in] maximum capture time difference.
+ * @return member index (-1: no free member).
+ */
+int SensorFrameSync::Join(wxSemaphore *wake_sem,
+                          long tolerance_usec) {  // NOLINT
+  wxMutexLocker lock(mutex_);
+  for (int i = 0; i < kSensorFrameSyncMaxMembers; i++) {
+    SensorFrameSyncMember *member = &members_[i];
+    if (member->is_active) {
+      continue;
+    }
+    member->is_active = true;
+    member->wake_sem = wake_sem;
+    member->tolerance_usec = tolerance_usec;
+    member->count = 0;
+    member->next = 0;
+    member->set_number = 0;
+    member->set_sequence = 0;
+    member->unmatched = 0;
+    return i;
+  }
+  return -1;
+}
+
+/**
+ * @brief
+ * Leave the synchronized members.
+ * @param member [in] member index.
+ */
+void SensorFrameSync::Leave(int member) {
+  if (member < 0 || member >= kSensorFrameSyncMaxMembers) {
+    return;
+  }
+  wxMutexLocker lock(mutex_);
+  members_[member].is_active = false;
+  members_[member].wake_sem = NULL;
+}
+
+/**
+ * @brief
+ * Find the frame of a member closest to a time, newer than its last set.
+ * @param member [in] member.
+ * @param time [in] capture time.
+ * @param diff_usec [out] absolute time difference.
+ * @return entry index (-1: none).
+ */
+int SensorFrameSync::FindClosest(const SensorFrameSyncMember &member,
+                                 const struct timeval &time,
+                                 long *diff_usec) {  // NOLINT
+  int closest = -1;
+  for (int i = 0; i < member.count; i++) {
+    const SensorFrameSyncEntry &entry = member.entries[i];
+    if (entry.is_settled ||
+        (member.set_number != 0 &&
+         static_cast<int>(entry.sequence - member.set_sequence) <= 0)) {
+      continue;
+    }
+    long diff = (entry.time.tv_sec - time.tv_sec) * 1000000 +  // NOLINT
+                (entry.time.tv_usec - time.tv_usec);
+    if (diff < 0) {
+      diff = -diff;
+    }
+    if (closest < 0 || diff < *diff_usec) {
+      closest = i;
+      *diff_usec = diff;
+    }
+  }
+  return closest;
+}
+
+/**
+ * @brief
+ * Report a frame of a member and complete a set if possible.
+ * @param member [in] member index.
+ * @param sequence [in] frame number of the member.
+ * @param time [in] capture time.
+ * @return If true, the frame completed a set.
+ */
+bool SensorFrameSync::AddFrame(int member, unsigned int sequence,
+                               const struct timeval &time) {
+  if (member < 0 || member >= kSensorFrameSyncMaxMembers) {
+    return false;
+  }
+  wxMutexLocker lock(mutex_);
+  SensorFrameSyncMember *self = &members_[member];
+  if (!self->is_active) {
+    return false;
+  }
+
+  // Keep the frame, counting the replaced one if it was never in a set.
+  SensorFrameSyncEntry *entry = &self->entries[self->next];
+  if (self->count == kSensorFrameSyncDepth) {
+    if (!entry->is_settled) {
+      self->unmatched++;
+    }
+  } else {
+    self->count++;
+  }
+  entry->sequence = sequence;
+  entry->time = time;
+  entry->is_settled = false;
+  int self_index = self->next;
+  self->next = (self->next + 1) % kSensorFrameSyncDepth;
+
+  // Every other member needs a free frame within the tolerance.
+  int matches[kSensorFrameSyncMaxMembers];
+  for (int i = 0; i < kSensorFrameSyncMaxMembers; i++) {
+    matches[i] = -1;
+    if (!members_[i].is_active) {
+      continue;
+    }
+    if (i == member) {
+      matches[i] = self_index;
+      continue;
+    }
+    long diff_usec = 0;  // NOLINT
+    matches[i] = FindClosest(members_[i], time, &diff_usec);
+    if (matches[i] < 0 || diff_usec > self->tolerance_usec) {
+      return false;
+    }
+  }
+
+  // The frames form a new set.
+  set_number_++;
+  if (set_number_ == 0) {
+    set_number_ = 1;
+  }
+  for (int i = 0; i < kSensorFrameSyncMaxMembers; i++) {
+    if (matches[i] < 0) {
+      continue;
+    }
+    SensorFrameSyncMember *other = &members_[i];
+    SensorFrameSyncEntry *matched = &other->entries[matches[i]];
+    // The older free frames of the member can no longer be in a set.
+    for (int j = 0; j < other->count; j++) {
+      SensorFrameSyncEntry *older = &other->entries[j];
+      if (!older->is_settled &&
+          static_cast<int>(older->sequence - matched->sequence) < 0 &&
+          (other->set_number == 0 ||
+           static_cast<int>(older->sequence - other->set_sequence) > 0)) {
+        older->is_settled = true;
+        other->unmatched++;
+      }
+    }
+    matched->is_settled = true;
+    other->set_number = set_number_;
+    other->set_sequence = matched->sequence;
+    if (other->wake_sem != NULL) {
+      other->wake_sem->Post();
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Get the last set of a member.
+ * @param member [in] member index.
+ * @param set_number [out] set number (from 1).
+ * @param sequence [out] frame number of the member in the set.
+ * @return If false, the member has no set yet.
+ */
+bool SensorFrameSync::GetSet(int member, unsigned int *set_number,
+                             unsigned int *sequence) {
+  if (member < 0 || member >= kSensorFrameSyncMaxMembers) {
+    return false;
+  }
+  wxMutexLocker lock(mutex_);
+  if (members_[member].set_number == 0) {
+    return false;
+  }
+  *set_number = members_[member].set_number;
+  *sequence = members_[member].set_sequence;
+  return true;
+}
+
+/**
+ * @brief
+ * Get the number of the frames of a member which were never in a set.
+ * @param member [in] member index.
+ * @return number of the frames.
+ */
+unsigned int SensorFrameSync::unmatched(int member) {
+  if (member < 0 || member >= kSensorFrameSyncMaxMembers) {
+    return 0;
+  }
+  wxMutexLocker lock(mutex_);
+  return members_[member].unmatched;
+}
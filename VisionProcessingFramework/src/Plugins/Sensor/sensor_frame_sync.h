@@ -0,0 +1,144 @@
+/**
+ * @file      sensor_frame_sync.h
+ * @brief     Frame synchronizer of the Sensor plugin instances.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _SENSOR_FRAME_SYNC_H_
+#define _SENSOR_FRAME_SYNC_H_
+
+#include <sys/time.h>
+#include "./include.h"
+#include "./sensor_define.h"
+
+/**
+ * @struct SensorFrameSyncEntry
+ * @brief Frame received by a member.
+ */
+typedef struct {
+  /*! Frame number of the member */
+  unsigned int sequence;
+  /*! Capture time */
+  struct timeval time;
+  /*! Whether the frame is settled (in a set, or skipped by one) */
+  bool is_settled;
+} SensorFrameSyncEntry;
+
+/**
+ * @struct SensorFrameSyncMember
+ * @brief Sensor synchronized with the others.
+ */
+typedef struct {
+  /*! Whether the member streams */
+  bool is_active;
+  /*! Posted when a set is complete (NOT own it) */
+  wxSemaphore *wake_sem;
+  /*! Maximum capture time difference to the other members */
+  long tolerance_usec;  // NOLINT
+  /*! Last frames, kSensorFrameSyncDepth at most */
+  SensorFrameSyncEntry entries[kSensorFrameSyncDepth];
+  /*! Number of the entries */
+  int count;
+  /*! Entry replaced next */
+  int next;
+  /*! Number of the last set of the member (0: none) */
+  unsigned int set_number;
+  /*! Frame of the member in the last set */
+  unsigned int set_sequence;
+  /*! Number of the frames which were never in a set */
+  unsigned int unmatched;
+} SensorFrameSyncMember;
+
+/**
+ * @class SensorFrameSync
+ * @brief Pairs the frames of the Sensor instances of the process by their
+ * capture time (stereo and multi-view rigs).
+ * Each streaming instance joins as a member and reports its frames. When
+ * every member has a frame within the tolerance of a new frame, the frames
+ * form a set with a new set number and all the members are woken, so each
+ * one outputs its frame of the set. Frames never in a set are counted.
+ */
+class SensorFrameSync {
+ public:
+  /**
+   * @brief
+   * Get the synchronizer shared by the instances of the process.
+   * @return synchronizer.
+   */
+  static SensorFrameSync *Instance(void);
+
+  /**
+   * @brief
+   * Constructor.
+   */
+  SensorFrameSync(void);
+
+  /**
+   * @brief
+   * Join the synchronized members.
+   * @param wake_sem [in] semaphore posted when a set is complete.
+   * @param tolerance_usec [in] maximum capture time difference.
+   * @return member index (-1: no free member).
+   */
+  int Join(wxSemaphore *wake_sem, long tolerance_usec);  // NOLINT
+
+  /**
+   * @brief
+   * Leave the synchronized members.
+   * @param member [in] member index.
+   */
+  void Leave(int member);
+
+  /**
+   * @brief
+   * Report a frame of a member and complete a set if possible.
+   * @param member [in] member index.
+   * @param sequence [in] frame number of the member.
+   * @param time [in] capture time.
+   * @return If true, the frame completed a set.
+   */
+  bool AddFrame(int member, unsigned int sequence, const struct timeval &time);
+
+  /**
+   * @brief
+   * Get the last set of a member.
+   * @param member [in] member index.
+   * @param set_number [out] set number (from 1).
+   * @param sequence [out] frame number of the member in the set.
+   * @return If false, the member has no set yet.
+   */
+  bool GetSet(int member, unsigned int *set_number, unsigned int *sequence);
+
+  /**
+   * @brief
+   * Get the number of the frames of a member which were never in a set.
+   * @param member [in] member index.
+   * @return number of the frames.
+   */
+  unsigned int unmatched(int member);
+
+ private:
+  /**
+   * @brief
+   * Find the frame of a member closest to a time, newer than its last set.
+   * @param member [in] member.
+   * @param time [in] capture time.
+   * @param diff_usec [out] absolute time difference.
+   * @return entry index (-1: none).
+   */
+  static int FindClosest(const SensorFrameSyncMember &member,
+                         const struct timeval &time,
+                         long *diff_usec);  // NOLINT
+
+  /*! Mutex of the members */
+  wxMutex mutex_;
+
+  /*! Members */
+  SensorFrameSyncMember members_[kSensorFrameSyncMaxMembers];
+
+  /*! Number of the last set */
+  unsigned int set_number_;
+};
+
+#endif /* _SENSOR_FRAME_SYNC_H_*/
@@ -0,0 +1,144 @@
+/**
+ * @file      sensor_profile_cache.cpp
+ * @brief     Cache of the parsed sensor profiles of the Sensor plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./sensor_profile_cache.h"
+#include <sys/stat.h>
+#include <stdio.h>
+#include "./porting_rpi.h"
+
+/**
+ * @brief
+ * Constructor.
+ */
+SensorProfileCache::SensorProfileCache(void) {}
+
+/**
+ * @brief
+ * Get the parsed profile of a file, parsing it if needed.
+ * @param path [in] profile file path.
+ * @return profile (NULL: the file can not be parsed).
+ */
+struct ssp_profile *SensorProfileCache::Load(const char *path) {
+  struct stat file_stat;
+  if (path == NULL || stat(path, &file_stat) != 0) {
+    return NULL;
+  }
+  SensorProfileCacheEntry *entry = NULL;
+  for (unsigned int i = 0; i < entries_.size(); i++) {
+    if (entries_[i].path == path) {
+      entry = &entries_[i];
+      break;
+    }
+  }
+  if (entry != NULL && entry->mtime == file_stat.st_mtime) {
+    return entry->profile;
+  }
+
+  struct ssp_profile *profile = NULL;
+  if (ssp_read_profile(const_cast<char *>(path), &profile) != SSP_SUCCESS) {
+    return NULL;
+  }
+  if (entry == NULL) {
+    SensorProfileCacheEntry new_entry;
+    new_entry.path = path;
+    entries_.push_back(new_entry);
+    entry = &entries_[entries_.size() - 1];
+  }
+  entry->mtime = file_stat.st_mtime;
+  entry->profile = profile;
+  return profile;
+}
+
+/**
+ * @brief
+ * Whether two register lists are equal.
+ * @param a [in] first list.
+ * @param num_a [in] number of the registers of a.
+ * @param b [in] second list.
+ * @param num_b [in] number of the registers of b.
+ * @param is_data [in] If true, the data are compared with the addresses.
+ * @return If true, the lists are equal.
+ */
+bool SensorProfileCache::IsSameRegisters(const struct RegisterSetting *a,
+                                         int num_a,
+                                         const struct RegisterSetting *b,
+                                         int num_b, bool is_data) {
+  if (num_a != num_b) {
+    return false;
+  }
+  for (int i = 0; i < num_a; i++) {
+    if (a[i].Address != b[i].Address) {
+      return false;
+    }
+    if (is_data && a[i].Data != b[i].Data) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Whether a handle initialized with a profile can switch to another one
+ * by register writes only.
+ * @param from [in] profile of the handle.
+ * @param to [in] new profile.
+ * @return If true, the register delta is enough.
+ */
+bool SensorProfileCache::IsWarmSwitchable(const struct ssp_profile *from,
+                                          const struct ssp_profile *to) {
+  if (from == NULL || to == NULL) {
+    return false;
+  }
+  // The receiver is set up for the geometry at the initialization.
+  if (from->CCIAddress != to->CCIAddress || from->NumLanes != to->NumLanes ||
+      from->ImageProperty.Width != to->ImageProperty.Width ||
+      from->ImageProperty.Height != to->ImageProperty.Height ||
+      from->ImageProperty.BayerBits != to->ImageProperty.BayerBits) {
+    return false;
+  }
+  // The handle keeps using the stream start and stop registers it has.
+  if (!IsSameRegisters(from->StartStreamSettings, from->NumStartStreamSettings,
+                       to->StartStreamSettings, to->NumStartStreamSettings,
+                       true) ||
+      !IsSameRegisters(from->StopStreamSettings, from->NumStopStreamSettings,
+                       to->StopStreamSettings, to->NumStopStreamSettings,
+                       true)) {
+    return false;
+  }
+  return IsSameRegisters(from->RegisterSettings, from->NumRegisterSettings,
+                         to->RegisterSettings, to->NumRegisterSettings,
+                         false);
+}
+
+/**
+ * @brief
+ * Write the registers of a profile whose values differ from another one.
+ * The profiles must be warm switchable.
+ * @param handle [in] SSP handle.
+ * @param from [in] profile of the handle.
+ * @param to [in] new profile.
+ * @return number of the registers written (-1: a write failed).
+ */
+int SensorProfileCache::WriteDelta(struct ssp_handle *handle,
+                                   const struct ssp_profile *from,
+                                   const struct ssp_profile *to) {
+  int written = 0;
+  for (int i = 0; i < to->NumRegisterSettings; i++) {
+    const struct RegisterSetting &reg = to->RegisterSettings[i];
+    if (reg.Data == from->RegisterSettings[i].Data) {
+      continue;
+    }
+    if (__CCIRegWrite(handle, reg.Address, reg.Data) == 0) {
+      DEBUG_PRINT("[SensorProfileCache] mode switch write failed - "
+                  "address=%04x, data=%02x\n", reg.Address, reg.Data);
+      return -1;
+    }
+    written++;
+  }
+  return written;
+}
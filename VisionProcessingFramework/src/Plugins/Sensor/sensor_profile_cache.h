@@ -0,0 +1,100 @@
+/**
+ * @file      sensor_profile_cache.h
+ * @brief     Cache of the parsed sensor profiles of the Sensor plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _SENSOR_PROFILE_CACHE_H_
+#define _SENSOR_PROFILE_CACHE_H_
+
+#include <sys/types.h>
+#include <string>
+#include <vector>
+
+extern "C" {
+  #include "./include/libssp.h"
+}
+
+/**
+ * @struct SensorProfileCacheEntry
+ * @brief Parsed profile of a file.
+ */
+typedef struct {
+  /*! Profile file path */
+  std::string path;
+  /*! Modification time of the file when it was parsed */
+  time_t mtime;
+  /*! Parsed profile (never released: the SSP may keep it) */
+  struct ssp_profile *profile;
+} SensorProfileCacheEntry;
+
+/**
+ * @class SensorProfileCache
+ * @brief Sensor profiles parsed once and kept (sensor modes preloaded).
+ * A profile is parsed again only when its file was modified.
+ * Two profiles of the same sensor, lanes and image geometry whose register
+ * lists have the same addresses in the same order are modes of one
+ * initialized handle: switching between them only writes the registers
+ * whose values differ.
+ */
+class SensorProfileCache {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  SensorProfileCache(void);
+
+  /**
+   * @brief
+   * Get the parsed profile of a file, parsing it if needed.
+   * @param path [in] profile file path.
+   * @return profile (NULL: the file can not be parsed).
+   */
+  struct ssp_profile *Load(const char *path);
+
+  /**
+   * @brief
+   * Whether a handle initialized with a profile can switch to another one
+   * by register writes only.
+   * @param from [in] profile of the handle.
+   * @param to [in] new profile.
+   * @return If true, the register delta is enough.
+   */
+  static bool IsWarmSwitchable(const struct ssp_profile *from,
+                               const struct ssp_profile *to);
+
+  /**
+   * @brief
+   * Write the registers of a profile whose values differ from another one.
+   * The profiles must be warm switchable.
+   * @param handle [in] SSP handle.
+   * @param from [in] profile of the handle.
+   * @param to [in] new profile.
+   * @return number of the registers written (-1: a write failed).
+   */
+  static int WriteDelta(struct ssp_handle *handle,
+                        const struct ssp_profile *from,
+                        const struct ssp_profile *to);
+
+ private:
+  /**
+   * @brief
+   * Whether two register lists are equal.
+   * @param a [in] first list.
+   * @param num_a [in] number of the registers of a.
+   * @param b [in] second list.
+   * @param num_b [in] number of the registers of b.
+   * @param is_data [in] If true, the data are compared with the addresses.
+   * @return If true, the lists are equal.
+   */
+  static bool IsSameRegisters(const struct RegisterSetting *a, int num_a,
+                              const struct RegisterSetting *b, int num_b,
+                              bool is_data);
+
+  /*! Parsed profiles */
+  std::vector<SensorProfileCacheEntry> entries_;
+};
+
+#endif /* _SENSOR_PROFILE_CACHE_H_*/
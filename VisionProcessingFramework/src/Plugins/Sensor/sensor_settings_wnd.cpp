@@ -309,11 +309,28 @@ bool SensorSettingsWnd::ReadSensorSettingsFile(
         DEBUG_PRINT("Failed to sensor settings file sensor type\n");
         return false;
       }
+      /* The IMX sensors hold the grouped parameters by 0x0104.*/
+      if (sensor_->sensor_type_.StartsWith(wxT("IMX"))) {
+        sensor_->group_hold_addr_ = kSensorGroupHoldAddress;
+      } else {
+        sensor_->group_hold_addr_ = kRegisterNone;
+      }
       if ((sensor_->sensor_type_ == wxT("IMX219")) ||
           (sensor_->sensor_type_ == wxT("IMX378")) ||
           (sensor_->sensor_type_ == wxT("IU233"))) {
         ReadConvetToDBFile();
       }
+    } else if (wxTokenStr == wxT("group_hold")) {
+      /* group_hold,<address> (other sensors than IMX)*/
+      long addr; /* NOLINT */
+      memset(value, 0, sizeof(value));
+      if (token_count > 1) {
+        wxTokenStr = wxTokenizer.GetNextToken();
+        strncpy(value, (const char*)wxTokenStr.mb_str(),
+                static_cast<int>(wxTokenStr.length()));
+        addr = strtol(value, NULL, 16);
+        sensor_->group_hold_addr_ = static_cast<int>(addr);
+      }
     } else if (wxTokenStr == wxT("register name")) {
       for (int i = 1; i < token_count; i++) {
         wxTokenStr = wxTokenizer.GetNextToken();
@@ -356,7 +373,7 @@ bool SensorSettingsWnd::ReadSensorSettingsFile(
       text_ctrl_analog_gain_->Enable(true);
       static_text_analog_gain_DB_->Enable(true);
       button_image_analog_gain_apply_->Enable(true);
-      sensor_->analog_gain_param_ = static_cast<int>(idef);
+      sensor_->QueueAnalogGain(static_cast<int>(idef));
       sensor_->analog_gain_param_temp_ = static_cast<int>(idef);
     } else if (wxTokenStr == wxT("digital_gain")) {
       memset(value, 0, sizeof(value));
@@ -406,7 +423,7 @@ bool SensorSettingsWnd::ReadSensorSettingsFile(
       text_ctrl_digital_gain_->Enable(true);
       static_text_digital_gain_DB_->Enable(true);
       button_image_digital_gain_apply_->Enable(true);
-      sensor_->digital_gain_param_ = static_cast<int>(idef);
+      sensor_->QueueDigitalGain(static_cast<int>(idef));
       sensor_->digital_gain_param_temp_ = static_cast<int>(idef);
     } else if (wxTokenStr == wxT("exposure_time")) {
       memset(value, 0, sizeof(value));
@@ -447,7 +464,7 @@ bool SensorSettingsWnd::ReadSensorSettingsFile(
       text_ctrl_exposure_time_->Enable(true);
       static_text_exposure_time_MS_->Enable(true);
       button_image_exposure_time_apply_->Enable(true);
-      sensor_->coarse_integration_time_ = static_cast<int>(idef);
+      sensor_->QueueExposureTime(static_cast<int>(idef));
       sensor_->coarse_integration_time_temp_ = static_cast<int>(idef);
     } else if (wxTokenStr == wxT("image_orientation")) {
       memset(value, 0, sizeof(value));
@@ -464,7 +481,7 @@ bool SensorSettingsWnd::ReadSensorSettingsFile(
       static_box_image_orientation_->Enable(true);
       combo_box_image_orientation_->Enable(true);
       button_image_orientation_apply_->Enable(true);
-      sensor_->orien_reg_ = 0;
+      sensor_->QueueImageOrientation(0);
       sensor_->orien_reg_temp_ = 0;
       combo_box_image_orientation_->SetValue(wxT("Normal"));
       combo_box_image_orientation_->SetSelection(0);
@@ -489,8 +506,8 @@ bool SensorSettingsWnd::ReadSensorSettingsFile(
         }
       }
       //static_text_exposure_time_->SetLabel(
-      //    ConvertToExposureTimeMS(sensor_->coarse_integration_time_));
-      text_ctrl_exposure_time_->SetValue(ConvertToExposureTimeMS(sensor_->coarse_integration_time_));
+      //    ConvertToExposureTimeMS(sensor_->coarse_integration_time_temp_));
+      text_ctrl_exposure_time_->SetValue(ConvertToExposureTimeMS(sensor_->coarse_integration_time_temp_));
 
     } else if (wxTokenStr == wxT("binning_mode")) {
       memset(value, 0, sizeof(value));
@@ -818,7 +835,7 @@ void SensorSettingsWnd::SetImageOrientation() {
     set_first_pixel = b_value[image_value];
   }
   sensor_->SetFirstPixel(set_first_pixel);
-  sensor_->orien_reg_ = image_value;
+  sensor_->QueueImageOrientation(image_value);
   sensor_->orien_reg_temp_ = image_value;
 }
 
@@ -842,7 +859,7 @@ void SensorSettingsWnd::SetAnalogGain() {
   value = slider_analog_gain_->GetValue();
   //static_text_analog_gain_->SetLabel(ConvertToAnalogGainDB(value));
   text_ctrl_analog_gain_->SetValue(ConvertToAnalogGainDB(value));
-  sensor_->analog_gain_param_ = value;
+  sensor_->QueueAnalogGain(value);
   sensor_->analog_gain_param_temp_ = value;
 }
 
@@ -865,7 +882,7 @@ void SensorSettingsWnd::SetDigitalGain() {
   value = slider_digital_gain_->GetValue();
   //static_text_digital_gain_->SetLabel(ConvertToDigitalGainDB(value));
   text_ctrl_digital_gain_->SetValue(ConvertToDigitalGainDB(value));
-  sensor_->digital_gain_param_ = value;
+  sensor_->QueueDigitalGain(value);
   sensor_->digital_gain_param_temp_ = value;
 }
 
@@ -888,7 +905,7 @@ void SensorSettingsWnd::SetExposureTime() {
   value = slider_exposure_time_->GetValue();
   //static_text_exposure_time_->SetLabel(ConvertToExposureTimeMS(value));
   text_ctrl_exposure_time_->SetValue(ConvertToExposureTimeMS(value));
-  sensor_->coarse_integration_time_ = value;
+  sensor_->QueueExposureTime(value);
   sensor_->coarse_integration_time_temp_ = value;
 }
 
@@ -1232,7 +1249,7 @@ bool SensorSettingsWnd::WriteSensorParamtoFile(wxString file_path) {
     text_file[7] = wxT("");
   }
 
-  for (int i = 0; i < 8; i++) {
+  for (int i = 0; i < kSensorSettingsNum; i++) {
     sensor_->AddLinePluginSettings(text_file[i]);
   }
 
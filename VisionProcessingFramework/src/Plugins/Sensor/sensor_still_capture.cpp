@@ -0,0 +1,289 @@
+/**
+ * @file      sensor_still_capture.cpp
+ * @brief     Still capture of the Sensor plugin (full resolution frames
+ *            taken while the preview streams).
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./sensor_still_capture.h"
+#include <opencv/highgui.h>
+#include <stdio.h>
+#include <string.h>
+#include "./sensor.h"
+
+/**
+ * @brief
+ * Constructor.
+ * @param sensor [in] Sensor plugin which switches the stream (NOT own it).
+ */
+SensorStillCapture::SensorStillCapture(Sensor *sensor)
+    : wxThread(wxTHREAD_JOINABLE), frame_sem_(0, 0) {
+  sensor_ = sensor;
+  size_ = cvSize(0, 0);
+  first_pixel_ = 0;
+  optical_black_ = 0;
+  count_ = 0;
+  received_ = 0;
+  timerclear(&request_time_);
+  cancel_flag_ = false;
+  is_done_ = false;
+  is_started_ = false;
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+SensorStillCapture::~SensorStillCapture(void) { Stop(); }
+
+/**
+ * @brief
+ * Start a capture.
+ * @param profile_path [in] sensor profile of the still mode.
+ * @param size [in] image size of the still mode.
+ * @param bit_count_type [in] bit count type (0x02: 8bit, else 10bit).
+ * @param first_pixel [in] first pixel of the Bayer pattern.
+ * @param optical_black [in] optical black level.
+ * @param count [in] number of the frames.
+ * @param output_dir [in] directory of the image files.
+ * @return If true, the thread is running.
+ */
+bool SensorStillCapture::Start(const std::string &profile_path, CvSize size,
+                               int bit_count_type, int first_pixel,
+                               int optical_black, int count,
+                               const std::string &output_dir) {
+  if (is_started_) {
+    return false;
+  }
+  profile_path_ = profile_path;
+  output_dir_ = output_dir;
+  size_ = size;
+  first_pixel_ = first_pixel;
+  optical_black_ = optical_black;
+  count_ = count;
+  received_ = 0;
+
+  // The frames are allocated here, so the frame callback only copies.
+  int type = (bit_count_type == 0x02) ? CV_8UC1 : CV_16UC1;
+  frames_.resize(count_);
+  frame_times_.resize(count_);
+  for (int i = 0; i < count_; i++) {
+    frames_[i].create(size_, type);
+    timerclear(&frame_times_[i]);
+  }
+  gettimeofday(&request_time_, NULL);
+
+  cancel_flag_ = false;
+  is_done_ = false;
+  if (Create() != wxTHREAD_NO_ERROR) {
+    DEBUG_PRINT("[SensorStillCapture] Create failed\n");
+    return false;
+  }
+  if (Run() != wxTHREAD_NO_ERROR) {
+    DEBUG_PRINT("[SensorStillCapture] Run failed\n");
+    return false;
+  }
+  is_started_ = true;
+  return true;
+}
+
+/**
+ * @brief
+ * Stop waiting for the frames (the frames received are still developed).
+ */
+void SensorStillCapture::Cancel(void) {
+  cancel_flag_ = true;
+  frame_sem_.Post();
+}
+
+/**
+ * @brief
+ * Cancel the capture and wait for the thread.
+ */
+void SensorStillCapture::Stop(void) {
+  if (!is_started_) {
+    return;
+  }
+  Cancel();
+  Wait();
+  is_started_ = false;
+}
+
+/**
+ * @brief
+ * Take a frame of the still mode (frame callback thread).
+ * @param data [in] frame data.
+ * @param size [in] frame data size in bytes.
+ * @param capture_time [in] capture time of the frame.
+ */
+void SensorStillCapture::AddFrame(const unsigned char *data, int size,
+                                  const struct timeval &capture_time) {
+  // The first frames after the mode switch may be partially exposed.
+  int index = received_ - kSensorStillSkipFrames;
+  received_++;
+  if (index < 0 || index >= count_) {
+    return;
+  }
+  cv::Mat *frame = &frames_[index];
+  int buffer_size = frame->step * frame->rows;
+  memcpy(frame->data, data, (size < buffer_size) ? size : buffer_size);
+  frame_times_[index] = capture_time;
+  frame_sem_.Post();
+}
+
+/**
+ * @brief
+ * Wait for the frames of the capture.
+ * @return number of the frames received.
+ */
+int SensorStillCapture::WaitFrames(void) {
+  int count = 0;
+  while (count < count_ && !cancel_flag_) {
+    if (frame_sem_.WaitTimeout(kSensorStillFrameTimeoutMsec) ==
+        wxSEMA_TIMEOUT) {
+      DEBUG_PRINT("[SensorStillCapture] frame timeout\n");
+      break;
+    }
+    if (cancel_flag_) {
+      break;
+    }
+    count++;
+  }
+  return count;
+}
+
+/**
+ * @brief
+ * Thread entry point.
+ * @return thread exit code.
+ */
+wxThread::ExitCode SensorStillCapture::Entry(void) {
+  DEBUG_PRINT("[SensorStillCapture] Start - tid:%d\n", this->GetId());
+  SensorStillReport report;
+  memset(&report, 0, sizeof(report));
+  report.time_to_still_msec = -1;
+
+  // The preview is stopped only while the still frames are received.
+  // The stream returns to the preview even if the switch failed midway.
+  int captured = 0;
+  if (sensor_->EnterStillMode(profile_path_.c_str(), size_)) {
+    captured = WaitFrames();
+  }
+  if (sensor_->LeaveStillMode() == false) {
+    DEBUG_PRINT("[SensorStillCapture] can not return to the preview\n");
+  }
+  report.frames = captured;
+  if (captured > 0) {
+    report.time_to_still_msec =
+        (frame_times_[0].tv_sec - request_time_.tv_sec) * 1000.0 +
+        (frame_times_[0].tv_usec - request_time_.tv_usec) / 1000.0;
+  }
+
+  // Development and encoding, off the preview flow. The frames are
+  // developed in parallel: each one only reads its own frame and the
+  // settings of the capture, and writes its own file.
+  struct timeval develop_time;
+  gettimeofday(&develop_time, NULL);
+  int saved = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : saved)
+#endif
+  for (int i = 0; i < captured; i++) {
+    cv::Mat image;
+    if (Develop(frames_[i], &image) && Encode(image, i)) {
+      saved++;
+    }
+  }
+  report.saved = saved;
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  report.develop_msec = (now.tv_sec - develop_time.tv_sec) * 1000.0 +
+                        (now.tv_usec - develop_time.tv_usec) / 1000.0;
+
+  frames_.clear();
+  sensor_->StillCaptured(report);
+  is_done_ = true;
+  DEBUG_PRINT("[SensorStillCapture] end - tid:%d\n", this->GetId());
+  return (wxThread::ExitCode)0;
+}
+
+/**
+ * @brief
+ * Develop a Bayer frame.
+ * @param raw [in] Bayer frame.
+ * @param image [out] BGR image (8bit, or 16bit for the 10bit frames).
+ * @return If false, the first pixel is unknown.
+ */
+bool SensorStillCapture::Develop(const cv::Mat &raw, cv::Mat *image) {
+  bool is_8bit = (raw.depth() == CV_8U);
+  // VNG interpolation is only available for 8bit frames.
+  int type;
+  if (first_pixel_ == 0) {
+    type = is_8bit ? CV_BayerBG2BGR_VNG : CV_BayerBG2BGR;
+  } else if (first_pixel_ == 1) {
+    type = is_8bit ? CV_BayerGB2BGR_VNG : CV_BayerGB2BGR;
+  } else if (first_pixel_ == 2) {
+    type = is_8bit ? CV_BayerGR2BGR_VNG : CV_BayerGR2BGR;
+  } else if (first_pixel_ == 3) {
+    type = is_8bit ? CV_BayerRG2BGR_VNG : CV_BayerRG2BGR;
+  } else {
+    DEBUG_PRINT("[SensorStillCapture] fail first pixel = %d\n", first_pixel_);
+    return false;
+  }
+
+  // Optical black, stretched back to the full range.
+  double max_value = is_8bit ? 0xFF : 0x3FF;
+  double scale = max_value / (max_value - optical_black_);
+  cv::Mat linear;
+  raw.convertTo(linear, raw.type(), scale, -optical_black_ * scale);
+
+  cv::Mat bgr;
+  cv::cvtColor(linear, bgr, type);
+
+  // Gray world white balance.
+  cv::Scalar mean = cv::mean(bgr);
+  double gray = (mean[0] + mean[1] + mean[2]) / 3;
+  std::vector<cv::Mat> planes;
+  cv::split(bgr, planes);
+  for (unsigned int i = 0; i < planes.size(); i++) {
+    if (mean[i] > 0) {
+      planes[i].convertTo(planes[i], -1, gray / mean[i]);
+    }
+  }
+  cv::merge(planes, *image);
+
+  // 10bit frames are written as 16bit.
+  if (!is_8bit) {
+    image->convertTo(*image, CV_16U, 65535.0 / max_value);
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Write a developed image (JPEG for 8bit, PNG for 16bit).
+ * @param image [in] BGR image.
+ * @param index [in] index of the frame in the capture.
+ * @return If true, the file is written.
+ */
+bool SensorStillCapture::Encode(const cv::Mat &image, int index) {
+  std::vector<int> params;
+  const char *extension = "png";
+  if (image.depth() == CV_8U) {
+    extension = "jpg";
+    params.push_back(CV_IMWRITE_JPEG_QUALITY);
+    params.push_back(kSensorStillJpegQuality);
+  }
+  char file_name[64];
+  snprintf(file_name, sizeof(file_name), "/%s_%ld_%02d.%s",
+           kSensorStillFilePrefix,
+           static_cast<long>(request_time_.tv_sec), index,  // NOLINT
+           extension);
+  std::string file_path = output_dir_ + file_name;
+  if (cv::imwrite(file_path, image, params) == false) {
+    DEBUG_PRINT("[SensorStillCapture] can not write %s\n", file_path.c_str());
+    return false;
+  }
+  return true;
+}
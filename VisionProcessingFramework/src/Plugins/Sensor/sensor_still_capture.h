@@ -0,0 +1,186 @@
+/**
+ * @file      sensor_still_capture.h
+ * @brief     Still capture of the Sensor plugin (full resolution frames
+ *            taken while the preview streams).
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _SENSOR_STILL_CAPTURE_H_
+#define _SENSOR_STILL_CAPTURE_H_
+
+#include <sys/time.h>
+#include <string>
+#include <vector>
+#include "./include.h"
+#include "./sensor_define.h"
+
+class Sensor;
+
+/**
+ * @struct SensorStillReport
+ * @brief Result of a still capture.
+ */
+typedef struct {
+  /*! Frames captured */
+  unsigned int frames;
+  /*! Frames developed and written */
+  unsigned int saved;
+  /*! Time from the request to the first still frame in msec (-1: none) */
+  double time_to_still_msec;
+  /*! Time of the development and the encoding of all frames in msec */
+  double develop_msec;
+} SensorStillReport;
+
+/**
+ * @class SensorStillCapture
+ * @brief Thread which takes full resolution frames while the preview
+ * streams.
+ * The thread asks the Sensor plugin to switch the stream to the still
+ * profile, keeps the requested number of frames, and switches the stream
+ * back to the preview as soon as they are received. The frames are then
+ * developed (optical black, edge-aware demosaic and white balance) and
+ * written on this thread, so the preview flow only misses the frames of
+ * the mode switches.
+ */
+class SensorStillCapture : public wxThread {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   * @param sensor [in] Sensor plugin which switches the stream (NOT own it).
+   */
+  explicit SensorStillCapture(Sensor *sensor);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~SensorStillCapture(void);
+
+  /**
+   * @brief
+   * Start a capture.
+   * @param profile_path [in] sensor profile of the still mode.
+   * @param size [in] image size of the still mode.
+   * @param bit_count_type [in] bit count type (0x02: 8bit, else 10bit).
+   * @param first_pixel [in] first pixel of the Bayer pattern.
+   * @param optical_black [in] optical black level.
+   * @param count [in] number of the frames.
+   * @param output_dir [in] directory of the image files.
+   * @return If true, the thread is running.
+   */
+  bool Start(const std::string &profile_path, CvSize size, int bit_count_type,
+             int first_pixel, int optical_black, int count,
+             const std::string &output_dir);
+
+  /**
+   * @brief
+   * Stop waiting for the frames (the frames received are still developed).
+   */
+  void Cancel(void);
+
+  /**
+   * @brief
+   * Cancel the capture and wait for the thread.
+   */
+  void Stop(void);
+
+  /**
+   * @brief
+   * Take a frame of the still mode (frame callback thread).
+   * @param data [in] frame data.
+   * @param size [in] frame data size in bytes.
+   * @param capture_time [in] capture time of the frame.
+   */
+  void AddFrame(const unsigned char *data, int size,
+                const struct timeval &capture_time);
+
+  /**
+   * @brief
+   * Whether the capture is over (the stream is back to the preview).
+   * @return If true, the capture is over.
+   */
+  bool is_done(void) const { return is_done_; }
+
+ private:
+  /**
+   * @brief
+   * Thread entry point.
+   * @return thread exit code.
+   */
+  virtual wxThread::ExitCode Entry(void);
+
+  /**
+   * @brief
+   * Wait for the frames of the capture.
+   * @return number of the frames received.
+   */
+  int WaitFrames(void);
+
+  /**
+   * @brief
+   * Develop a Bayer frame.
+   * @param raw [in] Bayer frame.
+   * @param image [out] BGR image (8bit, or 16bit for the 10bit frames).
+   * @return If false, the first pixel is unknown.
+   */
+  bool Develop(const cv::Mat &raw, cv::Mat *image);
+
+  /**
+   * @brief
+   * Write a developed image (JPEG for 8bit, PNG for 16bit).
+   * @param image [in] BGR image.
+   * @param index [in] index of the frame in the capture.
+   * @return If true, the file is written.
+   */
+  bool Encode(const cv::Mat &image, int index);
+
+  /*! Sensor plugin (NOT own it) */
+  Sensor *sensor_;
+
+  /*! Sensor profile of the still mode */
+  std::string profile_path_;
+
+  /*! Directory of the image files */
+  std::string output_dir_;
+
+  /*! Image size of the still mode */
+  CvSize size_;
+
+  /*! First pixel of the Bayer pattern */
+  int first_pixel_;
+
+  /*! Optical black level */
+  int optical_black_;
+
+  /*! Number of the frames requested */
+  int count_;
+
+  /*! Frames of the capture */
+  std::vector<cv::Mat> frames_;
+
+  /*! Capture time of the frames */
+  std::vector<struct timeval> frame_times_;
+
+  /*! Frames received in the still mode, skipped ones included
+      (frame callback thread) */
+  int received_;
+
+  /*! Posted for each frame kept */
+  wxSemaphore frame_sem_;
+
+  /*! Time of the request */
+  struct timeval request_time_;
+
+  /*! Cancel request */
+  volatile bool cancel_flag_;
+
+  /*! Whether the capture is over */
+  volatile bool is_done_;
+
+  /*! Whether the thread is running */
+  bool is_started_;
+};
+
+#endif /* _SENSOR_STILL_CAPTURE_H_*/
@@ -15,6 +15,7 @@ EVT_CLOSE(SensorWnd::OnClose)
 EVT_BUTTON(kButtonFileDialogId, SensorWnd::OnOpenFileDialog)
 EVT_BUTTON(kButtonApplyId, SensorWnd::OnApply)
 EVT_BUTTON(kButtonSensorSettingsId, SensorWnd::OnOpenSensorSettingsWnd)
+EVT_BUTTON(kButtonStillCaptureId, SensorWnd::OnStillCapture)
 END_EVENT_TABLE();
 
 /**
@@ -125,6 +126,13 @@ SensorWnd::SensorWnd(Sensor* sensor)
                                wxPoint(kButtonApplyPointX, kButtonApplyPointY),
                                wxSize(kButtonApplySizeW, kButtonApplySizeH));
 
+  /* Creating a still capture button object.*/
+  button_still_capture_ = new wxButton(
+      this, kButtonStillCaptureId, wxT(kButtonStillCaptureName),
+      wxPoint(kButtonStillCapturePointX, kButtonStillCapturePointY),
+      wxSize(kButtonStillCaptureSizeW, kButtonStillCaptureSizeH));
+  button_still_capture_->Enable(false);
+
   file_dialog_sensor_config_open_ = new wxFileDialog(
       this, wxT(kFileDialogSensorConfigOpenWndName), wxEmptyString,
       wxEmptyString, wxT(kFileDialogSensorConfig), wxFD_OPEN,
@@ -238,6 +246,11 @@ bool SensorWnd::ReadSensorConfigFile(wxString sensor_config_file_path) {
     }
     child = child->GetNext();
   }
+  /* Parse the profile now, so that the apply button is fast.*/
+  if (sensor_->sensor_config_type_ != wxT(kSimulatedSensorName)) {
+    sensor_->PreloadProfile(
+        (const char*)sensor_config_file_path.mb_str());
+  }
   WriteSensorParamtoFile(wxT(kSensorParamFilePath),
                          sensor_config_file_path,
                          8);
@@ -334,6 +347,36 @@ void SensorWnd::OnOpenSensorSettingsWnd(wxCommandEvent& event) {
   sensor_->OpenSensorSettingWindow();
 }
 
+/**
+ * @brief
+ * Capture a still in the mode of a chosen sensor profile while the
+ * preview streams.
+ */
+void SensorWnd::OnStillCapture(wxCommandEvent& event) {
+  DEBUG_PRINT("SensorWnd::OnStillCapture\n");
+  wxFileDialog profile_dialog(this, wxT(kFileDialogSensorConfigOpenWndName),
+                              wxEmptyString, wxEmptyString,
+                              wxT(kFileDialogSensorConfig), wxFD_OPEN,
+                              wxDefaultPosition);
+  if (profile_dialog.ShowModal() != wxID_OK) {
+    return;
+  }
+  wxDirDialog dir_dialog(this, wxT(kDirDialogStillCaptureName));
+  if (dir_dialog.ShowModal() != wxID_OK) {
+    return;
+  }
+  if (sensor_->CaptureStill(
+          (const char*)profile_dialog.GetPath().mb_str(),
+          kSensorStillDefaultCount,
+          (const char*)dir_dialog.GetPath().mb_str()) == false) {
+    wxMessageDialog dialog(
+       NULL, wxT("Could not capture a still.\n1.the preview is not streaming"
+                 "\n2.a capture is running\n3.the profile can not be read."),
+       wxT("Error"), wxOK, wxPoint(kMessageDialogPointX, kMessageDialogPointY));
+    dialog.ShowModal();
+  }
+}
+
 /**
  * @brief
  * Set the image processing state.
@@ -346,21 +389,28 @@ void SensorWnd::UpdateUIForImageProcessingState(ImageProcessingState state) {
       combo_box_bit_count_->Enable(false);
       button_apply_->Enable(false);
       button_file_dialog_->Enable(false);
+      button_still_capture_->Enable(true);
       break;
-    case kStop:
+    case kStop: {
       combo_box_bit_count_->Enable(true);
       button_apply_->Enable(true);
       button_file_dialog_->Enable(true);
-      sensor_->analog_gain_param_ = sensor_->analog_gain_param_temp_;
-      sensor_->digital_gain_param_ = sensor_->digital_gain_param_temp_;
-      sensor_->coarse_integration_time_ =
-          sensor_->coarse_integration_time_temp_;
-      sensor_->orien_reg_ = sensor_->orien_reg_temp_;
+      button_still_capture_->Enable(false);
+      /* Applied again after the first frame of the next stream.*/
+      SensorControlBatch batch;
+      SensorControlBatchClear(&batch);
+      batch.analog_gain = sensor_->analog_gain_param_temp_;
+      batch.digital_gain = sensor_->digital_gain_param_temp_;
+      batch.exposure = sensor_->coarse_integration_time_temp_;
+      batch.orientation = sensor_->orien_reg_temp_;
+      sensor_->SubmitControl(batch);
       break;
+    }
     case kPause:
       combo_box_bit_count_->Enable(false);
       button_apply_->Enable(false);
       button_file_dialog_->Enable(false);
+      button_still_capture_->Enable(false);
       break;
   }
 }
@@ -597,7 +647,7 @@ bool SensorWnd::WriteSensorParamtoFile(wxString file_path,
   wx_bit_count << bit_count;
   text_file[1] = wx_bit_count;
 
-  for (int i = 0; i < 8; i++) {
+  for (int i = 0; i < kSensorSettingsNum; i++) {
     sensor_->AddLinePluginSettings(text_file[i]);
   }
 
@@ -75,6 +75,13 @@ class SensorWnd : public wxFrame {
    */
   virtual void OnOpenSensorSettingsWnd(wxCommandEvent &event); /* NOLINT */
 
+  /**
+   * @brief
+   * Capture a still in the mode of a chosen sensor profile while the
+   * preview streams.
+   */
+  virtual void OnStillCapture(wxCommandEvent &event);          /* NOLINT */
+
   /**
    * @brief
    * Set the image processing state.
@@ -174,6 +181,9 @@ class SensorWnd : public wxFrame {
   /* Apply button object*/
   wxButton *button_apply_;
 
+  /* Still capture button object*/
+  wxButton *button_still_capture_;
+
   /* Sensor config open file dialog object*/
   wxFileDialog *file_dialog_sensor_config_open_;
 
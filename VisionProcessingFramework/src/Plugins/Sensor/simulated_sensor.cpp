@@ -0,0 +1,232 @@
+/**
+ * @file      simulated_sensor.cpp
+ * @brief     Simulated sensor backend of the Sensor plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./simulated_sensor.h"
+#include <unistd.h>
+#include <wx/xml/xml.h>
+#include "./sensor.h"
+#include "./sensor_define.h"
+
+/**
+ * @brief
+ * Constructor.
+ * @param sensor [in] Sensor plugin which receives the frames (NOT own it).
+ */
+SimulatedSensor::SimulatedSensor(Sensor *sensor)
+    : wxThread(wxTHREAD_JOINABLE) {
+  sensor_ = sensor;
+  max_value_ = 0xFF;
+  period_usec_ = 1000000 / kSimulatedSensorDefaultFrequency;
+  stop_flag_ = false;
+  is_started_ = false;
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+SimulatedSensor::~SimulatedSensor(void) { Stop(); }
+
+/**
+ * @brief
+ * Read the frame rate from a sensor profile.
+ * @param profile_path [in] sensor profile file path.
+ * @return frame rate (kSimulatedSensorDefaultFrequency if not found).
+ */
+int SimulatedSensor::ReadFrequency(const char *profile_path) {
+  wxXmlDocument document;
+  if (!document.Load(wxString(profile_path, wxConvUTF8)) ||
+      document.GetRoot() == NULL) {
+    return kSimulatedSensorDefaultFrequency;
+  }
+  wxXmlNode *child = document.GetRoot()->GetChildren();
+  while (child) {
+    if (child->GetName() == wxT(kSimulatedSensorImagePropertyNode)) {
+      wxXmlNode *property = child->GetChildren();
+      while (property) {
+        long value;  // NOLINT
+        if (property->GetName() == wxT(kSimulatedSensorFrequencyNode) &&
+            property->GetNodeContent().ToLong(&value) && value > 0) {
+          return static_cast<int>(value);
+        }
+        property = property->GetNext();
+      }
+    }
+    child = child->GetNext();
+  }
+  return kSimulatedSensorDefaultFrequency;
+}
+
+/**
+ * @brief
+ * Read the image size from a sensor profile.
+ * @param profile_path [in] sensor profile file path.
+ * @param size [out] image size.
+ * @return If false, the size is not found.
+ */
+bool SimulatedSensor::ReadImageSize(const char *profile_path, CvSize *size) {
+  wxXmlDocument document;
+  if (!document.Load(wxString(profile_path, wxConvUTF8)) ||
+      document.GetRoot() == NULL) {
+    return false;
+  }
+  long width = 0;   // NOLINT
+  long height = 0;  // NOLINT
+  wxXmlNode *child = document.GetRoot()->GetChildren();
+  while (child) {
+    if (child->GetName() == wxT(kSimulatedSensorImagePropertyNode)) {
+      wxXmlNode *property = child->GetChildren();
+      while (property) {
+        if (property->GetName() == wxT(kSimulatedSensorWidthNode)) {
+          property->GetNodeContent().ToLong(&width);
+        } else if (property->GetName() == wxT(kSimulatedSensorHeightNode)) {
+          property->GetNodeContent().ToLong(&height);
+        }
+        property = property->GetNext();
+      }
+    }
+    child = child->GetNext();
+  }
+  if (width <= 0 || height <= 0) {
+    return false;
+  }
+  *size = cvSize(static_cast<int>(width), static_cast<int>(height));
+  return true;
+}
+
+/**
+ * @brief
+ * Start to deliver the frames.
+ * @param size [in] image size.
+ * @param bit_count_type [in] bit count type (0x02: 8bit, else 10bit).
+ * @param frequency [in] frame rate.
+ * @return If true, the thread is running.
+ */
+bool SimulatedSensor::Start(CvSize size, int bit_count_type, int frequency) {
+  if (is_started_) {
+    return true;
+  }
+  if (frequency <= 0) {
+    frequency = kSimulatedSensorDefaultFrequency;
+  }
+  period_usec_ = 1000000 / frequency;
+
+  int type;
+  if (bit_count_type == 0x02) {
+    type = CV_8UC1;
+    max_value_ = 0xFF;
+  } else {
+    type = CV_16UC1;
+    max_value_ = 0x03FF;
+  }
+
+  // Bayer gradient: red grows to the right, blue to the left and green to
+  // the bottom, so the demosaiced scene has colors in every corner.
+  pattern_image_.create(size, type);
+  for (int y = 0; y < size.height; y++) {
+    for (int x = 0; x < size.width; x++) {
+      int value;
+      if ((y % 2) == 0 && (x % 2) == 0) {
+        value = max_value_ * x / size.width;
+      } else if ((y % 2) == 1 && (x % 2) == 1) {
+        value = max_value_ - max_value_ * x / size.width;
+      } else {
+        value = max_value_ * y / size.height;
+      }
+      if (type == CV_8UC1) {
+        pattern_image_.at<unsigned char>(y, x) =
+            static_cast<unsigned char>(value);
+      } else {
+        pattern_image_.at<unsigned short>(y, x) =  // NOLINT
+            static_cast<unsigned short>(value);    // NOLINT
+      }
+    }
+  }
+  frame_image_.create(size, type);
+
+  stop_flag_ = false;
+  if (Create() != wxTHREAD_NO_ERROR) {
+    DEBUG_PRINT("[SimulatedSensor] Create failed\n");
+    return false;
+  }
+  if (Run() != wxTHREAD_NO_ERROR) {
+    DEBUG_PRINT("[SimulatedSensor] Run failed\n");
+    return false;
+  }
+  is_started_ = true;
+  return true;
+}
+
+/**
+ * @brief
+ * Stop to deliver the frames and wait for the thread.
+ */
+void SimulatedSensor::Stop(void) {
+  if (!is_started_) {
+    return;
+  }
+  stop_flag_ = true;
+  Wait();
+  is_started_ = false;
+}
+
+/**
+ * @brief
+ * Render the next frame of the moving scene into frame_image_.
+ * @param count [in] number of the frames rendered before.
+ */
+void SimulatedSensor::RenderFrame(unsigned int count) {
+  pattern_image_.copyTo(frame_image_);
+  int bar_x = (count * kSimulatedSensorBarStep) % frame_image_.cols;
+  int bar_width = kSimulatedSensorBarWidth;
+  if (bar_x + bar_width > frame_image_.cols) {
+    bar_width = frame_image_.cols - bar_x;
+  }
+  frame_image_(cv::Rect(bar_x, 0, bar_width, frame_image_.rows))
+      .setTo(cv::Scalar(max_value_));
+}
+
+/**
+ * @brief
+ * Thread entry point.
+ * @return thread exit code.
+ */
+wxThread::ExitCode SimulatedSensor::Entry(void) {
+  DEBUG_PRINT("[SimulatedSensor] Start - tid:%d\n", this->GetId());
+  unsigned int count = 0;
+  int frame_size = frame_image_.step * frame_image_.rows;
+  struct timeval next_time;
+  gettimeofday(&next_time, NULL);
+
+  while (!stop_flag_) {
+    RenderFrame(count);
+    count++;
+
+    // Deadline of this frame (absolute, so the rate does not drift).
+    next_time.tv_usec += period_usec_;
+    while (next_time.tv_usec >= 1000000) {
+      next_time.tv_usec -= 1000000;
+      next_time.tv_sec++;
+    }
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    long wait_usec = (next_time.tv_sec - now.tv_sec) * 1000000 +  // NOLINT
+                     (next_time.tv_usec - now.tv_usec);
+    if (wait_usec > 0) {
+      usleep(wait_usec);
+      gettimeofday(&now, NULL);
+    } else if (wait_usec < -period_usec_) {
+      // Too late by more than a frame: restart the schedule from now.
+      next_time = now;
+    }
+
+    // The frame is read out at the deadline.
+    sensor_->ReceiveFrame(frame_image_.data, frame_size, now);
+  }
+  DEBUG_PRINT("[SimulatedSensor] end - tid:%d\n", this->GetId());
+  return (wxThread::ExitCode)0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file      simulated_sensor.h
+ * @brief     Simulated sensor backend of the Sensor plugin.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _SIMULATED_SENSOR_H_
+#define _SIMULATED_SENSOR_H_
+
+#include <sys/time.h>
+#include "./include.h"
+
+class Sensor;
+
+/**
+ * @class SimulatedSensor
+ * @brief Thread which delivers generated Bayer frames to the Sensor plugin
+ * at the frame rate of the profile, in place of the SSP callback.
+ */
+class SimulatedSensor : public wxThread {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   * @param sensor [in] Sensor plugin which receives the frames (NOT own it).
+   */
+  explicit SimulatedSensor(Sensor *sensor);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~SimulatedSensor(void);
+
+  /**
+   * @brief
+   * Read the frame rate from a sensor profile.
+   * @param profile_path [in] sensor profile file path.
+   * @return frame rate (kSimulatedSensorDefaultFrequency if not found).
+   */
+  static int ReadFrequency(const char *profile_path);
+
+  /**
+   * @brief
+   * Read the image size from a sensor profile.
+   * @param profile_path [in] sensor profile file path.
+   * @param size [out] image size.
+   * @return If false, the size is not found.
+   */
+  static bool ReadImageSize(const char *profile_path, CvSize *size);
+
+  /**
+   * @brief
+   * Start to deliver the frames.
+   * @param size [in] image size.
+   * @param bit_count_type [in] bit count type (0x02: 8bit, else 10bit).
+   * @param frequency [in] frame rate.
+   * @return If true, the thread is running.
+   */
+  bool Start(CvSize size, int bit_count_type, int frequency);
+
+  /**
+   * @brief
+   * Stop to deliver the frames and wait for the thread.
+   */
+  void Stop(void);
+
+ private:
+  /**
+   * @brief
+   * Thread entry point.
+   * @return thread exit code.
+   */
+  virtual wxThread::ExitCode Entry(void);
+
+  /**
+   * @brief
+   * Render the next frame of the moving scene into frame_image_.
+   * @param count [in] number of the frames rendered before.
+   */
+  void RenderFrame(unsigned int count);
+
+  /*! Sensor plugin (NOT own it) */
+  Sensor *sensor_;
+
+  /*! Static background (Bayer gradient) */
+  cv::Mat pattern_image_;
+
+  /*! Frame delivered to the Sensor plugin */
+  cv::Mat frame_image_;
+
+  /*! Pixel value of white */
+  int max_value_;
+
+  /*! Frame period in microseconds */
+  long period_usec_;  // NOLINT
+
+  /*! Stop request */
+  volatile bool stop_flag_;
+
+  /*! Whether the thread is running */
+  bool is_started_;
+};
+
+#endif /* _SIMULATED_SENSOR_H_*/
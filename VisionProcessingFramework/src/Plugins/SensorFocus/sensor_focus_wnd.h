@@ -11,11 +11,6 @@
 #include "./include.h"
 #include "./sensor_focus_define.h"
 
-typedef struct {
-  int adr;
-  int dat;
-} T_I2CRegWriteData;
-
 class SensorFocus;
 
 /**
@@ -101,16 +96,6 @@ class SensorFocusWnd : public wxFrame {
    */
   //virtual void OnOpenFileDialog(wxCommandEvent &event);        /* NOLINT */
 
-  // static const T_I2CRegWriteData i2cdat_[];
-  static const T_I2CRegWriteData i2cdat_gyro_[];
-  static const T_I2CRegWriteData i2cdat_dp1_[];
-  static const T_I2CRegWriteData i2cdat_dp2_[];
-  static const T_I2CRegWriteData i2cdat_SineTest_dp1_[];
-  static const T_I2CRegWriteData i2cdat_SineTest_dp2_[];
-  static const T_I2CRegWriteData i2cdat_calb_[];
-  static const T_I2CRegWriteData i2cdat_gpo_[];
-  static const T_I2CRegWriteData i2cdat_pwmfrequency_[];
-
  private:
   /*! Event table of wxWidgets.*/
   DECLARE_EVENT_TABLE();
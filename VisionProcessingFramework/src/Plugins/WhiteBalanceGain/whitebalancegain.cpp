@@ -40,6 +40,8 @@ WhiteBalanceGain::WhiteBalanceGain() : PluginBase() {
   }
 
   set_is_use_dest_buffer(false);
+  link_sequence_ = 0;
+  is_link_adopted_ = false;
 }
 
 /**
@@ -60,6 +62,9 @@ bool WhiteBalanceGain::InitProcess(CommonParam* common) {
   if (is_success_initialized_ == true) {
     common_ = common;
     one_push_ = false;
+    // Only the gains published during this capture are adopted.
+    link_sequence_ = WhiteBalanceLink::Instance()->sequence();
+    is_link_adopted_ = false;
     return true;
   } else {
     return false;
@@ -69,11 +74,15 @@ bool WhiteBalanceGain::InitProcess(CommonParam* common) {
 /**
  * @brief
  * Finalize routine of the Whitebalancegain plugin.
- * This function is empty implementation.
+ * The auto white balance gains adopted last are kept as the settings.
  */
 void WhiteBalanceGain::EndProcess() {
   DEBUG_PRINT("WhiteBalanceGain::EndProcess) \n");
-  /* Do nothing. */
+  if (is_link_adopted_) {
+    white_balance_gain_wnd_->SetTextCtrlValue(WhiteBalanceGainRedValue(),
+                                              WhiteBalanceGainBlueValue());
+    is_link_adopted_ = false;
+  }
 }
 
 /**
@@ -88,6 +97,8 @@ void WhiteBalanceGain::DoPostProcess(void) {
 /**
  * @brief
  * Main routine of the Whitebalancegain plugin.
+ * The gains published by an auto white balance (WhiteBalanceLink) replace
+ * the manual ones.
  * @param src_ipl [in] src image data.
  * @param dst_ipl [out] dst image data.
  * @return If true, success in the main processing
@@ -98,7 +109,7 @@ bool WhiteBalanceGain::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
   int first_pixel = common_->first_pixel();
   int first_pixel_height;
   int first_pixel_width;
-  int byte, byte_max;
+  int byte;
   int start_x, start_y, end_x, end_y;
   double sum_R = 0;
   double sum_GR = 0;
@@ -131,15 +142,20 @@ bool WhiteBalanceGain::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
 
   if (src_image->depth() == CV_8U) {
     byte = 1;
-    byte_max = 0xFF;
   } else if (src_image->depth() == CV_16U) {
     byte = 2;
-    byte_max = 0x03FF;
   }
 
   // one push.
+  FrameMetadata* metadata = frame_metadata();
   if (one_push_ == true) {
-    CvRect one_push_rect = common_->GetOnepushRectangle();
+    // The rectangle captured with the frame is preferred to the current one.
+    CvRect one_push_rect;
+    if (metadata != NULL && metadata->has_onepush_rect) {
+      one_push_rect = metadata->onepush_rect;
+    } else {
+      one_push_rect = common_->GetOnepushRectangle();
+    }
     start_x = one_push_rect.x;
     start_y = one_push_rect.y;
     end_x = one_push_rect.width;
@@ -210,6 +226,13 @@ bool WhiteBalanceGain::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
       ave_R = sum_R / count_R;
       ave_B = sum_B / count_B;
       ave_G = ((sum_GR / count_GR) + (sum_GB / count_GB)) / 2.0;
+      if (metadata != NULL) {
+        metadata->white_balance.valid = true;
+        metadata->white_balance.rect = cvRect(start_x, start_y, end_x, end_y);
+        metadata->white_balance.average_r = ave_R;
+        metadata->white_balance.average_g = ave_G;
+        metadata->white_balance.average_b = ave_B;
+      }
     }
 
     // Calculate correction value based on green.
@@ -221,6 +244,16 @@ bool WhiteBalanceGain::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
                                                 WhiteBalanceGainBlueValue());
     }
   }
+  // Gains of the auto white balance. The window is updated at the end of
+  // the capture, not on every change.
+  float link_red, link_blue;
+  if (WhiteBalanceLink::Instance()->Poll(&link_sequence_, &link_red,
+                                         &link_blue)) {
+    white_balanace_gain_red_value_ = link_red;
+    white_balanace_gain_blue_value_ = link_blue;
+    is_link_adopted_ = true;
+  }
+
   float red_value = white_balanace_gain_red_value_;
   if (red_value < 0x00) {
     DEBUG_PRINT("Failed to white balance gain red value\n");
@@ -231,103 +264,30 @@ bool WhiteBalanceGain::DoProcess(cv::Mat* src_image, cv::Mat* dst_image) {
     DEBUG_PRINT("Failed to white balance gain blue value\n");
     blue_value = static_cast<float>(kWhiteBalanceGainDefaultValue);
   }
+  if (metadata != NULL) {
+    metadata->white_balance.gain_r = red_value;
+    metadata->white_balance.gain_g =
+        static_cast<float>(kWhiteBalanceGainDefaultValue);
+    metadata->white_balance.gain_b = blue_value;
+  }
 
-  // White balance gain.
-  if (src_image->depth() == CV_8U) {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i = 0; i < src_image->rows; i++) {
-      for (int j = 0; j < src_image->cols; j++) {
-        char* bayer_image_calc;
-        bayer_image_calc = reinterpret_cast<char*>(
-            &src_image->data[i * src_image->step + j * byte]);
-        if (i % 2 == first_pixel_height) {
-          if (j % 2 == first_pixel_width) {  // Red
-            if (((signed int)((*bayer_image_calc) - ob_clamp) * red_value) <=
-                0x00) {
-              *bayer_image_calc = 0x00;
-              continue;
-            } else if (((signed int)((*bayer_image_calc) - ob_clamp) * red_value) >= byte_max) {
-              *bayer_image_calc = byte_max;
-              continue;
-            }
-            *bayer_image_calc =
-                ((*bayer_image_calc) - ob_clamp) * red_value;
-          } else {  // Green
-            //*bayer_image_calc =
-            //    ((*bayer_image_calc) - ob_clamp);
-            *bayer_image_calc =
-                ((*bayer_image_calc) - ((*bayer_image_calc<=ob_clamp)?(*bayer_image_calc):ob_clamp));
-          }
-        } else {
-          if (j % 2 == first_pixel_width) {  // Green
-            //*bayer_image_calc =
-            //    ((*bayer_image_calc) - ob_clamp);
-            *bayer_image_calc =
-                ((*bayer_image_calc) - ((*bayer_image_calc<=ob_clamp)?(*bayer_image_calc):ob_clamp));
-          } else {  // Blue
-            if (((signed int)((*bayer_image_calc) - ob_clamp) * blue_value) <=
-                0x00) {
-              *bayer_image_calc = 0x00;
-              continue;
-            } else if (((signed int)((*bayer_image_calc) - ob_clamp) * blue_value) >= byte_max) {
-              *bayer_image_calc = byte_max;
-              continue;
-            }
-            //*bayer_image_calc =
-            //    ((*bayer_image_calc) - ob_clamp) * blue_value;
-            *bayer_image_calc =
-                ((*bayer_image_calc) - ((*bayer_image_calc<=ob_clamp)?(*bayer_image_calc):ob_clamp)) * blue_value;
-
-          }
-        }
-      }
-    }
-  } else if (src_image->depth() == CV_16U) {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i = 0; i < src_image->rows; i++) {
-      for (int j = 0; j < src_image->cols; j++) {
-        INT16* bayer_image_calc;
-        bayer_image_calc = reinterpret_cast<INT16*>(
-            &src_image->data[i * src_image->step + j * byte]);
-        if (i % 2 == first_pixel_height) {
-          if (j % 2 == first_pixel_width) {  // Red
-            if (((signed int)((*bayer_image_calc) - ob_clamp) * red_value) <=
-                0x00) {
-              *bayer_image_calc = 0x00;
-              continue;
-            } else if (((signed int)((*bayer_image_calc) - ob_clamp) * red_value) >= byte_max) {
-              *bayer_image_calc = byte_max;
-              continue;
-            }
-            *bayer_image_calc =
-                ((*bayer_image_calc) - ob_clamp) * red_value;
-          } else {  // Green
-            *bayer_image_calc =
-                ((*bayer_image_calc) - ((*bayer_image_calc<=ob_clamp)?(*bayer_image_calc):ob_clamp));
-          }
-        } else {
-          if (j % 2 == first_pixel_width) {  // Green
-            *bayer_image_calc =
-                ((*bayer_image_calc) - ((*bayer_image_calc<=ob_clamp)?(*bayer_image_calc):ob_clamp));
-          } else {  // Blue
-            if (((signed int)((*bayer_image_calc) - ob_clamp) * blue_value) <=
-                0x00) {
-              *bayer_image_calc = 0x00;
-              continue;
-            } else if (((signed int)((*bayer_image_calc) - ob_clamp) * blue_value) >= byte_max) {
-              *bayer_image_calc = byte_max;
-              continue;
-            }
-            *bayer_image_calc =
-                ((*bayer_image_calc) - ((*bayer_image_calc<=ob_clamp)?(*bayer_image_calc):ob_clamp)) * blue_value;
-          }
-        }
-      }
-    }
+  // White balance gain. The green pixels only lose the optical black; the
+  // red and blue ones are also multiplied. Each is one table lookup.
+  int red = first_pixel_height * 2 + first_pixel_width;
+  int blue = (1 - first_pixel_height) * 2 + (1 - first_pixel_width);
+  float gains[kBayerGainLutChannels];
+  int offsets[kBayerGainLutChannels];
+  for (int i = 0; i < kBayerGainLutChannels; i++) {
+    gains[i] = static_cast<float>(kWhiteBalanceGainDefaultValue);
+    offsets[i] = 0;
+  }
+  gains[red] = red_value;
+  gains[blue] = blue_value;
+  gain_lut_.SetTransfer(ob_clamp, gains, offsets);
+  if (gain_lut_.Apply(src_image) == false) {
+    DEBUG_PRINT("WhiteBalanceGain: unsupported image type:%d\n",
+                src_image->type());
+    return false;
   }
 
   return true;
@@ -9,7 +9,9 @@
 #define _WHITE_BALANCE_GAIN_H_
 
 #include <vector>
+#include "./bayer_gain_lut.h"
 #include "./plugin_base.h"
+#include "./white_balance_link.h"
 #include "./whitebalancegain_define.h"
 #include "./whitebalancegain_wnd.h"
 
@@ -31,8 +33,14 @@ class WhiteBalanceGain : public PluginBase {
   float white_balanace_gain_blue_value_;
   /*! Whether use one push */
   bool one_push_;
+  /*! Sequence number of the auto white balance gains seen last */
+  unsigned int link_sequence_;
+  /*! Whether auto white balance gains were adopted in this capture */
+  bool is_link_adopted_;
   /*! Whether initialization has succeeded */
   bool is_success_initialized_;
+  /*! Transfer functions of the colors with the optical black clamp */
+  BayerGainLut gain_lut_;
 
  public:
   /**
@@ -58,7 +66,7 @@ class WhiteBalanceGain : public PluginBase {
   /**
    * @brief
    * Finalize routine of the Whitebalancegain plugin.
-   * This function is empty implementation.
+   * The auto white balance gains adopted last are kept as the settings.
    */
   virtual void EndProcess(void);
 
@@ -72,6 +80,8 @@ class WhiteBalanceGain : public PluginBase {
   /**
    * @brief
    * Main routine of the Whitebalancegain plugin.
+   * The gains published by an auto white balance (WhiteBalanceLink) replace
+   * the manual ones.
    * @param src_ipl [in] src image data.
    * @param dst_ipl [out] dst image data.
    * @return If true, success in the main processing
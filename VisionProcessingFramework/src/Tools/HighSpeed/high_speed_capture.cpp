@@ -0,0 +1,371 @@
+/**
+ * @file      high_speed_capture.cpp
+ * @brief     Capture of the HighSpeed capture tool.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./high_speed_capture.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+
+extern "C" {
+  int __CCIRegWrite(struct ssp_handle *handle, int address, int data);
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+HighSpeedCapture::HighSpeedCapture(void) {
+  profile_ = NULL;
+  memset(&settings_, 0, sizeof(settings_));
+  handle_ = NULL;
+  frame_bytes_ = 0;
+  frames_ = 0;
+  received_ = 0;
+  dropped_camera_ = 0;
+  dropped_preprocess_ = 0;
+  dropped_writer_ = 0;
+  timerclear(&start_time_);
+  timerclear(&end_time_);
+  sem_init(&done_sem_, 0, 0);
+  is_running_ = false;
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+HighSpeedCapture::~HighSpeedCapture(void) {
+  Close();
+  sem_destroy(&done_sem_);
+}
+
+/**
+ * @brief
+ * Initialize the SSP with a sensor profile.
+ * @param profile_path [in] sensor profile.
+ * @param is_8bit [in] If true, the frames are converted to 8bit Bayer,
+ * else to 16bit Bayer.
+ * @param preprocess_threads [in] number of the SSP preprocess threads.
+ * @return If true, the SSP is initialized.
+ */
+bool HighSpeedCapture::Open(const char *profile_path, bool is_8bit,
+                            int preprocess_threads) {
+  profile_ = profile_cache_.Load(profile_path);
+  if (profile_ == NULL) {
+    fprintf(stderr, "Can not read the profile %s\n", profile_path);
+    return false;
+  }
+  frame_bytes_ = profile_->ImageProperty.Width *
+                 profile_->ImageProperty.Height * (is_8bit ? 1 : 2);
+
+  settings_.lib_settings.NumFrameFIFOSize = kHighSpeedFrameFifoSize;
+  settings_.lib_settings.NumThreadForBuildInPreprocess = preprocess_threads;
+  settings_.lib_settings.frame_drop_cam_user_func = frame_drop_camera;
+  settings_.lib_settings.frame_drop_pre_user_func = frame_drop_preprocess;
+  settings_.lib_settings.fame_preprocess_user_func = frame_preprocess;
+  settings_.frame_preprocess_options.FormatConvertType =
+      is_8bit ? SSP_FRAME_BAYER8 : SSP_FRAME_BAYER16;
+  settings_.frame_preprocess_options.GammaCorrectionEnable = SSP_DISABLE;
+  settings_.camera_settings.PowerOnResetUsec = kHighSpeedPowerOnResetUsec;
+
+  int retval = ssp_initialize(&handle_, profile_, &settings_);
+  if (retval != SSP_SUCCESS) {
+    fprintf(stderr, "Can not initialize the SSP. %x\n", retval);
+    handle_ = NULL;
+    return false;
+  }
+  handle_->user_data = this;
+  printf("Profile: %d x %d @ %d fps %d bits\n", profile_->ImageProperty.Width,
+         profile_->ImageProperty.Height, profile_->ImageProperty.Frequency,
+         profile_->ImageProperty.BayerBits);
+  return true;
+}
+
+/**
+ * @brief
+ * Set the gains and the exposure of the IMX219.
+ * @param analog_gain [in] analog gain register value.
+ * @param digital_gain [in] digital gain register value.
+ * @param exposure [in] coarse integration time (-1: profile value).
+ */
+void HighSpeedCapture::SetExposure(int analog_gain, int digital_gain,
+                                   int exposure) {
+  if (handle_ == NULL) {
+    return;
+  }
+  __CCIRegWrite(handle_, kHighSpeedAnalogGainAddr, analog_gain & 0xFF);
+  __CCIRegWrite(handle_, kHighSpeedDigitalGainAddr1,
+                (digital_gain & 0xFF00) >> 8);
+  __CCIRegWrite(handle_, kHighSpeedDigitalGainAddr2, digital_gain & 0x00FF);
+  if (exposure >= 0) {
+    __CCIRegWrite(handle_, kHighSpeedExposureAddr1, (exposure & 0xFF00) >> 8);
+    __CCIRegWrite(handle_, kHighSpeedExposureAddr2, exposure & 0x00FF);
+  }
+}
+
+/**
+ * @brief
+ * Capture the frames.
+ * @param frames [in] number of the frames.
+ * @param output_dir [in] directory of the raw file and its index.
+ * @param writers [in] number of the writers.
+ * @param max_pending [in] maximum number of the frames waiting to be
+ * written.
+ * @return If true, the streaming started.
+ */
+bool HighSpeedCapture::Run(int frames, const std::string &output_dir,
+                           int writers, int max_pending) {
+  if (handle_ == NULL || frames <= 0) {
+    return false;
+  }
+  frames_ = frames;
+  received_ = 0;
+  dropped_camera_ = 0;
+  dropped_preprocess_ = 0;
+  dropped_writer_ = 0;
+  struct timeval zero;
+  timerclear(&zero);
+  capture_times_.assign(frames_, zero);
+  is_queued_.assign(frames_, 0);
+  while (sem_trywait(&done_sem_) == 0) {
+  }
+
+  gettimeofday(&start_time_, NULL);
+  char file_name[64];
+  snprintf(file_name, sizeof(file_name), "/%s_%ld", kHighSpeedFilePrefix,
+           static_cast<long>(start_time_.tv_sec));  // NOLINT
+  std::string base_path = output_dir + file_name;
+  if (writers_.Start(base_path + ".raw", frame_bytes_, writers,
+                     max_pending) == false) {
+    return false;
+  }
+
+  is_running_ = true;
+  int retval = ssp_start_streaming(handle_);
+  if (retval != SSP_SUCCESS) {
+    fprintf(stderr, "Can not start streaming. %x\n", retval);
+    is_running_ = false;
+    writers_.Stop();
+    return false;
+  }
+  printf("Recording %d frames to %s.raw\n", frames_, base_path.c_str());
+
+  // Sleep until the last frame or a stop request, waking up only for the
+  // progress line.
+  while (true) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += kHighSpeedProgressMsec / 1000;
+    deadline.tv_nsec += (kHighSpeedProgressMsec % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+      deadline.tv_sec++;
+      deadline.tv_nsec -= 1000000000L;
+    }
+    if (sem_timedwait(&done_sem_, &deadline) == 0) {
+      break;
+    }
+    if (errno == EINTR) {
+      continue;
+    }
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    double elapsed = (now.tv_sec - start_time_.tv_sec) +
+                     (now.tv_usec - start_time_.tv_usec) / 1000000.0;
+    int received = (received_ < frames_) ? received_ : frames_;
+    printf("  frames:%d/%d fps:%.1f pending:%d dropped camera:%u "
+           "preprocess:%u writer:%u\n",
+           received, frames_, received / elapsed, writers_.pending(),
+           dropped_camera_, dropped_preprocess_, dropped_writer_);
+  }
+  is_running_ = false;
+
+  if ((retval = ssp_stop_streaming(handle_)) != SSP_SUCCESS) {
+    fprintf(stderr, "Can not stop streaming. %x\n", retval);
+  }
+  ssp_flush_event(handle_);
+  writers_.Stop();
+  gettimeofday(&end_time_, NULL);
+  WriteIndex(base_path + ".csv");
+  return true;
+}
+
+/**
+ * @brief
+ * Request the end of the capture (safe in a signal handler).
+ */
+void HighSpeedCapture::Stop(void) { sem_post(&done_sem_); }
+
+/**
+ * @brief
+ * Print the statistics of the last capture.
+ */
+void HighSpeedCapture::PrintReport(void) {
+  int captured = (received_ < frames_) ? received_ : frames_;
+  double period_msec = 0;
+  if (profile_ != NULL && profile_->ImageProperty.Frequency > 0) {
+    period_msec = 1000.0 / profile_->ImageProperty.Frequency;
+  }
+
+  // Frame intervals, from the times the frames reached the preprocess.
+  LatencyHistogram intervals;
+  unsigned int gaps = 0;
+  for (int i = 1; i < captured; i++) {
+    double msec =
+        (capture_times_[i].tv_sec - capture_times_[i - 1].tv_sec) * 1000.0 +
+        (capture_times_[i].tv_usec - capture_times_[i - 1].tv_usec) / 1000.0;
+    intervals.Add(msec);
+    if (period_msec > 0 && msec > period_msec * kHighSpeedGapRatio) {
+      gaps++;
+    }
+  }
+  double sustained_fps = 0;
+  if (captured > 1) {
+    double msec = (capture_times_[captured - 1].tv_sec -
+                   capture_times_[0].tv_sec) * 1000.0 +
+                  (capture_times_[captured - 1].tv_usec -
+                   capture_times_[0].tv_usec) / 1000.0;
+    if (msec > 0) {
+      sustained_fps = (captured - 1) * 1000.0 / msec;
+    }
+  }
+  double elapsed = (end_time_.tv_sec - start_time_.tv_sec) +
+                   (end_time_.tv_usec - start_time_.tv_usec) / 1000000.0;
+  double written_mb =
+      static_cast<double>(writers_.written()) * frame_bytes_ / (1024 * 1024);
+
+  printf("Completed.\n");
+  printf("  frames:%d/%d sustained fps:%.1f (profile %d)\n", captured,
+         frames_, sustained_fps,
+         (profile_ != NULL) ? profile_->ImageProperty.Frequency : 0);
+  printf("  interval avg:%.3fms p50:%.3fms p99:%.3fms max:%.3fms "
+         "gaps:%u\n",
+         intervals.average_msec(), intervals.Percentile(0.5),
+         intervals.Percentile(0.99), intervals.max_msec(), gaps);
+  printf("  dropped camera:%u preprocess:%u writer:%u write failed:%u\n",
+         dropped_camera_, dropped_preprocess_, dropped_writer_,
+         writers_.failed());
+  printf("  written:%u frames %.1fMB (%.1fMB/s) max pending:%d\n",
+         writers_.written(), written_mb,
+         (elapsed > 0) ? written_mb / elapsed : 0.0,
+         writers_.max_pending_seen());
+}
+
+/**
+ * @brief
+ * Finalize the SSP.
+ */
+void HighSpeedCapture::Close(void) {
+  if (handle_ == NULL) {
+    return;
+  }
+  if (ssp_finalize(handle_) != SSP_SUCCESS) {
+    fprintf(stderr, "Error during finalization.\n");
+  }
+  handle_ = NULL;
+}
+
+/**
+ * @brief
+ * Callback function for the acquisition SSP of the frame.
+ * @param handle [in] ssp handle
+ * @param frame [in] ssp frame
+ */
+void HighSpeedCapture::frame_preprocess(struct ssp_handle *handle,
+                                        struct ssp_frame *frame) {
+  HighSpeedCapture *capture =
+      static_cast<HighSpeedCapture *>(handle->user_data);
+  if (capture == NULL) {
+    ssp_release_frame(frame);
+    return;
+  }
+  capture->ReceiveFrame(frame);
+}
+
+/**
+ * @brief
+ * Callback function for the frame dropped by the camera.
+ * @param handle [in] ssp handle
+ */
+void HighSpeedCapture::frame_drop_camera(struct ssp_handle *handle) {
+  HighSpeedCapture *capture =
+      static_cast<HighSpeedCapture *>(handle->user_data);
+  if (capture != NULL && capture->is_running_) {
+    __sync_add_and_fetch(&capture->dropped_camera_, 1);
+  }
+}
+
+/**
+ * @brief
+ * Callback function for the frame dropped at the preprocess.
+ * @param handle [in] ssp handle
+ */
+void HighSpeedCapture::frame_drop_preprocess(struct ssp_handle *handle) {
+  HighSpeedCapture *capture =
+      static_cast<HighSpeedCapture *>(handle->user_data);
+  if (capture != NULL && capture->is_running_) {
+    __sync_add_and_fetch(&capture->dropped_preprocess_, 1);
+  }
+}
+
+/**
+ * @brief
+ * Take a frame (SSP preprocess thread).
+ * @param frame [in] ssp frame
+ */
+void HighSpeedCapture::ReceiveFrame(struct ssp_frame *frame) {
+  struct timeval capture_time;
+  gettimeofday(&capture_time, NULL);
+  if (!is_running_) {
+    ssp_release_frame(frame);
+    return;
+  }
+  int index = __sync_fetch_and_add(&received_, 1);
+  if (index >= frames_) {
+    ssp_release_frame(frame);
+    return;
+  }
+  capture_times_[index] = capture_time;
+  if (writers_.Submit(frame, index)) {
+    is_queued_[index] = 1;
+  } else {
+    __sync_add_and_fetch(&dropped_writer_, 1);
+    ssp_release_frame(frame);
+  }
+  if (index == frames_ - 1) {
+    sem_post(&done_sem_);
+  }
+}
+
+/**
+ * @brief
+ * Write the index of the frames captured.
+ * @param file_path [in] index file path.
+ */
+void HighSpeedCapture::WriteIndex(const std::string &file_path) {
+  FILE *file = fopen(file_path.c_str(), "w");
+  if (file == NULL) {
+    fprintf(stderr, "Can not open %s\n", file_path.c_str());
+    return;
+  }
+  fprintf(file, "# width,%d,height,%d,bytes,%d\n",
+          profile_->ImageProperty.Width, profile_->ImageProperty.Height,
+          frame_bytes_);
+  fprintf(file, "index,offset,usec,queued\n");
+  int captured = (received_ < frames_) ? received_ : frames_;
+  for (int i = 0; i < captured; i++) {
+    long usec =  // NOLINT
+        (capture_times_[i].tv_sec - capture_times_[0].tv_sec) * 1000000L +
+        (capture_times_[i].tv_usec - capture_times_[0].tv_usec);
+    fprintf(file, "%d,%ld,%ld,%d\n", i,
+            static_cast<long>(i) * frame_bytes_, usec,  // NOLINT
+            is_queued_[i]);
+  }
+  fclose(file);
+}
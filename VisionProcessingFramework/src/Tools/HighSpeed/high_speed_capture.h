@@ -0,0 +1,185 @@
+/**
+ * @file      high_speed_capture.h
+ * @brief     Capture of the HighSpeed capture tool.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _HIGH_SPEED_CAPTURE_H_
+#define _HIGH_SPEED_CAPTURE_H_
+
+#include <semaphore.h>
+#include <sys/time.h>
+#include <string>
+#include <vector>
+#include "./high_speed_define.h"
+#include "./high_speed_writer.h"
+#include "./latency_histogram.h"
+#include "./sensor_profile_cache.h"
+
+/**
+ * @class HighSpeedCapture
+ * @brief Capture a number of frames at the full rate of a sensor profile
+ * and stream them to the disk.
+ * The SSP is set up as the Sensor plugin does, and its preprocess threads
+ * hand each frame to the writer pool without a copy. The main thread
+ * sleeps until the last frame or a stop request, and only wakes up to
+ * print the progress, so no core is spent waiting.
+ */
+class HighSpeedCapture {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  HighSpeedCapture(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~HighSpeedCapture(void);
+
+  /**
+   * @brief
+   * Initialize the SSP with a sensor profile.
+   * @param profile_path [in] sensor profile.
+   * @param is_8bit [in] If true, the frames are converted to 8bit Bayer,
+   * else to 16bit Bayer.
+   * @param preprocess_threads [in] number of the SSP preprocess threads.
+   * @return If true, the SSP is initialized.
+   */
+  bool Open(const char *profile_path, bool is_8bit, int preprocess_threads);
+
+  /**
+   * @brief
+   * Set the gains and the exposure of the IMX219.
+   * @param analog_gain [in] analog gain register value.
+   * @param digital_gain [in] digital gain register value.
+   * @param exposure [in] coarse integration time (-1: profile value).
+   */
+  void SetExposure(int analog_gain, int digital_gain, int exposure);
+
+  /**
+   * @brief
+   * Capture the frames.
+   * @param frames [in] number of the frames.
+   * @param output_dir [in] directory of the raw file and its index.
+   * @param writers [in] number of the writers.
+   * @param max_pending [in] maximum number of the frames waiting to be
+   * written.
+   * @return If true, the streaming started.
+   */
+  bool Run(int frames, const std::string &output_dir, int writers,
+           int max_pending);
+
+  /**
+   * @brief
+   * Request the end of the capture (safe in a signal handler).
+   */
+  void Stop(void);
+
+  /**
+   * @brief
+   * Print the statistics of the last capture.
+   */
+  void PrintReport(void);
+
+  /**
+   * @brief
+   * Finalize the SSP.
+   */
+  void Close(void);
+
+ private:
+  /**
+   * @brief
+   * Callback function for the acquisition SSP of the frame.
+   * @param handle [in] ssp handle
+   * @param frame [in] ssp frame
+   */
+  static void frame_preprocess(struct ssp_handle *handle,
+                               struct ssp_frame *frame);
+
+  /**
+   * @brief
+   * Callback function for the frame dropped by the camera.
+   * @param handle [in] ssp handle
+   */
+  static void frame_drop_camera(struct ssp_handle *handle);
+
+  /**
+   * @brief
+   * Callback function for the frame dropped at the preprocess.
+   * @param handle [in] ssp handle
+   */
+  static void frame_drop_preprocess(struct ssp_handle *handle);
+
+  /**
+   * @brief
+   * Take a frame (SSP preprocess thread).
+   * @param frame [in] ssp frame
+   */
+  void ReceiveFrame(struct ssp_frame *frame);
+
+  /**
+   * @brief
+   * Write the index of the frames captured.
+   * @param file_path [in] index file path.
+   */
+  void WriteIndex(const std::string &file_path);
+
+  /*! Profiles */
+  SensorProfileCache profile_cache_;
+
+  /*! Profile of the capture */
+  struct ssp_profile *profile_;
+
+  /*! SSP settings */
+  struct ssp_settings settings_;
+
+  /*! SSP handle */
+  struct ssp_handle *handle_;
+
+  /*! Size of a frame */
+  int frame_bytes_;
+
+  /*! Writer pool */
+  HighSpeedWriterPool writers_;
+
+  /*! Number of the frames to capture */
+  int frames_;
+
+  /*! Frames received (index of the next frame) */
+  volatile int received_;
+
+  /*! Capture time of each frame */
+  std::vector<struct timeval> capture_times_;
+
+  /*! Whether each frame was queued to the writers */
+  std::vector<unsigned char> is_queued_;
+
+  /*! Frames dropped by the camera */
+  volatile unsigned int dropped_camera_;
+
+  /*! Frames dropped at the preprocess */
+  volatile unsigned int dropped_preprocess_;
+
+  /*! Frames dropped because the writers are behind */
+  volatile unsigned int dropped_writer_;
+
+  /*! Time of the start of the streaming */
+  struct timeval start_time_;
+
+  /*! Time of the end of the writing */
+  struct timeval end_time_;
+
+  /*! Posted at the last frame and at a stop request (a POSIX semaphore,
+      as it is posted from a signal handler) */
+  sem_t done_sem_;
+
+  /*! Whether the frames are taken */
+  volatile bool is_running_;
+};
+
+#endif /* _HIGH_SPEED_CAPTURE_H_*/
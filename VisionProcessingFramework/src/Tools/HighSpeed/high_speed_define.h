@@ -0,0 +1,44 @@
+/**
+ * @file      high_speed_define.h
+ * @brief     Definition of values for the HighSpeed capture tool.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _HIGH_SPEED_DEFINE_H_
+#define _HIGH_SPEED_DEFINE_H_
+
+/* Default settings*/
+#define kHighSpeedDefaultProfile \
+  "../../../config/sensor/IMX219(640x200@385Hz).xml"
+#define kHighSpeedDefaultFrames 600
+#define kHighSpeedDefaultOutputDir "."
+#define kHighSpeedDefaultWriters 2
+/* One core of a 4 core board is left to the writers and the main thread.*/
+#define kHighSpeedDefaultPreprocessThreads 3
+#define kHighSpeedDefaultPending 256
+#define kHighSpeedMaxWriters 8
+
+/* SSP settings*/
+#define kHighSpeedFrameFifoSize 3
+#define kHighSpeedPowerOnResetUsec 1000000
+
+/* IMX219 exposure registers (as the highspeed sample of the SSP)*/
+#define kHighSpeedAnalogGainAddr 0x157
+#define kHighSpeedDigitalGainAddr1 0x158
+#define kHighSpeedDigitalGainAddr2 0x159
+#define kHighSpeedExposureAddr1 0x15A
+#define kHighSpeedExposureAddr2 0x15B
+#define kHighSpeedDefaultAnalogGain 0xE0
+#define kHighSpeedDefaultDigitalGain 0x0300
+
+/* Progress line interval in msec*/
+#define kHighSpeedProgressMsec 1000
+
+/* An interval longer than this ratio of the frame period is a gap.*/
+#define kHighSpeedGapRatio 1.5
+
+/* Output files*/
+#define kHighSpeedFilePrefix "capture"
+
+#endif /* _HIGH_SPEED_DEFINE_H_*/
@@ -0,0 +1,127 @@
+/**
+ * @file      high_speed_main.cpp
+ * @brief     HighSpeed capture tool.
+ *            Capture frames at the full rate of a sensor profile and stream
+ *            them to the disk (a raw file and its CSV index).
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string>
+#include "./high_speed_capture.h"
+#include "./high_speed_define.h"
+
+/*! Capture stopped by SIGINT */
+static HighSpeedCapture *g_capture = NULL;
+
+/**
+ * @brief
+ * Handler of SIGINT.
+ * @param sig [in] signal.
+ */
+static void signal_handler(int sig) {
+  if (sig == SIGINT && g_capture != NULL) {
+    g_capture->Stop();
+  }
+}
+
+/**
+ * @brief
+ * Print the usage.
+ * @param name [in] program name.
+ */
+static void PrintUsage(const char *name) {
+  printf("Usage: %s [options] [profile_file]\n", name);
+  printf("  -n frames    number of the frames (%d)\n",
+         kHighSpeedDefaultFrames);
+  printf("  -o dir       output directory (%s)\n", kHighSpeedDefaultOutputDir);
+  printf("  -w writers   number of the writer threads (%d)\n",
+         kHighSpeedDefaultWriters);
+  printf("  -t threads   number of the SSP preprocess threads (%d)\n",
+         kHighSpeedDefaultPreprocessThreads);
+  printf("  -q frames    maximum frames waiting for the writers (%d)\n",
+         kHighSpeedDefaultPending);
+  printf("  -a gain      analog gain register (0x%02x)\n",
+         kHighSpeedDefaultAnalogGain);
+  printf("  -d gain      digital gain register (0x%04x)\n",
+         kHighSpeedDefaultDigitalGain);
+  printf("  -e lines     coarse integration time (profile)\n");
+  printf("  -b           16bit Bayer frames (default: 8bit)\n");
+  printf("  profile_file defaults to %s\n", kHighSpeedDefaultProfile);
+}
+
+int main(int argc, char **argv) {
+  int frames = kHighSpeedDefaultFrames;
+  std::string output_dir = kHighSpeedDefaultOutputDir;
+  int writers = kHighSpeedDefaultWriters;
+  int preprocess_threads = kHighSpeedDefaultPreprocessThreads;
+  int max_pending = kHighSpeedDefaultPending;
+  int analog_gain = kHighSpeedDefaultAnalogGain;
+  int digital_gain = kHighSpeedDefaultDigitalGain;
+  int exposure = -1;
+  bool is_8bit = true;
+
+  int option;
+  while ((option = getopt(argc, argv, "n:o:w:t:q:a:d:e:bh")) != -1) {
+    switch (option) {
+      case 'n':
+        frames = atoi(optarg);
+        break;
+      case 'o':
+        output_dir = optarg;
+        break;
+      case 'w':
+        writers = atoi(optarg);
+        break;
+      case 't':
+        preprocess_threads = atoi(optarg);
+        break;
+      case 'q':
+        max_pending = atoi(optarg);
+        break;
+      case 'a':
+        analog_gain = strtol(optarg, NULL, 0);
+        break;
+      case 'd':
+        digital_gain = strtol(optarg, NULL, 0);
+        break;
+      case 'e':
+        exposure = strtol(optarg, NULL, 0);
+        break;
+      case 'b':
+        is_8bit = false;
+        break;
+      default:
+        PrintUsage(argv[0]);
+        return 1;
+    }
+  }
+  const char *profile_path =
+      (optind < argc) ? argv[optind] : kHighSpeedDefaultProfile;
+  if (frames <= 0 || writers <= 0 || writers > kHighSpeedMaxWriters ||
+      preprocess_threads <= 0 || max_pending <= 0) {
+    PrintUsage(argv[0]);
+    return 1;
+  }
+
+  HighSpeedCapture capture;
+  if (capture.Open(profile_path, is_8bit, preprocess_threads) == false) {
+    return 1;
+  }
+  capture.SetExposure(analog_gain, digital_gain, exposure);
+
+  g_capture = &capture;
+  signal(SIGINT, signal_handler);
+  bool ret = capture.Run(frames, output_dir, writers, max_pending);
+  signal(SIGINT, SIG_DFL);
+  g_capture = NULL;
+  if (ret) {
+    capture.PrintReport();
+  }
+  capture.Close();
+  return ret ? 0 : 1;
+}
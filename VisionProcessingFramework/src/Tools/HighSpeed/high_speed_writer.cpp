@@ -0,0 +1,204 @@
+/**
+ * @file      high_speed_writer.cpp
+ * @brief     Writer pool of the HighSpeed capture tool.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./high_speed_writer.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string>
+
+/**
+ * @brief
+ * Constructor.
+ */
+HighSpeedWriterPool::HighSpeedWriterPool(void) {
+  pthread_mutex_init(&jobs_mutex_, NULL);
+  sem_init(&jobs_sem_, 0, 0);
+  fd_ = -1;
+  frame_bytes_ = 0;
+  max_pending_ = 0;
+  max_pending_seen_ = 0;
+  written_ = 0;
+  failed_ = 0;
+  stop_flag_ = false;
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+HighSpeedWriterPool::~HighSpeedWriterPool(void) {
+  Stop();
+  sem_destroy(&jobs_sem_);
+  pthread_mutex_destroy(&jobs_mutex_);
+}
+
+/**
+ * @brief
+ * Writer thread entry point.
+ * @param arg [in] writer pool.
+ * @return NULL.
+ */
+void *HighSpeedWriterPool::WriterEntry(void *arg) {
+  HighSpeedWriterPool *pool = static_cast<HighSpeedWriterPool *>(arg);
+  HighSpeedJob job;
+  while (pool->Take(&job)) {
+    pool->Write(job);
+  }
+  return NULL;
+}
+
+/**
+ * @brief
+ * Open the file and start the writers.
+ * @param file_path [in] raw file path.
+ * @param frame_bytes [in] size of a frame in the file.
+ * @param writers [in] number of the writers.
+ * @param max_pending [in] maximum number of the frames waiting.
+ * @return If true, the writers are running.
+ */
+bool HighSpeedWriterPool::Start(const std::string &file_path,
+                                int frame_bytes, int writers,
+                                int max_pending) {
+  fd_ = open(file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd_ < 0) {
+    fprintf(stderr, "Can not open %s\n", file_path.c_str());
+    return false;
+  }
+  frame_bytes_ = frame_bytes;
+  max_pending_ = max_pending;
+  max_pending_seen_ = 0;
+  written_ = 0;
+  failed_ = 0;
+  stop_flag_ = false;
+
+  for (int i = 0; i < writers; i++) {
+    pthread_t writer;
+    if (pthread_create(&writer, NULL, WriterEntry, this) != 0) {
+      fprintf(stderr, "Can not start the writer %d\n", i);
+      break;
+    }
+    writers_.push_back(writer);
+  }
+  if (writers_.empty()) {
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Write all the frames waiting, then stop the writers and close the file.
+ */
+void HighSpeedWriterPool::Stop(void) {
+  if (fd_ < 0) {
+    return;
+  }
+  // Each writer leaves once it is woken up with nothing left to write.
+  stop_flag_ = true;
+  for (unsigned int i = 0; i < writers_.size(); i++) {
+    sem_post(&jobs_sem_);
+  }
+  for (unsigned int i = 0; i < writers_.size(); i++) {
+    pthread_join(writers_[i], NULL);
+  }
+  writers_.clear();
+  close(fd_);
+  fd_ = -1;
+}
+
+/**
+ * @brief
+ * Queue a frame (SSP preprocess thread).
+ * @param frame [in] SSP frame, released by the pool if accepted.
+ * @param index [in] index of the frame in the capture.
+ * @return If false, too many frames are waiting: the frame is not taken.
+ */
+bool HighSpeedWriterPool::Submit(struct ssp_frame *frame, int index) {
+  pthread_mutex_lock(&jobs_mutex_);
+  int pending = static_cast<int>(jobs_.size());
+  if (stop_flag_ || pending >= max_pending_) {
+    pthread_mutex_unlock(&jobs_mutex_);
+    return false;
+  }
+  HighSpeedJob job;
+  job.frame = frame;
+  job.index = index;
+  jobs_.push_back(job);
+  if (pending + 1 > max_pending_seen_) {
+    max_pending_seen_ = pending + 1;
+  }
+  pthread_mutex_unlock(&jobs_mutex_);
+  sem_post(&jobs_sem_);
+  return true;
+}
+
+/**
+ * @brief
+ * Get the number of the frames waiting.
+ * @return number of the frames.
+ */
+int HighSpeedWriterPool::pending(void) {
+  pthread_mutex_lock(&jobs_mutex_);
+  int pending = static_cast<int>(jobs_.size());
+  pthread_mutex_unlock(&jobs_mutex_);
+  return pending;
+}
+
+/**
+ * @brief
+ * Wait for a frame to write (writer thread).
+ * @param job [out] frame.
+ * @return If false, the pool is stopping and nothing is left to write.
+ */
+bool HighSpeedWriterPool::Take(HighSpeedJob *job) {
+  while (sem_wait(&jobs_sem_) != 0 && errno == EINTR) {
+  }
+  pthread_mutex_lock(&jobs_mutex_);
+  bool is_job = !jobs_.empty();
+  if (is_job) {
+    *job = jobs_.front();
+    jobs_.pop_front();
+  }
+  pthread_mutex_unlock(&jobs_mutex_);
+  return is_job;
+}
+
+/**
+ * @brief
+ * Write a frame and release it (writer thread).
+ * @param job [in] frame.
+ */
+void HighSpeedWriterPool::Write(const HighSpeedJob &job) {
+  int size = 0;
+  ssp_get_frame_size(job.frame, &size);
+  if (size > frame_bytes_) {
+    size = frame_bytes_;
+  }
+  off_t offset = static_cast<off_t>(job.index) * frame_bytes_;
+  const unsigned char *data = ssp_get_frame_data(job.frame);
+  bool is_written = true;
+  int done = 0;
+  while (done < size) {
+    ssize_t ret = pwrite(fd_, data + done, size - done, offset + done);
+    if (ret <= 0) {
+      is_written = false;
+      break;
+    }
+    done += static_cast<int>(ret);
+  }
+  ssp_release_frame(job.frame);
+  if (is_written) {
+    __sync_add_and_fetch(&written_, 1);
+  } else {
+    __sync_add_and_fetch(&failed_, 1);
+  }
+}
@@ -0,0 +1,167 @@
+/**
+ * @file      high_speed_writer.h
+ * @brief     Writer pool of the HighSpeed capture tool.
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _HIGH_SPEED_WRITER_H_
+#define _HIGH_SPEED_WRITER_H_
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <deque>
+#include <string>
+#include <vector>
+#include "./high_speed_define.h"
+#include "./sensor_profile_cache.h"
+
+/**
+ * @struct HighSpeedJob
+ * @brief Frame to write.
+ */
+typedef struct {
+  /*! SSP frame (released by the writer) */
+  struct ssp_frame *frame;
+  /*! Index of the frame in the capture */
+  int index;
+} HighSpeedJob;
+
+/**
+ * @class HighSpeedWriterPool
+ * @brief Threads which stream the frames to the disk during the capture.
+ * The SSP frames are written as they are, without a copy, and released by
+ * the writer. All the frames go to one file, each at the offset of its
+ * index, so the writers never wait for each other and the file is in the
+ * order of the capture. The writers sleep on a semaphore while there is
+ * nothing to write. The writers are plain POSIX threads, so the tool
+ * does not need wxWidgets.
+ */
+class HighSpeedWriterPool {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  HighSpeedWriterPool(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~HighSpeedWriterPool(void);
+
+  /**
+   * @brief
+   * Open the file and start the writers.
+   * @param file_path [in] raw file path.
+   * @param frame_bytes [in] size of a frame in the file.
+   * @param writers [in] number of the writers.
+   * @param max_pending [in] maximum number of the frames waiting.
+   * @return If true, the writers are running.
+   */
+  bool Start(const std::string &file_path, int frame_bytes, int writers,
+             int max_pending);
+
+  /**
+   * @brief
+   * Write all the frames waiting, then stop the writers and close the file.
+   */
+  void Stop(void);
+
+  /**
+   * @brief
+   * Queue a frame (SSP preprocess thread).
+   * @param frame [in] SSP frame, released by the pool if accepted.
+   * @param index [in] index of the frame in the capture.
+   * @return If false, too many frames are waiting: the frame is not taken.
+   */
+  bool Submit(struct ssp_frame *frame, int index);
+
+  /**
+   * @brief
+   * Get the number of the frames written.
+   * @return number of the frames.
+   */
+  unsigned int written(void) const { return written_; }
+
+  /**
+   * @brief
+   * Get the number of the frames which could not be written.
+   * @return number of the frames.
+   */
+  unsigned int failed(void) const { return failed_; }
+
+  /**
+   * @brief
+   * Get the number of the frames waiting.
+   * @return number of the frames.
+   */
+  int pending(void);
+
+  /**
+   * @brief
+   * Get the maximum number of the frames waiting since the start.
+   * @return number of the frames.
+   */
+  int max_pending_seen(void) const { return max_pending_seen_; }
+
+ private:
+  /**
+   * @brief
+   * Writer thread entry point.
+   * @param arg [in] writer pool.
+   * @return NULL.
+   */
+  static void *WriterEntry(void *arg);
+
+  /**
+   * @brief
+   * Wait for a frame to write (writer thread).
+   * @param job [out] frame.
+   * @return If false, the pool is stopping and nothing is left to write.
+   */
+  bool Take(HighSpeedJob *job);
+
+  /**
+   * @brief
+   * Write a frame and release it (writer thread).
+   * @param job [in] frame.
+   */
+  void Write(const HighSpeedJob &job);
+
+  /*! Writers */
+  std::vector<pthread_t> writers_;
+
+  /*! Frames waiting */
+  std::deque<HighSpeedJob> jobs_;
+
+  /*! Lock for the frames waiting */
+  pthread_mutex_t jobs_mutex_;
+
+  /*! Posted for each frame, and for each writer at the stop */
+  sem_t jobs_sem_;
+
+  /*! Raw file descriptor */
+  int fd_;
+
+  /*! Size of a frame in the file */
+  int frame_bytes_;
+
+  /*! Maximum number of the frames waiting */
+  int max_pending_;
+
+  /*! Maximum number of the frames waiting since the start */
+  int max_pending_seen_;
+
+  /*! Frames written */
+  volatile unsigned int written_;
+
+  /*! Frames which could not be written */
+  volatile unsigned int failed_;
+
+  /*! Stop request */
+  volatile bool stop_flag_;
+};
+
+#endif /* _HIGH_SPEED_WRITER_H_*/
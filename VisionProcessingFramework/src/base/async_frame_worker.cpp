@@ -0,0 +1,236 @@
+/**
+ * @file      async_frame_worker.cpp
+ * @brief     Source for AsyncFrameWorker class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+#include "./async_frame_worker.h"
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief
+ * Constructor.
+ * @param handler [in] frame handler (NOT own it).
+ * @param max_in_flight [in] maximum number of queued and running frames.
+ * @param policy [in] drop policy when the limit is reached.
+ */
+AsyncFrameWorker::AsyncFrameWorker(AsyncFrameHandler* handler,
+                                   int max_in_flight, AsyncDropPolicy policy)
+    : wxThread(wxTHREAD_JOINABLE), condition_(mutex_) {
+  handler_ = handler;
+  max_in_flight_ = (max_in_flight < 1) ? 1 : max_in_flight;
+  policy_ = policy;
+  for (int i = 0; i < max_in_flight_; i++) {
+    pool_.push_back(new cv::Mat());
+    metadata_pool_.push_back(new FrameMetadata);
+  }
+  work_image_ = new cv::Mat();
+  work_metadata_ = new FrameMetadata;
+  head_ = 0;
+  queued_ = 0;
+  processing_ = false;
+  stop_flag_ = false;
+  drain_ = false;
+  is_started_ = false;
+  completed_frames_ = 0;
+  dropped_frames_ = 0;
+  ThreadSchedCountsClear(&sched_counts_);
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+AsyncFrameWorker::~AsyncFrameWorker() {
+  Stop(false);
+  for (unsigned int i = 0; i < pool_.size(); i++) {
+    delete pool_[i];
+    delete metadata_pool_[i];
+  }
+  delete work_image_;
+  delete work_metadata_;
+}
+
+/**
+ * @brief
+ * Create and run the worker thread.
+ * @return If true, the worker thread is running.
+ */
+bool AsyncFrameWorker::Start(void) {
+  if (is_started_) {
+    return true;
+  }
+  if (Create() != wxTHREAD_NO_ERROR) {
+    DEBUG_PRINT("[AsyncFrameWorker] Create failed\n");
+    return false;
+  }
+  if (Run() != wxTHREAD_NO_ERROR) {
+    DEBUG_PRINT("[AsyncFrameWorker] Run failed\n");
+    return false;
+  }
+  is_started_ = true;
+  return true;
+}
+
+/**
+ * @brief
+ * Stop the worker thread and wait for it.
+ * @param drain [in] If true, queued frames are processed before stopping.
+ */
+void AsyncFrameWorker::Stop(bool drain) {
+  if (!is_started_) {
+    return;
+  }
+  {
+    wxMutexLocker lock(mutex_);
+    stop_flag_ = true;
+    drain_ = drain;
+    condition_.Broadcast();
+  }
+  Wait();
+  is_started_ = false;
+}
+
+/**
+ * @brief
+ * Submit a frame. The frame is copied, the caller keeps ownership.
+ * @param image [in] frame to process.
+ * @param metadata [in] metadata of the frame (can be NULL).
+ * @return true, the frame is pending. false, the frame was dropped.
+ */
+bool AsyncFrameWorker::Submit(const cv::Mat& image,
+                              const FrameMetadata* metadata) {
+  wxMutexLocker lock(mutex_);
+  if (stop_flag_) {
+    return false;
+  }
+
+  int in_flight = queued_ + (processing_ ? 1 : 0);
+  if (in_flight >= max_in_flight_) {
+    dropped_frames_++;
+    if (policy_ == kAsyncDropNewest || queued_ == 0) {
+      return false;
+    }
+    // Drop the oldest queued frame and reuse its slot at the tail.
+    head_ = (head_ + 1) % max_in_flight_;
+    queued_--;
+  }
+
+  int tail = (head_ + queued_) % max_in_flight_;
+  // copyTo() reuses the pooled buffer while size and type are unchanged.
+  image.copyTo(*pool_[tail]);
+  FrameMetadataCopy(metadata_pool_[tail], metadata);
+  queued_++;
+  condition_.Signal();
+  return true;
+}
+
+/**
+ * @brief
+ * Whether a new frame is accepted without dropping.
+ * @return true, a frame can be submitted.
+ */
+bool AsyncFrameWorker::CanAccept(void) {
+  wxMutexLocker lock(mutex_);
+  if (policy_ == kAsyncDropOldest) {
+    return true;
+  }
+  return (queued_ + (processing_ ? 1 : 0)) < max_in_flight_;
+}
+
+/**
+ * @brief
+ * Get the number of queued and running frames.
+ * @return number of in-flight frames.
+ */
+int AsyncFrameWorker::in_flight_frames(void) {
+  wxMutexLocker lock(mutex_);
+  return queued_ + (processing_ ? 1 : 0);
+}
+
+/**
+ * @brief
+ * Thread entry point.
+ * @return thread exit code.
+ */
+wxThread::ExitCode AsyncFrameWorker::Entry(void) {
+  DEBUG_PRINT("[AsyncFrameWorker] Start - tid:%d\n", this->GetId());
+  bool is_placed = placer_.Update();
+  {
+    wxMutexLocker lock(mutex_);
+    placement_ = is_placed ? placer_.Describe()
+                           : "failed (" + placer_.error() + ")";
+  }
+  while (1) {
+    {
+      wxMutexLocker lock(mutex_);
+      while (queued_ == 0 && !stop_flag_) {
+        condition_.Wait();
+      }
+      if (stop_flag_ && (!drain_ || queued_ == 0)) {
+        break;
+      }
+    }
+
+    // The handler may wait for its turn (e.g. the display refresh) before
+    // the frame is taken, so the frames submitted meanwhile are queued too.
+    bool is_paced = handler_->PaceAsyncProcess();
+
+    {
+      wxMutexLocker lock(mutex_);
+      if (stop_flag_ && (!drain_ || queued_ == 0)) {
+        break;
+      }
+      if (is_paced) {
+        // Only the newest frame is processed after the wait.
+        while (queued_ > 1) {
+          head_ = (head_ + 1) % max_in_flight_;
+          queued_--;
+          dropped_frames_++;
+        }
+      }
+      // Take the oldest frame out of the ring without copying.
+      std::swap(pool_[head_], work_image_);
+      std::swap(metadata_pool_[head_], work_metadata_);
+      head_ = (head_ + 1) % max_in_flight_;
+      queued_--;
+      processing_ = true;
+    }
+
+    placer_.BeginFrame();
+    bool result = handler_->DoAsyncProcess(work_image_, work_metadata_);
+    handler_->OnAsyncComplete(result);
+    placer_.EndFrame();
+
+    {
+      wxMutexLocker lock(mutex_);
+      processing_ = false;
+      completed_frames_++;
+      sched_counts_ = placer_.counts();
+    }
+  }
+  DEBUG_PRINT("[AsyncFrameWorker] end - tid:%d\n", this->GetId());
+  return (wxThread::ExitCode)0;
+}
+
+/**
+ * @brief
+ * Get the scheduling events of the worker thread while it processed the
+ * frames.
+ * @return scheduling events.
+ */
+ThreadSchedCounts AsyncFrameWorker::sched_counts(void) {
+  wxMutexLocker lock(mutex_);
+  return sched_counts_;
+}
+
+/**
+ * @brief
+ * Get the placement of the worker thread.
+ * @return placement, or the reason why it failed.
+ */
+std::string AsyncFrameWorker::placement(void) {
+  wxMutexLocker lock(mutex_);
+  return placement_;
+}
@@ -0,0 +1,252 @@
+/**
+ * @file      async_frame_worker.h
+ * @brief     Header for AsyncFrameWorker class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _ASYNC_FRAME_WORKER_H_
+#define _ASYNC_FRAME_WORKER_H_
+
+#include <string>
+#include <vector>
+#include "./include.h"
+#include "./frame_metadata.h"
+#include "./thread_placement.h"
+
+/* Default number of frames a plugin may keep in flight. */
+#define kAsyncDefaultMaxInFlight 2
+
+/**
+ * @enum AsyncDropPolicy
+ * @brief What to do with a new frame when the in-flight limit is reached.
+ */
+typedef enum {
+  /*! Reject the incoming frame (keeps every accepted frame). */
+  kAsyncDropNewest = 0,
+  /*! Replace the oldest queued frame (keeps the latest frame). */
+  kAsyncDropOldest,
+} AsyncDropPolicy;
+
+/**
+ * @class AsyncFrameHandler
+ * @brief Interface implemented by plugins that complete frames
+ * asynchronously.
+ */
+class AsyncFrameHandler {
+ public:
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~AsyncFrameHandler(void) {}
+
+  /**
+   * @brief
+   * Process one frame on the worker thread.
+   * @param image [in] frame owned by the worker pool.
+   * @param metadata [in] metadata of the frame owned by the worker pool.
+   * @return If true, success in the processing.
+   */
+  virtual bool DoAsyncProcess(cv::Mat* image, FrameMetadata* metadata) = 0;
+
+  /**
+   * @brief
+   * Pacing hook, called on the worker thread once a frame is queued and
+   * before it is taken out of the queue. A handler which waits here gets
+   * the newest frame queued at the end of the wait; the older ones are
+   * dropped.
+   * @return If true, the handler waited.
+   */
+  virtual bool PaceAsyncProcess(void) { return false; }
+
+  /**
+   * @brief
+   * Completion callback, called on the worker thread after DoAsyncProcess.
+   * @param result [in] return value of DoAsyncProcess.
+   */
+  virtual void OnAsyncComplete(bool result) {}
+};
+
+/**
+ * @class AsyncFrameWorker
+ * @brief Worker thread which completes frames submitted by DoProcess.
+ * Submitted frames are copied into a pooled ring whose depth is the in-flight
+ * limit, so the main flow never waits on the consumer.
+ */
+class AsyncFrameWorker : public wxThread {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   * @param handler [in] frame handler (NOT own it).
+   * @param max_in_flight [in] maximum number of queued and running frames.
+   * @param policy [in] drop policy when the limit is reached.
+   */
+  AsyncFrameWorker(AsyncFrameHandler* handler, int max_in_flight,
+                   AsyncDropPolicy policy);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~AsyncFrameWorker(void);
+
+  /**
+   * @brief
+   * Set the name of the worker thread (key of the ThreadPlacementTable).
+   * Called before Start().
+   * @param name [in] thread name.
+   */
+  void set_thread_name(const std::string& name) { placer_.set_name(name); }
+
+  /**
+   * @brief
+   * Create and run the worker thread.
+   * @return If true, the worker thread is running.
+   */
+  bool Start(void);
+
+  /**
+   * @brief
+   * Stop the worker thread and wait for it.
+   * @param drain [in] If true, queued frames are processed before stopping.
+   */
+  void Stop(bool drain);
+
+  /**
+   * @brief
+   * Submit a frame. The frame is copied, the caller keeps ownership.
+   * @param image [in] frame to process.
+   * @param metadata [in] metadata of the frame (can be NULL).
+   * @return true, the frame is pending. false, the frame was dropped.
+   */
+  bool Submit(const cv::Mat& image, const FrameMetadata* metadata);
+
+  /**
+   * @brief
+   * Whether a new frame is accepted without dropping.
+   * @return true, a frame can be submitted.
+   */
+  bool CanAccept(void);
+
+  /**
+   * @brief
+   * Get the number of queued and running frames.
+   * @return number of in-flight frames.
+   */
+  int in_flight_frames(void);
+
+  /**
+   * @brief
+   * Get the in-flight limit.
+   * @return maximum number of in-flight frames.
+   */
+  int max_in_flight_frames(void) { return max_in_flight_; }
+
+  /**
+   * @brief
+   * Get the drop policy.
+   * @return drop policy.
+   */
+  AsyncDropPolicy drop_policy(void) { return policy_; }
+
+  /**
+   * @brief
+   * Get the number of completed frames.
+   * @return number of completed frames.
+   */
+  unsigned int completed_frames(void) { return completed_frames_; }
+
+  /**
+   * @brief
+   * Get the number of dropped frames.
+   * @return number of dropped frames.
+   */
+  unsigned int dropped_frames(void) { return dropped_frames_; }
+
+  /**
+   * @brief
+   * Get the scheduling events of the worker thread while it processed the
+   * frames.
+   * @return scheduling events.
+   */
+  ThreadSchedCounts sched_counts(void);
+
+  /**
+   * @brief
+   * Get the placement of the worker thread.
+   * @return placement, or the reason why it failed.
+   */
+  std::string placement(void);
+
+ private:
+  /**
+   * @brief
+   * Thread entry point.
+   * @return thread exit code.
+   */
+  virtual wxThread::ExitCode Entry(void);
+
+  /*! Frame handler (NOT own it) */
+  AsyncFrameHandler* handler_;
+
+  /*! Maximum number of queued and running frames */
+  int max_in_flight_;
+
+  /*! Drop policy */
+  AsyncDropPolicy policy_;
+
+  /*! Pooled frame ring */
+  std::vector<cv::Mat*> pool_;
+
+  /*! Frame owned by the worker while it is processed */
+  cv::Mat* work_image_;
+
+  /*! Pooled metadata ring (paired with pool_) */
+  std::vector<FrameMetadata*> metadata_pool_;
+
+  /*! Metadata owned by the worker while it is processed */
+  FrameMetadata* work_metadata_;
+
+  /*! Index of the oldest queued frame */
+  int head_;
+
+  /*! Number of queued frames */
+  int queued_;
+
+  /*! Whether a frame is being processed */
+  bool processing_;
+
+  /*! Stop request */
+  bool stop_flag_;
+
+  /*! Process queued frames before stopping */
+  bool drain_;
+
+  /*! Whether the thread is running */
+  bool is_started_;
+
+  /*! Number of completed frames */
+  unsigned int completed_frames_;
+
+  /*! Number of dropped frames */
+  unsigned int dropped_frames_;
+
+  /*! Placement and scheduling monitor (worker thread only) */
+  ThreadPlacer placer_;
+
+  /*! Scheduling events (copied from placer_ after every frame) */
+  ThreadSchedCounts sched_counts_;
+
+  /*! Placement of the worker thread */
+  std::string placement_;
+
+  /*! Lock for the ring */
+  wxMutex mutex_;
+
+  /*! Signalled when a frame is queued or stop is requested */
+  wxCondition condition_;
+};
+
+#endif /* _ASYNC_FRAME_WORKER_H_*/
@@ -0,0 +1,173 @@
+/**
+ * @file      bayer_gain_lut.cpp
+ * @brief     Source for BayerGainLut class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./bayer_gain_lut.h"
+#include "./pixel_convert.h"
+
+/**
+ * @brief
+ * Apply 2 tables to a row, alternately.
+ * @param even_table [in] table of the even columns.
+ * @param odd_table [in] table of the odd columns.
+ * @param max_index [in] last entry of the tables.
+ * @param cols [in] number of the pixels.
+ * @param row [in,out] row.
+ */
+template <typename T>
+static void ApplyRow(const UINT16* even_table, const UINT16* odd_table,
+                     int max_index, int cols, T* row) {
+  int x = 0;
+  for (; x + 2 <= cols; x += 2) {
+    int even = row[x];
+    int odd = row[x + 1];
+    even = (even > max_index) ? max_index : even;
+    odd = (odd > max_index) ? max_index : odd;
+    row[x] = static_cast<T>(even_table[even]);
+    row[x + 1] = static_cast<T>(odd_table[odd]);
+  }
+  if (x < cols) {
+    int even = row[x];
+    row[x] = static_cast<T>(even_table[(even > max_index) ? max_index : even]);
+  }
+}
+
+/**
+ * @brief
+ * Apply the tables to an image.
+ * @param tables [in] tables of the 4 positions.
+ * @param size [in] number of the entries of a table.
+ * @param image [in,out] Bayer image.
+ */
+template <typename T>
+static void ApplyImage(const UINT16* tables, int size, cv::Mat* image) {
+  int rows = image->rows;
+  int cols = image->cols;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (int y = 0; y < rows; y++) {
+    const UINT16* even_table = tables + (y % 2) * 2 * size;
+    T* row = reinterpret_cast<T*>(image->data + y * image->step);
+    ApplyRow(even_table, even_table + size, size - 1, cols, row);
+  }
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+BayerGainLut::BayerGainLut(void)
+    : bits_(0), optical_black_(0), is_dirty_(true), builds_(0) {
+  for (int i = 0; i < kBayerGainLutChannels; i++) {
+    gains_[i] = 1.0f;
+    offsets_[i] = 0;
+  }
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+BayerGainLut::~BayerGainLut(void) {}
+
+/**
+ * @brief
+ * Set the transfer functions. The tables are rebuilt by the next Apply()
+ * if a value changed.
+ * @param optical_black [in] optical black subtracted from the input.
+ * @param gains [in] gains of the 4 positions.
+ * @param offsets [in] values added after the gain of the 4 positions.
+ */
+void BayerGainLut::SetTransfer(int optical_black, const float* gains,
+                               const int* offsets) {
+  if (optical_black != optical_black_) {
+    optical_black_ = optical_black;
+    is_dirty_ = true;
+  }
+  for (int i = 0; i < kBayerGainLutChannels; i++) {
+    if (gains[i] != gains_[i] || offsets[i] != offsets_[i]) {
+      gains_[i] = gains[i];
+      offsets_[i] = offsets[i];
+      is_dirty_ = true;
+    }
+  }
+}
+
+/**
+ * @brief
+ * Set the same transfer function to the 4 positions.
+ * @param optical_black [in] optical black subtracted from the input.
+ * @param gain [in] gain.
+ * @param offset [in] value added after the gain.
+ */
+void BayerGainLut::SetTransfer(int optical_black, float gain, int offset) {
+  float gains[kBayerGainLutChannels];
+  int offsets[kBayerGainLutChannels];
+  for (int i = 0; i < kBayerGainLutChannels; i++) {
+    gains[i] = gain;
+    offsets[i] = offset;
+  }
+  SetTransfer(optical_black, gains, offsets);
+}
+
+/**
+ * @brief
+ * Apply the tables in place.
+ * @param image [in,out] 8U or 16U single channel Bayer image.
+ * @return If false, the format is not supported.
+ */
+bool BayerGainLut::Apply(cv::Mat* image) {
+  if (image == NULL || image->data == NULL || image->channels() != 1) {
+    return false;
+  }
+  int bits;
+  if (image->depth() == CV_8U) {
+    bits = 8;
+  } else if (image->depth() == CV_16U) {
+    bits = kPixelConvertSensorBits;
+  } else {
+    return false;
+  }
+  if (is_dirty_ || bits != bits_) {
+    Build(bits);
+  }
+
+  int size = 1 << bits_;
+  if (bits_ == 8) {
+    ApplyImage<UINT8>(&tables_[0], size, image);
+  } else {
+    ApplyImage<UINT16>(&tables_[0], size, image);
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Build the tables for a bit depth.
+ * @param bits [in] significant bits of the data.
+ */
+void BayerGainLut::Build(int bits) {
+  int size = 1 << bits;
+  int max_value = size - 1;
+  tables_.resize(kBayerGainLutChannels * size);
+  for (int c = 0; c < kBayerGainLutChannels; c++) {
+    UINT16* table = &tables_[c * size];
+    for (int i = 0; i < size; i++) {
+      float value = (i - optical_black_) * gains_[c] + offsets_[c];
+      if (value <= 0) {
+        table[i] = 0;
+      } else if (value >= max_value) {
+        table[i] = static_cast<UINT16>(max_value);
+      } else {
+        table[i] = static_cast<UINT16>(value);
+      }
+    }
+  }
+  bits_ = bits;
+  is_dirty_ = false;
+  builds_++;
+}
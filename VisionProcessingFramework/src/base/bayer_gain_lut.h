@@ -0,0 +1,106 @@
+/**
+ * @file      bayer_gain_lut.h
+ * @brief     Header for BayerGainLut class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _BAYER_GAIN_LUT_H_
+#define _BAYER_GAIN_LUT_H_
+
+#include <vector>
+#include "./include.h"
+
+/* Number of the positions of the color filter array (2x2). */
+#define kBayerGainLutChannels 4
+
+/**
+ * @class BayerGainLut
+ * @brief Gain and optical black clamp of Bayer data through lookup tables.
+ * Each position of the 2x2 color filter array has its own transfer
+ * function out = clamp((in - optical_black) * gain + offset, 0, max),
+ * computed in float as before, but once per value instead of once per
+ * pixel: 256 entries for 8 bit data, 2^kPixelConvertSensorBits for 16 bit
+ * data. The tables are rebuilt only when the parameters or the depth
+ * change. The position index is (y % 2) * 2 + (x % 2) from the top left
+ * pixel of the image.
+ */
+class BayerGainLut {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  BayerGainLut(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~BayerGainLut(void);
+
+  /**
+   * @brief
+   * Set the transfer functions. The tables are rebuilt by the next Apply()
+   * if a value changed.
+   * @param optical_black [in] optical black subtracted from the input.
+   * @param gains [in] gains of the 4 positions.
+   * @param offsets [in] values added after the gain of the 4 positions.
+   */
+  void SetTransfer(int optical_black, const float* gains, const int* offsets);
+
+  /**
+   * @brief
+   * Set the same transfer function to the 4 positions.
+   * @param optical_black [in] optical black subtracted from the input.
+   * @param gain [in] gain.
+   * @param offset [in] value added after the gain.
+   */
+  void SetTransfer(int optical_black, float gain, int offset);
+
+  /**
+   * @brief
+   * Apply the tables in place.
+   * @param image [in,out] 8U or 16U single channel Bayer image.
+   * @return If false, the format is not supported.
+   */
+  bool Apply(cv::Mat* image);
+
+  /**
+   * @brief
+   * Get the number of the times the tables were built.
+   * @return number of the times.
+   */
+  unsigned int builds(void) const { return builds_; }
+
+ private:
+  /**
+   * @brief
+   * Build the tables for a bit depth.
+   * @param bits [in] significant bits of the data.
+   */
+  void Build(int bits);
+
+  /*! Tables of the 4 positions, (1 << bits_) entries each */
+  std::vector<UINT16> tables_;
+
+  /*! Bit depth of the tables (0: not built) */
+  int bits_;
+
+  /*! Optical black */
+  int optical_black_;
+
+  /*! Gains of the 4 positions */
+  float gains_[kBayerGainLutChannels];
+
+  /*! Offsets of the 4 positions */
+  int offsets_[kBayerGainLutChannels];
+
+  /*! Whether a parameter changed since the last build */
+  bool is_dirty_;
+
+  /*! Number of the builds */
+  unsigned int builds_;
+};
+
+#endif /* _BAYER_GAIN_LUT_H_*/
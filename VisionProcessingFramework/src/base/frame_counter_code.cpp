@@ -0,0 +1,118 @@
+/**
+ * @file      frame_counter_code.cpp
+ * @brief     Source for the frame counter code drawn in the image
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./frame_counter_code.h"
+
+/**
+ * @brief
+ * Get the height of the code band.
+ * @param rows [in] image height.
+ * @return band height in pixels.
+ */
+static int BandHeight(int rows) {
+  int height = rows / kFrameCounterCodeBandDivisor;
+  if (height < kFrameCounterCodeMinBandHeight) {
+    height = kFrameCounterCodeMinBandHeight;
+  }
+  return (height > rows) ? rows : height;
+}
+
+/**
+ * @brief
+ * Get the average level of the center of a cell.
+ * @param image [in] image.
+ * @param index [in] cell index.
+ * @param cell_width [in] cell width in pixels.
+ * @param band_height [in] band height in pixels.
+ * @return average level of all channels.
+ */
+static double CellLevel(const cv::Mat& image, int index, int cell_width,
+                        int band_height) {
+  cv::Rect rect(index * cell_width + cell_width / 4, band_height / 4,
+                cell_width / 2, band_height / 2);
+  if (rect.width < 1) {
+    rect.width = 1;
+  }
+  if (rect.height < 1) {
+    rect.height = 1;
+  }
+  cv::Scalar mean = cv::mean(image(rect));
+  double level = 0.0;
+  for (int i = 0; i < image.channels(); i++) {
+    level += mean[i];
+  }
+  return level / image.channels();
+}
+
+/**
+ * @brief
+ * Draw a frame counter into the top band of an image.
+ * The band is split into equal cells across the width: a white and a black
+ * reference cell followed by the bits (MSB first), so the code survives
+ * scaling, demosaicing and gain/gamma changes of the pipeline.
+ * @param image [in,out] image (any depth and channels).
+ * @param frame_number [in] frame counter.
+ * @param max_value [in] pixel value of the white cells.
+ */
+void FrameCounterCodeEncode(cv::Mat* image, unsigned int frame_number,
+                            int max_value) {
+  int cell_width = image->cols / kFrameCounterCodeCells;
+  if (cell_width < 1 || image->rows < 1) {
+    return;
+  }
+  int band_height = BandHeight(image->rows);
+  cv::Scalar white(max_value, max_value, max_value, max_value);
+  cv::Scalar black(0, 0, 0, 0);
+
+  for (int i = 0; i < kFrameCounterCodeCells; i++) {
+    bool is_white;
+    if (i == 0) {
+      is_white = true;
+    } else if (i == 1) {
+      is_white = false;
+    } else {
+      int bit = kFrameCounterCodeBits - 1 - (i - 2);
+      is_white = ((frame_number >> bit) & 1) != 0;
+    }
+    cv::Mat cell = (*image)(cv::Rect(i * cell_width, 0, cell_width,
+                                     band_height));
+    cell.setTo(is_white ? white : black);
+  }
+}
+
+/**
+ * @brief
+ * Read the frame counter from the top band of an image.
+ * @param image [in] image (any depth and channels).
+ * @param frame_number [out] frame counter.
+ * @return false, no code was found.
+ */
+bool FrameCounterCodeDecode(const cv::Mat& image, unsigned int* frame_number) {
+  int cell_width = image.cols / kFrameCounterCodeCells;
+  if (cell_width < 2 || image.rows < kFrameCounterCodeMinBandHeight) {
+    return false;
+  }
+  int band_height = BandHeight(image.rows);
+
+  double white = CellLevel(image, 0, cell_width, band_height);
+  double black = CellLevel(image, 1, cell_width, band_height);
+  // The reference cells must differ clearly, or the image has no code.
+  if (white - black < white / 4 || white <= 0.0) {
+    return false;
+  }
+  double threshold = (white + black) / 2;
+
+  unsigned int value = 0;
+  for (int i = 0; i < kFrameCounterCodeBits; i++) {
+    value <<= 1;
+    if (CellLevel(image, i + 2, cell_width, band_height) > threshold) {
+      value |= 1;
+    }
+  }
+  *frame_number = value;
+  return true;
+}
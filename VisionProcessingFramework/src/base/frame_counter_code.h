@@ -0,0 +1,47 @@
+/**
+ * @file      frame_counter_code.h
+ * @brief     Header for the frame counter code drawn in the image
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _FRAME_COUNTER_CODE_H_
+#define _FRAME_COUNTER_CODE_H_
+
+#include "./include.h"
+
+/* Number of bits of the frame counter. */
+#define kFrameCounterCodeBits 32
+
+/* Number of cells (white reference, black reference and the bits). */
+#define kFrameCounterCodeCells (kFrameCounterCodeBits + 2)
+
+/* Height of the code band is (image height / kFrameCounterCodeBandDivisor). */
+#define kFrameCounterCodeBandDivisor 16
+
+/* Minimum height of the code band in pixels. */
+#define kFrameCounterCodeMinBandHeight 4
+
+/**
+ * @brief
+ * Draw a frame counter into the top band of an image.
+ * The band is split into equal cells across the width: a white and a black
+ * reference cell followed by the bits (MSB first), so the code survives
+ * scaling, demosaicing and gain/gamma changes of the pipeline.
+ * @param image [in,out] image (any depth and channels).
+ * @param frame_number [in] frame counter.
+ * @param max_value [in] pixel value of the white cells.
+ */
+void FrameCounterCodeEncode(cv::Mat* image, unsigned int frame_number,
+                            int max_value);
+
+/**
+ * @brief
+ * Read the frame counter from the top band of an image.
+ * @param image [in] image (any depth and channels).
+ * @param frame_number [out] frame counter.
+ * @return false, no code was found.
+ */
+bool FrameCounterCodeDecode(const cv::Mat& image, unsigned int* frame_number);
+
+#endif /* _FRAME_COUNTER_CODE_H_*/
@@ -0,0 +1,153 @@
+/**
+ * @file      frame_derivatives.cpp
+ * @brief     Source for FrameDerivatives class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./frame_derivatives.h"
+#include "./pixel_convert.h"
+
+/**
+ * @brief
+ * Compute a derived format of a frame.
+ * @param src [in] source frame.
+ * @param format [in] derived format.
+ * @param eight_bit [in] 8 bit copy of src (can be NULL or src itself).
+ * @param dst [out] derived image.
+ * @return If false, the format of src is not supported.
+ */
+bool FrameDerivativesCompute(const cv::Mat& src, FrameDerivedFormat format,
+                             const cv::Mat* eight_bit, cv::Mat* dst) {
+  switch (format) {
+    case kFrameDerived8U:
+      return PixelConvertTo8U(src, kPixelConvertSensorBits, 1, dst);
+    case kFrameDerived8UHalf:
+      return PixelConvertTo8U(src, kPixelConvertSensorBits, 2, dst);
+    case kFrameDerivedGray8U:
+      if (eight_bit == NULL || eight_bit->depth() != CV_8U) {
+        return false;
+      }
+      if (eight_bit->channels() == 3) {
+        cv::cvtColor(*eight_bit, *dst, CV_BGR2GRAY);
+      } else if (eight_bit->channels() == 1) {
+        eight_bit->copyTo(*dst);
+      } else {
+        return false;
+      }
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief
+ * Constructor. The reference count is 1.
+ */
+FrameDerivatives::FrameDerivatives(void) {
+  ref_count_ = 1;
+  for (int i = 0; i < kFrameDerivedNum; i++) {
+    is_valid_[i] = false;
+  }
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+FrameDerivatives::~FrameDerivatives(void) {}
+
+/**
+ * @brief
+ * Forget the derived images of the previous frame (the buffers are kept).
+ * Call it only while nobody else holds a reference.
+ */
+void FrameDerivatives::Reset(void) {
+  wxMutexLocker lock(mutex_);
+  for (int i = 0; i < kFrameDerivedNum; i++) {
+    is_valid_[i] = false;
+    pyramids_[i].Reset();
+  }
+}
+
+/**
+ * @brief
+ * Get a derived image, computing it on the first request.
+ * @param format [in] derived format.
+ * @param src [in] the caller's copy of the frame.
+ * @return derived image (valid while the reference is held), or NULL if
+ * the format of src is not supported.
+ */
+const cv::Mat* FrameDerivatives::Get(FrameDerivedFormat format,
+                                     const cv::Mat& src) {
+  if (format < 0 || format >= kFrameDerivedNum) {
+    return NULL;
+  }
+  // An 8 bit frame is its own 8 bit format.
+  if (format == kFrameDerived8U && src.depth() == CV_8U) {
+    return &src;
+  }
+  wxMutexLocker lock(mutex_);
+  if (is_valid_[format]) {
+    return &images_[format];
+  }
+
+  // The gray image is made from the 8 bit image, which is kept as well.
+  const cv::Mat* eight_bit = NULL;
+  if (format == kFrameDerivedGray8U) {
+    if (src.depth() == CV_8U) {
+      eight_bit = &src;
+    } else {
+      if (!is_valid_[kFrameDerived8U]) {
+        is_valid_[kFrameDerived8U] = FrameDerivativesCompute(
+            src, kFrameDerived8U, NULL, &images_[kFrameDerived8U]);
+      }
+      if (is_valid_[kFrameDerived8U]) {
+        eight_bit = &images_[kFrameDerived8U];
+      }
+    }
+  }
+  if (!FrameDerivativesCompute(src, format, eight_bit, &images_[format])) {
+    return NULL;
+  }
+  is_valid_[format] = true;
+  return &images_[format];
+}
+
+/**
+ * @brief
+ * Get a pyramid level of a derived image, computing it on the first
+ * request.
+ * @param format [in] derived format (level 0).
+ * @param level [in] level (size = size of the format >> level).
+ * @param src [in] the caller's copy of the frame.
+ * @return level image (valid while the reference is held), or NULL if
+ * the format of src is not supported or the level is empty.
+ */
+const cv::Mat* FrameDerivatives::GetLevel(FrameDerivedFormat format,
+                                          int level, const cv::Mat& src) {
+  const cv::Mat* base = Get(format, src);
+  if (base == NULL) {
+    return NULL;
+  }
+  // The pyramid has its own lock: the levels are built without blocking
+  // the requests of the other formats.
+  return pyramids_[format].GetLevel(level, *base);
+}
+
+/**
+ * @brief
+ * Add a reference.
+ */
+void FrameDerivatives::AddRef(void) { __sync_add_and_fetch(&ref_count_, 1); }
+
+/**
+ * @brief
+ * Remove a reference, and delete the object when it was the last one.
+ */
+void FrameDerivatives::Release(void) {
+  if (__sync_sub_and_fetch(&ref_count_, 1) == 0) {
+    delete this;
+  }
+}
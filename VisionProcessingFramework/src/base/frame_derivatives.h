@@ -0,0 +1,132 @@
+/**
+ * @file      frame_derivatives.h
+ * @brief     Header for FrameDerivatives class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _FRAME_DERIVATIVES_H_
+#define _FRAME_DERIVATIVES_H_
+
+#include "./frame_pyramid.h"
+#include "./include.h"
+
+/**
+ * @enum FrameDerivedFormat
+ * @brief Formats derived from a frame for the output plugins.
+ */
+typedef enum {
+  /*! 8 bits per channel, same size */
+  kFrameDerived8U = 0,
+  /*! 8 bits per channel, half size */
+  kFrameDerived8UHalf,
+  /*! 8 bit gray, same size */
+  kFrameDerivedGray8U,
+  /*! Number of the formats */
+  kFrameDerivedNum,
+} FrameDerivedFormat;
+
+/**
+ * @brief
+ * Compute a derived format of a frame.
+ * @param src [in] source frame.
+ * @param format [in] derived format.
+ * @param eight_bit [in] 8 bit copy of src (can be NULL or src itself).
+ * @param dst [out] derived image.
+ * @return If false, the format of src is not supported.
+ */
+bool FrameDerivativesCompute(const cv::Mat& src, FrameDerivedFormat format,
+                             const cv::Mat* eight_bit, cv::Mat* dst);
+
+/**
+ * @class FrameDerivatives
+ * @brief Derived formats of one frame, shared by all the plugins that
+ * receive an unmodified copy of the frame at a branch of the flow. Each
+ * format is computed once, by the first plugin which asks for it.
+ * Each format also has a pyramid of reduced levels (FramePyramid), built
+ * level by level on demand, so the detection, the preview and the
+ * thumbnails downscale the frame only once.
+ * The object is reference counted and reused frame by frame, so the
+ * derived images keep their buffers.
+ */
+class FrameDerivatives {
+ public:
+  /**
+   * @brief
+   * Constructor. The reference count is 1.
+   */
+  FrameDerivatives(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~FrameDerivatives(void);
+
+  /**
+   * @brief
+   * Forget the derived images of the previous frame (the buffers are kept).
+   * Call it only while nobody else holds a reference.
+   */
+  void Reset(void);
+
+  /**
+   * @brief
+   * Get a derived image, computing it on the first request.
+   * @param format [in] derived format.
+   * @param src [in] the caller's copy of the frame.
+   * @return derived image (valid while the reference is held), or NULL if
+   * the format of src is not supported.
+   */
+  const cv::Mat* Get(FrameDerivedFormat format, const cv::Mat& src);
+
+  /**
+   * @brief
+   * Get a pyramid level of a derived image, computing it on the first
+   * request.
+   * @param format [in] derived format (level 0).
+   * @param level [in] level (size = size of the format >> level).
+   * @param src [in] the caller's copy of the frame.
+   * @return level image (valid while the reference is held), or NULL if
+   * the format of src is not supported or the level is empty.
+   */
+  const cv::Mat* GetLevel(FrameDerivedFormat format, int level,
+                          const cv::Mat& src);
+
+  /**
+   * @brief
+   * Add a reference.
+   */
+  void AddRef(void);
+
+  /**
+   * @brief
+   * Remove a reference, and delete the object when it was the last one.
+   */
+  void Release(void);
+
+  /**
+   * @brief
+   * Get the reference count.
+   * @return reference count.
+   */
+  int ref_count(void) const { return ref_count_; }
+
+ private:
+  /*! Reference count */
+  volatile int ref_count_;
+
+  /*! Lock of the derived images */
+  wxMutex mutex_;
+
+  /*! Derived images */
+  cv::Mat images_[kFrameDerivedNum];
+
+  /*! Whether images_ hold the current frame */
+  bool is_valid_[kFrameDerivedNum];
+
+  /*! Pyramids of the derived images */
+  FramePyramid pyramids_[kFrameDerivedNum];
+};
+
+#endif /* _FRAME_DERIVATIVES_H_*/
@@ -0,0 +1,258 @@
+/**
+ * @file      frame_mailbox.h
+ * @brief     Lock-free single-producer/single-consumer frame mailbox
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _FRAME_MAILBOX_H_
+#define _FRAME_MAILBOX_H_
+
+#include <vector>
+#include "./frame_metadata.h"
+#include "./include.h"
+
+/* Depth of the latest-frame mailbox (triple buffer). */
+#define kFrameMailboxLatestDepth 3
+
+/* Flag of FrameMailbox::ready_: the ready slot holds an unread frame. */
+#define kFrameMailboxFresh 0x80000000U
+
+/**
+ * @struct FrameMailboxSlot
+ * @brief Pooled storage of one frame in the mailbox.
+ */
+typedef struct {
+  /*! Image (reallocated only when the size or type changes) */
+  cv::Mat image;
+  /*! Metadata of the image */
+  FrameMetadata metadata;
+  /*! Sequence number given by the producer (from 1) */
+  unsigned int sequence;
+} FrameMailboxSlot;
+
+/**
+ * @class FrameMailbox
+ * @brief Frame mailbox between one producer thread and one consumer thread.
+ * With the depth kFrameMailboxLatestDepth the mailbox is a triple buffer: the
+ * producer always overwrites the unread frame and the consumer always gets
+ * the latest one. With a larger depth it is a ring which keeps the frames in
+ * order and rejects a new frame while full. Neither side ever blocks, and the
+ * consumer learns from the sequence numbers how many frames it skipped.
+ */
+class FrameMailbox {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   * @param depth [in] number of the slots (kFrameMailboxLatestDepth: latest
+   * frame only, larger: ring of depth frames, including the one being read).
+   */
+  explicit FrameMailbox(int depth = kFrameMailboxLatestDepth) {
+    if (depth < kFrameMailboxLatestDepth) {
+      depth = kFrameMailboxLatestDepth;
+    }
+    depth_ = depth;
+    is_latest_ = (depth == kFrameMailboxLatestDepth);
+    for (int i = 0; i < depth_; i++) {
+      FrameMailboxSlot* slot = new FrameMailboxSlot;
+      FrameMetadataClear(&slot->metadata);
+      slot->sequence = 0;
+      slots_.push_back(slot);
+    }
+    write_index_ = 0;
+    ready_ = 1;
+    read_index_ = 2;
+    head_ = 0;
+    tail_ = 0;
+    pushed_ = 0;
+    dropped_ = 0;
+    last_sequence_ = 0;
+    skipped_ = 0;
+  }
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~FrameMailbox(void) {
+    for (unsigned int i = 0; i < slots_.size(); i++) {
+      delete slots_[i];
+    }
+  }
+
+  /**
+   * @brief
+   * Get the slot to write the next frame into (producer only).
+   * Fill the image and the metadata of the slot, then call EndPush().
+   * @return slot, or NULL if the ring is full (the frame is dropped).
+   */
+  FrameMailboxSlot* BeginPush(void) {
+    if (is_latest_) {
+      return slots_[write_index_];
+    }
+    if (head_ - tail_ >= static_cast<unsigned int>(depth_)) {
+      dropped_++;
+      pushed_++;  // The consumer sees the gap in the sequence.
+      return NULL;
+    }
+    return slots_[head_ % depth_];
+  }
+
+  /**
+   * @brief
+   * Publish the slot got by BeginPush() (producer only).
+   */
+  void EndPush(void) {
+    pushed_++;
+    if (is_latest_) {
+      slots_[write_index_]->sequence = pushed_;
+      // Publish the slot and take back the one it replaces.
+      __sync_synchronize();
+      unsigned int old_ready = __sync_lock_test_and_set(
+          &ready_, static_cast<unsigned int>(write_index_) |
+                       kFrameMailboxFresh);
+      if ((old_ready & kFrameMailboxFresh) != 0) {
+        dropped_++;
+      }
+      write_index_ = static_cast<int>(old_ready & ~kFrameMailboxFresh);
+    } else {
+      slots_[head_ % depth_]->sequence = pushed_;
+      __sync_synchronize();
+      head_++;
+    }
+  }
+
+  /**
+   * @brief
+   * Copy a frame into the mailbox (producer only).
+   * @param image [in] image.
+   * @param metadata [in] metadata of the image (can be NULL).
+   * @return If false, the ring was full and the frame was dropped.
+   */
+  bool Push(const cv::Mat& image, const FrameMetadata* metadata) {
+    FrameMailboxSlot* slot = BeginPush();
+    if (slot == NULL) {
+      return false;
+    }
+    image.copyTo(slot->image);
+    FrameMetadataCopy(&slot->metadata, metadata);
+    EndPush();
+    return true;
+  }
+
+  /**
+   * @brief
+   * Take the next unread frame (consumer only).
+   * The slot belongs to the consumer until Release() (ring), or until the
+   * next Acquire() (latest frame).
+   * @param skipped [out] number of the frames skipped before this one
+   * (can be NULL).
+   * @return slot, or NULL if no new frame has arrived.
+   */
+  FrameMailboxSlot* Acquire(unsigned int* skipped) {
+    FrameMailboxSlot* slot;
+    if (is_latest_) {
+      if ((ready_ & kFrameMailboxFresh) == 0) {
+        return NULL;
+      }
+      unsigned int old_ready = __sync_lock_test_and_set(
+          &ready_, static_cast<unsigned int>(read_index_));
+      read_index_ = static_cast<int>(old_ready & ~kFrameMailboxFresh);
+      slot = slots_[read_index_];
+    } else {
+      if (tail_ == head_) {
+        return NULL;
+      }
+      __sync_synchronize();
+      slot = slots_[tail_ % depth_];
+    }
+
+    unsigned int gap = 0;
+    if (last_sequence_ != 0 && slot->sequence > last_sequence_ + 1) {
+      gap = slot->sequence - last_sequence_ - 1;
+    }
+    last_sequence_ = slot->sequence;
+    skipped_ += gap;
+    if (skipped != NULL) {
+      *skipped = gap;
+    }
+    return slot;
+  }
+
+  /**
+   * @brief
+   * Give the slot got by Acquire() back to the producer (consumer only).
+   */
+  void Release(void) {
+    if (!is_latest_ && tail_ != head_) {
+      __sync_synchronize();
+      tail_++;
+    }
+  }
+
+  /**
+   * @brief
+   * Get the number of the frames pushed (including the dropped frames).
+   * @return number of the frames.
+   */
+  unsigned int pushed(void) const { return pushed_; }
+
+  /**
+   * @brief
+   * Get the number of the frames overwritten or rejected before the consumer
+   * took them.
+   * @return number of the frames.
+   */
+  unsigned int dropped(void) const { return dropped_; }
+
+  /**
+   * @brief
+   * Get the number of the frames the consumer skipped.
+   * @return number of the frames.
+   */
+  unsigned int skipped(void) const { return skipped_; }
+
+ private:
+  /* Not copyable. */
+  FrameMailbox(const FrameMailbox&);
+  FrameMailbox& operator=(const FrameMailbox&);
+
+  /*! Pooled slots */
+  std::vector<FrameMailboxSlot*> slots_;
+
+  /*! Number of the slots */
+  int depth_;
+
+  /*! If true, triple buffer; if false, ring */
+  bool is_latest_;
+
+  /*! Triple buffer: slot of the producer */
+  int write_index_;
+
+  /*! Triple buffer: slot exchanged between the threads (| Fresh flag) */
+  volatile unsigned int ready_;
+
+  /*! Triple buffer: slot of the consumer */
+  int read_index_;
+
+  /*! Ring: count of the published slots (producer writes) */
+  volatile unsigned int head_;
+
+  /*! Ring: count of the released slots (consumer writes) */
+  volatile unsigned int tail_;
+
+  /*! Number of the pushed frames, also the last sequence number */
+  volatile unsigned int pushed_;
+
+  /*! Number of the overwritten or rejected frames */
+  volatile unsigned int dropped_;
+
+  /*! Sequence number of the last acquired frame */
+  unsigned int last_sequence_;
+
+  /*! Number of the frames skipped by the consumer */
+  volatile unsigned int skipped_;
+};
+
+#endif /* _FRAME_MAILBOX_H_*/
@@ -0,0 +1,157 @@
+/**
+ * @file      frame_metadata.h
+ * @brief     Header for the per-frame metadata block
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _FRAME_METADATA_H_
+#define _FRAME_METADATA_H_
+
+#include <string.h>
+#include <sys/time.h>
+#include "./include.h"
+
+/* Maximum number of boxes (detections) carried by a frame. */
+#define kFrameMetadataMaxBoxes 32
+
+/* Value of a sensor setting which is not known. */
+#define kFrameMetadataUnknown -1
+
+/**
+ * @struct FrameBox
+ * @brief Box appended to a frame by an analytics plugin.
+ */
+typedef struct FrameBox {
+  /*! Box in the coordinates of the frame which was analyzed */
+  CvRect rect;
+  /*! Label defined by the plugin which appended the box */
+  int label;
+  /*! Confidence or tracking identifier defined by the plugin */
+  float score;
+} FrameBox;
+
+/**
+ * @struct WhiteBalanceStats
+ * @brief White balance statistics of a frame.
+ */
+typedef struct WhiteBalanceStats {
+  /*! Whether the statistics are valid */
+  bool valid;
+  /*! Rectangle where the statistics were taken (start/end coordinates) */
+  CvRect rect;
+  /*! Average of red pixels (optical black subtracted) */
+  double average_r;
+  /*! Average of green pixels (optical black subtracted) */
+  double average_g;
+  /*! Average of blue pixels (optical black subtracted) */
+  double average_b;
+  /*! Red gain in effect */
+  float gain_r;
+  /*! Green gain in effect */
+  float gain_g;
+  /*! Blue gain in effect */
+  float gain_b;
+} WhiteBalanceStats;
+
+/**
+ * @struct FrameMetadata
+ * @brief Typed metadata block carried with every frame.
+ * The block has a fixed size, so it is preallocated by its owner and copied
+ * by value across sub-flow threads and queues without allocation.
+ */
+typedef struct FrameMetadata {
+  /*! Frame number (counted by the flow or the input plugin) */
+  unsigned int frame_number;
+  /*! Capture time of the frame */
+  struct timeval capture_time;
+  /*! Whether the frame counter is drawn in the image (test pattern) */
+  bool has_frame_code;
+  /*! Coarse integration time register value in effect */
+  int exposure;
+  /*! Analog gain register value in effect */
+  int analog_gain;
+  /*! Digital gain register value in effect */
+  int digital_gain;
+  /*! Lens actuator code in effect */
+  int focus;
+  /*! Whether the one-push rectangle is set */
+  bool has_onepush_rect;
+  /*! One-push rectangle (start/end coordinates, see CommonParam) */
+  CvRect onepush_rect;
+  /*! White balance statistics */
+  WhiteBalanceStats white_balance;
+  /*! Number of valid boxes */
+  int num_boxes;
+  /*! Boxes appended by analytics plugins */
+  FrameBox boxes[kFrameMetadataMaxBoxes];
+} FrameMetadata;
+
+/**
+ * @brief
+ * Reset a metadata block for a new frame.
+ * @param metadata [out] metadata block.
+ */
+inline void FrameMetadataClear(FrameMetadata* metadata) {
+  memset(metadata, 0, sizeof(FrameMetadata));
+  metadata->exposure = kFrameMetadataUnknown;
+  metadata->analog_gain = kFrameMetadataUnknown;
+  metadata->digital_gain = kFrameMetadataUnknown;
+  metadata->focus = kFrameMetadataUnknown;
+}
+
+/**
+ * @brief
+ * Copy a metadata block. Only the valid boxes are copied.
+ * @param dst [out] destination block.
+ * @param src [in] source block. If NULL, dst is cleared.
+ */
+inline void FrameMetadataCopy(FrameMetadata* dst, const FrameMetadata* src) {
+  if (src == NULL) {
+    FrameMetadataClear(dst);
+    return;
+  }
+  memcpy(dst, src,
+         sizeof(FrameMetadata) -
+             sizeof(FrameBox) * (kFrameMetadataMaxBoxes - src->num_boxes));
+}
+
+/**
+ * @brief
+ * Append a box to a metadata block.
+ * @param metadata [in,out] metadata block.
+ * @param rect [in] box.
+ * @param label [in] label defined by the plugin.
+ * @param score [in] confidence or tracking identifier.
+ * @return false, the block is full.
+ */
+inline bool FrameMetadataAddBox(FrameMetadata* metadata, const CvRect& rect,
+                                int label, float score) {
+  if (metadata->num_boxes >= kFrameMetadataMaxBoxes) {
+    return false;
+  }
+  FrameBox* box = &metadata->boxes[metadata->num_boxes];
+  box->rect = rect;
+  box->label = label;
+  box->score = score;
+  metadata->num_boxes++;
+  return true;
+}
+
+/**
+ * @brief
+ * Get the age of a frame since its capture.
+ * @param metadata [in] metadata block.
+ * @param now [in] current time.
+ * @return age in milliseconds. Negative, the capture time is unknown.
+ */
+inline double FrameMetadataAgeMsec(const FrameMetadata* metadata,
+                                   const struct timeval* now) {
+  if (!timerisset(&metadata->capture_time)) {
+    return -1.0;
+  }
+  return (now->tv_sec - metadata->capture_time.tv_sec) * 1000.0 +
+         (now->tv_usec - metadata->capture_time.tv_usec) / 1000.0;
+}
+
+#endif /* _FRAME_METADATA_H_*/
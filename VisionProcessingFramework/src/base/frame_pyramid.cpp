@@ -0,0 +1,113 @@
+/**
+ * @file      frame_pyramid.cpp
+ * @brief     Source for FramePyramid class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./frame_pyramid.h"
+
+/**
+ * @brief
+ * Constructor.
+ */
+FramePyramid::FramePyramid(void) : level_builds_(0) {
+  for (int i = 0; i < kFramePyramidMaxLevels; i++) {
+    is_valid_[i] = false;
+  }
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+FramePyramid::~FramePyramid(void) {}
+
+/**
+ * @brief
+ * Forget the levels of the previous frame (the buffers are kept).
+ */
+void FramePyramid::Reset(void) {
+  wxMutexLocker lock(mutex_);
+  for (int i = 0; i < kFramePyramidMaxLevels; i++) {
+    is_valid_[i] = false;
+  }
+}
+
+/**
+ * @brief
+ * Get a level, building it on the first request.
+ * @param level [in] level (0: base itself).
+ * @param base [in] base image of the frame (8U or 16U). It must be the
+ * same image for all the requests until Reset().
+ * @return level image (valid until Reset()), or NULL if the level is
+ * empty or the format of base is not supported.
+ */
+const cv::Mat* FramePyramid::GetLevel(int level, const cv::Mat& base) {
+  if (level < 0 || level >= kFramePyramidMaxLevels || base.data == NULL) {
+    return NULL;
+  }
+  if (level == 0) {
+    return &base;
+  }
+  cv::Size size = LevelSize(base.size(), level);
+  if (size.width <= 0 || size.height <= 0) {
+    return NULL;
+  }
+  wxMutexLocker lock(mutex_);
+  if (is_valid_[level]) {
+    return &levels_[level];
+  }
+
+  // Start from the nearest level built below, and reduce by 4 while the
+  // gap allows it: the levels in between are not built.
+  int current = level - 1;
+  while (current > 0 && !is_valid_[current]) {
+    current--;
+  }
+  while (current < level) {
+    const cv::Mat& src = (current == 0) ? base : levels_[current];
+    int step = (level - current >= 2) ? 2 : 1;
+    int next = current + step;
+    cv::Size next_size = LevelSize(base.size(), next);
+    cv::Rect area(0, 0, next_size.width << step, next_size.height << step);
+    if (!resizer_.Resize(src, area, next_size, &levels_[next])) {
+      return NULL;
+    }
+    is_valid_[next] = true;
+    level_builds_++;
+    current = next;
+  }
+  return &levels_[level];
+}
+
+/**
+ * @brief
+ * Get the size of a level.
+ * @param base_size [in] size of the base image.
+ * @param level [in] level.
+ * @return size of the level.
+ */
+cv::Size FramePyramid::LevelSize(const cv::Size& base_size, int level) {
+  return cv::Size(base_size.width >> level, base_size.height >> level);
+}
+
+/**
+ * @brief
+ * Get the smallest level which is not smaller than a size, the best
+ * source to resize to that size.
+ * @param base_size [in] size of the base image.
+ * @param size [in] wanted size.
+ * @return level (0 if size is not smaller than the half of base_size).
+ */
+int FramePyramid::LevelFor(const cv::Size& base_size, const cv::Size& size) {
+  int level = 0;
+  while (level + 1 < kFramePyramidMaxLevels) {
+    cv::Size next = LevelSize(base_size, level + 1);
+    if (next.width < size.width || next.height < size.height) {
+      break;
+    }
+    level++;
+  }
+  return level;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file      frame_pyramid.h
+ * @brief     Header for FramePyramid class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _FRAME_PYRAMID_H_
+#define _FRAME_PYRAMID_H_
+
+#include "./image_resizer.h"
+#include "./include.h"
+
+/* Number of the levels of a pyramid, including the base image (level 0). */
+#define kFramePyramidMaxLevels 8
+
+/**
+ * @class FramePyramid
+ * @brief Multi-resolution pyramid of one frame. Level n is the base image
+ * reduced by 2^n in both axes (size = base size >> n), each pixel being
+ * the box average of the base pixels it covers.
+ * Levels are built on demand: a request builds only that level, from the
+ * nearest level already built below it (2x or 4x box reductions), so the
+ * levels nobody asks for are never computed. A level, once built, is
+ * shared by all the callers until Reset().
+ */
+class FramePyramid {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  FramePyramid(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~FramePyramid(void);
+
+  /**
+   * @brief
+   * Forget the levels of the previous frame (the buffers are kept).
+   */
+  void Reset(void);
+
+  /**
+   * @brief
+   * Get a level, building it on the first request.
+   * @param level [in] level (0: base itself).
+   * @param base [in] base image of the frame (8U or 16U). It must be the
+   * same image for all the requests until Reset().
+   * @return level image (valid until Reset()), or NULL if the level is
+   * empty or the format of base is not supported.
+   */
+  const cv::Mat* GetLevel(int level, const cv::Mat& base);
+
+  /**
+   * @brief
+   * Get the size of a level.
+   * @param base_size [in] size of the base image.
+   * @param level [in] level.
+   * @return size of the level.
+   */
+  static cv::Size LevelSize(const cv::Size& base_size, int level);
+
+  /**
+   * @brief
+   * Get the smallest level which is not smaller than a size, the best
+   * source to resize to that size.
+   * @param base_size [in] size of the base image.
+   * @param size [in] wanted size.
+   * @return level (0 if size is not smaller than the half of base_size).
+   */
+  static int LevelFor(const cv::Size& base_size, const cv::Size& size);
+
+  /**
+   * @brief
+   * Get the number of the levels built since the construction.
+   * @return number of the levels.
+   */
+  unsigned int level_builds(void) const { return level_builds_; }
+
+ private:
+  /*! Lock of the levels */
+  wxMutex mutex_;
+
+  /*! Levels (levels_[0] is not used: level 0 is the base image) */
+  cv::Mat levels_[kFramePyramidMaxLevels];
+
+  /*! Whether levels_ hold the current frame */
+  bool is_valid_[kFramePyramidMaxLevels];
+
+  /*! Box reductions */
+  ImageResizer resizer_;
+
+  /*! Number of the levels built */
+  unsigned int level_builds_;
+};
+
+#endif /* _FRAME_PYRAMID_H_*/
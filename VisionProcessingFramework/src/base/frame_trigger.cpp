@@ -0,0 +1,49 @@
+/**
+ * @file      frame_trigger.cpp
+ * @brief     Source for FrameTrigger class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./frame_trigger.h"
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief
+ * Get the trigger shared by the plugins of the process.
+ * @return trigger.
+ */
+FrameTrigger* FrameTrigger::Instance(void) {
+  static FrameTrigger instance;
+  return &instance;
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+FrameTrigger::FrameTrigger(void) {
+  count_ = 0;
+  timerclear(&last_time_);
+  last_source_[0] = '\0';
+}
+
+/**
+ * @brief
+ * Fire an event (any thread).
+ * The time and the source are informative: two events fired at once may
+ * leave the ones of either.
+ * @param source [in] name of the source for the logs (can be NULL).
+ * @return number of the events fired, this one included.
+ */
+unsigned int FrameTrigger::Fire(const char* source) {
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  last_time_ = now;
+  strncpy(last_source_, (source != NULL) ? source : "",
+          kFrameTriggerSourceLength - 1);
+  last_source_[kFrameTriggerSourceLength - 1] = '\0';
+  __sync_synchronize();
+  return __sync_add_and_fetch(&count_, 1);
+}
@@ -0,0 +1,80 @@
+/**
+ * @file      frame_trigger.h
+ * @brief     Header for FrameTrigger class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _FRAME_TRIGGER_H_
+#define _FRAME_TRIGGER_H_
+
+#include <sys/time.h>
+
+/* Maximum length of the name of a trigger source (including the NUL). */
+#define kFrameTriggerSourceLength 32
+
+/**
+ * @class FrameTrigger
+ * @brief Trigger events shared by all the plugins of the process.
+ * A plugin which detects an event (a key, a detection, a threshold) fires
+ * the trigger; a plugin which reacts to events (a recorder) polls the count
+ * once per frame and handles the events fired since its last poll. The
+ * framework binary exports the base classes, so every plugin sees the same
+ * instance. Firing and polling never block.
+ */
+class FrameTrigger {
+ public:
+  /**
+   * @brief
+   * Get the trigger shared by the plugins of the process.
+   * @return trigger.
+   */
+  static FrameTrigger* Instance(void);
+
+  /**
+   * @brief
+   * Constructor.
+   */
+  FrameTrigger(void);
+
+  /**
+   * @brief
+   * Fire an event (any thread).
+   * @param source [in] name of the source for the logs (can be NULL).
+   * @return number of the events fired, this one included.
+   */
+  unsigned int Fire(const char* source);
+
+  /**
+   * @brief
+   * Get the number of the events fired since the process start.
+   * @return number of the events.
+   */
+  unsigned int count(void) const { return count_; }
+
+  /**
+   * @brief
+   * Get the time of the last event.
+   * @return time (cleared: no event).
+   */
+  struct timeval last_time(void) const { return last_time_; }
+
+  /**
+   * @brief
+   * Get the source of the last event.
+   * @return name of the source ("" if none).
+   */
+  const char* last_source(void) const { return last_source_; }
+
+ private:
+  /*! Number of the events fired */
+  volatile unsigned int count_;
+
+  /*! Time of the last event */
+  struct timeval last_time_;
+
+  /*! Source of the last event */
+  char last_source_[kFrameTriggerSourceLength];
+};
+
+#endif /* _FRAME_TRIGGER_H_*/
@@ -0,0 +1,436 @@
+/**
+ * @file      image_resizer.cpp
+ * @brief     Source for ImageResizer class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./image_resizer.h"
+#include <math.h>
+#include <algorithm>
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define IMAGE_RESIZER_NEON
+#endif
+
+/**
+ * @brief
+ * Copy the rows of an area.
+ * @param src [in] first pixel of the area.
+ * @param src_step [in] bytes per row of the source.
+ * @param row_size [in] bytes per row of the area.
+ * @param dst [out] image of the area size.
+ */
+static void CopyArea(const UINT8* src, size_t src_step, int row_size,
+                     cv::Mat* dst) {
+  int rows = dst->rows;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (int y = 0; y < rows; y++) {
+    memcpy(dst->data + y * dst->step, src + y * src_step, row_size);
+  }
+}
+
+#ifdef IMAGE_RESIZER_NEON
+/**
+ * @brief
+ * Average 2x2 pixels of 3 channel rows (NEON).
+ * @param row0 [in] first source row.
+ * @param row1 [in] second source row.
+ * @param cols [in] number of the destination pixels.
+ * @param dst [out] destination row.
+ * @return number of the pixels done.
+ */
+static int BoxRow2x3(const UINT8* row0, const UINT8* row1, int cols,
+                     UINT8* dst) {
+  int x = 0;
+  for (; x + 8 <= cols; x += 8) {
+    uint8x16x3_t top = vld3q_u8(row0 + 6 * x);
+    uint8x16x3_t bottom = vld3q_u8(row1 + 6 * x);
+    uint8x8x3_t out;
+    for (int c = 0; c < 3; c++) {
+      uint16x8_t sum = vpadalq_u8(vpaddlq_u8(top.val[c]), bottom.val[c]);
+      out.val[c] = vrshrn_n_u16(sum, 2);
+    }
+    vst3_u8(dst + 3 * x, out);
+  }
+  return x;
+}
+
+static int BoxRow2x3(const UINT16* row0, const UINT16* row1, int cols,
+                     UINT16* dst) {
+  int x = 0;
+  for (; x + 4 <= cols; x += 4) {
+    uint16x8x3_t top = vld3q_u16(row0 + 6 * x);
+    uint16x8x3_t bottom = vld3q_u16(row1 + 6 * x);
+    uint16x4x3_t out;
+    for (int c = 0; c < 3; c++) {
+      uint32x4_t sum = vpadalq_u16(vpaddlq_u16(top.val[c]), bottom.val[c]);
+      out.val[c] = vrshrn_n_u32(sum, 2);
+    }
+    vst3_u16(dst + 3 * x, out);
+  }
+  return x;
+}
+#endif
+
+/**
+ * @brief
+ * Average factor x factor pixels (factor: 2 or 4).
+ * @param src [in] first pixel of the source area.
+ * @param src_step [in] bytes per row of the source.
+ * @param channels [in] number of the channels.
+ * @param factor [in] reduction factor (2 or 4).
+ * @param dst [out] reduced image.
+ */
+template <typename T>
+static void BoxReduce(const UINT8* src, size_t src_step, int channels,
+                      int factor, cv::Mat* dst) {
+  int rows = dst->rows;
+  int cols = dst->cols;
+  int shift = (factor == 2) ? 2 : 4;
+  int round = 1 << (shift - 1);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (int y = 0; y < rows; y++) {
+    const T* src_row =
+        reinterpret_cast<const T*>(src + factor * y * src_step);
+    T* dst_row = reinterpret_cast<T*>(dst->data + y * dst->step);
+    int x = 0;
+#ifdef IMAGE_RESIZER_NEON
+    if (factor == 2 && channels == 3) {
+      x = BoxRow2x3(src_row,
+                    reinterpret_cast<const T*>(src + (2 * y + 1) * src_step),
+                    cols, dst_row);
+    }
+#endif
+    for (; x < cols; x++) {
+      for (int c = 0; c < channels; c++) {
+        int sum = round;
+        for (int ky = 0; ky < factor; ky++) {
+          const T* pixel = reinterpret_cast<const T*>(
+              src + (factor * y + ky) * src_step) + factor * x * channels + c;
+          for (int kx = 0; kx < factor; kx++) {
+            sum += pixel[kx * channels];
+          }
+        }
+        dst_row[x * channels + c] = static_cast<T>(sum >> shift);
+      }
+    }
+  }
+}
+
+/**
+ * @brief
+ * Resample a row horizontally.
+ * @param src [in] source row (first pixel of the area).
+ * @param channels [in] number of the channels.
+ * @param axis [in] horizontal weights.
+ * @param dst [out] resampled row (weights of kImageResizerCoefBits).
+ */
+template <typename T>
+static void HorizontalRow(const T* src, int channels,
+                          const ImageResizerAxis& axis, int* dst) {
+  int taps = axis.taps;
+  for (int x = 0; x < axis.dst_size; x++) {
+    const T* pixel = src + axis.starts[x] * channels;
+    const int* weights = &axis.weights[x * taps];
+    for (int c = 0; c < channels; c++) {
+      int sum = 0;
+      for (int k = 0; k < taps; k++) {
+        sum += pixel[k * channels + c] * weights[k];
+      }
+      dst[x * channels + c] = sum;
+    }
+  }
+}
+
+/**
+ * @brief
+ * Resample rows vertically.
+ * Acc holds (max value) << (2 * kImageResizerCoefBits).
+ * @param rows [in] horizontally resampled rows.
+ * @param weights [in] weights of the rows.
+ * @param count [in] number of the rows.
+ * @param size [in] number of the elements of a row.
+ * @param dst [out] destination row.
+ */
+template <typename T, typename Acc>
+static void VerticalRow(const int* const* rows, const int* weights, int count,
+                        int size, T* dst) {
+  const Acc round = static_cast<Acc>(1) << (2 * kImageResizerCoefBits - 1);
+  for (int i = 0; i < size; i++) {
+    Acc sum = round;
+    for (int k = 0; k < count; k++) {
+      sum += static_cast<Acc>(rows[k][i]) * weights[k];
+    }
+    dst[i] = static_cast<T>(sum >> (2 * kImageResizerCoefBits));
+  }
+}
+
+/**
+ * @brief
+ * Resample an area with separate horizontal and vertical weights.
+ * The horizontal rows of a stripe are kept in a ring, so each source row
+ * is resampled once per stripe.
+ * @param src [in] first pixel of the source area.
+ * @param src_step [in] bytes per row of the source.
+ * @param channels [in] number of the channels.
+ * @param x_axis [in] horizontal weights.
+ * @param y_axis [in] vertical weights.
+ * @param work [in] work area.
+ * @param dst [out] resampled image.
+ */
+template <typename T, typename Acc>
+static void SeparableResize(const UINT8* src, size_t src_step, int channels,
+                            const ImageResizerAxis& x_axis,
+                            const ImageResizerAxis& y_axis, int* work,
+                            cv::Mat* dst) {
+  int rows = dst->rows;
+  int taps = y_axis.taps;
+  int row_size = x_axis.dst_size * channels;
+  int stripe_size = taps * (row_size + 1);
+  int stripes = (rows + kImageResizerStripeRows - 1) / kImageResizerStripeRows;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (int s = 0; s < stripes; s++) {
+    int* ring = work + s * stripe_size;
+    int* ring_rows = ring + taps * row_size;
+    for (int k = 0; k < taps; k++) {
+      ring_rows[k] = -1;
+    }
+    int y1 = std::min((s + 1) * kImageResizerStripeRows, rows);
+    for (int y = s * kImageResizerStripeRows; y < y1; y++) {
+      const int* used_rows[kImageResizerMaxTaps];
+      int used_weights[kImageResizerMaxTaps];
+      int count = 0;
+      const int* weights = &y_axis.weights[y * taps];
+      for (int k = 0; k < taps; k++) {
+        if (weights[k] == 0) {
+          continue;
+        }
+        int src_y = y_axis.starts[y] + k;
+        int slot = src_y % taps;
+        int* row = ring + slot * row_size;
+        if (ring_rows[slot] != src_y) {
+          HorizontalRow(reinterpret_cast<const T*>(src + src_y * src_step),
+                        channels, x_axis, row);
+          ring_rows[slot] = src_y;
+        }
+        used_rows[count] = row;
+        used_weights[count] = weights[k];
+        count++;
+      }
+      VerticalRow<T, Acc>(used_rows, used_weights, count, row_size,
+                          reinterpret_cast<T*>(dst->data + y * dst->step));
+    }
+  }
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+ImageResizer::ImageResizer(void) : next_axis_(0), table_builds_(0) {}
+
+/**
+ * @brief
+ * Destructor.
+ */
+ImageResizer::~ImageResizer(void) {}
+
+/**
+ * @brief
+ * Resize an area of an image.
+ * @param src [in] 8U or 16U image.
+ * @param crop [in] source area (inside src).
+ * @param dst_size [in] size of dst.
+ * @param dst [out] resized image (must not be src).
+ * @return If false, the format, the area or the size is not supported.
+ */
+bool ImageResizer::Resize(const cv::Mat& src, const cv::Rect& crop,
+                          const cv::Size& dst_size, cv::Mat* dst) {
+  if (dst == NULL || dst == &src || src.data == NULL) {
+    return false;
+  }
+  if (src.depth() != CV_8U && src.depth() != CV_16U) {
+    return false;
+  }
+  if (crop.x < 0 || crop.y < 0 || crop.width <= 0 || crop.height <= 0 ||
+      crop.x + crop.width > src.cols || crop.y + crop.height > src.rows ||
+      dst_size.width <= 0 || dst_size.height <= 0) {
+    return false;
+  }
+  // The rows of a destination row are listed on the stack.
+  if (crop.height >= dst_size.height * (kImageResizerMaxTaps - 1)) {
+    return false;
+  }
+  dst->create(dst_size.height, dst_size.width, src.type());
+
+  int channels = src.channels();
+  int pixel_size = channels * ((src.depth() == CV_16U) ? 2 : 1);
+  const UINT8* area = src.data + crop.y * src.step + crop.x * pixel_size;
+
+  if (crop.width == dst_size.width && crop.height == dst_size.height) {
+    CopyArea(area, src.step, crop.width * pixel_size, dst);
+    return true;
+  }
+  for (int factor = 2; factor <= 4; factor += 2) {
+    if (crop.width == dst_size.width * factor &&
+        crop.height == dst_size.height * factor) {
+      if (src.depth() == CV_8U) {
+        BoxReduce<UINT8>(area, src.step, channels, factor, dst);
+      } else {
+        BoxReduce<UINT16>(area, src.step, channels, factor, dst);
+      }
+      return true;
+    }
+  }
+
+  int x_index = FindAxis(crop.width, dst_size.width, -1);
+  int y_index = FindAxis(crop.height, dst_size.height, x_index);
+  const ImageResizerAxis& x_axis = axes_[x_index];
+  const ImageResizerAxis& y_axis = axes_[y_index];
+  int stripes = (dst_size.height + kImageResizerStripeRows - 1) /
+                kImageResizerStripeRows;
+  size_t work_size = static_cast<size_t>(stripes) * y_axis.taps *
+                     (dst_size.width * channels + 1);
+  if (work_.size() < work_size) {
+    work_.resize(work_size);
+  }
+  // 8 bit data fits in 31 bits with the weights of both axes.
+  if (src.depth() == CV_8U) {
+    SeparableResize<UINT8, int>(area, src.step, channels, x_axis, y_axis,
+                                &work_[0], dst);
+  } else {
+    SeparableResize<UINT16, long long>(  // NOLINT
+        area, src.step, channels, x_axis, y_axis, &work_[0], dst);
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Resize a whole image.
+ * @param src [in] 8U or 16U image.
+ * @param dst_size [in] size of dst.
+ * @param dst [out] resized image (must not be src).
+ * @return If false, the format or the size is not supported.
+ */
+bool ImageResizer::Resize(const cv::Mat& src, const cv::Size& dst_size,
+                          cv::Mat* dst) {
+  return Resize(src, cv::Rect(0, 0, src.cols, src.rows), dst_size, dst);
+}
+
+/**
+ * @brief
+ * Get the centered area of a digital zoom.
+ * @param size [in] size of the image.
+ * @param zoom [in] zoom factor (1.0: whole image).
+ * @return area of the image.
+ */
+cv::Rect ImageResizer::ZoomRect(const cv::Size& size, double zoom) {
+  if (zoom <= 1.0) {
+    return cv::Rect(0, 0, size.width, size.height);
+  }
+  int width = std::max(1, static_cast<int>(size.width / zoom + 0.5));
+  int height = std::max(1, static_cast<int>(size.height / zoom + 0.5));
+  return cv::Rect((size.width - width) / 2, (size.height - height) / 2, width,
+                  height);
+}
+
+/**
+ * @brief
+ * Find the weights of an axis, building them if they are not kept.
+ * @param src_size [in] source size.
+ * @param dst_size [in] destination size.
+ * @param keep [in] entry which must not be replaced (-1: none).
+ * @return index of the entry in axes_.
+ */
+int ImageResizer::FindAxis(int src_size, int dst_size, int keep) {
+  for (size_t i = 0; i < axes_.size(); i++) {
+    if (axes_[i].src_size == src_size && axes_[i].dst_size == dst_size) {
+      return static_cast<int>(i);
+    }
+  }
+  int index;
+  if (axes_.size() < kImageResizerCacheSize) {
+    axes_.push_back(ImageResizerAxis());
+    index = static_cast<int>(axes_.size()) - 1;
+  } else {
+    if (next_axis_ == keep) {
+      next_axis_ = (next_axis_ + 1) % kImageResizerCacheSize;
+    }
+    index = next_axis_;
+    next_axis_ = (next_axis_ + 1) % kImageResizerCacheSize;
+  }
+  BuildAxis(src_size, dst_size, &axes_[index]);
+  table_builds_++;
+  return index;
+}
+
+/**
+ * @brief
+ * Build the weights of an axis.
+ * @param src_size [in] source size.
+ * @param dst_size [in] destination size.
+ * @param axis [out] weights.
+ */
+void ImageResizer::BuildAxis(int src_size, int dst_size,
+                             ImageResizerAxis* axis) {
+  double scale = static_cast<double>(src_size) / dst_size;
+  bool is_area = (src_size > dst_size);
+  int taps = is_area ? static_cast<int>(ceil(scale)) + 1 : 2;
+  taps = std::min(taps, src_size);
+  const int one = 1 << kImageResizerCoefBits;
+
+  axis->src_size = src_size;
+  axis->dst_size = dst_size;
+  axis->taps = taps;
+  axis->starts.resize(dst_size);
+  axis->weights.assign(dst_size * taps, 0);
+  std::vector<double> raw(taps);
+  for (int i = 0; i < dst_size; i++) {
+    int start;
+    std::fill(raw.begin(), raw.end(), 0.0);
+    if (is_area) {
+      // Average of the source pixels covered by [x0, x1).
+      double x0 = i * scale;
+      double x1 = x0 + scale;
+      start = std::min(static_cast<int>(floor(x0)), src_size - taps);
+      for (int k = 0; k < taps; k++) {
+        int pos = start + k;
+        double overlap = std::min(x1, pos + 1.0) - std::max(x0, 1.0 * pos);
+        raw[k] = (overlap > 0) ? overlap / scale : 0.0;
+      }
+    } else {
+      // Bilinear between the centers, the borders are repeated.
+      double x = (i + 0.5) * scale - 0.5;
+      int left = static_cast<int>(floor(x));
+      double fraction = x - left;
+      int pos0 = std::max(0, std::min(left, src_size - 1));
+      int pos1 = std::max(0, std::min(left + 1, src_size - 1));
+      start = std::min(pos0, src_size - taps);
+      raw[pos0 - start] += 1.0 - fraction;
+      raw[pos1 - start] += fraction;
+    }
+    axis->starts[i] = start;
+
+    // Round the weights; the largest one takes the rounding error, so
+    // the sum is exactly one.
+    int* weights = &axis->weights[i * taps];
+    int sum = 0;
+    int largest = 0;
+    for (int k = 0; k < taps; k++) {
+      weights[k] = static_cast<int>(raw[k] * one + 0.5);
+      sum += weights[k];
+      if (weights[k] > weights[largest]) {
+        largest = k;
+      }
+    }
+    weights[largest] += one - sum;
+  }
+}
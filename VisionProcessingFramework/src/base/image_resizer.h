@@ -0,0 +1,144 @@
+/**
+ * @file      image_resizer.h
+ * @brief     Header for ImageResizer class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _IMAGE_RESIZER_H_
+#define _IMAGE_RESIZER_H_
+
+#include <vector>
+#include "./include.h"
+
+/* Fraction bits of the resampling weights (per axis). */
+#define kImageResizerCoefBits 11
+
+/* Number of the axis weights kept, one per (source, destination) size. */
+#define kImageResizerCacheSize 4
+
+/* Number of the destination rows processed by one thread. */
+#define kImageResizerStripeRows 16
+
+/* Maximum number of the source rows of a destination row (reduction). */
+#define kImageResizerMaxTaps 64
+
+/**
+ * @struct ImageResizerAxis
+ * @brief Resampling weights of one axis for a (source, destination) size.
+ * The destination element i is the sum of the source elements
+ * starts[i] + k (0 <= k < taps) multiplied by weights[i * taps + k].
+ * The weights of an element sum to 1 << kImageResizerCoefBits.
+ */
+typedef struct {
+  /*! Source size */
+  int src_size;
+  /*! Destination size */
+  int dst_size;
+  /*! Number of the source elements per destination element */
+  int taps;
+  /*! First source element of each destination element */
+  std::vector<int> starts;
+  /*! Weights (dst_size * taps) */
+  std::vector<int> weights;
+} ImageResizerAxis;
+
+/**
+ * @class ImageResizer
+ * @brief Resize of 8U / 16U images of any size and number of channels,
+ * with integer weights only.
+ * Each axis is resampled separately: bilinear when it is enlarged, area
+ * (the average of the covered source pixels) when it is reduced, so a
+ * preview has no aliasing. The weights are built once per (source,
+ * destination) size and kept, so a stream only looks them up.
+ * Reductions by exactly 2 or 4 in both axes take a box average path
+ * (NEON on ARM), and a source of the destination size is copied.
+ * A crop rectangle selects the source area (digital zoom).
+ * The rows of the destination are processed in stripes in parallel.
+ */
+class ImageResizer {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  ImageResizer(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~ImageResizer(void);
+
+  /**
+   * @brief
+   * Resize an area of an image.
+   * @param src [in] 8U or 16U image.
+   * @param crop [in] source area (inside src).
+   * @param dst_size [in] size of dst.
+   * @param dst [out] resized image (must not be src).
+   * @return If false, the format, the area or the size is not supported.
+   */
+  bool Resize(const cv::Mat& src, const cv::Rect& crop,
+              const cv::Size& dst_size, cv::Mat* dst);
+
+  /**
+   * @brief
+   * Resize a whole image.
+   * @param src [in] 8U or 16U image.
+   * @param dst_size [in] size of dst.
+   * @param dst [out] resized image (must not be src).
+   * @return If false, the format or the size is not supported.
+   */
+  bool Resize(const cv::Mat& src, const cv::Size& dst_size, cv::Mat* dst);
+
+  /**
+   * @brief
+   * Get the centered area of a digital zoom.
+   * @param size [in] size of the image.
+   * @param zoom [in] zoom factor (1.0: whole image).
+   * @return area of the image.
+   */
+  static cv::Rect ZoomRect(const cv::Size& size, double zoom);
+
+  /**
+   * @brief
+   * Get the number of the times the weights of an axis were built.
+   * @return number of the times.
+   */
+  unsigned int table_builds(void) const { return table_builds_; }
+
+ private:
+  /**
+   * @brief
+   * Find the weights of an axis, building them if they are not kept.
+   * @param src_size [in] source size.
+   * @param dst_size [in] destination size.
+   * @param keep [in] entry which must not be replaced (-1: none).
+   * @return index of the entry in axes_.
+   */
+  int FindAxis(int src_size, int dst_size, int keep);
+
+  /**
+   * @brief
+   * Build the weights of an axis.
+   * @param src_size [in] source size.
+   * @param dst_size [in] destination size.
+   * @param axis [out] weights.
+   */
+  static void BuildAxis(int src_size, int dst_size, ImageResizerAxis* axis);
+
+  /*! Weights kept per (source, destination) size */
+  std::vector<ImageResizerAxis> axes_;
+
+  /*! Entry of axes_ replaced next */
+  int next_axis_;
+
+  /*! Work rows of the stripes */
+  std::vector<int> work_;
+
+  /*! Number of the builds of the weights */
+  unsigned int table_builds_;
+};
+
+#endif /* _IMAGE_RESIZER_H_*/
@@ -13,7 +13,10 @@
 #include <vector>
 
 #include "./common_param.h"
+#include "./frame_derivatives.h"
+#include "./frame_metadata.h"
 #include "./include.h"
+#include "./latency_stats.h"
 #include "./port_spec.h"
 
 typedef struct {
@@ -307,6 +310,83 @@ class IPlugin {
    */
   virtual float proc_time(void) = 0;
 
+  /**
+   * @brief
+   * Set the metadata of the frame passed to the next DoProcess.
+   * @param metadata [in] metadata owned by the flow (NOT own it).
+   */
+  virtual void set_frame_metadata(FrameMetadata* metadata) = 0;
+
+  /**
+   * @brief
+   * Get the metadata of the current frame.
+   * @return metadata of the current frame (can be NULL).
+   */
+  virtual FrameMetadata* frame_metadata(void) = 0;
+
+  /**
+   * @brief
+   * Set the derived formats shared with the other consumers of the frame
+   * passed to the next DoProcess.
+   * @param derivatives [in] derived formats (NOT own it, NULL: not shared).
+   */
+  virtual void set_frame_derivatives(FrameDerivatives* derivatives) = 0;
+
+  /**
+   * @brief
+   * Get the derived formats shared with the other consumers of the frame.
+   * @return derived formats (can be NULL).
+   */
+  virtual FrameDerivatives* frame_derivatives(void) = 0;
+
+  /**
+   * @brief
+   * Get the latency distribution of the frames displayed or stored.
+   * @return latency distribution.
+   */
+  virtual LatencyStats* latency_stats(void) = 0;
+
+  /**
+   * @brief
+   * Get the number of frames whose drawn frame counter did not match.
+   * @return number of mismatched frames.
+   */
+  virtual unsigned int frame_code_errors(void) = 0;
+
+  /**
+   * @brief
+   * Clear the latency distribution and the frame counter check.
+   */
+  virtual void ClearFrameLatency(void) = 0;
+
+  /**
+   * @brief
+   * Whether DoProcess completes frames asynchronously.
+   * @return true, the plugin runs in the asynchronous completion mode.
+   */
+  virtual bool is_async_process(void) = 0;
+
+  /**
+   * @brief
+   * Whether the plugin accepts a new frame without dropping it.
+   * @return true, DoProcess should be called for the current frame.
+   */
+  virtual bool CanAcceptAsyncFrame(void) = 0;
+
+  /**
+   * @brief
+   * Get the number of frames accepted but not yet completed.
+   * @return number of in-flight frames.
+   */
+  virtual int in_flight_frames(void) = 0;
+
+  /**
+   * @brief
+   * Get the number of frames dropped by the asynchronous completion mode.
+   * @return number of dropped frames.
+   */
+  virtual unsigned int async_dropped_frames(void) = 0;
+
   /**
    * @brief
    * Get the list of parameter setting string defined by each plugin to save the
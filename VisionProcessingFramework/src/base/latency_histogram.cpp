@@ -0,0 +1,96 @@
+/**
+ * @file      latency_histogram.cpp
+ * @brief     Source for LatencyHistogram class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./latency_histogram.h"
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief
+ * Constructor.
+ */
+LatencyHistogram::LatencyHistogram(void) : bins_(kLatencyStatsNumBins, 0) {
+  count_ = 0;
+  sum_msec_ = 0.0;
+  min_msec_ = 0.0;
+  max_msec_ = 0.0;
+}
+
+/**
+ * @brief
+ * Remove all samples.
+ */
+void LatencyHistogram::Clear(void) {
+  std::fill(bins_.begin(), bins_.end(), 0);
+  count_ = 0;
+  sum_msec_ = 0.0;
+  min_msec_ = 0.0;
+  max_msec_ = 0.0;
+}
+
+/**
+ * @brief
+ * Add a sample.
+ * @param msec [in] latency in milliseconds.
+ */
+void LatencyHistogram::Add(double msec) {
+  if (msec < 0.0) {
+    msec = 0.0;
+  }
+  int bin = static_cast<int>(msec * 1000.0 / kLatencyStatsBinUsec);
+  if (bin >= kLatencyStatsNumBins) {
+    bin = kLatencyStatsNumBins - 1;
+  }
+
+  bins_[bin]++;
+  if (count_ == 0 || msec < min_msec_) {
+    min_msec_ = msec;
+  }
+  if (count_ == 0 || msec > max_msec_) {
+    max_msec_ = msec;
+  }
+  count_++;
+  sum_msec_ += msec;
+}
+
+/**
+ * @brief
+ * Get a percentile of the samples.
+ * The result is rounded up to the histogram bin.
+ * @param ratio [in] ratio of the samples (0.0 - 1.0).
+ * @return latency in milliseconds (0.0: no sample).
+ */
+double LatencyHistogram::Percentile(double ratio) const {
+  if (count_ == 0) {
+    return 0.0;
+  }
+  unsigned int target = static_cast<unsigned int>(count_ * ratio);
+  if (target < 1) {
+    target = 1;
+  }
+  unsigned int sum = 0;
+  for (int i = 0; i < kLatencyStatsNumBins; i++) {
+    sum += bins_[i];
+    if (sum >= target) {
+      double msec = static_cast<double>((i + 1) * kLatencyStatsBinUsec) / 1000;
+      return (msec < max_msec_) ? msec : max_msec_;
+    }
+  }
+  return max_msec_;
+}
+
+/**
+ * @brief
+ * Get the average latency.
+ * @return latency in milliseconds (0.0: no sample).
+ */
+double LatencyHistogram::average_msec(void) const {
+  if (count_ == 0) {
+    return 0.0;
+  }
+  return sum_msec_ / count_;
+}
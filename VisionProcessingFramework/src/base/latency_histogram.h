@@ -0,0 +1,102 @@
+/**
+ * @file      latency_histogram.h
+ * @brief     Header for LatencyHistogram class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _LATENCY_HISTOGRAM_H_
+#define _LATENCY_HISTOGRAM_H_
+
+#include <vector>
+
+/* Width of a histogram bin in microseconds. */
+#define kLatencyStatsBinUsec 250
+
+/* Number of histogram bins (the last bin also counts longer latencies). */
+#define kLatencyStatsNumBins 4000
+
+/**
+ * @class LatencyHistogram
+ * @brief Distribution of latencies, without a lock.
+ * Samples are counted into a fixed histogram, so adding a sample never
+ * allocates and the percentiles are available at any time. The class does
+ * not depend on wxWidgets, so the tools without GUI use it too; the
+ * framework shares it between threads through LatencyStats.
+ */
+class LatencyHistogram {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  LatencyHistogram(void);
+
+  /**
+   * @brief
+   * Remove all samples.
+   */
+  void Clear(void);
+
+  /**
+   * @brief
+   * Add a sample.
+   * @param msec [in] latency in milliseconds.
+   */
+  void Add(double msec);
+
+  /**
+   * @brief
+   * Get a percentile of the samples.
+   * The result is rounded up to the histogram bin.
+   * @param ratio [in] ratio of the samples (0.0 - 1.0).
+   * @return latency in milliseconds (0.0: no sample).
+   */
+  double Percentile(double ratio) const;
+
+  /**
+   * @brief
+   * Get the number of samples.
+   * @return number of samples.
+   */
+  unsigned int count(void) const { return count_; }
+
+  /**
+   * @brief
+   * Get the minimum latency.
+   * @return latency in milliseconds (0.0: no sample).
+   */
+  double min_msec(void) const { return min_msec_; }
+
+  /**
+   * @brief
+   * Get the maximum latency.
+   * @return latency in milliseconds (0.0: no sample).
+   */
+  double max_msec(void) const { return max_msec_; }
+
+  /**
+   * @brief
+   * Get the average latency.
+   * @return latency in milliseconds (0.0: no sample).
+   */
+  double average_msec(void) const;
+
+ private:
+  /*! Histogram of the samples */
+  std::vector<unsigned int> bins_;
+
+  /*! Number of samples */
+  unsigned int count_;
+
+  /*! Sum of the samples in milliseconds */
+  double sum_msec_;
+
+  /*! Minimum sample in milliseconds */
+  double min_msec_;
+
+  /*! Maximum sample in milliseconds */
+  double max_msec_;
+};
+
+#endif /* _LATENCY_HISTOGRAM_H_*/
@@ -0,0 +1,91 @@
+/**
+ * @file      latency_stats.cpp
+ * @brief     Source for LatencyStats class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./latency_stats.h"
+
+/**
+ * @brief
+ * Constructor.
+ */
+LatencyStats::LatencyStats(void) {}
+
+/**
+ * @brief
+ * Destructor.
+ */
+LatencyStats::~LatencyStats(void) {}
+
+/**
+ * @brief
+ * Remove all samples.
+ */
+void LatencyStats::Clear(void) {
+  wxMutexLocker lock(mutex_);
+  histogram_.Clear();
+}
+
+/**
+ * @brief
+ * Add a sample.
+ * @param msec [in] latency in milliseconds.
+ */
+void LatencyStats::Add(double msec) {
+  wxMutexLocker lock(mutex_);
+  histogram_.Add(msec);
+}
+
+/**
+ * @brief
+ * Get a percentile of the samples.
+ * The result is rounded up to the histogram bin.
+ * @param ratio [in] ratio of the samples (0.0 - 1.0).
+ * @return latency in milliseconds (0.0: no sample).
+ */
+double LatencyStats::Percentile(double ratio) {
+  wxMutexLocker lock(mutex_);
+  return histogram_.Percentile(ratio);
+}
+
+/**
+ * @brief
+ * Get the number of samples.
+ * @return number of samples.
+ */
+unsigned int LatencyStats::count(void) {
+  wxMutexLocker lock(mutex_);
+  return histogram_.count();
+}
+
+/**
+ * @brief
+ * Get the minimum latency.
+ * @return latency in milliseconds (0.0: no sample).
+ */
+double LatencyStats::min_msec(void) {
+  wxMutexLocker lock(mutex_);
+  return histogram_.min_msec();
+}
+
+/**
+ * @brief
+ * Get the maximum latency.
+ * @return latency in milliseconds (0.0: no sample).
+ */
+double LatencyStats::max_msec(void) {
+  wxMutexLocker lock(mutex_);
+  return histogram_.max_msec();
+}
+
+/**
+ * @brief
+ * Get the average latency.
+ * @return latency in milliseconds (0.0: no sample).
+ */
+double LatencyStats::average_msec(void) {
+  wxMutexLocker lock(mutex_);
+  return histogram_.average_msec();
+}
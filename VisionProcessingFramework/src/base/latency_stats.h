@@ -0,0 +1,91 @@
+/**
+ * @file      latency_stats.h
+ * @brief     Header for LatencyStats class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _LATENCY_STATS_H_
+#define _LATENCY_STATS_H_
+
+#include "./include.h"
+#include "./latency_histogram.h"
+
+/**
+ * @class LatencyStats
+ * @brief Distribution of frame latencies, shared between threads.
+ * The samples are kept by a LatencyHistogram under a lock.
+ */
+class LatencyStats {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   */
+  LatencyStats(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~LatencyStats(void);
+
+  /**
+   * @brief
+   * Remove all samples.
+   */
+  void Clear(void);
+
+  /**
+   * @brief
+   * Add a sample.
+   * @param msec [in] latency in milliseconds.
+   */
+  void Add(double msec);
+
+  /**
+   * @brief
+   * Get a percentile of the samples.
+   * The result is rounded up to the histogram bin.
+   * @param ratio [in] ratio of the samples (0.0 - 1.0).
+   * @return latency in milliseconds (0.0: no sample).
+   */
+  double Percentile(double ratio);
+
+  /**
+   * @brief
+   * Get the number of samples.
+   * @return number of samples.
+   */
+  unsigned int count(void);
+
+  /**
+   * @brief
+   * Get the minimum latency.
+   * @return latency in milliseconds (0.0: no sample).
+   */
+  double min_msec(void);
+
+  /**
+   * @brief
+   * Get the maximum latency.
+   * @return latency in milliseconds (0.0: no sample).
+   */
+  double max_msec(void);
+
+  /**
+   * @brief
+   * Get the average latency.
+   * @return latency in milliseconds (0.0: no sample).
+   */
+  double average_msec(void);
+
+ private:
+  /*! Samples */
+  LatencyHistogram histogram_;
+
+  /*! Lock for the samples (added on the worker threads) */
+  wxMutex mutex_;
+};
+
+#endif /* _LATENCY_STATS_H_*/
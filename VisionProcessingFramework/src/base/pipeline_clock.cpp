@@ -0,0 +1,191 @@
+/**
+ * @file      pipeline_clock.cpp
+ * @brief     Source for PipelineClock class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./pipeline_clock.h"
+#include <math.h>
+#include <stddef.h>
+#include <unistd.h>
+
+/**
+ * @brief
+ * Constructor (real time at 60 fps).
+ */
+PipelineClock::PipelineClock(void) {
+  mode_ = kPipelineClockRealTime;
+  fps_ = 60.0;
+  multiple_ = 1.0;
+  period_usec_ = 1000000.0 / fps_;
+  Start();
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+PipelineClock::~PipelineClock(void) {}
+
+/**
+ * @brief
+ * Set the pacing. Takes effect from the next Start().
+ * @param mode [in] pacing mode.
+ * @param fps [in] frame rate of the source.
+ * @param multiple [in] speed of kPipelineClockMultiple (2.0: twice as fast).
+ */
+void PipelineClock::Configure(PipelineClockMode mode, double fps,
+                              double multiple) {
+  if (mode < 0 || mode >= kPipelineClockModeNum) {
+    mode = kPipelineClockRealTime;
+  }
+  mode_ = mode;
+  fps_ = (fps > 0.0) ? fps : 60.0;
+  multiple_ = (multiple > 0.0) ? multiple : 1.0;
+  period_usec_ = 1000000.0 / fps_;
+  if (mode_ == kPipelineClockMultiple) {
+    period_usec_ /= multiple_;
+  }
+}
+
+/**
+ * @brief
+ * Restart the schedule and the telemetry. The first frame is due at once.
+ */
+void PipelineClock::Start(void) {
+  is_started_ = false;
+  gettimeofday(&start_time_, NULL);
+  first_time_ = start_time_;
+  last_time_ = start_time_;
+  next_index_ = 0.0;
+  frames_ = 0;
+  dropped_ = 0;
+  restarts_ = 0;
+  sum_lag_usec_ = 0.0;
+  max_lag_usec_ = 0.0;
+}
+
+/**
+ * @brief
+ * Wait until the next frame is due.
+ * @return number of the source frames to drop before the next frame.
+ */
+int PipelineClock::WaitNextFrame(void) {
+  int drop = 0;
+  double lag_usec = 0.0;
+
+  if (!is_started_) {
+    // The schedule starts with the first frame, not with the plugin.
+    gettimeofday(&start_time_, NULL);
+    first_time_ = start_time_;
+    next_index_ = 0.0;
+    is_started_ = true;
+  } else if (mode_ != kPipelineClockFreeRun) {
+    double deadline = next_index_ * period_usec_;
+    double now = ElapsedUsec();
+    if (now < deadline) {
+      usleep(static_cast<useconds_t>(deadline - now));
+      now = ElapsedUsec();
+    } else if (now - deadline >= period_usec_) {
+      // Late by whole periods: skip the frames which are already stale.
+      double skip = floor((now - deadline) / period_usec_);
+      if (skip > kPipelineClockMaxDropFrames) {
+        // A stall (pause, debugger, ...): catching up makes no sense.
+        gettimeofday(&start_time_, NULL);
+        next_index_ = 0.0;
+        deadline = 0.0;
+        now = 0.0;
+        restarts_++;
+      } else {
+        drop = static_cast<int>(skip);
+        dropped_ += drop;
+        next_index_ += skip;
+        deadline += skip * period_usec_;
+      }
+    }
+    lag_usec = (now > deadline) ? (now - deadline) : 0.0;
+  }
+  next_index_ += 1.0;
+
+  gettimeofday(&last_time_, NULL);
+  frames_++;
+  sum_lag_usec_ += lag_usec;
+  if (lag_usec > max_lag_usec_) {
+    max_lag_usec_ = lag_usec;
+  }
+  return drop;
+}
+
+/**
+ * @brief
+ * Get the speed relative to the source.
+ * @return speed (1.0: real time, 0.0: as fast as possible).
+ */
+double PipelineClock::multiple(void) const {
+  switch (mode_) {
+    case kPipelineClockFreeRun:
+      return 0.0;
+    case kPipelineClockMultiple:
+      return multiple_;
+    default:
+      return 1.0;
+  }
+}
+
+/**
+ * @brief
+ * Get the average lag of the delivered frames behind their deadlines.
+ * @return lag in milliseconds.
+ */
+double PipelineClock::mean_lag_msec(void) const {
+  if (frames_ == 0) {
+    return 0.0;
+  }
+  return sum_lag_usec_ / frames_ / 1000.0;
+}
+
+/**
+ * @brief
+ * Get the delivered frame rate since Start().
+ * @return frame rate (0.0: less than 2 frames).
+ */
+double PipelineClock::actual_fps(void) const {
+  double usec = (last_time_.tv_sec - first_time_.tv_sec) * 1000000.0 +
+                (last_time_.tv_usec - first_time_.tv_usec);
+  if (frames_ < 2 || usec <= 0.0) {
+    return 0.0;
+  }
+  return (frames_ - 1) * 1000000.0 / usec;
+}
+
+/**
+ * @brief
+ * Get the name of a pacing mode for the logs.
+ * @param mode [in] pacing mode.
+ * @return name of the mode.
+ */
+const char* PipelineClock::ModeName(PipelineClockMode mode) {
+  switch (mode) {
+    case kPipelineClockRealTime:
+      return "real time";
+    case kPipelineClockFreeRun:
+      return "as fast as possible";
+    case kPipelineClockMultiple:
+      return "fixed multiple";
+    default:
+      return "unknown";
+  }
+}
+
+/**
+ * @brief
+ * Get the microseconds elapsed since start_time_.
+ * @return elapsed time.
+ */
+double PipelineClock::ElapsedUsec(void) const {
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  return (now.tv_sec - start_time_.tv_sec) * 1000000.0 +
+         (now.tv_usec - start_time_.tv_usec);
+}
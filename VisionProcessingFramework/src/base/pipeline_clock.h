@@ -0,0 +1,192 @@
+/**
+ * @file      pipeline_clock.h
+ * @brief     Header for PipelineClock class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _PIPELINE_CLOCK_H_
+#define _PIPELINE_CLOCK_H_
+
+#include <sys/time.h>
+
+/* Number of the modes of the pipeline clock. */
+#define kPipelineClockModeNum 3
+
+/* Lag (in frames) above which the schedule restarts instead of dropping. */
+#define kPipelineClockMaxDropFrames 120
+
+/**
+ * @enum PipelineClockMode
+ * @brief How an input plugin paces its frames.
+ */
+typedef enum {
+  /*! Deliver at the rate of the source, dropping frames when late */
+  kPipelineClockRealTime = 0,
+  /*! Deliver as fast as the pipeline takes the frames, never drop */
+  kPipelineClockFreeRun,
+  /*! Deliver at a fixed multiple of the rate of the source */
+  kPipelineClockMultiple,
+} PipelineClockMode;
+
+/**
+ * @class PipelineClock
+ * @brief Clock which an input plugin schedules its frames against.
+ * The deadline of the n-th source frame is start + n * period, so the time
+ * spent by the rest of the pipeline is absorbed instead of added to the
+ * period, and the rate does not drift. When the pipeline is late by whole
+ * periods, those source frames are dropped so that the latency never
+ * accumulates. Only the thread of the input plugin uses the clock.
+ */
+class PipelineClock {
+ public:
+  /**
+   * @brief
+   * Constructor (real time at 60 fps).
+   */
+  PipelineClock(void);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~PipelineClock(void);
+
+  /**
+   * @brief
+   * Set the pacing. Takes effect from the next Start().
+   * @param mode [in] pacing mode.
+   * @param fps [in] frame rate of the source.
+   * @param multiple [in] speed of kPipelineClockMultiple (2.0: twice as fast).
+   */
+  void Configure(PipelineClockMode mode, double fps, double multiple);
+
+  /**
+   * @brief
+   * Restart the schedule and the telemetry. The first frame is due at once.
+   */
+  void Start(void);
+
+  /**
+   * @brief
+   * Wait until the next frame is due.
+   * @return number of the source frames to drop before the next frame.
+   */
+  int WaitNextFrame(void);
+
+  /**
+   * @brief
+   * Get the pacing mode.
+   * @return pacing mode.
+   */
+  PipelineClockMode mode(void) const { return mode_; }
+
+  /**
+   * @brief
+   * Get the speed relative to the source.
+   * @return speed (1.0: real time, 0.0: as fast as possible).
+   */
+  double multiple(void) const;
+
+  /**
+   * @brief
+   * Get the number of the frames delivered since Start().
+   * @return number of the frames.
+   */
+  unsigned int frames(void) const { return frames_; }
+
+  /**
+   * @brief
+   * Get the number of the source frames dropped since Start().
+   * @return number of the frames.
+   */
+  unsigned int dropped(void) const { return dropped_; }
+
+  /**
+   * @brief
+   * Get the number of the times the schedule restarted after a long stall.
+   * @return number of the restarts.
+   */
+  unsigned int restarts(void) const { return restarts_; }
+
+  /**
+   * @brief
+   * Get the average lag of the delivered frames behind their deadlines.
+   * @return lag in milliseconds.
+   */
+  double mean_lag_msec(void) const;
+
+  /**
+   * @brief
+   * Get the maximum lag of the delivered frames behind their deadlines.
+   * @return lag in milliseconds.
+   */
+  double max_lag_msec(void) const { return max_lag_usec_ / 1000.0; }
+
+  /**
+   * @brief
+   * Get the delivered frame rate since Start().
+   * @return frame rate (0.0: less than 2 frames).
+   */
+  double actual_fps(void) const;
+
+  /**
+   * @brief
+   * Get the name of a pacing mode for the logs.
+   * @param mode [in] pacing mode.
+   * @return name of the mode.
+   */
+  static const char* ModeName(PipelineClockMode mode);
+
+ private:
+  /**
+   * @brief
+   * Get the microseconds elapsed since start_time_.
+   * @return elapsed time.
+   */
+  double ElapsedUsec(void) const;
+
+  /*! Pacing mode */
+  PipelineClockMode mode_;
+
+  /*! Frame rate of the source */
+  double fps_;
+
+  /*! Speed of kPipelineClockMultiple */
+  double multiple_;
+
+  /*! Interval between the deadlines in microseconds */
+  double period_usec_;
+
+  /*! Whether the first frame has been delivered */
+  bool is_started_;
+
+  /*! Time of the deadline of source frame 0 */
+  struct timeval start_time_;
+
+  /*! Index of the source frame due next, counted from start_time_ */
+  double next_index_;
+
+  /*! Number of the delivered frames */
+  unsigned int frames_;
+
+  /*! Number of the dropped source frames */
+  unsigned int dropped_;
+
+  /*! Number of the restarts of the schedule */
+  unsigned int restarts_;
+
+  /*! Sum of the lags of the delivered frames in microseconds */
+  double sum_lag_usec_;
+
+  /*! Maximum lag of the delivered frames in microseconds */
+  double max_lag_usec_;
+
+  /*! Time of the first delivered frame */
+  struct timeval first_time_;
+
+  /*! Time of the last delivered frame */
+  struct timeval last_time_;
+};
+
+#endif /* _PIPELINE_CLOCK_H_*/
@@ -0,0 +1,413 @@
+/**
+ * @file      pixel_convert.cpp
+ * @brief     Source for the pixel format conversion
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./pixel_convert.h"
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define PIXEL_CONVERT_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define PIXEL_CONVERT_SSE2
+#endif
+
+/**
+ * @brief
+ * Get log2 of the downscale factor.
+ * @param downscale [in] downscale factor.
+ * @return log2 (-1: not supported).
+ */
+static int DownscaleShift(int downscale) {
+  switch (downscale) {
+    case 1:
+      return 0;
+    case 2:
+      return 1;
+    case 4:
+      return 2;
+    default:
+      return -1;
+  }
+}
+
+/**
+ * @brief
+ * Convert a row from 16 to 8 bits with a right shift and saturation.
+ * @param src [in] source row.
+ * @param dst [out] destination row.
+ * @param count [in] number of the elements.
+ * @param shift [in] right shift (0 - 8).
+ */
+static void Row16To8(const UINT16* src, UINT8* dst, int count, int shift) {
+  int i = 0;
+#if defined(PIXEL_CONVERT_NEON)
+  int16x8_t neg_shift = vdupq_n_s16(static_cast<INT16>(-shift));
+  for (; i + 16 <= count; i += 16) {
+    uint16x8_t low = vshlq_u16(vld1q_u16(src + i), neg_shift);
+    uint16x8_t high = vshlq_u16(vld1q_u16(src + i + 8), neg_shift);
+    vst1q_u8(dst + i, vcombine_u8(vqmovn_u16(low), vqmovn_u16(high)));
+  }
+#elif defined(PIXEL_CONVERT_SSE2)
+  // packus saturates signed values, so the shift must clear the top bit.
+  if (shift > 0) {
+    __m128i count_shift = _mm_cvtsi32_si128(shift);
+    for (; i + 16 <= count; i += 16) {
+      __m128i low = _mm_srl_epi16(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)),
+          count_shift);
+      __m128i high = _mm_srl_epi16(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8)),
+          count_shift);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                       _mm_packus_epi16(low, high));
+    }
+  }
+#endif
+  for (; i < count; i++) {
+    unsigned int value = src[i] >> shift;
+    dst[i] = static_cast<UINT8>((value > 0xFF) ? 0xFF : value);
+  }
+}
+
+/**
+ * @brief
+ * Convert a row from 8 to 16 bits with a left shift.
+ * @param src [in] source row.
+ * @param dst [out] destination row.
+ * @param count [in] number of the elements.
+ * @param shift [in] left shift (0 - 8).
+ */
+static void Row8To16(const UINT8* src, UINT16* dst, int count, int shift) {
+  int i = 0;
+#if defined(PIXEL_CONVERT_NEON)
+  int16x8_t left_shift = vdupq_n_s16(static_cast<INT16>(shift));
+  for (; i + 16 <= count; i += 16) {
+    uint8x16_t value = vld1q_u8(src + i);
+    vst1q_u16(dst + i, vshlq_u16(vmovl_u8(vget_low_u8(value)), left_shift));
+    vst1q_u16(dst + i + 8,
+              vshlq_u16(vmovl_u8(vget_high_u8(value)), left_shift));
+  }
+#elif defined(PIXEL_CONVERT_SSE2)
+  __m128i count_shift = _mm_cvtsi32_si128(shift);
+  __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= count; i += 16) {
+    __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(dst + i),
+        _mm_sll_epi16(_mm_unpacklo_epi8(value, zero), count_shift));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(dst + i + 8),
+        _mm_sll_epi16(_mm_unpackhi_epi8(value, zero), count_shift));
+  }
+#endif
+  for (; i < count; i++) {
+    dst[i] = static_cast<UINT16>(src[i] << shift);
+  }
+}
+
+/**
+ * @brief
+ * Shift a 16 bit row (left if shift > 0, right if shift < 0), saturating
+ * to max_value.
+ * @param src [in] source row.
+ * @param dst [out] destination row.
+ * @param count [in] number of the elements.
+ * @param shift [in] shift.
+ * @param max_value [in] maximum value of dst.
+ */
+static void Row16To16(const UINT16* src, UINT16* dst, int count, int shift,
+                      unsigned int max_value) {
+  if (shift >= 0) {
+    unsigned int max_src = max_value >> shift;
+    for (int i = 0; i < count; i++) {
+      unsigned int value = src[i];
+      dst[i] = static_cast<UINT16>((value > max_src) ? max_value
+                                                     : (value << shift));
+    }
+  } else {
+    for (int i = 0; i < count; i++) {
+      unsigned int value = src[i] >> (-shift);
+      dst[i] = static_cast<UINT16>((value > max_value) ? max_value : value);
+    }
+  }
+}
+
+/**
+ * @brief
+ * Read a pixel element as an unsigned integer.
+ * @param row [in] row pointer.
+ * @param is_16u [in] If true, the elements are 16 bits.
+ * @param index [in] element index.
+ * @return element value.
+ */
+static inline unsigned int ReadElement(const UINT8* row, bool is_16u,
+                                       int index) {
+  if (is_16u) {
+    return reinterpret_cast<const UINT16*>(row)[index];
+  }
+  return row[index];
+}
+
+/**
+ * @brief
+ * Write a pixel element, saturating to max_value.
+ * @param row [in] row pointer.
+ * @param is_16u [in] If true, the elements are 16 bits.
+ * @param index [in] element index.
+ * @param value [in] element value.
+ * @param max_value [in] maximum value.
+ */
+static inline void WriteElement(UINT8* row, bool is_16u, int index,
+                                unsigned int value, unsigned int max_value) {
+  if (value > max_value) {
+    value = max_value;
+  }
+  if (is_16u) {
+    reinterpret_cast<UINT16*>(row)[index] = static_cast<UINT16>(value);
+  } else {
+    row[index] = static_cast<UINT8>(value);
+  }
+}
+
+/**
+ * @brief
+ * Box downscale fused with a bit depth shift.
+ * dst(y, x, c) = (sum of the block of src) >> (2 * scale_shift) shifted by
+ * bit_shift (right if > 0, left if < 0).
+ * @param src [in] source image.
+ * @param dst [out] destination image (allocated).
+ * @param scale_shift [in] log2 of the downscale factor.
+ * @param bit_shift [in] bit depth shift.
+ * @param max_value [in] maximum value of dst.
+ */
+static void DownscaleShifted(const cv::Mat& src, cv::Mat* dst, int scale_shift,
+                             int bit_shift, unsigned int max_value) {
+  int factor = 1 << scale_shift;
+  int channels = src.channels();
+  bool src_16u = (src.depth() == CV_16U);
+  bool dst_16u = (dst->depth() == CV_16U);
+  int sum_shift = 2 * scale_shift + ((bit_shift > 0) ? bit_shift : 0);
+  int left_shift = (bit_shift < 0) ? -bit_shift : 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (int y = 0; y < dst->rows; y++) {
+    UINT8* dst_row = dst->ptr<UINT8>(y);
+    for (int x = 0; x < dst->cols; x++) {
+      for (int c = 0; c < channels; c++) {
+        unsigned int sum = 0;
+        for (int j = 0; j < factor; j++) {
+          const UINT8* src_row = src.ptr<UINT8>((y << scale_shift) + j);
+          for (int i = 0; i < factor; i++) {
+            sum += ReadElement(src_row, src_16u,
+                               ((x << scale_shift) + i) * channels + c);
+          }
+        }
+        WriteElement(dst_row, dst_16u, x * channels + c,
+                     (sum >> sum_shift) << left_shift, max_value);
+      }
+    }
+  }
+}
+
+/**
+ * @brief
+ * Convert an image to 8 bits per channel (10/12/16 -> 8 bit).
+ * @param src [in] 8U or 16U image, any number of channels.
+ * @param src_bits [in] significant bits of a 16U src (8 - 16).
+ * @param downscale [in] downscale factor (1, 2 or 4).
+ * @param dst [out] 8U image.
+ * @return If false, the format is not supported.
+ */
+bool PixelConvertTo8U(const cv::Mat& src, int src_bits, int downscale,
+                      cv::Mat* dst) {
+  int scale_shift = DownscaleShift(downscale);
+  if (dst == NULL || src.empty() || scale_shift < 0) {
+    return false;
+  }
+  int bit_shift;
+  if (src.depth() == CV_8U) {
+    bit_shift = 0;
+  } else if (src.depth() == CV_16U && src_bits >= 8 && src_bits <= 16) {
+    bit_shift = src_bits - 8;
+  } else {
+    DEBUG_PRINT("PixelConvertTo8U: unsupported depth:%d bits:%d\n",
+                src.depth(), src_bits);
+    return false;
+  }
+  int channels = src.channels();
+  dst->create(src.rows >> scale_shift, src.cols >> scale_shift,
+              CV_MAKETYPE(CV_8U, channels));
+
+  if (scale_shift != 0) {
+    DownscaleShifted(src, dst, scale_shift, bit_shift, 0xFF);
+    return true;
+  }
+  if (src.depth() == CV_8U) {
+    src.copyTo(*dst);
+    return true;
+  }
+  int count = src.cols * channels;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (int y = 0; y < src.rows; y++) {
+    Row16To8(src.ptr<UINT16>(y), dst->ptr<UINT8>(y), count, bit_shift);
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Convert an image to 16 bits per channel (8/10 -> 10/16 bit).
+ * @param src [in] 8U or 16U image, any number of channels.
+ * @param src_bits [in] significant bits of src (8 for 8U).
+ * @param dst_bits [in] significant bits of dst (src_bits - 16).
+ * @param dst [out] 16U image.
+ * @return If false, the format is not supported.
+ */
+bool PixelConvertTo16U(const cv::Mat& src, int src_bits, int dst_bits,
+                       cv::Mat* dst) {
+  if (dst == NULL || src.empty() || dst_bits < 8 || dst_bits > 16) {
+    return false;
+  }
+  if (src.depth() == CV_8U) {
+    src_bits = 8;
+  } else if (src.depth() != CV_16U || src_bits < 8 || src_bits > 16) {
+    DEBUG_PRINT("PixelConvertTo16U: unsupported depth:%d bits:%d\n",
+                src.depth(), src_bits);
+    return false;
+  }
+  int shift = dst_bits - src_bits;
+  unsigned int max_value = (1U << dst_bits) - 1;
+  int count = src.cols * src.channels();
+  dst->create(src.rows, src.cols, CV_MAKETYPE(CV_16U, src.channels()));
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (int y = 0; y < src.rows; y++) {
+    if (src.depth() == CV_8U) {
+      Row8To16(src.ptr<UINT8>(y), dst->ptr<UINT16>(y), count, shift);
+    } else {
+      Row16To16(src.ptr<UINT16>(y), dst->ptr<UINT16>(y), count, shift,
+                max_value);
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Convert Bayer data (Bayer8 <-> Bayer16), keeping the color filter array.
+ * The downscale averages the pixels of the same color, so the result is
+ * still a Bayer image of the same pattern.
+ * @param src [in] 8U or 16U single channel Bayer image.
+ * @param src_bits [in] significant bits of src (8 for 8U).
+ * @param dst_bits [in] significant bits of dst (8: 8U, 9 - 16: 16U).
+ * @param downscale [in] downscale factor (1, 2 or 4).
+ * @param dst [out] Bayer image.
+ * @return If false, the format is not supported.
+ */
+bool PixelConvertBayer(const cv::Mat& src, int src_bits, int dst_bits,
+                       int downscale, cv::Mat* dst) {
+  int scale_shift = DownscaleShift(downscale);
+  if (dst == NULL || src.empty() || src.channels() != 1 || scale_shift < 0 ||
+      dst_bits < 8 || dst_bits > 16) {
+    return false;
+  }
+  if (src.depth() == CV_8U) {
+    src_bits = 8;
+  } else if (src.depth() != CV_16U || src_bits < 8 || src_bits > 16) {
+    return false;
+  }
+
+  if (scale_shift == 0) {
+    if (dst_bits == 8) {
+      return PixelConvertTo8U(src, src_bits, 1, dst);
+    }
+    return PixelConvertTo16U(src, src_bits, dst_bits, dst);
+  }
+
+  // Keep whole 2x2 cells of the pattern.
+  int dst_rows = (src.rows >> scale_shift) & ~1;
+  int dst_cols = (src.cols >> scale_shift) & ~1;
+  if (dst_rows == 0 || dst_cols == 0) {
+    return false;
+  }
+  dst->create(dst_rows, dst_cols, (dst_bits == 8) ? CV_8UC1 : CV_16UC1);
+
+  int factor = 1 << scale_shift;
+  bool src_16u = (src.depth() == CV_16U);
+  bool dst_16u = (dst->depth() == CV_16U);
+  int bit_shift = src_bits - dst_bits;
+  int sum_shift = 2 * scale_shift + ((bit_shift > 0) ? bit_shift : 0);
+  int left_shift = (bit_shift < 0) ? -bit_shift : 0;
+  unsigned int max_value = (1U << dst_bits) - 1;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (int y = 0; y < dst_rows; y++) {
+    UINT8* dst_row = dst->ptr<UINT8>(y);
+    // Same color pixels are 2 apart; a dst cell covers factor x factor cells.
+    int src_y = ((y >> 1) << (scale_shift + 1)) + (y & 1);
+    for (int x = 0; x < dst_cols; x++) {
+      int src_x = ((x >> 1) << (scale_shift + 1)) + (x & 1);
+      unsigned int sum = 0;
+      for (int j = 0; j < factor; j++) {
+        const UINT8* src_row = src.ptr<UINT8>(src_y + 2 * j);
+        for (int i = 0; i < factor; i++) {
+          sum += ReadElement(src_row, src_16u, src_x + 2 * i);
+        }
+      }
+      WriteElement(dst_row, dst_16u, x, (sum >> sum_shift) << left_shift,
+                   max_value);
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief
+ * Swap the first and the third channels (RGB <-> BGR, RGBA <-> BGRA).
+ * @param src [in] 8U or 16U image of 3 or 4 channels.
+ * @param dst [out] swapped image (can be src).
+ * @return If false, the format is not supported.
+ */
+bool PixelConvertSwapRB(const cv::Mat& src, cv::Mat* dst) {
+  int channels = src.channels();
+  if (dst == NULL || src.empty() || (channels != 3 && channels != 4) ||
+      (src.depth() != CV_8U && src.depth() != CV_16U)) {
+    return false;
+  }
+  if (dst != &src) {
+    dst->create(src.rows, src.cols, src.type());
+  }
+  bool is_16u = (src.depth() == CV_16U);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (int y = 0; y < src.rows; y++) {
+    const UINT8* src_row = src.ptr<UINT8>(y);
+    UINT8* dst_row = dst->ptr<UINT8>(y);
+    for (int x = 0; x < src.cols * channels; x += channels) {
+      unsigned int first = ReadElement(src_row, is_16u, x);
+      unsigned int second = ReadElement(src_row, is_16u, x + 1);
+      unsigned int third = ReadElement(src_row, is_16u, x + 2);
+      WriteElement(dst_row, is_16u, x, third, 0xFFFF);
+      WriteElement(dst_row, is_16u, x + 1, second, 0xFFFF);
+      WriteElement(dst_row, is_16u, x + 2, first, 0xFFFF);
+      if (channels == 4) {
+        WriteElement(dst_row, is_16u, x + 3,
+                     ReadElement(src_row, is_16u, x + 3), 0xFFFF);
+      }
+    }
+  }
+  return true;
+}
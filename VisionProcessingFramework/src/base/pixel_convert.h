@@ -0,0 +1,72 @@
+/**
+ * @file      pixel_convert.h
+ * @brief     Header for the pixel format conversion
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _PIXEL_CONVERT_H_
+#define _PIXEL_CONVERT_H_
+
+#include "./include.h"
+
+/* Bit depth of the Bayer data stored in 16 bits. */
+#define kPixelConvertSensorBits 10
+
+/*
+ * All the conversions use integer shifts only, and write into the image
+ * given by the caller: dst->create() reallocates only when the size or type
+ * changes, so a dst kept by the caller (or a pooled slot) is reused frame by
+ * frame. Except PixelConvertSwapRB, dst must not be src.
+ * downscale is 1, 2 or 4 (box average of downscale x downscale pixels).
+ */
+
+/**
+ * @brief
+ * Convert an image to 8 bits per channel (10/12/16 -> 8 bit).
+ * @param src [in] 8U or 16U image, any number of channels.
+ * @param src_bits [in] significant bits of a 16U src (8 - 16).
+ * @param downscale [in] downscale factor (1, 2 or 4).
+ * @param dst [out] 8U image.
+ * @return If false, the format is not supported.
+ */
+bool PixelConvertTo8U(const cv::Mat& src, int src_bits, int downscale,
+                      cv::Mat* dst);
+
+/**
+ * @brief
+ * Convert an image to 16 bits per channel (8/10 -> 10/16 bit).
+ * @param src [in] 8U or 16U image, any number of channels.
+ * @param src_bits [in] significant bits of src (8 for 8U).
+ * @param dst_bits [in] significant bits of dst (src_bits - 16).
+ * @param dst [out] 16U image.
+ * @return If false, the format is not supported.
+ */
+bool PixelConvertTo16U(const cv::Mat& src, int src_bits, int dst_bits,
+                       cv::Mat* dst);
+
+/**
+ * @brief
+ * Convert Bayer data (Bayer8 <-> Bayer16), keeping the color filter array.
+ * The downscale averages the pixels of the same color, so the result is
+ * still a Bayer image of the same pattern.
+ * @param src [in] 8U or 16U single channel Bayer image.
+ * @param src_bits [in] significant bits of src (8 for 8U).
+ * @param dst_bits [in] significant bits of dst (8: 8U, 9 - 16: 16U).
+ * @param downscale [in] downscale factor (1, 2 or 4).
+ * @param dst [out] Bayer image.
+ * @return If false, the format is not supported.
+ */
+bool PixelConvertBayer(const cv::Mat& src, int src_bits, int dst_bits,
+                       int downscale, cv::Mat* dst);
+
+/**
+ * @brief
+ * Swap the first and the third channels (RGB <-> BGR, RGBA <-> BGRA).
+ * @param src [in] 8U or 16U image of 3 or 4 channels.
+ * @param dst [out] swapped image (can be src).
+ * @return If false, the format is not supported.
+ */
+bool PixelConvertSwapRB(const cv::Mat& src, cv::Mat* dst);
+
+#endif /* _PIXEL_CONVERT_H_*/
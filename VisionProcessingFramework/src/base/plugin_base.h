@@ -11,9 +11,14 @@
 #include <string>
 #include <vector>
 
+#include "./async_frame_worker.h"
 #include "./common_param.h"
+#include "./frame_counter_code.h"
+#include "./frame_derivatives.h"
+#include "./frame_metadata.h"
 #include "./include.h"
 #include "./iplugin.h"
+#include "./latency_stats.h"
 #include "./log_level.h"
 #include "./port_spec.h"
 
@@ -77,10 +82,40 @@ class PluginBase : public IPlugin {
   /*! used for the list of parameter setting string */
   std::vector<wxString> setting_params_;
 
+  /*! Number of frames dropped by the asynchronous completion mode */
+  unsigned int async_dropped_frames_;
+
+  /*! Scheduling events of the asynchronous worker threads */
+  ThreadSchedCounts async_sched_counts_;
+
+  /*! Placement of the last asynchronous worker thread */
+  std::string async_placement_;
+
+  /*! Age of the frames when this plugin displayed or stored them */
+  LatencyStats latency_stats_;
+
+  /*! Number of frames whose drawn frame counter did not match */
+  unsigned int frame_code_errors_;
+
+  /*! Derived images made by this plugin when the frame has no shared ones */
+  cv::Mat derived_images_[kFrameDerivedNum];
+
+  /*! Pyramids made by this plugin when the frame has no shared ones */
+  FramePyramid derived_pyramids_[kFrameDerivedNum];
+
  protected:
   /*! Logger function */
   void* logger_func_;
 
+  /*! Worker for the asynchronous completion mode (NULL: synchronous) */
+  AsyncFrameWorker* async_worker_;
+
+  /*! Metadata of the current frame (NOT own it, NULL: no metadata) */
+  FrameMetadata* frame_metadata_;
+
+  /*! Derived formats shared at a branch (NOT own it, NULL: not shared) */
+  FrameDerivatives* frame_derivatives_;
+
  public:
   /**
    * @brief
@@ -98,6 +133,12 @@ class PluginBase : public IPlugin {
     original_plugin_name_ = "";
     proc_time_counter_ = 0;
     proc_time_ = 0.0f;
+    async_worker_ = NULL;
+    async_dropped_frames_ = 0;
+    ThreadSchedCountsClear(&async_sched_counts_);
+    frame_metadata_ = NULL;
+    frame_derivatives_ = NULL;
+    frame_code_errors_ = 0;
   }
 
   /**
@@ -105,6 +146,7 @@ class PluginBase : public IPlugin {
    * Destructor.
    */
   virtual ~PluginBase(void) {
+    StopAsyncProcess(false);
     for (unsigned int i = 0; i < input_port_candidate_specs_.size(); i++) {
       delete input_port_candidate_specs_[i];
     }
@@ -490,6 +532,226 @@ class PluginBase : public IPlugin {
    */
   float proc_time(void) { return proc_time_; }
 
+  /**
+   * @brief
+   * Set the metadata of the frame passed to the next DoProcess.
+   * @param metadata [in] metadata owned by the flow (NOT own it).
+   */
+  void set_frame_metadata(FrameMetadata* metadata) {
+    frame_metadata_ = metadata;
+  }
+
+  /**
+   * @brief
+   * Get the metadata of the current frame.
+   * @return metadata of the current frame (can be NULL).
+   */
+  FrameMetadata* frame_metadata(void) { return frame_metadata_; }
+
+  /**
+   * @brief
+   * Set the derived formats shared with the other consumers of the frame
+   * passed to the next DoProcess.
+   * @param derivatives [in] derived formats (NOT own it, NULL: not shared).
+   */
+  void set_frame_derivatives(FrameDerivatives* derivatives) {
+    frame_derivatives_ = derivatives;
+    // It is called for every frame: the own pyramid levels are stale.
+    for (int i = 0; i < kFrameDerivedNum; i++) {
+      derived_pyramids_[i].Reset();
+    }
+  }
+
+  /**
+   * @brief
+   * Get the derived formats shared with the other consumers of the frame.
+   * @return derived formats (can be NULL).
+   */
+  FrameDerivatives* frame_derivatives(void) { return frame_derivatives_; }
+
+  /**
+   * @brief
+   * Get a derived format of the current frame. If the frame is shared at a
+   * branch, the image is computed once for all the consumers.
+   * @param src_image [in] current frame given to DoProcess.
+   * @param format [in] derived format.
+   * @return derived image (valid until the next DoProcess), or NULL if the
+   * format of src_image is not supported.
+   */
+  const cv::Mat* GetDerivedImage(const cv::Mat* src_image,
+                                 FrameDerivedFormat format) {
+    if (src_image == NULL || format < 0 || format >= kFrameDerivedNum) {
+      return NULL;
+    }
+    if (format == kFrameDerived8U && src_image->depth() == CV_8U) {
+      return src_image;
+    }
+    if (frame_derivatives_ != NULL) {
+      return frame_derivatives_->Get(format, *src_image);
+    }
+    const cv::Mat* eight_bit = src_image;
+    if (format == kFrameDerivedGray8U && src_image->depth() != CV_8U) {
+      if (!FrameDerivativesCompute(*src_image, kFrameDerived8U, NULL,
+                                   &derived_images_[kFrameDerived8U])) {
+        return NULL;
+      }
+      eight_bit = &derived_images_[kFrameDerived8U];
+    }
+    if (!FrameDerivativesCompute(*src_image, format, eight_bit,
+                                 &derived_images_[format])) {
+      return NULL;
+    }
+    return &derived_images_[format];
+  }
+
+  /**
+   * @brief
+   * Get a pyramid level of a derived format of the current frame. If the
+   * frame is shared at a branch, the level is computed once for all the
+   * consumers; otherwise it is computed once per DoProcess.
+   * @param src_image [in] current frame given to DoProcess.
+   * @param format [in] derived format (level 0).
+   * @param level [in] level (size = size of the format >> level, see
+   * FramePyramid::LevelFor()).
+   * @return level image (valid until the next DoProcess), or NULL if the
+   * format of src_image is not supported or the level is empty.
+   */
+  const cv::Mat* GetDerivedLevel(const cv::Mat* src_image,
+                                 FrameDerivedFormat format, int level) {
+    if (src_image == NULL || format < 0 || format >= kFrameDerivedNum) {
+      return NULL;
+    }
+    if (frame_derivatives_ != NULL) {
+      return frame_derivatives_->GetLevel(format, level, *src_image);
+    }
+    const cv::Mat* base = GetDerivedImage(src_image, format);
+    if (base == NULL) {
+      return NULL;
+    }
+    return derived_pyramids_[format].GetLevel(level, *base);
+  }
+
+  /**
+   * @brief
+   * Whether DoProcess completes frames asynchronously.
+   * @return true, the plugin runs in the asynchronous completion mode.
+   */
+  bool is_async_process(void) { return async_worker_ != NULL; }
+
+  /**
+   * @brief
+   * Whether the plugin accepts a new frame without dropping it.
+   * The framework skips DoProcess of an output plugin when this is false.
+   * @return true, DoProcess should be called for the current frame.
+   */
+  virtual bool CanAcceptAsyncFrame(void) {
+    if (async_worker_ == NULL || async_worker_->CanAccept()) {
+      return true;
+    }
+    async_dropped_frames_++;
+    return false;
+  }
+
+  /**
+   * @brief
+   * Get the number of frames accepted but not yet completed.
+   * @return number of in-flight frames.
+   */
+  int in_flight_frames(void) {
+    if (async_worker_ == NULL) {
+      return 0;
+    }
+    return async_worker_->in_flight_frames();
+  }
+
+  /**
+   * @brief
+   * Get the number of frames dropped by the asynchronous completion mode.
+   * @return number of dropped frames.
+   */
+  unsigned int async_dropped_frames(void) {
+    if (async_worker_ == NULL) {
+      return async_dropped_frames_;
+    }
+    return async_dropped_frames_ + async_worker_->dropped_frames();
+  }
+
+  /**
+   * @brief
+   * Get the scheduling events of the asynchronous worker threads.
+   * @return scheduling events.
+   */
+  ThreadSchedCounts async_sched_counts(void) {
+    ThreadSchedCounts counts = async_sched_counts_;
+    if (async_worker_ != NULL) {
+      ThreadSchedCountsAdd(&counts, async_worker_->sched_counts());
+    }
+    return counts;
+  }
+
+  /**
+   * @brief
+   * Get the placement of the asynchronous worker thread.
+   * @return placement (empty if the mode was not started).
+   */
+  std::string async_placement(void) {
+    if (async_worker_ != NULL) {
+      return async_worker_->placement();
+    }
+    return async_placement_;
+  }
+
+  /**
+   * @brief
+   * Record the age of a frame which was displayed or stored by this plugin.
+   * When the frame carries a drawn frame counter, the counter is checked
+   * against the metadata.
+   * @param metadata [in] metadata of the frame (can be NULL).
+   * @param image [in] image of the frame (can be NULL).
+   */
+  void RecordFrameLatency(const FrameMetadata* metadata,
+                          const cv::Mat* image) {
+    if (metadata == NULL) {
+      return;
+    }
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    double age = FrameMetadataAgeMsec(metadata, &now);
+    if (age >= 0.0) {
+      latency_stats_.Add(age);
+    }
+    if (metadata->has_frame_code && image != NULL) {
+      unsigned int frame_number;
+      if (FrameCounterCodeDecode(*image, &frame_number) == false ||
+          frame_number != metadata->frame_number) {
+        frame_code_errors_++;
+      }
+    }
+  }
+
+  /**
+   * @brief
+   * Get the latency distribution of the frames displayed or stored.
+   * @return latency distribution.
+   */
+  LatencyStats* latency_stats(void) { return &latency_stats_; }
+
+  /**
+   * @brief
+   * Get the number of frames whose drawn frame counter did not match.
+   * @return number of mismatched frames.
+   */
+  unsigned int frame_code_errors(void) { return frame_code_errors_; }
+
+  /**
+   * @brief
+   * Clear the latency distribution and the frame counter check.
+   */
+  void ClearFrameLatency(void) {
+    latency_stats_.Clear();
+    frame_code_errors_ = 0;
+  }
+
   /**
    * @brief
    * Get the list of parameter setting string defined by each plugin to save the
@@ -607,6 +869,63 @@ class PluginBase : public IPlugin {
    * @param is_use_dest_buffer [in] if true, use dest buffer
    */
   void set_is_use_dest_buffer(bool is_use_dest) { is_use_dest_ = is_use_dest; }
+
+  /**
+   * @brief
+   * Start the asynchronous completion mode. DoProcess then only submits the
+   * frame to the worker and returns while the frame is pending.
+   * @param handler [in] frame handler called on the worker thread.
+   * @param max_in_flight [in] maximum number of in-flight frames.
+   * @param policy [in] drop policy when the limit is reached.
+   * @return true, the worker thread is running.
+   */
+  bool StartAsyncProcess(AsyncFrameHandler* handler, int max_in_flight,
+                         AsyncDropPolicy policy) {
+    StopAsyncProcess(false);
+    async_dropped_frames_ = 0;
+    ThreadSchedCountsClear(&async_sched_counts_);
+    async_worker_ = new AsyncFrameWorker(handler, max_in_flight, policy);
+    async_worker_->set_thread_name(plugin_name_ + kThreadPlacementAsyncSuffix);
+    if (async_worker_->Start() == false) {
+      delete async_worker_;
+      async_worker_ = NULL;
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief
+   * Stop the asynchronous completion mode.
+   * @param drain [in] If true, pending frames are completed before stopping.
+   */
+  void StopAsyncProcess(bool drain) {
+    if (async_worker_ == NULL) {
+      return;
+    }
+    async_worker_->Stop(drain);
+    async_dropped_frames_ += async_worker_->dropped_frames();
+    ThreadSchedCountsAdd(&async_sched_counts_, async_worker_->sched_counts());
+    async_placement_ = async_worker_->placement();
+    DEBUG_PRINT("[%s] async completed:%u dropped:%u\n", plugin_name_.c_str(),
+                async_worker_->completed_frames(), async_dropped_frames_);
+    delete async_worker_;
+    async_worker_ = NULL;
+  }
+
+  /**
+   * @brief
+   * Submit a frame to the asynchronous worker.
+   * The metadata of the current frame is copied together with the frame.
+   * @param image [in] frame to process. The frame is copied.
+   * @return true, the frame is pending. false, the frame was dropped.
+   */
+  bool SubmitAsyncFrame(const cv::Mat& image) {
+    if (async_worker_ == NULL) {
+      return false;
+    }
+    return async_worker_->Submit(image, frame_metadata_);
+  }
 };
 
 typedef void (*LogFunc)(enum LogLevel, wxString, wxString, ...);
@@ -0,0 +1,151 @@
+/**
+ * @file      register_table.cpp
+ * @brief     Source for RegisterTableLoader class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./register_table.h"
+#include <sys/time.h>
+#include <string.h>
+
+/**
+ * @brief
+ * Constructor.
+ * @param write_func [in] burst write function.
+ * @param read_func [in] burst read function (NULL: no verification).
+ */
+RegisterTableLoader::RegisterTableLoader(RegisterTableAccessFunc write_func,
+                                         RegisterTableAccessFunc read_func)
+    : write_func_(write_func), read_func_(read_func), run_address_(0) {
+  memset(&result_, 0, sizeof(result_));
+}
+
+/**
+ * @brief
+ * Destructor.
+ */
+RegisterTableLoader::~RegisterTableLoader(void) {}
+
+/**
+ * @brief
+ * Write a register table.
+ * @param name [in] name of the table for the log.
+ * @param slave_address [in] slave address.
+ * @param table [in] register table.
+ * @param max_burst [in] registers per transaction at most (1: one
+ * transaction per register, for the registers which act on each write).
+ * @param is_verify [in] if true, each burst is read back and compared.
+ * @return If false, a write failed or a value read back differs.
+ */
+bool RegisterTableLoader::Load(const char* name, int slave_address,
+                               const UINT8* table, int max_burst,
+                               bool is_verify) {
+  memset(&result_, 0, sizeof(result_));
+  if (write_func_ == NULL || table == NULL) {
+    return false;
+  }
+  if (max_burst < 1 || max_burst > kRegisterTableMaxBurst) {
+    max_burst = kRegisterTableMaxBurst;
+  }
+  is_verify = (is_verify && read_func_ != NULL);
+
+  struct timeval start_time;
+  struct timeval end_time;
+  gettimeofday(&start_time, NULL);
+
+  run_.clear();
+  const UINT8* block = table;
+  while (block[2] != 0) {
+    int address = (block[0] << 8) | block[1];
+    int size = block[2];
+    if (run_.size() > 0 &&
+        address != run_address_ + static_cast<int>(run_.size())) {
+      FlushRun(name, slave_address, max_burst, is_verify);
+    }
+    if (run_.size() == 0) {
+      run_address_ = address;
+    }
+    run_.insert(run_.end(), block + kRegisterTableBlockHeader,
+                block + kRegisterTableBlockHeader + size);
+    block += kRegisterTableBlockHeader + size;
+  }
+  FlushRun(name, slave_address, max_burst, is_verify);
+
+  gettimeofday(&end_time, NULL);
+  result_.msec = (end_time.tv_sec - start_time.tv_sec) * 1000.0 +
+                 (end_time.tv_usec - start_time.tv_usec) / 1000.0;
+  DEBUG_PRINT(
+      "[RegisterTableLoader] %s - slave=%02x, %d registers in %d "
+      "transactions, %d errors, %d mismatches, %.1f msec\n",
+      name, slave_address, result_.registers, result_.transactions,
+      result_.errors, result_.mismatches, result_.msec);
+  return (result_.errors == 0 && result_.mismatches == 0);
+}
+
+/**
+ * @brief
+ * Count the registers of a table.
+ * @param table [in] register table.
+ * @return number of the registers.
+ */
+int RegisterTableLoader::CountRegisters(const UINT8* table) {
+  int count = 0;
+  if (table == NULL) {
+    return 0;
+  }
+  while (table[2] != 0) {
+    count += table[2];
+    table += kRegisterTableBlockHeader + table[2];
+  }
+  return count;
+}
+
+/**
+ * @brief
+ * Write the pending run of contiguous registers in bursts.
+ * @param name [in] name of the table for the log.
+ * @param slave_address [in] slave address.
+ * @param max_burst [in] registers per transaction at most.
+ * @param is_verify [in] if true, each burst is read back and compared.
+ */
+void RegisterTableLoader::FlushRun(const char* name, int slave_address,
+                                   int max_burst, bool is_verify) {
+  int run_size = static_cast<int>(run_.size());
+  for (int offset = 0; offset < run_size; offset += max_burst) {
+    int size = std::min(max_burst, run_size - offset);
+    int address = run_address_ + offset;
+    result_.transactions++;
+    if (write_func_(slave_address, address, &run_[offset], size) != size) {
+      DEBUG_PRINT(
+          "[RegisterTableLoader] %s - write failed slave=%02x, "
+          "address=%04x, size=%d\n",
+          name, slave_address, address, size);
+      result_.errors++;
+      continue;
+    }
+    result_.registers += size;
+    if (!is_verify) {
+      continue;
+    }
+    read_back_.resize(size);
+    if (read_func_(slave_address, address, &read_back_[0], size) != size) {
+      DEBUG_PRINT(
+          "[RegisterTableLoader] %s - read failed slave=%02x, "
+          "address=%04x, size=%d\n",
+          name, slave_address, address, size);
+      result_.errors++;
+      continue;
+    }
+    for (int i = 0; i < size; i++) {
+      if (read_back_[i] != run_[offset + i]) {
+        DEBUG_PRINT(
+            "[RegisterTableLoader] %s - verify failed address=%04x, "
+            "RegData = %02x (%02x)\n",
+            name, address + i, read_back_[i], run_[offset + i]);
+        result_.mismatches++;
+      }
+    }
+  }
+  run_.clear();
+}
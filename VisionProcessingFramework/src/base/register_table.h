@@ -0,0 +1,138 @@
+/**
+ * @file      register_table.h
+ * @brief     Header for RegisterTableLoader class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _REGISTER_TABLE_H_
+#define _REGISTER_TABLE_H_
+
+#include <vector>
+#include "./include.h"
+
+/* Number of the register bytes of one bus transaction at most. */
+#define kRegisterTableMaxBurst 32
+
+/* Size of the header of a block of a register table. */
+#define kRegisterTableBlockHeader 3
+
+/**
+ * @brief
+ * Multi-byte register access of a slave (the same as
+ * __CCIRegWriteMBySlaveAddress / __CCIRegReadMBySlaveAddress).
+ * @param slave_address [in] slave address.
+ * @param reg_address [in] first register address.
+ * @param data [in,out] register values.
+ * @param size [in] number of the registers.
+ * @return number of the registers accessed (size on success).
+ */
+typedef int (*RegisterTableAccessFunc)(int slave_address, int reg_address,
+                                       unsigned char* data, int size);
+
+/**
+ * @struct RegisterTableResult
+ * @brief Summary of the load of a register table.
+ */
+typedef struct {
+  /*! Number of the registers written */
+  int registers;
+  /*! Number of the write transactions */
+  int transactions;
+  /*! Number of the failed transactions */
+  int errors;
+  /*! Number of the registers whose read back value differs */
+  int mismatches;
+  /*! Time of the load */
+  double msec;
+} RegisterTableResult;
+
+/**
+ * @class RegisterTableLoader
+ * @brief Writes register tables with as few bus transactions as possible.
+ * A table is a compact byte blob of blocks: the 16 bit first register
+ * address (big endian), the number of the registers (1 - 255) and their
+ * values. A block of 0 registers ends the table.
+ * Consecutive blocks of contiguous addresses are merged, and the runs are
+ * written in bursts of up to max_burst registers, in the table order.
+ * The bursts can be read back and compared. One summary line is logged
+ * per table instead of one line per register.
+ */
+class RegisterTableLoader {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   * @param write_func [in] burst write function.
+   * @param read_func [in] burst read function (NULL: no verification).
+   */
+  RegisterTableLoader(RegisterTableAccessFunc write_func,
+                      RegisterTableAccessFunc read_func);
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~RegisterTableLoader(void);
+
+  /**
+   * @brief
+   * Write a register table.
+   * @param name [in] name of the table for the log.
+   * @param slave_address [in] slave address.
+   * @param table [in] register table.
+   * @param max_burst [in] registers per transaction at most (1: one
+   * transaction per register, for the registers which act on each write).
+   * @param is_verify [in] if true, each burst is read back and compared.
+   * @return If false, a write failed or a value read back differs.
+   */
+  bool Load(const char* name, int slave_address, const UINT8* table,
+            int max_burst, bool is_verify);
+
+  /**
+   * @brief
+   * Get the summary of the last Load().
+   * @return summary.
+   */
+  const RegisterTableResult& result(void) const { return result_; }
+
+  /**
+   * @brief
+   * Count the registers of a table.
+   * @param table [in] register table.
+   * @return number of the registers.
+   */
+  static int CountRegisters(const UINT8* table);
+
+ private:
+  /**
+   * @brief
+   * Write the pending run of contiguous registers in bursts.
+   * @param name [in] name of the table for the log.
+   * @param slave_address [in] slave address.
+   * @param max_burst [in] registers per transaction at most.
+   * @param is_verify [in] if true, each burst is read back and compared.
+   */
+  void FlushRun(const char* name, int slave_address, int max_burst,
+                bool is_verify);
+
+  /*! Burst write function */
+  RegisterTableAccessFunc write_func_;
+
+  /*! Burst read function (NULL: no verification) */
+  RegisterTableAccessFunc read_func_;
+
+  /*! First register address of the pending run */
+  int run_address_;
+
+  /*! Values of the pending run */
+  std::vector<UINT8> run_;
+
+  /*! Values read back */
+  std::vector<UINT8> read_back_;
+
+  /*! Summary of the last Load() */
+  RegisterTableResult result_;
+};
+
+#endif /* _REGISTER_TABLE_H_*/
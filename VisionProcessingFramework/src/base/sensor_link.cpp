@@ -0,0 +1,78 @@
+/**
+ * @file      sensor_link.cpp
+ * @brief     Source for SensorLink class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./sensor_link.h"
+
+/**
+ * @brief
+ * Get the link shared by the plugins of the process.
+ * @return link.
+ */
+SensorLink* SensorLink::Instance(void) {
+  static SensorLink instance;
+  return &instance;
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+SensorLink::SensorLink(void) { target_ = NULL; }
+
+/**
+ * @brief
+ * Attach the target of the requests. The first target attached is kept
+ * until it is detached.
+ * @param target [in] target (NOT own it).
+ * @return If false, another target is attached.
+ */
+bool SensorLink::Attach(SensorLinkTarget* target) {
+  wxMutexLocker lock(mutex_);
+  if (target_ != NULL && target_ != target) {
+    return false;
+  }
+  target_ = target;
+  return true;
+}
+
+/**
+ * @brief
+ * Detach a target (nothing if it is not the attached one).
+ * @param target [in] target.
+ */
+void SensorLink::Detach(SensorLinkTarget* target) {
+  wxMutexLocker lock(mutex_);
+  if (target_ == target) {
+    target_ = NULL;
+  }
+}
+
+/**
+ * @brief
+ * Submit a request to the attached target (any thread).
+ * The target queues the request without blocking, so the mutex only
+ * keeps the target from being detached meanwhile.
+ * @param request [in] request.
+ * @return If false, no target is attached or the request is dropped.
+ */
+bool SensorLink::Submit(const SensorLinkRequest& request) {
+  wxMutexLocker lock(mutex_);
+  if (target_ == NULL) {
+    return false;
+  }
+  return target_->SubmitSensorRequest(request);
+}
+
+/**
+ * @brief
+ * Whether a target is attached.
+ * @return If true, a target is attached.
+ */
+bool SensorLink::is_attached(void) {
+  wxMutexLocker lock(mutex_);
+  return target_ != NULL;
+}
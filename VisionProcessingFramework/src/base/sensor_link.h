@@ -0,0 +1,129 @@
+/**
+ * @file      sensor_link.h
+ * @brief     Header for SensorLink class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _SENSOR_LINK_H_
+#define _SENSOR_LINK_H_
+
+#include "./include.h"
+
+/* Value of a request which leaves the setting unchanged. */
+#define kSensorLinkNone -1
+
+/**
+ * @struct SensorLinkRequest
+ * @brief Sensor settings requested by an auto-algorithm
+ * (kSensorLinkNone: unchanged).
+ */
+typedef struct {
+  /*! Analog gain register value */
+  int analog_gain;
+  /*! Digital gain register value */
+  int digital_gain;
+  /*! Coarse integration time register value */
+  int exposure;
+  /*! Lens actuator code */
+  int focus;
+} SensorLinkRequest;
+
+/**
+ * @brief
+ * Clear a request (all the settings unchanged).
+ * @param request [out] request.
+ */
+inline void SensorLinkRequestClear(SensorLinkRequest* request) {
+  request->analog_gain = kSensorLinkNone;
+  request->digital_gain = kSensorLinkNone;
+  request->exposure = kSensorLinkNone;
+  request->focus = kSensorLinkNone;
+}
+
+/**
+ * @class SensorLinkTarget
+ * @brief Interface implemented by the input plugin which owns the sensor.
+ */
+class SensorLinkTarget {
+ public:
+  /**
+   * @brief
+   * Destructor.
+   */
+  virtual ~SensorLinkTarget(void) {}
+
+  /**
+   * @brief
+   * Queue a request to the sensor (any thread, must not block).
+   * @param request [in] request.
+   * @return If false, the request is dropped.
+   */
+  virtual bool SubmitSensorRequest(const SensorLinkRequest& request) = 0;
+};
+
+/**
+ * @class SensorLink
+ * @brief Path from the auto-algorithm plugins (focus, exposure) to the
+ * sensor of the flow.
+ * The input plugin attaches itself while it exists; a plugin of a sub-flow
+ * submits its requests without knowing which plugin owns the sensor. The
+ * requests take the asynchronous register path of the target, so a
+ * submission never waits for the bus. The framework binary exports the
+ * base classes, so every plugin sees the same instance.
+ */
+class SensorLink {
+ public:
+  /**
+   * @brief
+   * Get the link shared by the plugins of the process.
+   * @return link.
+   */
+  static SensorLink* Instance(void);
+
+  /**
+   * @brief
+   * Constructor.
+   */
+  SensorLink(void);
+
+  /**
+   * @brief
+   * Attach the target of the requests. The first target attached is kept
+   * until it is detached.
+   * @param target [in] target (NOT own it).
+   * @return If false, another target is attached.
+   */
+  bool Attach(SensorLinkTarget* target);
+
+  /**
+   * @brief
+   * Detach a target (nothing if it is not the attached one).
+   * @param target [in] target.
+   */
+  void Detach(SensorLinkTarget* target);
+
+  /**
+   * @brief
+   * Submit a request to the attached target (any thread).
+   * @param request [in] request.
+   * @return If false, no target is attached or the request is dropped.
+   */
+  bool Submit(const SensorLinkRequest& request);
+
+  /**
+   * @brief
+   * Whether a target is attached.
+   * @return If true, a target is attached.
+   */
+  bool is_attached(void);
+
+ private:
+  /*! Mutex of the target (held while a request is queued) */
+  wxMutex mutex_;
+
+  /*! Target of the requests (NULL: none) */
+  SensorLinkTarget* target_;
+};
+
+#endif /* _SENSOR_LINK_H_*/
@@ -0,0 +1,354 @@
+/**
+ * @file      thread_placement.cpp
+ * @brief     Source for the thread placement (core affinity, scheduling
+ * policy and name) of the framework threads
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./thread_placement.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/* Length of a thread name without the terminator (TASK_COMM_LEN - 1)*/
+#define kThreadNameMaxLength 15
+
+/**
+ * @brief
+ * Get the table shared by the threads of the process.
+ * @return table.
+ */
+ThreadPlacementTable* ThreadPlacementTable::Instance(void) {
+  static ThreadPlacementTable instance;
+  return &instance;
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+ThreadPlacementTable::ThreadPlacementTable(void) { generation_ = 0; }
+
+/**
+ * @brief
+ * Set the placement of a thread.
+ * @param name [in] thread name.
+ * @param placement [in] placement.
+ */
+void ThreadPlacementTable::Set(const std::string& name,
+                               const ThreadPlacement& placement) {
+  wxMutexLocker lock(mutex_);
+  placements_[name] = placement;
+  generation_++;
+}
+
+/**
+ * @brief
+ * Get the placement of a thread.
+ * @param name [in] thread name.
+ * @param placement [out] placement (cleared if none).
+ * @return If false, the thread has no placement.
+ */
+bool ThreadPlacementTable::Get(const std::string& name,
+                               ThreadPlacement* placement) {
+  wxMutexLocker lock(mutex_);
+  std::map<std::string, ThreadPlacement>::const_iterator it =
+      placements_.find(name);
+  if (it == placements_.end()) {
+    ThreadPlacementClear(placement);
+    return false;
+  }
+  *placement = it->second;
+  return true;
+}
+
+/**
+ * @brief
+ * Remove all the placements.
+ */
+void ThreadPlacementTable::Clear(void) {
+  wxMutexLocker lock(mutex_);
+  if (placements_.empty() == false) {
+    placements_.clear();
+    generation_++;
+  }
+}
+
+/**
+ * @brief
+ * Set a placement from a line of the flow file.
+ * @param line [in] "name,cpu mask,other|fifo,priority,nice".
+ * @return If false, the line is invalid.
+ */
+bool ThreadPlacementTable::ParseLine(const std::string& line) {
+  std::vector<std::string> tokens;
+  std::string::size_type start = 0;
+  while (true) {
+    std::string::size_type end = line.find(',', start);
+    std::string token = line.substr(start, end == std::string::npos
+                                               ? std::string::npos
+                                               : end - start);
+    std::string::size_type first = token.find_first_not_of(" \t\r");
+    std::string::size_type last = token.find_last_not_of(" \t\r");
+    tokens.push_back(first == std::string::npos
+                         ? std::string()
+                         : token.substr(first, last - first + 1));
+    if (end == std::string::npos) {
+      break;
+    }
+    start = end + 1;
+  }
+  /* The flow file ends the lines with a comma.*/
+  if (tokens.size() == 6 && tokens[5].empty() == true) {
+    tokens.pop_back();
+  }
+  if (tokens.size() != 5 || tokens[0].empty() == true) {
+    return false;
+  }
+
+  ThreadPlacement placement;
+  ThreadPlacementClear(&placement);
+  char* end = NULL;
+  unsigned long mask = strtoul(tokens[1].c_str(), &end, 0);  // NOLINT
+  if (tokens[1].empty() == true || *end != '\0') {
+    return false;
+  }
+  placement.cpu_mask = static_cast<unsigned int>(mask);
+
+  if (tokens[2] == "fifo") {
+    placement.policy = kThreadPolicyFifo;
+  } else if (tokens[2] == "other") {
+    placement.policy = kThreadPolicyOther;
+  } else {
+    return false;
+  }
+
+  placement.priority = static_cast<int>(strtol(tokens[3].c_str(), &end, 10));
+  if (tokens[3].empty() == true || *end != '\0') {
+    return false;
+  }
+  placement.nice = static_cast<int>(strtol(tokens[4].c_str(), &end, 10));
+  if (tokens[4].empty() == true || *end != '\0') {
+    return false;
+  }
+  if (placement.policy == kThreadPolicyFifo &&
+      (placement.priority < 1 || placement.priority > 99)) {
+    return false;
+  }
+  if (placement.nice < -20 || placement.nice > 19) {
+    return false;
+  }
+
+  Set(tokens[0], placement);
+  return true;
+}
+
+/**
+ * @brief
+ * Get the lines of the flow file.
+ * @return one line per placement.
+ */
+std::vector<std::string> ThreadPlacementTable::FormatLines(void) {
+  wxMutexLocker lock(mutex_);
+  std::vector<std::string> lines;
+  std::map<std::string, ThreadPlacement>::const_iterator it;
+  for (it = placements_.begin(); it != placements_.end(); ++it) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), ",0x%X,%s,%d,%d,", it->second.cpu_mask,
+             it->second.policy == kThreadPolicyFifo ? "fifo" : "other",
+             it->second.priority, it->second.nice);
+    lines.push_back(it->first + buf);
+  }
+  return lines;
+}
+
+/**
+ * @brief
+ * Constructor.
+ * @param name [in] thread name (key of the table).
+ */
+ThreadPlacer::ThreadPlacer(const std::string& name) {
+  name_ = name;
+  tid_ = 0;
+  generation_ = 0;
+  is_placed_ = false;
+  ThreadPlacementClear(&placement_);
+  begin_cpu_ = -1;
+  begin_switches_ = 0;
+  ThreadSchedCountsClear(&counts_);
+}
+
+/**
+ * @brief
+ * Set the thread name (applied by the next Update()).
+ * @param name [in] thread name (key of the table).
+ */
+void ThreadPlacer::set_name(const std::string& name) {
+  name_ = name;
+  tid_ = 0;
+}
+
+/**
+ * @brief
+ * Name the calling thread and apply its placement if needed.
+ * @return If false, the placement failed (see error()). The thread keeps
+ * running with the placement it had.
+ */
+bool ThreadPlacer::Update(void) {
+  ThreadPlacementTable* table = ThreadPlacementTable::Instance();
+  pid_t tid = static_cast<pid_t>(syscall(SYS_gettid));
+  unsigned int generation = table->generation();
+  if (tid == tid_ && generation == generation_) {
+    return true;
+  }
+
+  if (tid != tid_) {
+    std::string thread_name = name_.substr(0, kThreadNameMaxLength);
+    prctl(PR_SET_NAME, thread_name.c_str(), 0, 0, 0);
+    begin_cpu_ = -1;
+  }
+  tid_ = tid;
+  generation_ = generation;
+
+  ThreadPlacement placement;
+  bool has_placement = table->Get(name_, &placement);
+  if (has_placement == false && is_placed_ == false) {
+    /* The thread keeps the placement it inherited.*/
+    return true;
+  }
+  is_placed_ = has_placement;
+  return Apply(placement);
+}
+
+/**
+ * @brief
+ * Apply a placement to the calling thread.
+ * @param placement [in] placement.
+ * @return If false, a part of the placement failed.
+ */
+bool ThreadPlacer::Apply(const ThreadPlacement& placement) {
+  bool is_success = true;
+  error_.clear();
+  placement_ = placement;
+
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  long cores = sysconf(_SC_NPROCESSORS_CONF);  // NOLINT
+  for (long i = 0; i < cores && i < 32; i++) {  // NOLINT
+    if (placement.cpu_mask == 0 || (placement.cpu_mask & (1u << i)) != 0) {
+      CPU_SET(i, &cpus);
+    }
+  }
+  if (CPU_COUNT(&cpus) == 0) {
+    error_ += "affinity: no core in the mask; ";
+    is_success = false;
+  } else {
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    if (ret != 0) {
+      error_ += std::string("affinity: ") + strerror(ret) + "; ";
+      is_success = false;
+    }
+  }
+
+  struct sched_param param;
+  memset(&param, 0, sizeof(param));
+  int policy = SCHED_OTHER;
+  if (placement.policy == kThreadPolicyFifo) {
+    policy = SCHED_FIFO;
+    param.sched_priority = placement.priority;
+    int min_priority = sched_get_priority_min(SCHED_FIFO);
+    int max_priority = sched_get_priority_max(SCHED_FIFO);
+    if (param.sched_priority < min_priority) {
+      param.sched_priority = min_priority;
+    } else if (param.sched_priority > max_priority) {
+      param.sched_priority = max_priority;
+    }
+  }
+  int ret = pthread_setschedparam(pthread_self(), policy, &param);
+  if (ret != 0) {
+    /* SCHED_FIFO needs CAP_SYS_NICE or an rtprio limit.*/
+    error_ += std::string("policy: ") + strerror(ret) + "; ";
+    is_success = false;
+  }
+
+  if (placement.policy == kThreadPolicyOther) {
+    /* The nice value of a thread is the one of its task id.*/
+    if (setpriority(PRIO_PROCESS, tid_, placement.nice) != 0) {
+      error_ += std::string("nice: ") + strerror(errno) + "; ";
+      is_success = false;
+    }
+  }
+  return is_success;
+}
+
+/**
+ * @brief
+ * Mark the start of the work of a frame (calling thread).
+ */
+void ThreadPlacer::BeginFrame(void) {
+  struct rusage usage;
+  begin_cpu_ = sched_getcpu();
+  if (getrusage(RUSAGE_THREAD, &usage) == 0) {
+    begin_switches_ = usage.ru_nivcsw;
+  } else {
+    begin_switches_ = -1;
+  }
+}
+
+/**
+ * @brief
+ * Mark the end of the work of a frame (calling thread).
+ */
+void ThreadPlacer::EndFrame(void) {
+  struct rusage usage;
+  int cpu = sched_getcpu();
+  counts_.frames++;
+  if (begin_cpu_ >= 0 && cpu >= 0 && cpu != begin_cpu_) {
+    counts_.migrations++;
+  }
+  if (begin_switches_ >= 0 && getrusage(RUSAGE_THREAD, &usage) == 0 &&
+      usage.ru_nivcsw > begin_switches_) {
+    counts_.preempted_frames++;
+    counts_.preemptions +=
+        static_cast<unsigned int>(usage.ru_nivcsw - begin_switches_);
+  }
+  begin_cpu_ = -1;
+}
+
+/**
+ * @brief
+ * Reset the scheduling events.
+ */
+void ThreadPlacer::ResetCounts(void) { ThreadSchedCountsClear(&counts_); }
+
+/**
+ * @brief
+ * Get the placement applied last, e.g. "cpu:0x2 fifo:80".
+ * @return description ("inherited" if the table has none).
+ */
+std::string ThreadPlacer::Describe(void) const {
+  char buf[64];
+  char cpus[16];
+  if (is_placed_ == false) {
+    return std::string("inherited");
+  }
+  if (placement_.cpu_mask == 0) {
+    snprintf(cpus, sizeof(cpus), "all");
+  } else {
+    snprintf(cpus, sizeof(cpus), "0x%X", placement_.cpu_mask);
+  }
+  if (placement_.policy == kThreadPolicyFifo) {
+    snprintf(buf, sizeof(buf), "cpu:%s fifo:%d", cpus, placement_.priority);
+  } else {
+    snprintf(buf, sizeof(buf), "cpu:%s nice:%d", cpus, placement_.nice);
+  }
+  return std::string(buf);
+}
@@ -0,0 +1,295 @@
+/**
+ * @file      thread_placement.h
+ * @brief     Header for the thread placement (core affinity, scheduling
+ * policy and name) of the framework threads
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _THREAD_PLACEMENT_H_
+#define _THREAD_PLACEMENT_H_
+
+#include <sys/types.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "./include.h"
+
+/* Suffixes of the threads owned by a plugin (the key is the plugin name
+   followed by the suffix). */
+#define kThreadPlacementAsyncSuffix "/async"
+#define kThreadPlacementWriterSuffix "/io"
+#define kThreadPlacementControlSuffix "/ctl"
+#define kThreadPlacementPreprocessSuffix "/ssp"
+
+/**
+ * @enum ThreadPolicy
+ * @brief Scheduling policy of a thread.
+ */
+typedef enum {
+  /*! SCHED_OTHER with a nice value */
+  kThreadPolicyOther = 0,
+  /*! SCHED_FIFO with a real-time priority */
+  kThreadPolicyFifo,
+} ThreadPolicy;
+
+/**
+ * @struct ThreadPlacement
+ * @brief Placement of a thread.
+ */
+typedef struct {
+  /*! Cores allowed (bit n: core n, 0: all the cores) */
+  unsigned int cpu_mask;
+  /*! Scheduling policy */
+  ThreadPolicy policy;
+  /*! Real-time priority of kThreadPolicyFifo (1..99) */
+  int priority;
+  /*! Nice value of kThreadPolicyOther (-20..19) */
+  int nice;
+} ThreadPlacement;
+
+/**
+ * @brief
+ * Clear a placement (all the cores, SCHED_OTHER, nice 0).
+ * @param placement [out] placement.
+ */
+inline void ThreadPlacementClear(ThreadPlacement* placement) {
+  placement->cpu_mask = 0;
+  placement->policy = kThreadPolicyOther;
+  placement->priority = 0;
+  placement->nice = 0;
+}
+
+/**
+ * @struct ThreadSchedCounts
+ * @brief Scheduling events of a thread while it processed frames.
+ */
+typedef struct {
+  /*! Frames processed */
+  unsigned int frames;
+  /*! Frames which ended on another core than they started on */
+  unsigned int migrations;
+  /*! Frames during which the thread was preempted */
+  unsigned int preempted_frames;
+  /*! Involuntary context switches during the frames */
+  unsigned int preemptions;
+} ThreadSchedCounts;
+
+/**
+ * @brief
+ * Clear the scheduling events.
+ * @param counts [out] scheduling events.
+ */
+inline void ThreadSchedCountsClear(ThreadSchedCounts* counts) {
+  counts->frames = 0;
+  counts->migrations = 0;
+  counts->preempted_frames = 0;
+  counts->preemptions = 0;
+}
+
+/**
+ * @brief
+ * Add scheduling events.
+ * @param dst [in,out] sum.
+ * @param src [in] scheduling events added.
+ */
+inline void ThreadSchedCountsAdd(ThreadSchedCounts* dst,
+                                 const ThreadSchedCounts& src) {
+  dst->frames += src.frames;
+  dst->migrations += src.migrations;
+  dst->preempted_frames += src.preempted_frames;
+  dst->preemptions += src.preemptions;
+}
+
+/**
+ * @class ThreadPlacementTable
+ * @brief Placements of the threads of the flow, by thread name.
+ * A processing thread is named after the root plugin of its flow; a thread
+ * owned by a plugin after the plugin followed by a suffix
+ * (kThreadPlacement*Suffix). The table is the [thread] section of the flow
+ * file, one line per thread:
+ *   name,cpu mask,other|fifo,priority,nice
+ * e.g. "Sensor,0x2,fifo,80,0". The framework binary exports the base
+ * classes, so every plugin sees the same instance.
+ */
+class ThreadPlacementTable {
+ public:
+  /**
+   * @brief
+   * Get the table shared by the threads of the process.
+   * @return table.
+   */
+  static ThreadPlacementTable* Instance(void);
+
+  /**
+   * @brief
+   * Constructor.
+   */
+  ThreadPlacementTable(void);
+
+  /**
+   * @brief
+   * Set the placement of a thread.
+   * @param name [in] thread name.
+   * @param placement [in] placement.
+   */
+  void Set(const std::string& name, const ThreadPlacement& placement);
+
+  /**
+   * @brief
+   * Get the placement of a thread.
+   * @param name [in] thread name.
+   * @param placement [out] placement (cleared if none).
+   * @return If false, the thread has no placement.
+   */
+  bool Get(const std::string& name, ThreadPlacement* placement);
+
+  /**
+   * @brief
+   * Remove all the placements.
+   */
+  void Clear(void);
+
+  /**
+   * @brief
+   * Set a placement from a line of the flow file.
+   * @param line [in] "name,cpu mask,other|fifo,priority,nice".
+   * @return If false, the line is invalid.
+   */
+  bool ParseLine(const std::string& line);
+
+  /**
+   * @brief
+   * Get the lines of the flow file.
+   * @return one line per placement.
+   */
+  std::vector<std::string> FormatLines(void);
+
+  /**
+   * @brief
+   * Get the generation of the table, changed by every update.
+   * @return generation.
+   */
+  unsigned int generation(void) const { return generation_; }
+
+ private:
+  /*! Mutex of the placements */
+  wxMutex mutex_;
+
+  /*! Placements by thread name */
+  std::map<std::string, ThreadPlacement> placements_;
+
+  /*! Generation of the table */
+  volatile unsigned int generation_;
+};
+
+/**
+ * @class ThreadPlacer
+ * @brief Placement and scheduling monitor of one thread.
+ * The thread calls Update() where it starts and then once per loop: the
+ * thread is named (top -H, perf) and its placement applied when the table
+ * changed or the placer is used by another thread; otherwise the call
+ * reads one counter. BeginFrame() and EndFrame() around the work of a frame
+ * count the frames migrated to another core and the frames preempted
+ * (involuntary context switches).
+ */
+class ThreadPlacer {
+ public:
+  /**
+   * @brief
+   * Constructor.
+   * @param name [in] thread name (key of the table).
+   */
+  explicit ThreadPlacer(const std::string& name = "");
+
+  /**
+   * @brief
+   * Set the thread name (applied by the next Update()).
+   * @param name [in] thread name (key of the table).
+   */
+  void set_name(const std::string& name);
+
+  /**
+   * @brief
+   * Get the thread name.
+   * @return thread name.
+   */
+  const std::string& name(void) const { return name_; }
+
+  /**
+   * @brief
+   * Name the calling thread and apply its placement if needed.
+   * @return If false, the placement failed (see error()). The thread keeps
+   * running with the placement it had.
+   */
+  bool Update(void);
+
+  /**
+   * @brief
+   * Mark the start of the work of a frame (calling thread).
+   */
+  void BeginFrame(void);
+
+  /**
+   * @brief
+   * Mark the end of the work of a frame (calling thread).
+   */
+  void EndFrame(void);
+
+  /**
+   * @brief
+   * Get the scheduling events since the last reset.
+   * @return scheduling events.
+   */
+  ThreadSchedCounts counts(void) const { return counts_; }
+
+  /**
+   * @brief
+   * Reset the scheduling events.
+   */
+  void ResetCounts(void);
+
+  /**
+   * @brief
+   * Get the placement applied last, e.g. "cpu:0x2 fifo:80".
+   * @return description ("inherited" if the table has none).
+   */
+  std::string Describe(void) const;
+
+  /**
+   * @brief
+   * Get the reason of the last failure of Update().
+   * @return error message.
+   */
+  const std::string& error(void) const { return error_; }
+
+ private:
+  /**
+   * @brief
+   * Apply a placement to the calling thread.
+   * @param placement [in] placement.
+   * @return If false, a part of the placement failed.
+   */
+  bool Apply(const ThreadPlacement& placement);
+
+  /*! Thread name */
+  std::string name_;
+  /*! Thread which the placement was applied to (0: none) */
+  pid_t tid_;
+  /*! Generation of the table applied */
+  unsigned int generation_;
+  /*! Whether a placement of the table was applied */
+  bool is_placed_;
+  /*! Placement applied */
+  ThreadPlacement placement_;
+  /*! Reason of the last failure */
+  std::string error_;
+  /*! Core at the start of the frame */
+  int begin_cpu_;
+  /*! Involuntary context switches at the start of the frame */
+  long begin_switches_;  // NOLINT
+  /*! Scheduling events */
+  ThreadSchedCounts counts_;
+};
+
+#endif /* _THREAD_PLACEMENT_H_*/
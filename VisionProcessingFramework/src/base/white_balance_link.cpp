@@ -0,0 +1,73 @@
+/**
+ * @file      white_balance_link.cpp
+ * @brief     Source for WhiteBalanceLink class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./white_balance_link.h"
+
+/**
+ * @brief
+ * Get the link shared by the plugins of the process.
+ * @return link.
+ */
+WhiteBalanceLink* WhiteBalanceLink::Instance(void) {
+  static WhiteBalanceLink instance;
+  return &instance;
+}
+
+/**
+ * @brief
+ * Constructor.
+ */
+WhiteBalanceLink::WhiteBalanceLink(void) {
+  sequence_ = 0;
+  red_ = 1.0f;
+  blue_ = 1.0f;
+}
+
+/**
+ * @brief
+ * Publish new gains (any thread).
+ * @param red [in] red gain.
+ * @param blue [in] blue gain.
+ */
+void WhiteBalanceLink::Publish(float red, float blue) {
+  wxMutexLocker lock(mutex_);
+  red_ = red;
+  blue_ = blue;
+  sequence_++;
+  if (sequence_ == 0) {
+    sequence_ = 1;
+  }
+}
+
+/**
+ * @brief
+ * Get the gains if they changed since a sequence number (any thread).
+ * @param sequence [in,out] sequence number seen last, updated.
+ * @param red [out] red gain.
+ * @param blue [out] blue gain.
+ * @return If false, nothing was published since the sequence number.
+ */
+bool WhiteBalanceLink::Poll(unsigned int* sequence, float* red, float* blue) {
+  wxMutexLocker lock(mutex_);
+  if (*sequence == sequence_) {
+    return false;
+  }
+  *sequence = sequence_;
+  *red = red_;
+  *blue = blue_;
+  return true;
+}
+
+/**
+ * @brief
+ * Get the sequence number of the gains published last.
+ * @return sequence number (0: nothing published).
+ */
+unsigned int WhiteBalanceLink::sequence(void) {
+  wxMutexLocker lock(mutex_);
+  return sequence_;
+}
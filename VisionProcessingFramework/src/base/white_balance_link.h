@@ -0,0 +1,76 @@
+/**
+ * @file      white_balance_link.h
+ * @brief     Header for WhiteBalanceLink class
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _WHITE_BALANCE_LINK_H_
+#define _WHITE_BALANCE_LINK_H_
+
+#include "./include.h"
+
+/**
+ * @class WhiteBalanceLink
+ * @brief Path from the auto white balance to the WhiteBalanceGain plugin.
+ * The controller publishes the gains (relative to green) from its branch;
+ * the gain plugin polls them once per frame and adopts a new set when the
+ * sequence number changed, so neither side waits for the other. The
+ * framework binary exports the base classes, so every plugin sees the same
+ * instance.
+ */
+class WhiteBalanceLink {
+ public:
+  /**
+   * @brief
+   * Get the link shared by the plugins of the process.
+   * @return link.
+   */
+  static WhiteBalanceLink* Instance(void);
+
+  /**
+   * @brief
+   * Constructor.
+   */
+  WhiteBalanceLink(void);
+
+  /**
+   * @brief
+   * Publish new gains (any thread).
+   * @param red [in] red gain.
+   * @param blue [in] blue gain.
+   */
+  void Publish(float red, float blue);
+
+  /**
+   * @brief
+   * Get the gains if they changed since a sequence number (any thread).
+   * @param sequence [in,out] sequence number seen last, updated.
+   * @param red [out] red gain.
+   * @param blue [out] blue gain.
+   * @return If false, nothing was published since the sequence number.
+   */
+  bool Poll(unsigned int* sequence, float* red, float* blue);
+
+  /**
+   * @brief
+   * Get the sequence number of the gains published last.
+   * @return sequence number (0: nothing published).
+   */
+  unsigned int sequence(void);
+
+ private:
+  /*! Mutex of the gains */
+  wxMutex mutex_;
+
+  /*! Sequence number of the gains published last */
+  unsigned int sequence_;
+
+  /*! Red gain */
+  float red_;
+
+  /*! Blue gain */
+  float blue_;
+};
+
+#endif /* _WHITE_BALANCE_LINK_H_*/
@@ -91,16 +91,6 @@ class DemoOisWnd : public wxFrame {
   wxButton *button_ois_start_apply_;
   wxButton *button_ois_demostart_apply_;
 
-  // static const T_I2CRegWriteData i2cdat_[];
-  static const T_I2CRegWriteData i2cdat_gyro_[];
-  static const T_I2CRegWriteData i2cdat_dp1_[];
-  static const T_I2CRegWriteData i2cdat_dp2_[];
-  static const T_I2CRegWriteData i2cdat_calb_[];
-  static const T_I2CRegWriteData i2cdat_gpo_[];
-  static const T_I2CRegWriteData i2cdat_pwmfrequency_[];
-  static const T_I2CRegWriteData i2cdat_SineTest_dp1_[];
-  static const T_I2CRegWriteData i2cdat_SineTest_dp2_[];
-
  private:
   /* Event table of wxWidgets.*/
   DECLARE_EVENT_TABLE();
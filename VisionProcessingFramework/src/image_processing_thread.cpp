@@ -32,6 +32,10 @@ ImageProcessingThread::ImageProcessingThread(
   root_plugin_ = plugin;
   wait_sem_ = wait_sem;
   receive_image_ = NULL;
+  FrameMetadataClear(&receive_metadata_);
+  FrameMetadataClear(&frame_metadata_);
+  receive_derivatives_ = NULL;
+  frame_derivatives_ = NULL;
   thread_running_cycle_manager_ = thread_running_cycle_manager;
   stop_flag_ = false;
   is_running_ = false;
@@ -91,6 +95,40 @@ void ImageProcessingThread::ClearSubThreadMap() {
   }
 }
 
+/**
+ * @brief
+ * Get free derived formats from the pool for a branch of this flow.
+ * @return derived formats with a reference for the caller.
+ */
+FrameDerivatives* ImageProcessingThread::AcquireDerivatives(void) {
+  FrameDerivatives* derivatives = NULL;
+  // Only the pool holds a free one.
+  for (unsigned int i = 0; i < derivatives_pool_.size(); i++) {
+    if (derivatives_pool_[i]->ref_count() == 1) {
+      derivatives = derivatives_pool_[i];
+      derivatives->Reset();
+      break;
+    }
+  }
+  if (derivatives == NULL) {
+    derivatives = new FrameDerivatives();
+    derivatives_pool_.push_back(derivatives);
+  }
+  derivatives->AddRef();
+  return derivatives;
+}
+
+/**
+ * @brief
+ * Release the derived formats of the frame being processed.
+ */
+void ImageProcessingThread::ReleaseFrameDerivatives(void) {
+  if (frame_derivatives_ != NULL) {
+    frame_derivatives_->Release();
+    frame_derivatives_ = NULL;
+  }
+}
+
 /**
  * @brief
  * Thread entry point.
@@ -110,6 +148,17 @@ wxThread::ExitCode ImageProcessingThread::Entry() {
   // Clear sub thread Map
   ClearSubThreadMap();
 
+  // Name the thread and place it before the plugins start their own threads
+  if (root_plugin_) {
+    placer_.set_name(root_plugin_->plugin_name());
+  }
+  placer_.ResetCounts();
+  if (placer_.Update() == false) {
+    LOG_WARNING("Failed to place thread - thread:%s %s",
+                wxString::FromUTF8(placer_.name().c_str()).c_str(),
+                wxString::FromUTF8(placer_.error().c_str()).c_str());
+  }
+
   //////////////////////////////////////////////////////////////
   // InitProcess
   //////////////////////////////////////////////////////////////
@@ -123,6 +172,7 @@ wxThread::ExitCode ImageProcessingThread::Entry() {
       DEBUG_PRINT(
           "[ImageProcessingThread] Do InitProcess plugin = %s - tid:%d\n",
           plugin->plugin_name().c_str(), this->GetId());
+      plugin->ClearFrameLatency();
       if (plugin->InitProcess(common_param_) == false) {
         DEBUG_PRINT("[ImageProcessingThread] InitProcess fail plugin = %s\n",
                     plugin->plugin_name().c_str());
@@ -197,6 +247,7 @@ wxThread::ExitCode ImageProcessingThread::Entry() {
           "[ImageProcessingThread] After sem wait tid:%d wait_sem_:0x%08x\n",
           this->GetId(), wait_sem_);
       if (stop_flag()) break;
+      placer_.BeginFrame();
       receive_image_mutex_.Lock();
       if (src_image != NULL) {
         delete src_image;
@@ -204,7 +255,27 @@ wxThread::ExitCode ImageProcessingThread::Entry() {
       }
       src_image = new cv::Mat(receive_image_->size(), receive_image_->type());
       *src_image = receive_image_->clone();
+      FrameMetadataCopy(&frame_metadata_, &receive_metadata_);
+      // The root plugin gets the same frame as the other consumers at the
+      // branch, so it shares their derived formats.
+      ReleaseFrameDerivatives();
+      frame_derivatives_ = receive_derivatives_;
+      receive_derivatives_ = NULL;
       receive_image_mutex_.Unlock();
+    } else if (wait_sem_ == NULL && plugin == root_plugin_) {
+      // Start of a frame in the main flow. The input plugin may overwrite
+      // the frame number and the capture time with its own values.
+      placer_.BeginFrame();
+      ReleaseFrameDerivatives();
+      FrameMetadataClear(&frame_metadata_);
+      frame_metadata_.frame_number = frame_counter;
+      gettimeofday(&frame_metadata_.capture_time, NULL);
+      CvRect onepush_rect = common_param_->GetOnepushRectangle();
+      if (onepush_rect.width > onepush_rect.x &&
+          onepush_rect.height > onepush_rect.y) {
+        frame_metadata_.has_onepush_rect = true;
+        frame_metadata_.onepush_rect = onepush_rect;
+      }
     }
 
     CvSize size;
@@ -275,7 +346,23 @@ wxThread::ExitCode ImageProcessingThread::Entry() {
       //////////////////////////////////////////////////////////////
       DEBUG_PRINT("[ImageProcessingThread] DoProcess %s - tid:%d\n",
                   plugin->plugin_name().c_str(), this->GetId());
-      if (plugin->DoProcess(src_image, dst_image) == false) {
+      // An asynchronous output plugin whose in-flight limit is reached drops
+      // this frame instead of stalling the flow.
+      bool skip_process = false;
+      if (plugin->is_async_process() &&
+          plugin->output_port_candidate_specs().size() == 0 &&
+          plugin->CanAcceptAsyncFrame() == false) {
+        DEBUG_PRINT("[ImageProcessingThread] skip %s in_flight:%d - tid:%d\n",
+                    plugin->plugin_name().c_str(), plugin->in_flight_frames(),
+                    this->GetId());
+        skip_process = true;
+      }
+      plugin->set_frame_metadata(&frame_metadata_);
+      plugin->set_frame_derivatives(frame_derivatives_);
+      bool process_result =
+          (skip_process || plugin->DoProcess(src_image, dst_image));
+      plugin->set_frame_derivatives(NULL);
+      if (process_result == false) {
         DEBUG_PRINT("[ImageProcessingThread] DoProcess fail plugin = %s\n",
                     plugin->plugin_name().c_str());
         LOG_ERROR("Failed to DoProcess - plugin:%s",
@@ -317,6 +404,12 @@ wxThread::ExitCode ImageProcessingThread::Entry() {
       }
       temp_next_plugin = NULL;
       if (plugin->next_plugins().size() > 0) {
+        // The output is a new frame. When it fans out, its derived formats
+        // are made once and shared by all the next plugins.
+        ReleaseFrameDerivatives();
+        if (plugin->next_plugins().size() > 1) {
+          frame_derivatives_ = AcquireDerivatives();
+        }
         for (int i = 0; i < plugin->next_plugins().size(); i++) {
           next_plugin =
               reinterpret_cast<PluginBase*>(plugin->next_plugins()[i]);
@@ -337,7 +430,8 @@ wxThread::ExitCode ImageProcessingThread::Entry() {
                   for (itr = threads->begin(); itr != threads->end(); itr++) {
                     ImageProcessingThread* thread = *itr;
                     if (!thread->stop_flag()) {
-                      thread->set_receive_image(dst_image);
+                      thread->set_receive_image(dst_image, &frame_metadata_,
+                                                frame_derivatives_);
                     }
                   }
                   sem->Post();
@@ -426,6 +520,8 @@ wxThread::ExitCode ImageProcessingThread::Entry() {
           }
         }
         // End of Frame
+        placer_.EndFrame();
+        ReleaseFrameDerivatives();
         plugin = reinterpret_cast<PluginBase*>(root_plugin_);
         frame_counter++;
         plugin_index = 0;
@@ -445,6 +541,37 @@ wxThread::ExitCode ImageProcessingThread::Entry() {
       DEBUG_PRINT("[ImageProcessingThread] EndProcess %s - tid:%d\n",
                   plugin->plugin_name().c_str(), this->GetId());
       plugin->EndProcess();
+      if (plugin->async_dropped_frames() > 0) {
+        LOG_MESSAGE("Asynchronous frames dropped - plugin:%s count:%u",
+                    wxString::FromUTF8(plugin->plugin_name().c_str()).c_str(),
+                    plugin->async_dropped_frames());
+      }
+      ThreadSchedCounts async_counts = plugin->async_sched_counts();
+      if (async_counts.frames > 0) {
+        LOG_MESSAGE(
+            "Thread schedule - thread:%s%s placement:%s frames:%u "
+            "migrations:%u preempted:%u switches:%u",
+            wxString::FromUTF8(plugin->plugin_name().c_str()).c_str(),
+            wxT(kThreadPlacementAsyncSuffix),
+            wxString::FromUTF8(plugin->async_placement().c_str()).c_str(),
+            async_counts.frames, async_counts.migrations,
+            async_counts.preempted_frames, async_counts.preemptions);
+      }
+      LatencyStats* latency = plugin->latency_stats();
+      if (latency->count() > 0) {
+        LOG_MESSAGE(
+            "Frame latency - plugin:%s frames:%u min:%.1fms avg:%.1fms "
+            "p50:%.1fms p95:%.1fms p99:%.1fms max:%.1fms",
+            wxString::FromUTF8(plugin->plugin_name().c_str()).c_str(),
+            latency->count(), latency->min_msec(), latency->average_msec(),
+            latency->Percentile(0.50), latency->Percentile(0.95),
+            latency->Percentile(0.99), latency->max_msec());
+      }
+      if (plugin->frame_code_errors() > 0) {
+        LOG_ERROR("Frame counter mismatch - plugin:%s count:%u",
+                  wxString::FromUTF8(plugin->plugin_name().c_str()).c_str(),
+                  plugin->frame_code_errors());
+      }
       time = plugin->proc_time();
       all_time += time;
       //printf("plugin name:%s time:%f(ms)\n", plugin->plugin_name().c_str(),
@@ -472,6 +599,15 @@ wxThread::ExitCode ImageProcessingThread::Entry() {
       break;
     }
   }
+  ThreadSchedCounts counts = placer_.counts();
+  if (counts.frames > 0) {
+    LOG_MESSAGE(
+        "Thread schedule - thread:%s placement:%s frames:%u migrations:%u "
+        "preempted:%u switches:%u",
+        wxString::FromUTF8(placer_.name().c_str()).c_str(),
+        wxString::FromUTF8(placer_.Describe().c_str()).c_str(), counts.frames,
+        counts.migrations, counts.preempted_frames, counts.preemptions);
+  }
   if (src_image != NULL) {
     delete src_image;
     src_image = NULL;
@@ -484,6 +620,18 @@ wxThread::ExitCode ImageProcessingThread::Entry() {
     delete receive_image_;
     receive_image_ = NULL;
   }
+  ReleaseFrameDerivatives();
+  receive_image_mutex_.Lock();
+  if (receive_derivatives_ != NULL) {
+    receive_derivatives_->Release();
+    receive_derivatives_ = NULL;
+  }
+  receive_image_mutex_.Unlock();
+  // The sub threads may still hold some; the last one deletes them.
+  for (unsigned int i = 0; i < derivatives_pool_.size(); i++) {
+    derivatives_pool_[i]->Release();
+  }
+  derivatives_pool_.clear();
   DEBUG_PRINT("[ImageProcessingThread] end - tid:%d\n", this->GetId());
   printf("all_time:%f(ms)\n", all_time);
   is_running_ = false;
@@ -495,8 +643,13 @@ wxThread::ExitCode ImageProcessingThread::Entry() {
  * Set a pointer to an image buffer data.
  * The buffer is input data for sub thread.
  * @param receive_image [in] pointer to an image buffer data.
+ * @param metadata [in] metadata of the image buffer data.
+ * @param derivatives [in] derived formats shared at the branch (can be
+ * NULL).
  */
-void ImageProcessingThread::set_receive_image(cv::Mat* dst_image) {
+void ImageProcessingThread::set_receive_image(cv::Mat* dst_image,
+                                              const FrameMetadata* metadata,
+                                              FrameDerivatives* derivatives) {
   receive_image_mutex_.Lock();
   if (receive_image_ != NULL &&
       ((dst_image->size().width != receive_image_->size().width) ||
@@ -513,6 +666,14 @@ void ImageProcessingThread::set_receive_image(cv::Mat* dst_image) {
     receive_image_ = new cv::Mat(dst_image->size(), dst_image->type());
   }
   *receive_image_ = dst_image->clone();
+  FrameMetadataCopy(&receive_metadata_, metadata);
+  if (receive_derivatives_ != NULL) {
+    receive_derivatives_->Release();
+  }
+  receive_derivatives_ = derivatives;
+  if (receive_derivatives_ != NULL) {
+    receive_derivatives_->AddRef();
+  }
   receive_image_mutex_.Unlock();
 }
 
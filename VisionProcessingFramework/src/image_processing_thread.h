@@ -12,9 +12,12 @@
 #include <vector>
 #include <string>
 #include "./common_param.h"
+#include "./frame_derivatives.h"
+#include "./frame_metadata.h"
 #include "./image_processing_thread.h"
 #include "./include.h"
 #include "./plugin_base.h"
+#include "./thread_placement.h"
 #include "./thread_running_cycle_manager.h"
 
 class MainWnd;
@@ -88,8 +91,12 @@ class ImageProcessingThread : public wxThread {
    * Set a pointer to an image buffer data. The buffer is input data for sub
    * thread.
    * @param receive_image [in] pointer to an image buffer data.
+   * @param metadata [in] metadata of the image buffer data.
+   * @param derivatives [in] derived formats shared at the branch (can be
+   * NULL).
    */
-  void set_receive_image(cv::Mat* receive_image);
+  void set_receive_image(cv::Mat* receive_image, const FrameMetadata* metadata,
+                         FrameDerivatives* derivatives);
 
   /**
    * @brief
@@ -175,6 +182,19 @@ class ImageProcessingThread : public wxThread {
    */
   void ClearSubThreadMap();
 
+  /**
+   * @brief
+   * Get free derived formats from the pool for a branch of this flow.
+   * @return derived formats with a reference for the caller.
+   */
+  FrameDerivatives* AcquireDerivatives(void);
+
+  /**
+   * @brief
+   * Release the derived formats of the frame being processed.
+   */
+  void ReleaseFrameDerivatives(void);
+
   /*! Pointer to the root plugin (NOT own it) */
   IPlugin* root_plugin_;
 
@@ -184,6 +204,21 @@ class ImageProcessingThread : public wxThread {
   /*! Pointer to an image buffer data */
   cv::Mat* receive_image_;
 
+  /*! Metadata of the image buffer data received from the parent flow */
+  FrameMetadata receive_metadata_;
+
+  /*! Metadata of the frame processed by this flow */
+  FrameMetadata frame_metadata_;
+
+  /*! Derived formats received from the parent flow (one reference) */
+  FrameDerivatives* receive_derivatives_;
+
+  /*! Derived formats valid for the current source image (one reference) */
+  FrameDerivatives* frame_derivatives_;
+
+  /*! Derived formats reused at the branches (one reference each) */
+  std::vector<FrameDerivatives*> derivatives_pool_;
+
   /*! Pointer to a semaphore object for synchronization branch point (NOT own
    * it) */
   wxSemaphore* wait_sem_;
@@ -225,6 +260,10 @@ class ImageProcessingThread : public wxThread {
 
   /*! The name of the last plugin on the flow. */
   std::string last_plugin_name_;
+
+  /*! Placement and scheduling monitor of the thread (named after the root
+   * plugin) */
+  ThreadPlacer placer_;
 };
 
 #endif /* _IMAGE_PROCESSING_THREAD_H_*/
@@ -0,0 +1,869 @@
+/**
+ * @file      ois_register_tables.cpp
+ * @brief     Register tables of the OIS/AF driver
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#include "./ois_register_tables.h"
+
+/* Gyro activation */
+const UINT8 kOisTableGyro[] = {
+  0xF0, 0x20, 16,
+  0x01, 0x01, 0x18, 0x10, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0xE1,
+  0x0B, 0x13, 0x00, 0x00,
+  0xF0, 0x2C, 4,
+  0x0C, 0x80, 0x00, 0x00,
+  0xFF, 0xFF, 0,
+};
+
+/* Download program 1 */
+const UINT8 kOisTableProgram1[] = {
+  0x00, 0x00, 255,
+  0x24, 0x00, 0xB5, 0x70, 0x28, 0x00, 0x46, 0x22, 0x4A, 0x35, 0xDA, 0x10,
+  0xD0, 0x04, 0x18, 0x80, 0xD0, 0x04, 0x28, 0x01, 0xD1, 0x60, 0x28, 0x04,
+  0x4A, 0x32, 0xE0, 0x03, 0x4A, 0x32, 0xE0, 0x02, 0x4A, 0x32, 0xE0, 0x00,
+  0x47, 0x90, 0x46, 0x08, 0xE0, 0x56, 0x46, 0x04, 0x33, 0x40, 0x23, 0xFF,
+  0x42, 0x98, 0x1A, 0xC5, 0xDC, 0x1F, 0xD0, 0x4B, 0xD0, 0x3D, 0x28, 0xCC,
+  0x28, 0x94, 0xDC, 0x0C, 0xDC, 0x04, 0xD0, 0x45, 0xD0, 0x42, 0x28, 0x92,
+  0xD1, 0x46, 0x28, 0x93, 0x28, 0xA0, 0xE0, 0x28, 0x28, 0xA1, 0xD0, 0x3D,
+  0xE0, 0x25, 0xD1, 0x41, 0x35, 0x0D, 0x25, 0xFF, 0x42, 0xA8, 0x1B, 0x43,
+  0xDC, 0x04, 0xD0, 0x35, 0xD0, 0x32, 0x33, 0x0C, 0xD1, 0x36, 0x2B, 0x01,
+  0x2B, 0x01, 0xE0, 0x20, 0x2B, 0x02, 0xD0, 0x20, 0xE0, 0x2A, 0xD1, 0x31,
+  0xD0, 0x25, 0x2D, 0x0E, 0x3D, 0x09, 0xDC, 0x07, 0xF0, 0x00, 0x00, 0x2B,
+  0x24, 0x05, 0xFB, 0x29, 0x1F, 0x1D, 0x24, 0x1B, 0x3D, 0x19, 0x00, 0x2A,
+  0xF0, 0x00, 0x00, 0x2B, 0x1C, 0x07, 0xFB, 0x21, 0x22, 0x0B, 0x1C, 0x09,
+  0x00, 0x22, 0x1B, 0x22, 0xE0, 0x14, 0x4A, 0x13, 0xE0, 0x12, 0x4A, 0x13,
+  0xE0, 0x10, 0x4A, 0x13, 0xE0, 0x0E, 0x4A, 0x13, 0xE0, 0x0C, 0x4A, 0x13,
+  0xE0, 0x0A, 0x4A, 0x13, 0xE0, 0x08, 0x4A, 0x13, 0xE0, 0x06, 0x4A, 0x13,
+  0xE0, 0x04, 0x4A, 0x13, 0xE0, 0x02, 0x4A, 0x13, 0xE0, 0x00, 0x4A, 0x13,
+  0x4B, 0x14, 0x4A, 0x13, 0x2A, 0x00, 0x54, 0x19, 0xB2, 0xC8, 0xD0, 0x01,
+  0x46, 0x20, 0x47, 0x90, 0x00, 0x00, 0xBD, 0x70, 0x7F, 0xFF, 0xFF, 0xD6,
+  0x10, 0x00, 0x06, 0x1B, 0x10, 0x00, 0x05, 0xCD, 0x10, 0x00, 0x04, 0xD5,
+  0x10, 0x00, 0x0A, 0xC5, 0x10, 0x00, 0x0A, 0xD7, 0x10, 0x00, 0x0A, 0x49,
+  0x10, 0x00, 0x0A,
+  0x00, 0xFF, 255,
+  0x69, 0x10, 0x00, 0x08, 0xD1, 0x10, 0x00, 0x08, 0xDD, 0x10, 0x00, 0x0A,
+  0xE5, 0x10, 0x00, 0x08, 0xED, 0x10, 0x00, 0x09, 0x59, 0x10, 0x00, 0x09,
+  0xA5, 0x10, 0x00, 0x09, 0xFD, 0x10, 0x00, 0x0A, 0x89, 0x10, 0x00, 0x19,
+  0x40, 0x46, 0x0C, 0xB5, 0x70, 0xD0, 0x15, 0x00, 0x05, 0xD0, 0x15, 0x2D,
+  0x01, 0x3C, 0xFF, 0x21, 0xFF, 0x3C, 0xFF, 0x31, 0x05, 0x20, 0x19, 0x3C,
+  0x02, 0x18, 0x08, 0x06, 0xC0, 0x49, 0xBE, 0x60, 0x04, 0x68, 0x09, 0x48,
+  0xBC, 0x47, 0x88, 0x68, 0x40, 0xD0, 0x07, 0x2C, 0x00, 0xF0, 0x00, 0x46,
+  0x28, 0xBD, 0x70, 0xF9, 0xA1, 0xE7, 0xEE, 0x21, 0x58, 0xE7, 0xEC, 0x21,
+  0x5C, 0xBD, 0x70, 0x20, 0x00, 0x46, 0x06, 0xB5, 0xF3, 0xB0, 0x89, 0x48,
+  0xB5, 0x32, 0xF9, 0x1D, 0xC2, 0x21, 0x00, 0x30, 0xA0, 0x90, 0x03, 0x92,
+  0x04, 0xD0, 0x00, 0x2E, 0x00, 0x70, 0x41, 0x46, 0x10, 0x68, 0x28, 0x4D,
+  0xAD, 0x28, 0x00, 0x4F, 0xAF, 0xF0, 0x00, 0xD1, 0x19, 0x46, 0x3C, 0xF9,
+  0x93, 0x60, 0x20, 0x3C, 0x0C, 0xF0, 0x00, 0x20, 0x01, 0x60, 0x60, 0xF9,
+  0x8D, 0xF0, 0x00, 0x20, 0x02, 0x60, 0xA0, 0xF9, 0x89, 0x20, 0x06, 0x4C,
+  0xA8, 0x60, 0x38, 0x47, 0xA0, 0x47, 0xA0, 0x20, 0x04, 0x20, 0x2A, 0x60,
+  0x78, 0x60, 0xB8, 0x47, 0xA0, 0x1C, 0x40, 0x68, 0x28, 0x21, 0x0F, 0x60,
+  0x28, 0xD0, 0x01, 0x2E, 0x00, 0xE0, 0x00, 0x98, 0x04, 0x78, 0x02, 0x98,
+  0x03, 0x28, 0x01, 0x98, 0x0A, 0x06, 0x10, 0xD1, 0x7E, 0x2E, 0x00, 0x0F,
+  0x00, 0x28, 0x03, 0xD0, 0x0C, 0x28, 0x00, 0xD8, 0x79, 0x24, 0x01, 0xD0,
+  0x06, 0x02, 0xA4, 0x01, 0xC3, 0x01, 0xC0, 0x1A, 0xE3, 0xE0, 0x0B, 0x93,
+  0x00, 0xE7, 0xFA, 0x4B, 0x96, 0xD8, 0x6D, 0x28, 0x07, 0xD0, 0x19, 0x28,
+  0x00, 0x90, 0x00,
+  0x01, 0xFE, 255,
+  0x02, 0x00, 0x1C, 0x40, 0x43, 0xC0, 0x0D, 0x00, 0x05, 0x00, 0x07, 0x10,
+  0x90, 0x05, 0x28, 0x07, 0x0F, 0x00, 0x02, 0x40, 0xD8, 0x5E, 0x90, 0x07,
+  0x4A, 0x8E, 0x68, 0x12, 0x21, 0x00, 0x47, 0x90, 0x20, 0x02, 0x43, 0x48,
+  0x21, 0x64, 0x60, 0x68, 0x24, 0x00, 0xD0, 0x03, 0x2E, 0x00, 0xE0, 0x05,
+  0x24, 0x02, 0xE7, 0xE4, 0x20, 0x80, 0xD0, 0x12, 0x2C, 0x00, 0xD0, 0x12,
+  0x2C, 0x01, 0x4A, 0x85, 0x21, 0x90, 0x68, 0x12, 0x20, 0x04, 0x21, 0x01,
+  0x47, 0x90, 0x1A, 0x08, 0x02, 0xC9, 0x0D, 0x00, 0x05, 0x00, 0x2E, 0x00,
+  0x90, 0x02, 0x48, 0x7B, 0xD0, 0x07, 0x58, 0x45, 0x00, 0xA1, 0x21, 0x8C,
+  0xE0, 0x17, 0x21, 0x92, 0xE7, 0xED, 0x46, 0x20, 0xE7, 0xEB, 0xF9, 0x16,
+  0xF0, 0x00, 0x1A, 0x40, 0x99, 0x02, 0xF0, 0x00, 0x21, 0x0A, 0x49, 0x73,
+  0xFA, 0x25, 0x58, 0x89, 0x00, 0xA2, 0x46, 0x29, 0x1A, 0x0D, 0xF0, 0x00,
+  0x46, 0x20, 0x49, 0x6D, 0xF8, 0xF9, 0x68, 0x09, 0x20, 0x01, 0x46, 0x20,
+  0x47, 0x88, 0xF7, 0xFF, 0x99, 0x00, 0x90, 0x01, 0xFF, 0x47, 0x99, 0x05,
+  0x46, 0x20, 0xFF, 0x42, 0xF7, 0xFF, 0x98, 0x01, 0x46, 0x07, 0xD0, 0x26,
+  0x2E, 0x00, 0xD5, 0x00, 0x1B, 0xC0, 0x10, 0x41, 0x42, 0x40, 0x42, 0xB8,
+  0x98, 0x01, 0x46, 0x07, 0xD2, 0x00, 0x99, 0x02, 0x19, 0xC8, 0x21, 0x0A,
+  0x1A, 0x40, 0xF9, 0xFE, 0xF0, 0x00, 0x48, 0x5F, 0x1A, 0x2D, 0x50, 0x45,
+  0x00, 0xA1, 0xE0, 0x02, 0x46, 0x29, 0xE0, 0x9D, 0xE0, 0x9C, 0x46, 0x20,
+  0xE0, 0xAB, 0xF8, 0xCE, 0xF0, 0x00, 0x20, 0x01, 0x49, 0x57, 0x47, 0x88,
+  0x68, 0x09, 0xF0, 0x00, 0x46, 0x20, 0x46, 0x07, 0xF8, 0xD7, 0x99, 0x00,
+  0x46, 0x20, 0xFF, 0x18, 0xF7, 0xFF, 0x1B, 0xC1, 0x90, 0x01, 0x42, 0x49,
+  0xD5, 0x00, 0x00,
+  0x02, 0xFD, 255,
+  0xA7, 0x48, 0x51, 0x97, 0x06, 0x38, 0x0C, 0x9A, 0x07, 0x59, 0xC0, 0xF0,
+  0x00, 0x43, 0x50, 0x49, 0x4D, 0xF9, 0xDF, 0x39, 0x0C, 0x90, 0x01, 0x46,
+  0x20, 0x51, 0xC8, 0xF0, 0x00, 0x99, 0x01, 0x49, 0x47, 0xF8, 0x9D, 0x68,
+  0x09, 0x48, 0x45, 0x47, 0x88, 0x68, 0x40, 0xD0, 0x20, 0x2E, 0x00, 0xF0,
+  0x00, 0x46, 0x20, 0x46, 0x07, 0xF8, 0xB3, 0x99, 0x05, 0x46, 0x20, 0xFE,
+  0xF4, 0xF7, 0xFF, 0xD5, 0x00, 0x1A, 0x39, 0x10, 0x49, 0x42, 0x49, 0xD2,
+  0x00, 0x42, 0x87, 0x18, 0x08, 0x46, 0x38, 0x1A, 0x40, 0x99, 0x02, 0xF0,
+  0x00, 0x21, 0x0A, 0x1A, 0x2D, 0xF9, 0xB5, 0x99, 0x06, 0x48, 0x3A, 0x46,
+  0x29, 0x50, 0x45, 0xF0, 0x00, 0x46, 0x20, 0x49, 0x35, 0xF8, 0x89, 0x68,
+  0x09, 0x20, 0x01, 0x46, 0x20, 0x47, 0x88, 0xF8, 0x92, 0xF0, 0x00, 0x46,
+  0x20, 0x46, 0x07, 0xF7, 0xFF, 0x99, 0x00, 0x4A, 0x31, 0xFE, 0xD3, 0x3A,
+  0x24, 0x00, 0xE1, 0x18, 0x89, 0x50, 0x50, 0x2E, 0x00, 0x60, 0x4F, 0x1B,
+  0xC1, 0xD1, 0x18, 0x42, 0x49, 0xD5, 0x00, 0x42, 0xB8, 0x10, 0x49, 0x46,
+  0x38, 0xD3, 0x00, 0x99, 0x02, 0x18, 0x08, 0x21, 0x0A, 0x1A, 0x40, 0xF9,
+  0x8C, 0xF0, 0x00, 0x48, 0x26, 0x1A, 0x2D, 0x50, 0x45, 0x99, 0x06, 0x46,
+  0x20, 0x46, 0x29, 0xF8, 0x60, 0xF0, 0x00, 0x20, 0x01, 0x49, 0x20, 0x47,
+  0x88, 0x68, 0x09, 0xD0, 0x27, 0x2C, 0x02, 0x46, 0x20, 0x21, 0x00, 0xFE,
+  0xAC, 0xF7, 0xFF, 0x46, 0x20, 0x46, 0x29, 0xF8, 0x52, 0xF0, 0x00, 0xD0,
+  0x20, 0x2C, 0x00, 0xD0, 0x21, 0x2C, 0x01, 0x30, 0x05, 0x20, 0xFF, 0x4F,
+  0x17, 0x1C, 0x41, 0x54, 0x3B, 0x0A, 0x2B, 0x46, 0x20, 0x54, 0x7D, 0xF0,
+  0x00, 0x99, 0x01, 0x2C, 0x00, 0xF8, 0x33, 0x2C, 0x01, 0xD0, 0x17, 0x20,
+  0xFF, 0xD0, 0x17,
+  0x03, 0xFC, 255,
+  0x99, 0x01, 0x30, 0x03, 0x21, 0x01, 0x54, 0x39, 0x2C, 0x02, 0x1C, 0x64,
+  0xE7, 0x0D, 0xD2, 0x00, 0xD0, 0x0E, 0x2E, 0x00, 0xE0, 0x0D, 0x98, 0x04,
+  0x02, 0x49, 0x21, 0x01, 0x20, 0xA4, 0xE7, 0xD5, 0xE7, 0xE0, 0x21, 0xA5,
+  0x21, 0xA7, 0x20, 0xA6, 0x20, 0xA2, 0xE7, 0xDD, 0x20, 0xA3, 0xE7, 0xE9,
+  0x98, 0x03, 0xE7, 0xE7, 0xB0, 0x0B, 0x70, 0x41, 0x00, 0x00, 0xBD, 0xF0,
+  0x10, 0x00, 0x0F, 0x84, 0x10, 0x00, 0x0E, 0xF8, 0x10, 0x00, 0x19, 0x40,
+  0x10, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x07, 0x7B, 0x00, 0x00, 0x03, 0xFF,
+  0x10, 0x00, 0x0E, 0xF4, 0x10, 0x00, 0x0E, 0xF0, 0xD0, 0x09, 0x28, 0x00,
+  0xD0, 0x09, 0x28, 0x01, 0x05, 0x89, 0x20, 0x44, 0x0D, 0x89, 0x22, 0x19,
+  0x18, 0x80, 0x06, 0xD2, 0x47, 0x70, 0x60, 0x01, 0xE7, 0xF6, 0x20, 0x18,
+  0xE7, 0xF4, 0x20, 0x1C, 0xD0, 0x09, 0x28, 0x00, 0xD0, 0x09, 0x28, 0x01,
+  0x05, 0x89, 0x20, 0x48, 0x0D, 0x89, 0x22, 0x19, 0x18, 0x80, 0x06, 0xD2,
+  0x47, 0x70, 0x60, 0x01, 0xE7, 0xF6, 0x20, 0x20, 0xE7, 0xF4, 0x20, 0x24,
+  0xD0, 0x07, 0x28, 0x00, 0xD0, 0x07, 0x28, 0x01, 0x21, 0x19, 0x20, 0x68,
+  0x18, 0x40, 0x06, 0xC9, 0x47, 0x70, 0x68, 0x00, 0xE7, 0xF8, 0x20, 0x60,
+  0xE7, 0xF6, 0x20, 0x64, 0xD0, 0x04, 0x28, 0x00, 0xD0, 0x04, 0x28, 0x01,
+  0x49, 0x03, 0x20, 0x24, 0x20, 0x02, 0x47, 0x08, 0x20, 0x00, 0xE7, 0xFB,
+  0x00, 0x00, 0xE7, 0xF9, 0x00, 0x00, 0x07, 0x89, 0x47, 0x70, 0xBA, 0x40,
+  0x4D, 0x6C, 0xB5, 0xF8, 0x4E, 0x6B, 0x46, 0x04, 0xF0, 0x00, 0x35, 0xB4,
+  0x4F, 0x6A, 0xF9, 0xC3, 0xD0, 0x15, 0x2C, 0x00, 0x60, 0x38, 0x6B, 0x60,
+  0x60, 0x78, 0x6B, 0xA0, 0x60, 0xB8, 0x69, 0x60, 0x60, 0xF8, 0x68, 0xA0,
+  0x61, 0x38, 0x68,
+  0x04, 0xFB, 255,
+  0xE0, 0x61, 0x78, 0x69, 0x20, 0x61, 0xB8, 0x6B, 0x20, 0x61, 0xF8, 0x69,
+  0xE0, 0x62, 0x38, 0x6A, 0xA0, 0x62, 0x78, 0x6A, 0x20, 0x62, 0xB8, 0x6A,
+  0xE0, 0x78, 0x00, 0x48, 0x5E, 0xD1, 0x0B, 0x28, 0x19, 0x69, 0x7A, 0x21,
+  0x1E, 0x47, 0x90, 0x20, 0x00, 0x21, 0x1D, 0x02, 0x04, 0x20, 0x00, 0x69,
+  0x7A, 0x49, 0x59, 0x47, 0x90, 0x60, 0x88, 0x43, 0x20, 0x21, 0x20, 0x48,
+  0x58, 0x4F, 0x54, 0x81, 0x01, 0x69, 0x7A, 0x21, 0x02, 0x47, 0x90, 0x20,
+  0x01, 0x06, 0xC9, 0x21, 0x19, 0x49, 0x54, 0x63, 0xC8, 0x61, 0x08, 0x20,
+  0x00, 0x31, 0x80, 0x49, 0x52, 0x49, 0x51, 0x62, 0x48, 0x39, 0xC0, 0x48,
+  0x51, 0x48, 0x4C, 0x61, 0x88, 0x21, 0x0C, 0x78, 0x04, 0x20, 0x01, 0x69,
+  0x7A, 0x07, 0x07, 0x47, 0x90, 0x0F, 0x3F, 0x06, 0x00, 0x28, 0x02, 0x0F,
+  0x00, 0x2C, 0x13, 0xD1, 0x28, 0x2C, 0x41, 0xD0, 0x04, 0x2C, 0x42, 0xD0,
+  0x06, 0xE0, 0x0C, 0xD0, 0x09, 0x4E, 0x47, 0x4D, 0x47, 0xE0, 0x08, 0x35,
+  0xB4, 0x4D, 0x45, 0x4E, 0x45, 0x35, 0xBC, 0x36, 0x08, 0x4E, 0x3C, 0xE0,
+  0x03, 0x36, 0x14, 0x4D, 0x42, 0x4C, 0x3B, 0x3D, 0x84, 0x69, 0x62, 0x21,
+  0x0D, 0x47, 0x90, 0x20, 0x01, 0x47, 0x88, 0x69, 0xA1, 0x47, 0xB0, 0x20,
+  0x0B, 0x47, 0xA8, 0x20, 0x13, 0x47, 0xB0, 0x20, 0x0C, 0x47, 0xA8, 0x20,
+  0x80, 0xD1, 0x03, 0x2F, 0x01, 0x47, 0xB0, 0x20, 0x1F, 0x47, 0xA8, 0x20,
+  0x08, 0xBD, 0xF8, 0x20, 0x00, 0x4B, 0x2F, 0xB5, 0x00, 0x6A, 0xD9, 0xB0,
+  0x87, 0xD0, 0x01, 0x28, 0x00, 0xD1, 0x1B, 0x28, 0x04, 0xD1, 0x19, 0x29,
+  0x01, 0x07, 0x89, 0x20, 0x00, 0x07, 0x89, 0x68, 0x09, 0x49, 0x2F, 0xD0,
+  0x0E, 0x49, 0x2F, 0x91, 0x04, 0x90, 0x01, 0x91, 0x05, 0x90, 0x02, 0x49,
+  0x2E, 0x90, 0x03,
+  0x05, 0xFA, 255,
+  0x91, 0x06, 0x22, 0x01, 0x68, 0x1B, 0xA8, 0x04, 0xA9, 0x01, 0xE0, 0x05,
+  0x47, 0x98, 0x61, 0x08, 0x49, 0x24, 0x63, 0x88, 0x49, 0x29, 0x63, 0x88,
+  0x49, 0x29, 0xB0, 0x07, 0x20, 0x00, 0xB5, 0x70, 0xBD, 0x00, 0x4C, 0x27,
+  0x49, 0x1C, 0x78, 0x09, 0x31, 0x20, 0x07, 0x49, 0xB0, 0x88, 0x4D, 0x18,
+  0x0F, 0x49, 0x62, 0xE9, 0x28, 0x01, 0x29, 0x00, 0xD1, 0x26, 0x29, 0x04,
+  0xD0, 0x01, 0x20, 0x0E, 0xD1, 0x22, 0x46, 0x06, 0x47, 0xA0, 0x47, 0xA0,
+  0x20, 0x0C, 0x43, 0x30, 0x04, 0x00, 0x07, 0x89, 0x21, 0x01, 0x07, 0x8A,
+  0x68, 0x09, 0x2A, 0x00, 0x21, 0x00, 0x4A, 0x14, 0xD0, 0x0E, 0x4A, 0x14,
+  0x92, 0x04, 0x4A, 0x14, 0x92, 0x05, 0x91, 0x02, 0x92, 0x06, 0x90, 0x01,
+  0x91, 0x03, 0x22, 0x03, 0x68, 0x2B, 0xA8, 0x04, 0xA9, 0x01, 0xE0, 0x05,
+  0x47, 0x98, 0x61, 0x10, 0x4A, 0x09, 0x63, 0x81, 0x48, 0x0E, 0x63, 0x81,
+  0x48, 0x0E, 0xB0, 0x08, 0x20, 0x00, 0x47, 0x70, 0xBD, 0x70, 0x00, 0x00,
+  0x29, 0xD9, 0x10, 0x00, 0x0E, 0xE0, 0x10, 0x00, 0x19, 0x40, 0xC8, 0x00,
+  0x01, 0x80, 0x10, 0x00, 0x1A, 0x80, 0x50, 0x00, 0x60, 0xC0, 0x30, 0x48,
+  0x30, 0x48, 0x00, 0x00, 0x2B, 0x25, 0x00, 0x00, 0x60, 0xD0, 0x00, 0x00,
+  0x41, 0x38, 0x00, 0x00, 0x51, 0x38, 0x50, 0x00, 0x41, 0x00, 0x50, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x07, 0x7B, 0x48, 0x01, 0xB4, 0x03, 0xBD, 0x01,
+  0x90, 0x01, 0x00, 0x00, 0x00, 0xD5, 0x48, 0x01, 0xB4, 0x03, 0xBD, 0x01,
+  0x90, 0x01, 0x00, 0x00, 0x00, 0xC1, 0x46, 0x74, 0xB4, 0x30, 0x78, 0x25,
+  0x1E, 0x64, 0x42, 0xAB, 0x1C, 0x64, 0x46, 0x1D, 0xD2, 0x00, 0x00, 0x5B,
+  0x5D, 0x63, 0xBC, 0x30, 0x18, 0xE3, 0x00, 0x00, 0x47, 0x18, 0x2A, 0x05,
+  0xB5, 0xF0, 0x20,
+  0x06, 0xF9, 255,
+  0x00, 0xDD, 0x02, 0xBD, 0xF0, 0x43, 0xC0, 0x23, 0x00, 0xB6, 0x72, 0xE0,
+  0x0B, 0x46, 0x1C, 0x4E, 0x09, 0x00, 0x9D, 0x19, 0xAE, 0x59, 0x47, 0x59,
+  0x4D, 0x60, 0x77, 0x1D, 0x5E, 0x62, 0xF5, 0x40, 0xB5, 0x25, 0x01, 0x1C,
+  0x5B, 0x43, 0x2C, 0xDB, 0xF1, 0x42, 0x93, 0x07, 0x80, 0x20, 0x01, 0xB6,
+  0x62, 0x62, 0x44, 0xBD, 0xF0, 0x20, 0x00, 0x40, 0x00, 0x00, 0x40, 0x28,
+  0x02, 0xB5, 0x1F, 0x28, 0x01, 0xD0, 0x24, 0x48, 0x16, 0xD0, 0x27, 0x48,
+  0x15, 0x90, 0x00, 0x4B, 0x15, 0x30, 0x08, 0x68, 0x1B, 0x90, 0x01, 0xA9,
+  0x02, 0x22, 0x02, 0x47, 0x98, 0x46, 0x68, 0x99, 0x03, 0x98, 0x02, 0x15,
+  0x00, 0x01, 0x00, 0x43, 0xC0, 0xD5, 0x01, 0x4A, 0x0F, 0x1C, 0x40, 0x68,
+  0x93, 0x05, 0x00, 0x18, 0x18, 0x0D, 0x00, 0x01, 0x08, 0x60, 0x90, 0xD5,
+  0x01, 0x15, 0x00, 0x1C, 0x40, 0x43, 0xC0, 0x68, 0xD1, 0x05, 0x00, 0x18,
+  0x08, 0x0D, 0x00, 0xBD, 0x1F, 0x60, 0xD0, 0x90, 0x00, 0x48, 0x07, 0x30,
+  0x08, 0x48, 0x06, 0x48, 0x06, 0xE7, 0xDB, 0x48, 0x05, 0x90, 0x00, 0xE7,
+  0xD6, 0x30, 0x08, 0x00, 0x00, 0x41, 0x04, 0x10, 0x00, 0x0E, 0xE4, 0x10,
+  0x00, 0x0F, 0x10, 0x00, 0x00, 0x43, 0x40, 0x00, 0x00, 0x51, 0x04, 0x4E,
+  0x18, 0xB5, 0xF3, 0x68, 0xF4, 0xB0, 0x81, 0x2C, 0x00, 0x68, 0xB7, 0x12,
+  0xA1, 0xD0, 0x26, 0xF7, 0xFF, 0x46, 0x38, 0x46, 0x05, 0xFF, 0x7F, 0x28,
+  0x02, 0x98, 0x01, 0xD0, 0x16, 0x48, 0x12, 0x7C, 0x80, 0x30, 0x80, 0x09,
+  0x00, 0x49, 0x0F, 0x31, 0x54, 0x00, 0x40, 0x46, 0x20, 0x5A, 0x09, 0x46,
+  0x39, 0x43, 0x48, 0xFF, 0x74, 0xF7, 0xFF, 0x60, 0x08, 0x99, 0x02, 0x88,
+  0x01, 0x69, 0x30, 0x42, 0x85, 0x88, 0x40, 0x42, 0x8D, 0xD9, 0x07, 0x20,
+  0x00, 0xD2, 0x05,
+  0x07, 0xF8, 255,
+  0x30, 0xFF, 0xBD, 0xFE, 0x7B, 0x00, 0x30, 0x01, 0x48, 0x05, 0xE7, 0xE6,
+  0xD3, 0x01, 0x42, 0x85, 0xBD, 0xFE, 0x20, 0x02, 0xBD, 0xFE, 0x20, 0x01,
+  0x10, 0x00, 0x0F, 0x10, 0x10, 0x00, 0x19, 0x40, 0x00, 0x00, 0x0C, 0xA6,
+  0x48, 0x10, 0xB5, 0x70, 0x4E, 0x0F, 0x69, 0xC5, 0x36, 0x98, 0x4B, 0x0E,
+  0x3B, 0x18, 0x1C, 0x71, 0x1D, 0x1A, 0x1C, 0xCC, 0x1D, 0x10, 0x78, 0x36,
+  0xD0, 0x11, 0x2E, 0x00, 0x78, 0x09, 0x68, 0x24, 0x06, 0x64, 0x19, 0x64,
+  0x29, 0x00, 0x0E, 0x64, 0x2C, 0x10, 0xD0, 0x0A, 0x49, 0x06, 0xD1, 0x08,
+  0x2C, 0x00, 0x7F, 0xCC, 0x68, 0x00, 0xD0, 0x04, 0x60, 0x10, 0x60, 0x18,
+  0x77, 0xC8, 0x20, 0x00, 0x00, 0x00, 0xBD, 0x70, 0x10, 0x00, 0x17, 0x40,
+  0x10, 0x00, 0x1A, 0x60, 0x49, 0x03, 0x48, 0x04, 0x49, 0x04, 0x60, 0x41,
+  0x49, 0x04, 0x60, 0x81, 0x47, 0x70, 0x62, 0x41, 0x10, 0x00, 0x08, 0x89,
+  0x10, 0x00, 0x1B, 0x48, 0x10, 0x00, 0x08, 0xA5, 0x10, 0x00, 0x08, 0x1D,
+  0x48, 0x04, 0xB5, 0x10, 0x28, 0x01, 0x78, 0x00, 0x48, 0x03, 0xD1, 0x03,
+  0xF0, 0x00, 0x78, 0x00, 0xBD, 0x10, 0xFA, 0x6B, 0x10, 0x00, 0x0F, 0x8C,
+  0x10, 0x00, 0x0F, 0x13, 0x78, 0x01, 0x48, 0x06, 0x29, 0x01, 0x20, 0x00,
+  0x49, 0x05, 0xD0, 0x06, 0x29, 0x01, 0x78, 0x09, 0x49, 0x04, 0xD1, 0x01,
+  0x47, 0x70, 0x70, 0x08, 0xE7, 0xFB, 0x49, 0x03, 0x10, 0x00, 0x0F, 0x8C,
+  0x10, 0x00, 0x0F, 0x11, 0x10, 0x00, 0x0F, 0x12, 0x10, 0x00, 0x0F, 0x10,
+  0xB2, 0xC1, 0xB5, 0x10, 0xF7, 0xFF, 0x20, 0x01, 0xBD, 0x10, 0xFC, 0x45,
+  0xB2, 0xC1, 0xB5, 0x10, 0xD1, 0x01, 0x29, 0x03, 0xF9, 0x20, 0xF0, 0x00,
+  0x00, 0x00, 0xBD, 0x10, 0x48, 0x15, 0xB5, 0x7C, 0x89, 0x00, 0x4C, 0x13,
+  0xFD, 0xEC, 0xF7,
+  0x08, 0xF7, 255,
+  0xFF, 0x14, 0x05, 0x04, 0x00, 0x47, 0xA0, 0x20, 0x2C, 0x14, 0x00, 0x04,
+  0x00, 0x49, 0x10, 0x43, 0x68, 0x42, 0x88, 0x13, 0x40, 0x43, 0xC9, 0xDC,
+  0x02, 0xDA, 0x00, 0x42, 0x88, 0xB2, 0x84, 0x46, 0x08, 0x4B, 0x0D, 0x48,
+  0x0C, 0x68, 0x1B, 0x90, 0x01, 0x46, 0x69, 0x22, 0x01, 0x47, 0x98, 0xA8,
+  0x01, 0x4B, 0x0A, 0x98, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x90, 0x00, 0x43,
+  0x20, 0x22, 0x01, 0x68, 0x1B, 0xA8, 0x01, 0x46, 0x69, 0xBD, 0x7C, 0x47,
+  0x98, 0x00, 0x00, 0x07, 0x7B, 0x10, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x7F,
+  0xFF, 0x00, 0x00, 0x61, 0x74, 0x10, 0x00, 0x0E, 0xE4, 0x10, 0x00, 0x0E,
+  0xE0, 0x48, 0x0F, 0xB5, 0x70, 0x89, 0x40, 0x4C, 0x0D, 0xFD, 0xB6, 0xF7,
+  0xFF, 0x15, 0x85, 0x05, 0x80, 0x47, 0xA0, 0x20, 0x2A, 0x38, 0xFF, 0x38,
+  0xFF, 0x05, 0x80, 0x38, 0x02, 0x49, 0x09, 0x15, 0x80, 0x42, 0x88, 0x19,
+  0x40, 0x43, 0xC9, 0xDC, 0x02, 0xDA, 0x00, 0x42, 0x88, 0x30, 0xFF, 0x46,
+  0x08, 0x49, 0x05, 0x30, 0xFF, 0x60, 0x88, 0x30, 0x02, 0x00, 0x00, 0xBD,
+  0x70, 0x00, 0x00, 0x07, 0x7B, 0x10, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x01,
+  0xFF, 0xC8, 0x00, 0x00, 0x40, 0x49, 0x0F, 0xB5, 0x00, 0x20, 0x28, 0xB0,
+  0x85, 0x21, 0x01, 0x47, 0x88, 0x68, 0x09, 0x07, 0x89, 0x21, 0x00, 0x07,
+  0x8A, 0xD0, 0x0D, 0x2A, 0x00, 0x92, 0x03, 0x4A, 0x0A, 0x4B, 0x0B, 0x4A,
+  0x0A, 0x91, 0x02, 0x92, 0x04, 0x68, 0x1B, 0x90, 0x01, 0xA9, 0x01, 0x22,
+  0x02, 0x47, 0x98, 0xA8, 0x03, 0xBD, 0x00, 0xB0, 0x05, 0x62, 0x50, 0x4A,
+  0x06, 0x62, 0xC1, 0x48, 0x06, 0x00, 0x00, 0xE7, 0xF8, 0x00, 0x00, 0x07,
+  0x7B, 0x00, 0x00, 0x61, 0x64, 0x00, 0x00, 0x43, 0x6C, 0x10, 0x00, 0x0E,
+  0xE0, 0x50, 0x00,
+  0x09, 0xF6, 255,
+  0x61, 0x40, 0x50, 0x00, 0x43, 0x40, 0x20, 0x00, 0xB5, 0x00, 0x07, 0x89,
+  0x21, 0x01, 0xB0, 0x85, 0x68, 0x09, 0xD0, 0x0D, 0x07, 0x89, 0x91, 0x03,
+  0x49, 0x09, 0x4B, 0x0A, 0x49, 0x09, 0x91, 0x04, 0x90, 0x01, 0x68, 0x1B,
+  0x90, 0x02, 0xA9, 0x01, 0x22, 0x02, 0x47, 0x98, 0xA8, 0x03, 0xBD, 0x00,
+  0xB0, 0x05, 0x62, 0x48, 0x49, 0x05, 0x62, 0xC8, 0x49, 0x05, 0x00, 0x00,
+  0xE7, 0xF8, 0x00, 0x00, 0x61, 0x64, 0x00, 0x00, 0x43, 0x6C, 0x10, 0x00,
+  0x0E, 0xE0, 0x50, 0x00, 0x61, 0x40, 0x50, 0x00, 0x43, 0x40, 0x8B, 0x00,
+  0x48, 0x04, 0x49, 0x04, 0x4A, 0x05, 0x76, 0x13, 0x0A, 0x03, 0x76, 0x50,
+  0x75, 0x0B, 0x47, 0x70, 0x75, 0x48, 0x10, 0x00, 0x1A, 0x80, 0x10, 0x00,
+  0x1D, 0xC0, 0x10, 0x00, 0x1C, 0xD0, 0x8B, 0x40, 0x48, 0x04, 0x49, 0x04,
+  0x4A, 0x05, 0x76, 0x93, 0x0A, 0x03, 0x76, 0xD0, 0x76, 0x8B, 0x47, 0x70,
+  0x76, 0xC8, 0x10, 0x00, 0x1A, 0x80, 0x10, 0x00, 0x1D, 0xC0, 0x10, 0x00,
+  0x1C, 0xD0, 0x07, 0xC0, 0xB5, 0x1C, 0xD0, 0x01, 0x0F, 0xC0, 0xE0, 0x00,
+  0x48, 0x08, 0x4B, 0x09, 0x48, 0x08, 0x68, 0x1B, 0x90, 0x00, 0xA9, 0x01,
+  0x22, 0x01, 0x47, 0x98, 0x46, 0x68, 0x49, 0x06, 0x98, 0x01, 0x77, 0x0A,
+  0x0E, 0x02, 0x77, 0x48, 0x0C, 0x00, 0x00, 0x00, 0xBD, 0x1C, 0x00, 0x00,
+  0x50, 0x54, 0x00, 0x00, 0x40, 0x54, 0x10, 0x00, 0x0E, 0xE4, 0x10, 0x00,
+  0x1A, 0x80, 0xB2, 0xC1, 0xB5, 0x10, 0xD0, 0x01, 0x29, 0x01, 0xD1, 0x01,
+  0x29, 0x02, 0xF8, 0x2A, 0xF0, 0x00, 0xB5, 0x10, 0xBD, 0x10, 0x20, 0x00,
+  0xB2, 0xC1, 0xFB, 0x42, 0xF7, 0xFF, 0x00, 0x00, 0xBD, 0x10, 0x07, 0x82,
+  0xB5, 0x10, 0x0F, 0x92, 0x49, 0x0D, 0x07, 0x82, 0x73, 0x0A, 0x4B, 0x0C,
+  0x0F, 0xD2, 0x58,
+  0x0A, 0xF5, 255,
+  0x9C, 0x00, 0xD2, 0x68, 0x53, 0x18, 0xD2, 0xD3, 0x02, 0x42, 0x9C, 0x23,
+  0x01, 0x24, 0x00, 0x24, 0x01, 0xE0, 0x01, 0x07, 0xC0, 0x23, 0x00, 0x00,
+  0xA0, 0xD0, 0x01, 0x00, 0x98, 0xE0, 0x00, 0x0A, 0x02, 0x58, 0x10, 0x73,
+  0xC8, 0x73, 0x8A, 0x00, 0x00, 0xBD, 0x10, 0x10, 0x00, 0x1A, 0x00, 0x10,
+  0x00, 0x0F, 0x98, 0xB2, 0xC0, 0xB5, 0xF0, 0x28, 0x01, 0xB0, 0x85, 0x28,
+  0x02, 0xD0, 0x42, 0x28, 0x03, 0xD0, 0x42, 0x24, 0x02, 0xD1, 0x7E, 0x4A,
+  0x7F, 0x4E, 0x80, 0x36, 0xFF, 0x46, 0x35, 0x35, 0x80, 0x20, 0x00, 0x70,
+  0xD4, 0x36, 0x01, 0xD0, 0x37, 0x2C, 0x02, 0x21, 0x01, 0x74, 0xE8, 0x20,
+  0x00, 0x70, 0x51, 0x60, 0xD0, 0x60, 0x90, 0x60, 0x50, 0x20, 0x04, 0xD0,
+  0x2F, 0x2C, 0x02, 0x7C, 0xA9, 0x7C, 0xA8, 0x07, 0x09, 0x09, 0x00, 0x23,
+  0x0A, 0x0F, 0x09, 0x23, 0x40, 0x43, 0x59, 0x4B, 0x71, 0x93, 0x04, 0x33,
+  0x14, 0x00, 0x80, 0x48, 0x6F, 0x18, 0xC3, 0x61, 0x03, 0x31, 0x6E, 0x48,
+  0x6F, 0x27, 0x05, 0xFD, 0xA0, 0xF7, 0xFF, 0x90, 0x03, 0x01, 0x00, 0xF0,
+  0x00, 0x46, 0x20, 0x49, 0x69, 0xF9, 0x41, 0x70, 0x08, 0x20, 0x01, 0x20,
+  0x04, 0x49, 0x6A, 0x48, 0x6A, 0x60, 0x08, 0x22, 0x0C, 0x68, 0x81, 0x60,
+  0x81, 0x43, 0x91, 0x98, 0x03, 0x49, 0x68, 0x1E, 0x40, 0x68, 0x09, 0xE0,
+  0x0C, 0x47, 0x88, 0xE7, 0xBF, 0x24, 0x00, 0xE7, 0xBD, 0x24, 0x01, 0xE7,
+  0xC6, 0x73, 0x70, 0x7B, 0x31, 0x7B, 0x30, 0xE7, 0xCE, 0x09, 0x00, 0xF7,
+  0xFF, 0x46, 0x20, 0x48, 0x5A, 0xFD, 0xB1, 0x28, 0x01, 0x78, 0x00, 0x48,
+  0x5E, 0xD0, 0xF8, 0x47, 0x80, 0x68, 0x00, 0x68, 0x90, 0x4A, 0x5A, 0x43,
+  0x88, 0x21, 0x0C, 0x60, 0x90, 0x1D, 0x00, 0x20, 0x04, 0x49, 0x56, 0x60,
+  0x08, 0x31, 0x80,
+  0x0B, 0xF4, 255,
+  0xF0, 0x00, 0x46, 0x20, 0xA9, 0x02, 0xF9, 0x41, 0xF7, 0xFF, 0x46, 0x20,
+  0x28, 0x01, 0xFD, 0xD5, 0x28, 0x02, 0xD0, 0x1F, 0x2F, 0x00, 0xD0, 0x7A,
+  0x2C, 0x02, 0xD0, 0x7F, 0x48, 0x51, 0xD0, 0x77, 0x90, 0x00, 0x4B, 0x51,
+  0x22, 0x01, 0x68, 0x1B, 0x46, 0x68, 0xA9, 0x01, 0x2C, 0x02, 0x47, 0x98,
+  0x98, 0x01, 0xD0, 0x7B, 0xD0, 0x7F, 0x2C, 0x01, 0x0E, 0x09, 0x04, 0x01,
+  0x74, 0x68, 0x74, 0x29, 0xE0, 0x00, 0x20, 0x01, 0x74, 0xE8, 0xE0, 0x03,
+  0x20, 0x00, 0x49, 0x3F, 0xB0, 0x05, 0x70, 0x48, 0x2F, 0x00, 0xBD, 0xF0,
+  0x1E, 0x7F, 0xD0, 0x61, 0xD0, 0x23, 0x2C, 0x02, 0xD0, 0x23, 0x2C, 0x01,
+  0x90, 0x00, 0x48, 0x42, 0x4B, 0x42, 0x20, 0x00, 0x68, 0x1B, 0x90, 0x01,
+  0xA9, 0x01, 0x22, 0x01, 0x47, 0x98, 0x46, 0x68, 0xD0, 0x19, 0x2C, 0x02,
+  0x4B, 0x3B, 0x48, 0x3A, 0x68, 0x1B, 0x90, 0x00, 0xA9, 0x01, 0x22, 0x01,
+  0x47, 0x98, 0x46, 0x68, 0x2C, 0x01, 0x98, 0x01, 0xB2, 0x81, 0xD0, 0x11,
+  0x43, 0x51, 0x9A, 0x02, 0x2C, 0x02, 0x09, 0xC9, 0x4A, 0x32, 0xD0, 0x0D,
+  0x2C, 0x01, 0x92, 0x00, 0xE0, 0x0B, 0xD0, 0x38, 0xE7, 0xDC, 0x48, 0x33,
+  0xE7, 0xDA, 0x48, 0x33, 0x30, 0x94, 0x48, 0x2D, 0x0C, 0x01, 0xE7, 0xE3,
+  0x4A, 0x2B, 0xE7, 0xEC, 0x92, 0x00, 0x32, 0x94, 0xB2, 0x89, 0x0C, 0x00,
+  0x43, 0x01, 0x04, 0x00, 0x91, 0x01, 0x4B, 0x2A, 0x22, 0x01, 0x68, 0x1B,
+  0x46, 0x68, 0xA9, 0x01, 0x49, 0x1D, 0x47, 0x98, 0x60, 0xC8, 0x20, 0x00,
+  0x20, 0x01, 0x60, 0x88, 0x49, 0x1D, 0x70, 0x88, 0x60, 0x08, 0x20, 0x04,
+  0x98, 0x04, 0x21, 0xD3, 0x43, 0x48, 0x00, 0xC9, 0x1E, 0x40, 0x49, 0x1B,
+  0x47, 0x88, 0x68, 0x09, 0x78, 0x81, 0x48, 0x14, 0xD0, 0xFC, 0x29, 0x01,
+  0x68, 0x00, 0x48,
+  0x0C, 0xF3, 255,
+  0x18, 0x49, 0x14, 0x47, 0x80, 0x31, 0x80, 0x20, 0x04, 0xE7, 0x47, 0x60,
+  0x08, 0xE0, 0x09, 0xE0, 0x05, 0xE0, 0x11, 0xE0, 0x0B, 0xB2, 0x80, 0x04,
+  0x09, 0x20, 0xFF, 0xE7, 0xD3, 0xD1, 0x90, 0x2C, 0x02, 0xE7, 0x91, 0x73,
+  0x70, 0x30, 0x94, 0x48, 0x0F, 0x98, 0x01, 0xE7, 0x7A, 0x0E, 0x09, 0x04,
+  0x01, 0x72, 0xF0, 0x72, 0xB1, 0xE7, 0xF3, 0x20, 0x03, 0x74, 0x29, 0x0E,
+  0x01, 0x0E, 0x00, 0x02, 0x00, 0x20, 0x02, 0x74, 0x68, 0x00, 0x00, 0xE7,
+  0x7D, 0x10, 0x00, 0x0F, 0x10, 0x10, 0x00, 0x19, 0x40, 0x01, 0x9B, 0xFC,
+  0xC0, 0xE0, 0x00, 0xE1, 0x00, 0xC6, 0x00, 0x00, 0x40, 0x10, 0x00, 0x0F,
+  0x04, 0x10, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x60, 0xD0, 0x10, 0x00, 0x0E,
+  0xE4, 0x00, 0x00, 0x41, 0x08, 0x10, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x43,
+  0x44, 0x00, 0x00, 0x51, 0x08, 0x4A, 0x23, 0xB5, 0x1C, 0x88, 0x51, 0x24,
+  0xFF, 0x42, 0xA1, 0x34, 0x01, 0x49, 0x21, 0xD1, 0x01, 0x68, 0x93, 0xE0,
+  0x02, 0x5A, 0x59, 0x00, 0x49, 0x2A, 0x02, 0x88, 0x92, 0x2A, 0x03, 0xD0,
+  0x01, 0x42, 0x49, 0xD1, 0x00, 0x04, 0x09, 0x4A, 0x1C, 0x12, 0x89, 0x68,
+  0x12, 0x91, 0x01, 0x43, 0x51, 0xD0, 0x16, 0x28, 0x02, 0xD0, 0x16, 0x28,
+  0x01, 0x90, 0x00, 0x48, 0x18, 0xA9, 0x01, 0x22, 0x01, 0xF7, 0xFF, 0x46,
+  0x68, 0x4B, 0x12, 0xFC, 0x9F, 0x1C, 0x9A, 0x1C, 0x9B, 0x88, 0x18, 0x88,
+  0x11, 0xD0, 0x0A, 0x29, 0x00, 0xD0, 0x08, 0x29, 0x02, 0xD0, 0x0E, 0x29,
+  0x01, 0xD0, 0x0C, 0x29, 0x03, 0x48, 0x0F, 0xE0, 0x0E, 0x48, 0x0F, 0xE7,
+  0xE9, 0x42, 0xA0, 0xE7, 0xE7, 0x1C, 0x49, 0xD1, 0x03, 0x0F, 0x89, 0x07,
+  0x89, 0x1D, 0x00, 0xE0, 0x03, 0x28, 0x00, 0xE0, 0x02, 0x1F, 0x00, 0xD0,
+  0x03, 0x80, 0x11,
+  0x0D, 0xF2, 255,
+  0x80, 0x18, 0x1C, 0x49, 0xBD, 0x1C, 0x0F, 0x89, 0x07, 0x89, 0xE7, 0xF7,
+  0x20, 0x04, 0x10, 0x00, 0x0F, 0x8C, 0x00, 0x00, 0x7F, 0xFF, 0x10, 0x00,
+  0x0F, 0x14, 0x00, 0x00, 0x41, 0x08, 0x00, 0x00, 0x43, 0x44, 0x00, 0x00,
+  0x51, 0x08, 0x49, 0x13, 0xB5, 0x10, 0x70, 0x0A, 0x22, 0x01, 0x28, 0x02,
+  0x22, 0x00, 0x48, 0x11, 0x80, 0x4A, 0xD0, 0x18, 0x80, 0x8A, 0x7C, 0x80,
+  0x30, 0x80, 0x07, 0x01, 0x4A, 0x0F, 0x20, 0x0A, 0x0F, 0x09, 0x31, 0x6E,
+  0x43, 0x41, 0x60, 0x10, 0x20, 0x02, 0x06, 0x40, 0x20, 0x63, 0x23, 0x0C,
+  0x6A, 0x82, 0x62, 0x82, 0x43, 0x9A, 0xF7, 0xFF, 0x48, 0x09, 0x49, 0x09,
+  0xFC, 0x3D, 0x68, 0x09, 0x0A, 0x00, 0x47, 0x88, 0x1E, 0x40, 0x30, 0xFF,
+  0xBD, 0x10, 0x7B, 0x00, 0x30, 0x01, 0x00, 0x00, 0xE7, 0xE4, 0x10, 0x00,
+  0x0F, 0x8C, 0x10, 0x00, 0x19, 0x40, 0xE0, 0x00, 0xE1, 0x00, 0x01, 0x9B,
+  0xFC, 0xC0, 0x10, 0x00, 0x0E, 0xFC, 0x46, 0x04, 0xB5, 0x1C, 0x68, 0x00,
+  0x48, 0x10, 0x20, 0x63, 0x47, 0x80, 0x6A, 0x81, 0x06, 0x40, 0x43, 0x91,
+  0x22, 0x0C, 0x62, 0x81, 0x1D, 0x09, 0x20, 0x02, 0x49, 0x0C, 0x2C, 0x02,
+  0x60, 0x08, 0x2C, 0x01, 0xD0, 0x0E, 0x48, 0x0A, 0xD0, 0x0E, 0x4B, 0x0A,
+  0x24, 0x00, 0x90, 0x00, 0x94, 0x01, 0x22, 0x01, 0x68, 0x1B, 0x46, 0x68,
+  0xA9, 0x01, 0x48, 0x07, 0x47, 0x98, 0xBD, 0x1C, 0x70, 0x04, 0xE7, 0xF1,
+  0x48, 0x06, 0xE7, 0xEF, 0x48, 0x06, 0x10, 0x00, 0x0F, 0x00, 0xE0, 0x00,
+  0xE1, 0x80, 0x00, 0x00, 0x41, 0x08, 0x10, 0x00, 0x0E, 0xE0, 0x10, 0x00,
+  0x0F, 0x8C, 0x00, 0x00, 0x43, 0x44, 0x00, 0x00, 0x51, 0x08, 0x10, 0x00,
+  0x06, 0x87, 0x10, 0x00, 0x06, 0x87, 0x10, 0x00, 0x06, 0x87, 0x10, 0x00,
+  0x06, 0x87, 0x10,
+  0x0E, 0xF1, 167,
+  0x00, 0x06, 0x87, 0x10, 0x00, 0x06, 0x87, 0x10, 0x00, 0x06, 0x87, 0x10,
+  0x00, 0x06, 0x87, 0x10, 0x00, 0x06, 0x87, 0x10, 0x00, 0x06, 0x87, 0x10,
+  0x00, 0x06, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xCA, 0x02, 0x3F, 0x02, 0x02, 0x02, 0x86, 0x02,
+  0x40, 0x02, 0xD4, 0x02, 0x87, 0x03, 0x2D, 0x02, 0xD5, 0x03, 0x90, 0x03,
+  0x2E, 0x04, 0x00, 0x03, 0x91, 0x04, 0x7C, 0x04, 0x01, 0x05, 0x09, 0x04,
+  0x7D, 0x05, 0xA6, 0x05, 0x0A, 0x06, 0x56, 0x05, 0xA7, 0x07, 0x1C, 0x06,
+  0x57, 0x07, 0xFB, 0x07, 0x1D, 0x08, 0xF4, 0x07, 0xFC, 0x0A, 0x0C, 0x08,
+  0xF5, 0x0B, 0x46, 0x0A, 0x0D, 0x0C, 0xA6, 0x00, 0x47, 0x00, 0x40, 0x00,
+  0x5A, 0x00, 0x50, 0x00, 0x72, 0x00, 0x65, 0x00, 0x8F, 0x00, 0x80, 0x00,
+  0xB4, 0x00, 0xA1, 0x00, 0xE3, 0x00, 0xCA, 0x01, 0x1E, 0x00, 0xFF, 0x01,
+  0x68, 0x01, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00,
+  0xFF, 0xFF, 0,
+};
+
+/* Download program 2 */
+const UINT8 kOisTableProgram2[] = {
+  0x1C, 0x00, 255,
+  0x00, 0x00, 0x77, 0x7E, 0x02, 0x0F, 0x24, 0x1B, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x22, 0x04, 0x0B, 0x80, 0x45, 0x00, 0x00, 0x00, 0x00, 0x02, 0x14,
+  0x00, 0x01, 0x00, 0x01, 0x08, 0x00, 0x00, 0x02, 0x10, 0x10, 0x10, 0x03,
+  0x0C, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x0C, 0x30, 0x01, 0x11,
+  0x00, 0xF0, 0x22, 0x71, 0x02, 0x27, 0x00, 0xF0, 0x83, 0xC0, 0x05, 0x00,
+  0x02, 0x32, 0x00, 0x02, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0xD0, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0x50, 0x50, 0x50, 0x50,
+  0x3F, 0x3F, 0x07, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x02, 0x00, 0x83, 0x91, 0x3C, 0x6F,
+  0x83, 0x9A, 0x3C, 0x66, 0x3F, 0xFE, 0x3F, 0xFC, 0x3F, 0xFF, 0x3F, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0xC1, 0x0A,
+  0x7F, 0xF8, 0x7F, 0xF8, 0x1A, 0x5E, 0x01, 0xA5, 0x05, 0xDE, 0x01, 0x7A,
+  0x01, 0x0E, 0x28, 0x00, 0x00, 0x02, 0x04, 0x65, 0x01, 0x51, 0x01, 0x00,
+  0x3F, 0xF2, 0x3F, 0xF2, 0x3F, 0xE0, 0x7F, 0xFF, 0x05, 0xDE, 0x04, 0x65,
+  0x01, 0x00, 0x11, 0x9A, 0x50, 0x46, 0xB0, 0x9E, 0x7F, 0x74, 0x13, 0x26,
+  0xDD, 0x45, 0x10, 0x1C, 0x7C, 0xD5, 0x85, 0xD0, 0x21, 0x87, 0xBE, 0x1E,
+  0x20, 0x65, 0x7E, 0xDA, 0x82, 0x38, 0x50, 0x00, 0x30, 0x00, 0x30, 0x00,
+  0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x01, 0x18, 0x10, 0x00,
+  0x00, 0x30, 0x00, 0x40, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x07, 0xC0,
+  0x00, 0x01, 0x00,
+  0x1C, 0xFF, 193,
+  0x00, 0xB4, 0x70, 0x12, 0x00, 0x07, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x18,
+  0x00, 0x18, 0x00, 0x50, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x3C, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x06, 0x78, 0x06, 0x78, 0x00, 0x00, 0x33,
+  0x18, 0x00, 0x00, 0xF9, 0x88, 0xF9, 0x88, 0x00, 0x00, 0x33, 0x18, 0x00,
+  0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6D, 0x01, 0x23, 0x06, 0x54, 0x05,
+  0x42, 0x24, 0x01, 0x1E, 0x12, 0x01, 0x01, 0x18, 0x14, 0x01, 0x01, 0x18,
+  0x14, 0x0F, 0x0F, 0x18, 0x10, 0x0F, 0x0F, 0x18, 0x10, 0x00, 0x01, 0x00,
+  0x05, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00,
+  0x05, 0x00, 0x00, 0x01, 0x84, 0xE0, 0xE0, 0x00, 0x80, 0x00, 0xC3, 0xC3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0xF4, 0x41, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  0xFF, 0xFF, 0,
+};
+
+/* Download program 1 of the sine test demo */
+const UINT8 kOisTableSineTestProgram1[] = {
+  0x00, 0x00, 255,
+  0x24, 0x00, 0xB5, 0x70, 0x28, 0x00, 0x46, 0x22, 0x4A, 0x24, 0xDA, 0x10,
+  0xD0, 0x04, 0x18, 0x80, 0xD0, 0x04, 0x28, 0x01, 0xD1, 0x3E, 0x28, 0x04,
+  0x4A, 0x21, 0xE0, 0x03, 0x4A, 0x21, 0xE0, 0x02, 0x4A, 0x21, 0xE0, 0x00,
+  0x47, 0x90, 0x46, 0x08, 0xE0, 0x34, 0x46, 0x04, 0x35, 0x32, 0x25, 0xFF,
+  0x42, 0xA8, 0x1B, 0x43, 0xDC, 0x12, 0xD0, 0x29, 0xD0, 0x26, 0x28, 0x3D,
+  0x28, 0x3A, 0xDC, 0x06, 0x28, 0x3B, 0xD0, 0x23, 0x28, 0x3C, 0xD0, 0x21,
+  0xE0, 0x1E, 0xD1, 0x25, 0xD0, 0x15, 0x28, 0x3E, 0xD0, 0x17, 0x28, 0x3F,
+  0x3A, 0xFF, 0x46, 0x02, 0xD1, 0x1C, 0x3A, 0x31, 0x2B, 0x05, 0xE0, 0x14,
+  0xDC, 0x06, 0xD0, 0x13, 0xD0, 0x10, 0x2B, 0x01, 0xD0, 0x0E, 0x2B, 0x03,
+  0xD1, 0x12, 0x2B, 0x04, 0x2B, 0x06, 0xE0, 0x0B, 0x2B, 0x1D, 0xD0, 0x09,
+  0xE0, 0x01, 0xD1, 0x0D, 0xE0, 0x04, 0x4A, 0x0B, 0xE0, 0x02, 0x4A, 0x0B,
+  0xE0, 0x00, 0x4A, 0x0B, 0x4B, 0x0C, 0x4A, 0x0B, 0x2A, 0x00, 0x54, 0x19,
+  0xB2, 0xC8, 0xD0, 0x01, 0x46, 0x20, 0x47, 0x90, 0x00, 0x00, 0xBD, 0x70,
+  0x7F, 0xFF, 0xFF, 0xD6, 0x10, 0x00, 0x01, 0xE5, 0x10, 0x00, 0x01, 0x97,
+  0x10, 0x00, 0x00, 0xC1, 0x10, 0x00, 0x08, 0x01, 0x10, 0x00, 0x07, 0x55,
+  0x10, 0x00, 0x08, 0x0D, 0x10, 0x00, 0x06, 0x21, 0x10, 0x00, 0x19, 0x40,
+  0x4D, 0x64, 0xB5, 0xF8, 0x4E, 0x63, 0x46, 0x04, 0xF0, 0x00, 0x35, 0xB4,
+  0x4A, 0x62, 0xFA, 0x15, 0xD0, 0x19, 0x2C, 0x00, 0x60, 0x10, 0x6B, 0x60,
+  0x60, 0x50, 0x6B, 0xA0, 0x60, 0x90, 0x69, 0x60, 0x60, 0xD0, 0x68, 0xA0,
+  0x61, 0x10, 0x68, 0xE0, 0x61, 0x50, 0x69, 0x20, 0x61, 0x90, 0x6B, 0x20,
+  0x61, 0xD0, 0x69, 0xE0, 0x62, 0x10, 0x6A, 0xA0, 0x62, 0x50, 0x6A, 0x20,
+  0x62, 0x90, 0x6A,
+  0x00, 0xFF, 255,
+  0xE0, 0x62, 0xD0, 0x6C, 0xE0, 0x63, 0x10, 0x6D, 0x60, 0x78, 0x20, 0x4C,
+  0x54, 0x21, 0x02, 0x4F, 0x52, 0x20, 0x01, 0x69, 0x7A, 0x21, 0x19, 0x47,
+  0x90, 0x63, 0xC8, 0x06, 0xC9, 0x20, 0x00, 0x49, 0x50, 0x49, 0x4F, 0x61,
+  0x08, 0x39, 0xC0, 0x48, 0x4F, 0x78, 0x24, 0x61, 0x88, 0x69, 0x7A, 0x21,
+  0x42, 0x47, 0x90, 0x20, 0x06, 0x06, 0x00, 0x07, 0x07, 0x0F, 0x00, 0x0F,
+  0x3F, 0xD1, 0x28, 0x28, 0x02, 0xD0, 0x04, 0x2C, 0x13, 0xD0, 0x06, 0x2C,
+  0x41, 0xD0, 0x09, 0x2C, 0x42, 0x4D, 0x46, 0xE0, 0x0C, 0x35, 0xB4, 0x4E,
+  0x45, 0x4E, 0x44, 0xE0, 0x08, 0x36, 0x08, 0x4D, 0x43, 0xE0, 0x03, 0x35,
+  0xBC, 0x4D, 0x41, 0x4E, 0x3C, 0x3D, 0x84, 0x36, 0x14, 0x21, 0x43, 0x4C,
+  0x3B, 0x20, 0x06, 0x69, 0x62, 0x69, 0xA1, 0x47, 0x90, 0x20, 0x0B, 0x47,
+  0x88, 0x20, 0x13, 0x47, 0xB0, 0x20, 0x0C, 0x47, 0xA8, 0x20, 0x80, 0x47,
+  0xB0, 0x2F, 0x01, 0x47, 0xA8, 0x20, 0x1F, 0xD1, 0x03, 0x20, 0x08, 0x47,
+  0xB0, 0x20, 0x00, 0x47, 0xA8, 0xB5, 0x00, 0xBD, 0xF8, 0xB0, 0x87, 0x4B,
+  0x2F, 0x28, 0x00, 0x6B, 0x59, 0x28, 0x04, 0xD0, 0x01, 0x29, 0x01, 0xD1,
+  0x1B, 0x20, 0x00, 0xD1, 0x19, 0x68, 0x09, 0x07, 0x89, 0xD0, 0x0E, 0x07,
+  0x89, 0x91, 0x04, 0x49, 0x2D, 0x91, 0x05, 0x49, 0x2D, 0x49, 0x2D, 0x90,
+  0x01, 0x91, 0x06, 0x90, 0x02, 0x68, 0x1B, 0x90, 0x03, 0xA9, 0x01, 0x22,
+  0x01, 0x47, 0x98, 0xA8, 0x04, 0x49, 0x23, 0xE0, 0x05, 0x49, 0x28, 0x61,
+  0x08, 0x49, 0x28, 0x63, 0x88, 0x20, 0x00, 0x63, 0x88, 0xBD, 0x00, 0xB0,
+  0x07, 0x49, 0x1D, 0xB5, 0x70, 0x31, 0x20, 0x4C, 0x25, 0xB0, 0x88, 0x78,
+  0x09, 0x0F, 0x49, 0x07, 0x49, 0x28, 0x01, 0x4D, 0x18, 0xD1, 0x26, 0x63,
+  0x69, 0xD0, 0x01,
+  0x01, 0xFE, 255,
+  0x29, 0x00, 0xD1, 0x22, 0x29, 0x04, 0x47, 0xA0, 0x20, 0x0E, 0x20, 0x0C,
+  0x46, 0x06, 0x04, 0x00, 0x47, 0xA0, 0x21, 0x01, 0x43, 0x30, 0x68, 0x09,
+  0x07, 0x89, 0x21, 0x00, 0x07, 0x8A, 0xD0, 0x0E, 0x2A, 0x00, 0x92, 0x04,
+  0x4A, 0x12, 0x92, 0x05, 0x4A, 0x12, 0x92, 0x06, 0x4A, 0x12, 0x91, 0x03,
+  0x91, 0x02, 0x68, 0x2B, 0x90, 0x01, 0xA9, 0x01, 0x22, 0x03, 0x47, 0x98,
+  0xA8, 0x04, 0x4A, 0x08, 0xE0, 0x05, 0x48, 0x0D, 0x61, 0x10, 0x48, 0x0D,
+  0x63, 0x81, 0x20, 0x00, 0x63, 0x81, 0xBD, 0x70, 0xB0, 0x08, 0x00, 0x00,
+  0x47, 0x70, 0x00, 0x00, 0x29, 0xD9, 0x10, 0x00, 0x0E, 0x40, 0x10, 0x00,
+  0x19, 0x40, 0x50, 0x00, 0x60, 0xC0, 0x30, 0x48, 0x30, 0x48, 0x00, 0x00,
+  0x2B, 0x25, 0x00, 0x00, 0x60, 0xD0, 0x00, 0x00, 0x41, 0x38, 0x00, 0x00,
+  0x51, 0x38, 0x50, 0x00, 0x41, 0x00, 0x50, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x07, 0x7B, 0x49, 0x1A, 0xB4, 0x30, 0x2A, 0x01, 0x78, 0x0A, 0x22, 0x19,
+  0xD0, 0x17, 0x68, 0x13, 0x06, 0xD2, 0x03, 0x24, 0x24, 0x01, 0x60, 0x13,
+  0x43, 0xA3, 0x70, 0x0A, 0x22, 0x01, 0x21, 0x04, 0x4A, 0x14, 0x49, 0x14,
+  0x60, 0x11, 0x08, 0x52, 0x68, 0x8A, 0x60, 0x8A, 0x00, 0x52, 0x00, 0x80,
+  0x49, 0x12, 0x49, 0x12, 0x58, 0x08, 0xBC, 0x30, 0x68, 0x09, 0xBC, 0x30,
+  0x47, 0x08, 0xB5, 0x10, 0x47, 0x70, 0x68, 0x00, 0x48, 0x0F, 0x48, 0x0B,
+  0x47, 0x80, 0x22, 0x01, 0x68, 0x81, 0x60, 0x81, 0x43, 0x11, 0x20, 0x04,
+  0x49, 0x07, 0x60, 0x08, 0x31, 0x80, 0x20, 0x00, 0x49, 0x04, 0x20, 0x19,
+  0x70, 0x08, 0x68, 0x01, 0x06, 0xC0, 0x43, 0x11, 0x03, 0x12, 0xBD, 0x10,
+  0x60, 0x01, 0x10, 0x00, 0x0E, 0xAC, 0xE0, 0x00, 0xE1, 0x00, 0xC6, 0x00,
+  0x00, 0x40, 0x10,
+  0x02, 0xFD, 255,
+  0x00, 0x0E, 0x18, 0x10, 0x00, 0x0E, 0x64, 0x10, 0x00, 0x0E, 0x68, 0x47,
+  0x70, 0xBA, 0x40, 0x88, 0x0C, 0xB5, 0x30, 0x2C, 0x00, 0x88, 0x03, 0x2C,
+  0x02, 0xD0, 0x06, 0x2C, 0x01, 0xD0, 0x04, 0x2C, 0x03, 0xD0, 0x0B, 0xE0,
+  0x0B, 0xD0, 0x09, 0x3D, 0xF9, 0x1F, 0xDD, 0x1C, 0x64, 0xD1, 0x03, 0x0F,
+  0xA4, 0x07, 0xA4, 0x18, 0x9B, 0xE0, 0x03, 0x2B, 0x00, 0xE0, 0x02, 0x1A,
+  0x9B, 0xD0, 0x03, 0x80, 0x0C, 0x80, 0x03, 0x1C, 0x64, 0xBD, 0x30, 0x0F,
+  0xA4, 0x07, 0xA4, 0xE7, 0xF7, 0x46, 0x13, 0x05, 0x00, 0xB5, 0x30, 0x4A,
+  0x0A, 0x11, 0x04, 0x4B, 0x08, 0x05, 0x08, 0x06, 0x10, 0x11, 0x05, 0x29,
+  0x00, 0x6A, 0x41, 0x49, 0x07, 0xD1, 0xFC, 0x60, 0x8A, 0x60, 0x4B, 0x63,
+  0x0D, 0x62, 0xCC, 0x62, 0x41, 0x21, 0x60, 0x29, 0x00, 0x6A, 0x41, 0xBD,
+  0x30, 0xD1, 0xFC, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x52, 0x40, 0x40,
+  0x00, 0x00, 0x40, 0x48, 0x01, 0xB4, 0x03, 0xBD, 0x01, 0x90, 0x01, 0x00,
+  0x00, 0x00, 0xC1, 0x46, 0x0B, 0xB5, 0xF0, 0x21, 0x00, 0xB0, 0x85, 0x46,
+  0x6C, 0x25, 0x03, 0xE0, 0x05, 0x03, 0x6D, 0x00, 0xB6, 0x18, 0x5E, 0x00,
+  0x8F, 0x43, 0x2E, 0x1C, 0x49, 0x51, 0xE6, 0xD3, 0xF7, 0x42, 0x91, 0x46,
+  0x01, 0x4B, 0x03, 0x46, 0x20, 0x68, 0x1B, 0xB0, 0x05, 0x47, 0x98, 0x00,
+  0x00, 0xBD, 0xF0, 0x10, 0x00, 0x0E, 0x40, 0x4F, 0x25, 0xB5, 0xFE, 0x69,
+  0xBE, 0x69, 0x7D, 0xD1, 0x06, 0x2D, 0x02, 0x22, 0x02, 0x4B, 0x23, 0x68,
+  0x1B, 0x46, 0x38, 0x30, 0x24, 0x46, 0x69, 0x68, 0xF8, 0x47, 0x98, 0x0F,
+  0xE4, 0x07, 0xF4, 0x2D, 0x02, 0x90, 0x02, 0x49, 0x1C, 0xD0, 0x0D, 0x31,
+  0x1C, 0x00, 0xA0, 0x2D, 0x01, 0x58, 0x08, 0xD0, 0x0A, 0x68, 0x07, 0xD0,
+  0x16, 0x2D, 0x02,
+  0x03, 0xFC, 255,
+  0x0D, 0x00, 0x05, 0x38, 0xD0, 0x14, 0x2E, 0x02, 0x00, 0xA0, 0xE0, 0x15,
+  0x58, 0x0F, 0x46, 0x69, 0x4A, 0x15, 0xE0, 0x0D, 0x68, 0x12, 0x21, 0x13,
+  0x47, 0x90, 0x20, 0x00, 0xD0, 0x02, 0x28, 0x02, 0xD0, 0x02, 0x2C, 0x01,
+  0x2C, 0x01, 0xE0, 0x03, 0xB2, 0xB8, 0xD0, 0x01, 0x0C, 0x38, 0xE7, 0xEA,
+  0x2C, 0x01, 0xE7, 0xE8, 0x21, 0x00, 0xD0, 0x11, 0x0A, 0x02, 0x9B, 0x02,
+  0x4B, 0x0B, 0x18, 0x59, 0x54, 0x5A, 0x1C, 0x64, 0x70, 0x48, 0x18, 0xC9,
+  0x69, 0x00, 0x48, 0x05, 0xDB, 0xCC, 0x42, 0x84, 0x68, 0xC8, 0x49, 0x03,
+  0x60, 0xC8, 0x1C, 0x80, 0x21, 0x01, 0xBD, 0xFE, 0xE7, 0xEB, 0x02, 0x89,
+  0x10, 0x00, 0x0E, 0x80, 0x10, 0x00, 0x0E, 0x44, 0x10, 0x00, 0x0E, 0x54,
+  0x10, 0x00, 0x0F, 0x00, 0x06, 0x92, 0x22, 0x31, 0x23, 0x01, 0x6A, 0x51,
+  0x0D, 0x09, 0x05, 0x09, 0x42, 0x99, 0x02, 0x5B, 0x18, 0x08, 0xD3, 0x07,
+  0x18, 0x40, 0x49, 0x03, 0x78, 0x00, 0x1A, 0xC0, 0x20, 0x00, 0x62, 0xD0,
+  0x47, 0x70, 0x63, 0x50, 0x10, 0x00, 0x0F, 0x00, 0x6B, 0x08, 0x49, 0x0C,
+  0x01, 0x00, 0x6B, 0x49, 0xD5, 0x01, 0x15, 0x00, 0x1C, 0x40, 0x43, 0xC0,
+  0x05, 0x00, 0x4A, 0x09, 0x0D, 0x00, 0x68, 0x93, 0x60, 0x90, 0x18, 0x18,
+  0x15, 0x00, 0x01, 0x08, 0x43, 0xC0, 0xD5, 0x01, 0x05, 0x00, 0x1C, 0x40,
+  0x0D, 0x00, 0x68, 0xD1, 0x60, 0xD0, 0x18, 0x08, 0x00, 0x00, 0x47, 0x70,
+  0x40, 0x00, 0x00, 0x80, 0x10, 0x00, 0x0E, 0xD0, 0x20, 0x02, 0xB5, 0x10,
+  0xFF, 0xCA, 0xF7, 0xFF, 0xB5, 0x10, 0xBD, 0x10, 0xF7, 0xFF, 0x20, 0x01,
+  0xBD, 0x10, 0xFF, 0xC5, 0x20, 0x01, 0xB5, 0x10, 0xFF, 0xC0, 0xF7, 0xFF,
+  0xB5, 0x10, 0xBD, 0x10, 0xF7, 0xFF, 0x20, 0x00, 0xBD, 0x10, 0xFF, 0xBB,
+  0x49, 0x06, 0x48,
+  0x04, 0xFB, 255,
+  0x07, 0x49, 0x07, 0x60, 0x41, 0x49, 0x07, 0x60, 0x81, 0x49, 0x07, 0x61,
+  0x01, 0x49, 0x07, 0x60, 0xC1, 0x49, 0x07, 0x61, 0x41, 0x47, 0x70, 0x61,
+  0x81, 0x10, 0x00, 0x05, 0x31, 0x10, 0x00, 0x1B, 0x48, 0x10, 0x00, 0x05,
+  0x9D, 0x10, 0x00, 0x04, 0xEF, 0x10, 0x00, 0x04, 0xD1, 0x10, 0x00, 0x04,
+  0xDB, 0x10, 0x00, 0x04, 0xE5, 0x48, 0x13, 0xB5, 0x10, 0x28, 0x01, 0x78,
+  0x00, 0x4C, 0x12, 0xD1, 0x0B, 0x68, 0x61, 0x68, 0x20, 0xD2, 0x06, 0x42,
+  0x88, 0xFB, 0x9C, 0xF0, 0x00, 0xFF, 0xA4, 0xF7, 0xFF, 0x1C, 0x40, 0x68,
+  0x20, 0x4C, 0x0D, 0x60, 0x20, 0x28, 0x01, 0x78, 0x20, 0xF7, 0xFF, 0xD1,
+  0x10, 0x49, 0x0B, 0xFF, 0x33, 0x42, 0x88, 0x68, 0x09, 0x20, 0x00, 0xD1,
+  0x0A, 0x48, 0x09, 0x70, 0x20, 0x47, 0x80, 0x68, 0x00, 0x4A, 0x08, 0x21,
+  0x01, 0x60, 0x10, 0x20, 0x02, 0x73, 0x81, 0x48, 0x07, 0x00, 0x00, 0xBD,
+  0x10, 0x10, 0x00, 0x0E, 0xE0, 0x10, 0x00, 0x0E, 0x78, 0x10, 0x00, 0x0E,
+  0x80, 0x10, 0x00, 0x0E, 0x88, 0x10, 0x00, 0x0E, 0x60, 0xE0, 0x00, 0xE1,
+  0x80, 0x10, 0x00, 0x1A, 0x80, 0x48, 0x03, 0xB5, 0x10, 0x28, 0x01, 0x78,
+  0x00, 0xF0, 0x00, 0xD1, 0x01, 0xBD, 0x10, 0xFB, 0x19, 0x10, 0x00, 0x0E,
+  0xAC, 0x08, 0x9B, 0xB5, 0x7C, 0x4C, 0x17, 0x25, 0x00, 0xD0, 0x23, 0x2B,
+  0x01, 0xD0, 0x24, 0x2B, 0x02, 0x36, 0x01, 0x26, 0xFF, 0x26, 0x01, 0x80,
+  0x66, 0x80, 0xA5, 0x80, 0xE6, 0x61, 0x61, 0x81, 0x25, 0x62, 0x22, 0x61,
+  0xA2, 0x61, 0xE1, 0x46, 0x15, 0xD0, 0x19, 0x2B, 0x01, 0xD0, 0x17, 0x2B,
+  0x02, 0x02, 0x9B, 0x23, 0x01, 0x43, 0x43, 0x61, 0x20, 0x4A, 0x0B, 0x11,
+  0xD8, 0x68, 0x12, 0x18, 0x44, 0x46, 0x20, 0x46, 0x29, 0x49, 0x09, 0x47,
+  0x90, 0x94, 0x00,
+  0x05, 0xFA, 255,
+  0x95, 0x01, 0x46, 0x68, 0x68, 0x09, 0xBD, 0x7C, 0x47, 0x88, 0x80, 0xE5,
+  0x80, 0x65, 0x80, 0x65, 0xE7, 0xDF, 0xE7, 0xDB, 0x26, 0x02, 0xE7, 0xE7,
+  0x23, 0x00, 0x10, 0x00, 0x0E, 0xAC, 0x10, 0x00, 0x0E, 0x6C, 0x10, 0x00,
+  0x0E, 0x70, 0x46, 0x05, 0xB5, 0xF0, 0xB0, 0x8B, 0x48, 0x40, 0x48, 0x40,
+  0x68, 0x07, 0x48, 0x40, 0x68, 0x03, 0x28, 0x03, 0x78, 0x00, 0x4C, 0x3F,
+  0xD1, 0x64, 0x28, 0x00, 0x68, 0x60, 0x48, 0x3E, 0xD1, 0x16, 0x1D, 0x00,
+  0x90, 0x00, 0x48, 0x3D, 0x90, 0x01, 0x1D, 0x00, 0x90, 0x02, 0x22, 0x04,
+  0x90, 0x03, 0x46, 0x68, 0xA9, 0x04, 0x48, 0x3A, 0x47, 0x98, 0x60, 0x01,
+  0x99, 0x04, 0x60, 0x41, 0x99, 0x05, 0x60, 0x81, 0x99, 0x06, 0x60, 0xC1,
+  0x99, 0x07, 0x60, 0x60, 0x20, 0x01, 0x07, 0xA8, 0x4C, 0x35, 0x7C, 0x66,
+  0xD0, 0x48, 0x90, 0x0A, 0x7C, 0xA0, 0xF7, 0xFF, 0x8A, 0xA0, 0x04, 0x00,
+  0xFE, 0x45, 0x90, 0x09, 0x14, 0x00, 0xF7, 0xFF, 0x8A, 0xE0, 0x04, 0x00,
+  0xFE, 0x3F, 0x90, 0x08, 0x14, 0x00, 0xD8, 0x34, 0x2E, 0x0A, 0xD0, 0x32,
+  0x2E, 0x00, 0x1E, 0x76, 0x98, 0x0A, 0xD8, 0x2E, 0x28, 0x80, 0x99, 0x09,
+  0x20, 0x01, 0x18, 0x0A, 0x02, 0x80, 0x42, 0x8A, 0x49, 0x27, 0x9A, 0x08,
+  0xD2, 0x27, 0x42, 0x88, 0x18, 0x10, 0x06, 0x28, 0xD2, 0x23, 0x48, 0x1F,
+  0xD5, 0x11, 0x1D, 0x00, 0x90, 0x00, 0x48, 0x1E, 0x90, 0x01, 0x1D, 0x00,
+  0x90, 0x02, 0x48, 0x20, 0x90, 0x03, 0x02, 0xC1, 0x90, 0x04, 0x91, 0x07,
+  0x91, 0x05, 0x22, 0x04, 0x90, 0x06, 0x46, 0x68, 0xA9, 0x04, 0x46, 0x2B,
+  0x47, 0xB8, 0x40, 0x03, 0x20, 0x0C, 0x99, 0x09, 0x9A, 0x08, 0xF7, 0xFF,
+  0x98, 0x0A, 0x49, 0x18, 0xFF, 0x61, 0x68, 0x09, 0x20, 0xFF, 0x47, 0x88,
+  0x30, 0x2D, 0xF7,
+  0x06, 0xF9, 255,
+  0xFF, 0x46, 0x30, 0x74, 0x25, 0xFD, 0xC3, 0xBD, 0xF0, 0xB0, 0x0B, 0xFD,
+  0xDD, 0xF7, 0xFF, 0x06, 0x00, 0x7C, 0x20, 0x48, 0x0A, 0xD5, 0xF7, 0x1D,
+  0x00, 0x90, 0x00, 0x48, 0x09, 0x90, 0x01, 0x1D, 0x00, 0x90, 0x02, 0x22,
+  0x04, 0x90, 0x03, 0x46, 0x68, 0x49, 0x07, 0xE7, 0xEA, 0x47, 0xB8, 0x10,
+  0x00, 0x0E, 0x40, 0x10, 0x00, 0x0E, 0x44, 0x10, 0x00, 0x19, 0x60, 0x10,
+  0x00, 0x0E, 0x80, 0x00, 0x00, 0x42, 0x4C, 0x00, 0x00, 0x52, 0x4C, 0x10,
+  0x00, 0x0E, 0xF0, 0x10, 0x00, 0x1A, 0x60, 0x00, 0x00, 0x08, 0x01, 0x07,
+  0xFF, 0x00, 0x00, 0x10, 0x00, 0x0E, 0x58, 0x46, 0x04, 0xB5, 0xF8, 0x40,
+  0x08, 0x21, 0xF0, 0x09, 0x01, 0x4D, 0x1D, 0x61, 0x69, 0x4E, 0x1D, 0x29,
+  0x01, 0xD0, 0x20, 0x29, 0x02, 0xD0, 0x23, 0x46, 0x28, 0xD1, 0x1B, 0x30,
+  0x24, 0x49, 0x1A, 0x49, 0x1A, 0x60, 0x01, 0x07, 0x20, 0x60, 0x41, 0x22,
+  0x02, 0x0F, 0x00, 0x61, 0xA8, 0x21, 0x01, 0xD0, 0x20, 0x28, 0x02, 0x02,
+  0xC8, 0xD2, 0x0D, 0x60, 0xA8, 0x61, 0x29, 0x20, 0x00, 0x4B, 0x14, 0x60,
+  0xE8, 0x73, 0x98, 0x48, 0x13, 0x70, 0x29, 0x49, 0x14, 0x60, 0x02, 0x68,
+  0x09, 0x48, 0x12, 0xBD, 0xF8, 0x47, 0x88, 0x60, 0x30, 0x48, 0x12, 0x60,
+  0x70, 0x1D, 0x00, 0x4F, 0x11, 0xE7, 0xE3, 0x60, 0x37, 0x4A, 0x11, 0x68,
+  0x12, 0x21, 0x13, 0x47, 0x90, 0x20, 0x00, 0xD0, 0x00, 0x28, 0x02, 0x60,
+  0x77, 0x1D, 0x3F, 0x20, 0x01, 0xE7, 0xD7, 0x61, 0x2A, 0x02, 0x80, 0xE7,
+  0xDD, 0x60, 0xA8, 0x10, 0x00, 0x0E, 0x80, 0x10, 0x00, 0x0E, 0x9C, 0x00,
+  0x00, 0x40, 0x54, 0x00, 0x00, 0x50, 0x54, 0x10, 0x00, 0x1A, 0x80, 0xE0,
+  0x00, 0xE1, 0x00, 0x00, 0x00, 0x06, 0x97, 0x10, 0x00, 0x0E, 0x5C, 0xC8,
+  0x00, 0x00, 0x60,
+  0x07, 0xF8, 255,
+  0x10, 0x00, 0x17, 0x60, 0x10, 0x00, 0x0E, 0x54, 0xB2, 0xC0, 0xB5, 0x10,
+  0xF9, 0x7E, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x49, 0xB0, 0xB5, 0xF0,
+  0x68, 0x0C, 0xB0, 0x89, 0xD8, 0x7D, 0x28, 0x01, 0x4D, 0xAE, 0x26, 0x03,
+  0x28, 0x00, 0x03, 0x76, 0x20, 0x00, 0xD0, 0x5E, 0x90, 0x03, 0x90, 0x04,
+  0x90, 0x01, 0x90, 0x02, 0x21, 0x01, 0x22, 0x04, 0xF7, 0xFF, 0xA8, 0x01,
+  0x22, 0x04, 0xFD, 0xAD, 0xA8, 0x01, 0x21, 0x05, 0xFD, 0xA8, 0xF7, 0xFF,
+  0x21, 0x09, 0x22, 0x02, 0xF7, 0xFF, 0xA8, 0x01, 0x22, 0x04, 0xFD, 0xA3,
+  0xA8, 0x01, 0x21, 0x0C, 0xFD, 0x9E, 0xF7, 0xFF, 0x21, 0x11, 0x22, 0x04,
+  0xF7, 0xFF, 0xA8, 0x01, 0x22, 0x02, 0xFD, 0x99, 0xA8, 0x01, 0x21, 0x16,
+  0xFD, 0x94, 0xF7, 0xFF, 0x21, 0x36, 0x22, 0x02, 0xF7, 0xFF, 0xA8, 0x01,
+  0x48, 0x99, 0xFD, 0x8F, 0x90, 0x02, 0x90, 0x03, 0x48, 0x98, 0x90, 0x01,
+  0x48, 0x98, 0x90, 0x04, 0x48, 0x97, 0x90, 0x06, 0x30, 0x14, 0x96, 0x05,
+  0x48, 0x95, 0x90, 0x07, 0x30, 0xA8, 0xA9, 0x01, 0x22, 0x04, 0x90, 0x08,
+  0x47, 0xA0, 0xA8, 0x05, 0x21, 0x85, 0x4F, 0x92, 0x20, 0x04, 0x68, 0x3A,
+  0x06, 0x00, 0x47, 0x90, 0x00, 0x76, 0xD5, 0x01, 0x26, 0x01, 0xE0, 0x01,
+  0x21, 0x87, 0x03, 0xB6, 0x20, 0x04, 0x68, 0x3A, 0x06, 0x00, 0x47, 0x90,
+  0x20, 0x03, 0xD5, 0x02, 0xE0, 0x01, 0x07, 0x80, 0x07, 0x80, 0x20, 0x01,
+  0x96, 0x01, 0x43, 0x06, 0x20, 0xA2, 0x68, 0x29, 0x90, 0x02, 0x47, 0x88,
+  0x30, 0x28, 0x48, 0x83, 0x48, 0x82, 0x90, 0x05, 0x22, 0x02, 0x30, 0xA4,
+  0xE0, 0xF1, 0x90, 0x06, 0xAF, 0x05, 0x20, 0x00, 0x46, 0x0A, 0x00, 0x81,
+  0x1C, 0x40, 0x43, 0x31, 0x28, 0x03, 0x50, 0xB9, 0x4D, 0x78, 0xD3, 0xF8,
+  0x68, 0x29, 0x20,
+  0x08, 0xF7, 255,
+  0x6A, 0x90, 0x01, 0x47, 0x88, 0x20, 0x68, 0x68, 0x29, 0x90, 0x02, 0x47,
+  0x88, 0x20, 0x6E, 0x68, 0x29, 0x90, 0x03, 0x47, 0x88, 0xA9, 0x01, 0x22,
+  0x03, 0xE0, 0x00, 0xA8, 0x05, 0x47, 0xA0, 0xE0, 0xD9, 0x4D, 0x73, 0x48,
+  0x71, 0x90, 0x05, 0x38, 0x20, 0x90, 0x06, 0x1D, 0x00, 0x95, 0x01, 0x48,
+  0x6E, 0x90, 0x07, 0x38, 0x14, 0xA9, 0x01, 0x48, 0x6C, 0x90, 0x08, 0x38,
+  0x0C, 0x90, 0x02, 0x48, 0x6D, 0x90, 0x03, 0x48, 0x6D, 0x95, 0x04, 0x22,
+  0x04, 0x47, 0xA0, 0xA8, 0x05, 0xA9, 0x01, 0x48, 0x66, 0x90, 0x05, 0x38,
+  0x18, 0x95, 0x04, 0x48, 0x64, 0x90, 0x06, 0x38, 0x10, 0x38, 0x08, 0x48,
+  0x62, 0x1D, 0x00, 0x90, 0x07, 0x20, 0x00, 0x90, 0x08, 0x90, 0x02, 0x90,
+  0x01, 0x22, 0x04, 0x90, 0x03, 0x47, 0xA0, 0xA8, 0x05, 0x20, 0x00, 0x25,
+  0x00, 0x18, 0x19, 0x00, 0xAB, 0x22, 0x03, 0x00, 0x89, 0x03, 0x52, 0x31,
+  0x2C, 0x00, 0x86, 0x43, 0x11, 0x1C, 0x40, 0xAA, 0x05, 0x28, 0x04, 0x51,
+  0x91, 0x4F, 0x52, 0xD3, 0xF3, 0x46, 0x30, 0x00, 0xEE, 0x30, 0x6C, 0x68,
+  0x39, 0x90, 0x01, 0x47, 0x88, 0x68, 0x39, 0x46, 0x30, 0x47, 0x88, 0x30,
+  0x72, 0x46, 0x30, 0x90, 0x02, 0x30, 0x70, 0x68, 0x39, 0x90, 0x03, 0x47,
+  0x88, 0x68, 0x39, 0x46, 0x30, 0x47, 0x88, 0x30, 0x76, 0x22, 0x04, 0x90,
+  0x04, 0xA8, 0x05, 0xA9, 0x01, 0x1C, 0x6D, 0x47, 0xA0, 0xD3, 0xD4, 0x2D,
+  0x02, 0x26, 0x03, 0x20, 0x00, 0x03, 0x76, 0xAD, 0x05, 0x46, 0x0A, 0x00,
+  0x81, 0x43, 0x32, 0x32, 0x4C, 0x50, 0x6A, 0x1C, 0x40, 0xD3, 0xF7, 0x28,
+  0x04, 0x20, 0x7C, 0x4F, 0x3D, 0x47, 0x88, 0x68, 0x39, 0x68, 0x39, 0x90,
+  0x01, 0x47, 0x88, 0x20, 0x82, 0x90, 0x02, 0x4A, 0x41, 0x68, 0x12, 0x21,
+  0x84, 0x47, 0x90,
+  0x09, 0xF6, 255,
+  0x20, 0x04, 0x90, 0x03, 0x4A, 0x3E, 0x68, 0x12, 0x21, 0x88, 0x47, 0x90,
+  0x20, 0x04, 0x22, 0x04, 0x90, 0x04, 0xA8, 0x05, 0xA9, 0x01, 0x48, 0x34,
+  0x47, 0xA0, 0x90, 0x05, 0x30, 0x30, 0x20, 0x80, 0x68, 0x39, 0x90, 0x01,
+  0x47, 0x88, 0xA9, 0x01, 0x22, 0x01, 0x47, 0xA0, 0xA8, 0x05, 0x00, 0x8A,
+  0x21, 0x00, 0x30, 0xD0, 0x46, 0x10, 0x1C, 0x49, 0x43, 0x30, 0x29, 0x04,
+  0x50, 0xA8, 0x22, 0x02, 0xD3, 0xF7, 0x4D, 0x2F, 0x1D, 0x28, 0x68, 0x2B,
+  0xA9, 0x02, 0x68, 0x2B, 0x47, 0x98, 0xA9, 0x04, 0x22, 0x01, 0x47, 0x98,
+  0xA8, 0x08, 0x20, 0x0E, 0x4D, 0x2B, 0x46, 0x06, 0x47, 0xA8, 0x47, 0xA8,
+  0x20, 0x0C, 0x43, 0x06, 0x04, 0x00, 0x48, 0x28, 0x96, 0x01, 0x4D, 0x20,
+  0x9E, 0x02, 0x21, 0x03, 0x40, 0x06, 0x20, 0x04, 0x68, 0x2A, 0x46, 0x07,
+  0x47, 0x90, 0x68, 0x2A, 0x21, 0x02, 0x47, 0x90, 0x20, 0x04, 0x43, 0x07,
+  0x04, 0x00, 0x48, 0x20, 0x43, 0x37, 0x97, 0x02, 0x9E, 0x03, 0x21, 0x07,
+  0x40, 0x06, 0x20, 0x04, 0x68, 0x2A, 0x46, 0x07, 0x47, 0x90, 0x68, 0x2A,
+  0x21, 0x06, 0x47, 0x90, 0x20, 0x04, 0x43, 0x07, 0x04, 0x00, 0x48, 0x18,
+  0x43, 0x37, 0x97, 0x03, 0x9E, 0x04, 0x40, 0x06, 0x43, 0xC0, 0x68, 0x2A,
+  0x21, 0x01, 0x47, 0x90, 0x20, 0x04, 0x21, 0x00, 0x02, 0x07, 0x20, 0x04,
+  0x68, 0x2A, 0x06, 0x00, 0x47, 0x90, 0x43, 0x37, 0x43, 0x07, 0x97, 0x04,
+  0x22, 0x04, 0xA8, 0x05, 0xA9, 0x01, 0xB0, 0x09, 0x47, 0xA0, 0x00, 0x00,
+  0xBD, 0xF0, 0x10, 0x00, 0x0E, 0x40, 0x10, 0x00, 0x0E, 0x48, 0x7F, 0xFF,
+  0x7F, 0xFF, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x60, 0x2C, 0x10, 0x00,
+  0x0E, 0x54, 0x40, 0x00, 0x40, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x3C, 0x00,
+  0x3C, 0x00, 0x10,
+  0x0A, 0xF5, 255,
+  0x00, 0x0E, 0x4C, 0x10, 0x00, 0x0E, 0x44, 0x00, 0x00, 0x07, 0x7B, 0xFF,
+  0x00, 0xFF, 0x00, 0x28, 0x01, 0xB5, 0xF8, 0x28, 0x02, 0xD0, 0x10, 0x25,
+  0x01, 0xD1, 0x54, 0x21, 0x00, 0x4C, 0x2C, 0x46, 0x26, 0x77, 0xA1, 0x8F,
+  0x72, 0x3E, 0x20, 0x0C, 0x00, 0x06, 0x10, 0x43, 0x10, 0x0A, 0x12, 0xD8,
+  0x03, 0x28, 0xCD, 0xE0, 0x44, 0x20, 0xFF, 0xE7, 0xEF, 0x25, 0x00, 0x60,
+  0x38, 0x4F, 0x25, 0x07, 0x40, 0x7F, 0x20, 0x28, 0x05, 0x0F, 0x40, 0x20,
+  0x01, 0xD9, 0x00, 0x02, 0x52, 0x22, 0x01, 0x01, 0x13, 0x40, 0xC2, 0x60,
+  0x13, 0x4A, 0x20, 0x1A, 0x12, 0x22, 0x09, 0x02, 0x80, 0x20, 0x01, 0x4A,
+  0x1E, 0x40, 0xD0, 0x7F, 0x60, 0x60, 0x10, 0x07, 0x40, 0x22, 0x0A, 0x28,
+  0x04, 0x0F, 0x40, 0x20, 0x02, 0xD9, 0x00, 0x60, 0xB9, 0x1A, 0x10, 0x60,
+  0xF9, 0x60, 0x78, 0xF0, 0x00, 0x46, 0x28, 0x48, 0x15, 0xF8, 0xAB, 0x68,
+  0x00, 0x49, 0x16, 0x42, 0x82, 0x68, 0x0A, 0x46, 0x28, 0xD3, 0xFC, 0xF9,
+  0x04, 0xF0, 0x00, 0x46, 0x39, 0x68, 0xF8, 0x28, 0x00, 0x4F, 0x12, 0x68,
+  0x88, 0xD0, 0x13, 0x01, 0xC0, 0x68, 0xC9, 0xFB, 0xF4, 0xF7, 0xFF, 0x1C,
+  0x79, 0x00, 0x40, 0xD3, 0x00, 0x42, 0x88, 0x06, 0x01, 0x46, 0x38, 0x0A,
+  0x00, 0x0C, 0x09, 0x87, 0x31, 0x43, 0x01, 0xD0, 0x04, 0x2D, 0x00, 0x77,
+  0xA0, 0x20, 0x02, 0x87, 0x37, 0xBD, 0xF8, 0x20, 0x01, 0xE7, 0xB4, 0x00,
+  0x00, 0xE7, 0xF9, 0x10, 0x00, 0x19, 0x60, 0x10, 0x00, 0x0E, 0xD0, 0x10,
+  0x00, 0x0E, 0x7C, 0x10, 0x00, 0x0E, 0xEC, 0x10, 0x00, 0x0E, 0x78, 0x00,
+  0x00, 0xFF, 0xFF, 0x48, 0x24, 0xB5, 0xF0, 0x4A, 0x26, 0x7C, 0x01, 0x4E,
+  0x24, 0x4D, 0x23, 0x69, 0x13, 0x68, 0xD4, 0xD0, 0x16, 0x07, 0xC8, 0x42,
+  0xA8, 0x88, 0x50,
+  0x0B, 0xF4, 255,
+  0x46, 0x30, 0xD1, 0x01, 0x00, 0x40, 0xE0, 0x01, 0x88, 0xD7, 0x5A, 0x20,
+  0xD0, 0x01, 0x2F, 0x02, 0xD1, 0x00, 0x2F, 0x03, 0x43, 0x58, 0x42, 0x40,
+  0x06, 0x0F, 0x11, 0xC0, 0x11, 0x00, 0xD5, 0x01, 0x11, 0x40, 0xE0, 0x00,
+  0x19, 0xC0, 0x69, 0x57, 0x69, 0xD0, 0xE0, 0x00, 0xD5, 0x14, 0x07, 0x8F,
+  0x42, 0xAF, 0x88, 0x97, 0x00, 0x7D, 0xD0, 0x01, 0x89, 0x14, 0x5B, 0x66,
+  0xD0, 0x01, 0x2C, 0x02, 0xD1, 0x00, 0x2C, 0x03, 0x43, 0x5E, 0x42, 0x76,
+  0x06, 0x09, 0x11, 0xF3, 0x11, 0x19, 0xD5, 0x01, 0x11, 0x59, 0xE0, 0x00,
+  0x18, 0x89, 0x69, 0x92, 0x6A, 0x11, 0xE0, 0x00, 0xFB, 0x7C, 0xF7, 0xFF,
+  0x22, 0x01, 0x49, 0x09, 0x1F, 0x08, 0x1D, 0x89, 0xFB, 0x56, 0xF7, 0xFF,
+  0x22, 0x01, 0x49, 0x06, 0x1F, 0x08, 0x31, 0x08, 0xFB, 0x50, 0xF7, 0xFF,
+  0x00, 0x00, 0xBD, 0xF0, 0x10, 0x00, 0x1A, 0x60, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0x10, 0x00, 0x0E, 0xAC, 0x4A, 0x0E, 0xB5, 0x10,
+  0x1F, 0xC1, 0x88, 0x50, 0xD1, 0x01, 0x39, 0xF9, 0xE0, 0x02, 0x48, 0x0C,
+  0x00, 0x40, 0x68, 0x91, 0x88, 0x91, 0x5A, 0x08, 0xD0, 0x01, 0x29, 0x02,
+  0xD1, 0x00, 0x29, 0x03, 0x49, 0x08, 0x42, 0x40, 0x40, 0x88, 0x68, 0x09,
+  0x62, 0xC8, 0x49, 0x07, 0x68, 0xD2, 0x49, 0x03, 0x1E, 0x88, 0x1D, 0x09,
+  0xFB, 0x2A, 0xF7, 0xFF, 0x00, 0x00, 0xBD, 0x10, 0x10, 0x00, 0x0E, 0xE0,
+  0x00, 0x00, 0x7F, 0xFF, 0x10, 0x00, 0x0E, 0xD4, 0x40, 0x00, 0x00, 0x40,
+  0x4B, 0x27, 0xB4, 0x30, 0x29, 0x01, 0x78, 0x19, 0x21, 0x19, 0xD0, 0x48,
+  0x68, 0x0A, 0x06, 0xC9, 0x03, 0x24, 0x24, 0x01, 0x60, 0x0A, 0x43, 0xA2,
+  0x80, 0x5C, 0x24, 0x00, 0x00, 0xC9, 0x80, 0x9C, 0x2A, 0x00, 0x6A, 0x4A,
+  0x6A, 0x8A, 0xD1,
+  0x0C, 0xF3, 255,
+  0xFC, 0xD1, 0xFC, 0x2A, 0x00, 0x4D, 0x1D, 0x6A, 0x0A, 0x62, 0x0A, 0x43,
+  0x2A, 0xD0, 0x29, 0x28, 0x01, 0x4D, 0x1C, 0x4A, 0x1B, 0x6A, 0x4A, 0x60,
+  0x6A, 0x43, 0x2A, 0x25, 0x20, 0x28, 0x01, 0x62, 0x4A, 0x4A, 0x17, 0xD0,
+  0x22, 0x4D, 0x17, 0x1F, 0x12, 0x61, 0x2A, 0x35, 0x40, 0xD0, 0x1E, 0x28,
+  0x01, 0x1D, 0x00, 0x48, 0x13, 0x6A, 0x88, 0x61, 0x68, 0x43, 0x10, 0x22,
+  0x30, 0x48, 0x12, 0x62, 0x88, 0x20, 0x01, 0x60, 0x04, 0x49, 0x11, 0x70,
+  0x18, 0x60, 0x08, 0x20, 0x02, 0x06, 0x40, 0x20, 0x63, 0x22, 0x0C, 0x6A,
+  0x81, 0x62, 0x81, 0x43, 0x91, 0x68, 0x00, 0x48, 0x0D, 0x68, 0x09, 0x49,
+  0x0D, 0x47, 0x08, 0xBC, 0x30, 0xE7, 0xD4, 0x4A, 0x0C, 0x1F, 0x12, 0x4A,
+  0x0B, 0x48, 0x0A, 0xE7, 0xDB, 0xE7, 0xDF, 0x1D, 0x00, 0x47, 0x70, 0xBC,
+  0x30, 0x10, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0xC0, 0x20, 0x00, 0x00, 0x41,
+  0x08, 0x40, 0x00, 0x00, 0x40, 0x10, 0x00, 0x0E, 0x78, 0xE0, 0x00, 0xE1,
+  0x00, 0x10, 0x00, 0x0E, 0xD0, 0x10, 0x00, 0x0E, 0x5C, 0x00, 0x00, 0x51,
+  0x08, 0x46, 0x04, 0xB5, 0x1C, 0x68, 0x00, 0x48, 0x19, 0x20, 0x63, 0x47,
+  0x80, 0x6A, 0x81, 0x06, 0x40, 0x43, 0x91, 0x22, 0x0C, 0x62, 0x81, 0x1D,
+  0x09, 0x20, 0x02, 0x49, 0x15, 0x48, 0x15, 0x60, 0x08, 0x70, 0x02, 0x22,
+  0x00, 0x07, 0x89, 0x21, 0x01, 0x23, 0x20, 0x6A, 0x48, 0x62, 0x48, 0x43,
+  0x98, 0x23, 0x30, 0x6A, 0x88, 0x62, 0x88, 0x43, 0x98, 0x4B, 0x0F, 0x6A,
+  0x08, 0x62, 0x08, 0x40, 0x18, 0x06, 0xC9, 0x21, 0x19, 0x23, 0x01, 0x68,
+  0x08, 0x43, 0x18, 0x03, 0x1B, 0x2C, 0x01, 0x60, 0x08, 0x48, 0x0A, 0xD0,
+  0x09, 0x92, 0x01, 0x4B, 0x0A, 0x68, 0x1B, 0x90, 0x00, 0xA9, 0x01, 0x22,
+  0x01, 0x47, 0x98,
+  0x0D, 0xF2, 254,
+  0x46, 0x68, 0x48, 0x07, 0xBD, 0x1C, 0x00, 0x00, 0xE7, 0xF4, 0x10, 0x00,
+  0x0E, 0x60, 0xE0, 0x00, 0xE1, 0x80, 0x10, 0x00, 0x0E, 0xE0, 0xFF, 0xFF,
+  0x3F, 0xDF, 0x00, 0x00, 0x41, 0x08, 0x10, 0x00, 0x0E, 0x40, 0x00, 0x00,
+  0x51, 0x08, 0x00, 0x00, 0x06, 0x6F, 0x00, 0x00, 0x03, 0x37, 0x00, 0x00,
+  0x02, 0x23, 0x00, 0x00, 0x01, 0x9B, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00,
+  0x01, 0x10, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00,
+  0x00, 0xB5, 0x00, 0x00, 0x00, 0xA3, 0x10, 0x00, 0x02, 0x51, 0x10, 0x00,
+  0x02, 0x51, 0x10, 0x00, 0x02, 0x51, 0x10, 0x00, 0x02, 0x51, 0x10, 0x00,
+  0x02, 0x51, 0x10, 0x00, 0x02, 0x51, 0x10, 0x00, 0x02, 0x51, 0x10, 0x00,
+  0x02, 0x51, 0x10, 0x00, 0x02, 0x51, 0x10, 0x00, 0x02, 0x51, 0x10, 0x00,
+  0x02, 0x51, 0x10, 0x00, 0x02, 0x51, 0x10, 0x00, 0x02, 0x51, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  0xFF, 0xFF, 0,
+};
+
+/* Download program 2 of the sine test demo */
+const UINT8 kOisTableSineTestProgram2[] = {
+  0x1C, 0x00, 255,
+  0x00, 0x00, 0x77, 0x7E, 0x02, 0x0F, 0x24, 0x1B, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x22, 0x04, 0x0B, 0x80, 0x45, 0x00, 0x00, 0x00, 0x00, 0x02, 0x14,
+  0x00, 0x01, 0x00, 0x01, 0x08, 0x00, 0x00, 0x02, 0x10, 0x10, 0x10, 0x03,
+  0x0C, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x0C, 0x30, 0x01, 0x12,
+  0x00, 0xF0, 0x22, 0x71, 0x02, 0x27, 0x00, 0xF0, 0x83, 0xC0, 0x05, 0x00,
+  0x02, 0x32, 0x00, 0x02, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0xD0, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0x50, 0x50, 0x50, 0x50,
+  0x3F, 0x3F, 0x07, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x02, 0x00, 0x83, 0x91, 0x3C, 0x6F,
+  0x83, 0x9A, 0x3C, 0x66, 0x3F, 0xFE, 0x3F, 0xFC, 0x3F, 0xFF, 0x3F, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0xC1, 0x0A,
+  0x7F, 0xF8, 0x7F, 0xF8, 0x1A, 0x5E, 0x01, 0xA5, 0x05, 0xDE, 0x01, 0x7A,
+  0x01, 0x0E, 0x28, 0x00, 0x00, 0x02, 0x04, 0x65, 0x01, 0x51, 0x01, 0x00,
+  0x3F, 0xF2, 0x3F, 0xF2, 0x3F, 0xE0, 0x7F, 0xFF, 0x05, 0xDE, 0x04, 0x65,
+  0x01, 0x00, 0x11, 0x9A, 0x50, 0x46, 0xB0, 0x9E, 0x7F, 0x74, 0x13, 0x26,
+  0xDD, 0x45, 0x10, 0x1C, 0x7C, 0xD5, 0x85, 0xD0, 0x21, 0x87, 0xBE, 0x1E,
+  0x20, 0x65, 0x7E, 0xDA, 0x82, 0x38, 0x50, 0x00, 0x30, 0x00, 0x30, 0x00,
+  0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x01, 0x18, 0x10, 0x00,
+  0x00, 0x30, 0x00, 0x40, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x07, 0xC0,
+  0x00, 0x01, 0x00,
+  0x1C, 0xFF, 193,
+  0x00, 0xB4, 0x70, 0x12, 0x00, 0x07, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x18,
+  0x00, 0x18, 0x00, 0x50, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x3C, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x06, 0x78, 0x06, 0x78, 0x00, 0x00, 0x33,
+  0x18, 0x00, 0x00, 0xF9, 0x88, 0xF9, 0x88, 0x00, 0x00, 0x33, 0x18, 0x00,
+  0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6D, 0x01, 0x23, 0x06, 0x54, 0x05,
+  0x42, 0x24, 0x01, 0x1E, 0x12, 0x01, 0x01, 0x18, 0x14, 0x01, 0x01, 0x18,
+  0x14, 0x0F, 0x0F, 0x18, 0x10, 0x0F, 0x0F, 0x18, 0x10, 0x00, 0x01, 0x00,
+  0x05, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00,
+  0x05, 0x00, 0x00, 0x01, 0x84, 0xE0, 0xE0, 0x00, 0x80, 0x00, 0xC3, 0xC3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0xF4, 0x41, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  0xFF, 0xFF, 0,
+};
+
+/* Calibration */
+const UINT8 kOisTableCalibration[] = {
+  0x1D, 0xC0, 48,
+  0x00, 0x20, 0x00, 0x20, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x10, 0x08, 0x00, 0x08, 0x00, 0x00, 0x80, 0x08, 0x00,
+  0x08, 0x00, 0x29, 0x24, 0xD6, 0xDC, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x50, 0x02, 0x90, 0x00, 0x10, 0x00, 0x00, 0xE0, 0x00,
+  0xFF, 0xFF, 0,
+};
+
+/* GPO to Hsync (sensor) */
+const UINT8 kOisTableGpo[] = {
+  0x42, 0x88, 1,
+  0x00,
+  0x42, 0xB0, 1,
+  0x00,
+  0x4B, 0xDD, 1,
+  0x15,
+  0x42, 0xA8, 1,
+  0xFF,
+  0x42, 0xAA, 1,
+  0xFD,
+  0x42, 0x70, 1,
+  0x00,
+  0xFF, 0xFF, 0,
+};
+
+/* PWM frequency adjustment - About 4.5MHz */
+const UINT8 kOisTablePwmFrequency[] = {
+  0x60, 0xD0, 1,
+  0x00,
+  0x60, 0xD4, 1,
+  0x0A,
+  0x60, 0xD1, 1,
+  0x00,
+  0x60, 0xD5, 1,
+  0x00,
+  0x60, 0xD2, 3,
+  0x5F, 0x00, 0x0A,
+  0x60, 0xD0, 1,
+  0x01,
+  0xFF, 0xFF, 0,
+};
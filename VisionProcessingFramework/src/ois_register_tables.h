@@ -0,0 +1,56 @@
+/**
+ * @file      ois_register_tables.h
+ * @brief     Register tables of the OIS/AF driver
+ * @author    Vision Processing Community
+ * @copyright 2016 Vision Processing Community. All rights reserved.
+ */
+
+#ifndef _OIS_REGISTER_TABLES_H_
+#define _OIS_REGISTER_TABLES_H_
+
+#include "./include.h"
+#include "./register_table.h"
+
+/*
+ * Registers per transaction of the command tables (gyro, GPO, PWM): each
+ * write acts on the driver, so they are written one by one.
+ */
+#define kOisTableCommandBurst 1
+
+/* Registers per transaction of the program and calibration tables. */
+#define kOisTableDownloadBurst kRegisterTableMaxBurst
+
+/* Whether the program and calibration tables are read back and compared. */
+#define kOisTableVerify false
+
+/*
+ * The tables are in the format of RegisterTableLoader: the 16 bit first
+ * register address, the number of the registers and their values, per
+ * block of contiguous addresses.
+ */
+
+/* Gyro activation (20 registers). */
+extern const UINT8 kOisTableGyro[];
+
+/* Download program 1 (3992 registers). */
+extern const UINT8 kOisTableProgram1[];
+
+/* Download program 2 (448 registers). */
+extern const UINT8 kOisTableProgram2[];
+
+/* Download program 1 of the sine test demo (3824 registers). */
+extern const UINT8 kOisTableSineTestProgram1[];
+
+/* Download program 2 of the sine test demo (448 registers). */
+extern const UINT8 kOisTableSineTestProgram2[];
+
+/* Calibration (48 registers). */
+extern const UINT8 kOisTableCalibration[];
+
+/* GPO to Hsync (sensor) (6 registers). */
+extern const UINT8 kOisTableGpo[];
+
+/* PWM frequency adjustment - About 4.5MHz (8 registers). */
+extern const UINT8 kOisTablePwmFrequency[];
+
+#endif /* _OIS_REGISTER_TABLES_H_*/
@@ -596,6 +596,7 @@ void PluginEditCanvas::RemovePluginFlowList(wxPoint del_pos) {
 
     flow_plugin_list_.clear();
     thread_running_cycle_manager_->DeleteAllCycle();
+    ThreadPlacementTable::Instance()->Clear();
     parent_->RemoveAllPluginNameFromPluginList();
 
     // move scroll bar to default position
@@ -1429,6 +1430,17 @@ bool PluginEditCanvas::SavePluginFlowToFile(wxString file_path) {
     text_file.AddLine(all_cycle_settings[param_count]);
   }
 
+  // Add a all thread placements.
+  std::vector<std::string> thread_lines =
+      ThreadPlacementTable::Instance()->FormatLines();
+  if (thread_lines.size() > 0) {
+    text_file.AddLine(wxT(kFlowThreadString));
+    for (int line_count = 0; line_count < thread_lines.size(); line_count++) {
+      text_file.AddLine(
+          wxString(thread_lines[line_count].c_str(), wxConvUTF8));
+    }
+  }
+
   text_file.Write();
   text_file.Close();
 
@@ -1457,6 +1469,7 @@ bool PluginEditCanvas::LoadPluginFlowFromFile(wxString file_path) {
   if (thread_running_cycle_manager_ != NULL) {
     thread_running_cycle_manager_->DeleteAllCycle();
   }
+  ThreadPlacementTable::Instance()->Clear();
   parent_->RemoveAllPluginNameFromPluginList();
 
   DEBUG_PRINT("PluginEditCanvas::LoadPluginFlowFromFile\n");
@@ -1711,6 +1724,9 @@ bool PluginEditCanvas::LoadPluginFlowFromFile(wxString file_path) {
     }
   } while (!text_file.Eof());
 
+  // Get thread placements (the section is searched from the first line).
+  LoadThreadPlacementFromFile(&text_file, load_item_list);
+
   // Get setting info and set for each plugin.
   bool is_end_settings = false;
   for (; !text_file.Eof(); line_str = text_file.GetNextLine()) {
@@ -1814,6 +1830,9 @@ bool PluginEditCanvas::LoadPluginFlowFromFile(wxString file_path) {
   line_str = text_file.GetNextLine();
   do {
     // 1sǂݍ
+    if (line_str.find(wxT(kFlowThreadString)) != wxNOT_FOUND) {
+      break;
+    }
     tokenizer.SetString(line_str, wxT(","), wxTOKEN_DEFAULT);
     if (tokenizer.CountTokens() != 3) {
       text_file.Close();
@@ -1866,6 +1885,53 @@ bool PluginEditCanvas::LoadPluginFlowFromFile(wxString file_path) {
   return true;
 }
 
+/**
+ * @brief
+ * Load the thread placements of the [thread] section of ".flow" file.
+ * The plugin names of the file are replaced by the ones of the flow.
+ * @param text_file [in] ".flow" file.
+ * @param load_item_list [in] plugins of the file and of the flow.
+ */
+void PluginEditCanvas::LoadThreadPlacementFromFile(
+    wxTextFile *text_file,
+    const std::vector<LoadPluginFlowInfo> &load_item_list) {
+  size_t line_count = 0;
+  for (; line_count < text_file->GetLineCount(); line_count++) {
+    if (text_file->GetLine(line_count).find(wxT(kFlowThreadString)) !=
+        wxNOT_FOUND) {
+      DEBUG_PRINT("Find [thread] \n");
+      break;
+    }
+  }
+
+  for (line_count++; line_count < text_file->GetLineCount(); line_count++) {
+    wxString line_str = text_file->GetLine(line_count);
+    if (line_str.StartsWith(wxT("["))) {
+      break;
+    }
+    if (line_str.IsEmpty()) {
+      continue;
+    }
+
+    // The name is the plugin name followed by the suffix of the thread.
+    std::string line = std::string(line_str.mb_str());
+    std::string::size_type end = line.find_first_of("/,");
+    std::string file_plugin_name = line.substr(0, end);
+    for (int list_count = 0; list_count < load_item_list.size(); list_count++) {
+      if (load_item_list[list_count].file_plugin_name == file_plugin_name &&
+          load_item_list[list_count].item_info != NULL) {
+        line.replace(0, file_plugin_name.size(),
+                     load_item_list[list_count].item_info->plugin_name());
+        break;
+      }
+    }
+    if (ThreadPlacementTable::Instance()->ParseLine(line) == false) {
+      DEBUG_PRINT("[LoadPluginFlowFromFile]Invalid thread placement %s\n",
+                  line.c_str());
+    }
+  }
+}
+
 /**
  * @brief
  * Add plugin to plugin flow.
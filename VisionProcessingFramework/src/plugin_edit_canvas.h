@@ -15,6 +15,7 @@
 #include "./plugin_edit_canvas_define.h"
 #include "./plugin_edit_item_info.h"
 #include "./plugin_manager.h"
+#include "./thread_placement.h"
 #include "./thread_running_cycle_manager.h"
 #include "wx/wx.h"
 
@@ -215,6 +216,17 @@ class PluginEditCanvas : public wxScrolledWindow {
    */
   bool LoadPluginFlowFromFile(wxString file_path);
 
+  /**
+   * @brief
+   * Load the thread placements of the [thread] section of ".flow" file.
+   * The plugin names of the file are replaced by the ones of the flow.
+   * @param text_file [in] ".flow" file.
+   * @param load_item_list [in] plugins of the file and of the flow.
+   */
+  void LoadThreadPlacementFromFile(
+      wxTextFile *text_file,
+      const std::vector<LoadPluginFlowInfo> &load_item_list);
+
   /**
    * @brief
    * Add plugin to plugin flow.
@@ -100,5 +100,6 @@ typedef enum {
 #define kSubFlowString "[sub_flow]"
 #define kFlowSettingString "[settings]"
 #define kFlowCycleString "[cycle]"
+#define kFlowThreadString "[thread]"
 
 #endif /* _PLUGIN_EDIT_CANVAS_DEFINE_H_*/
@@ -10,6 +10,7 @@
 #include <vector>
 #include "./save_as_image_wnd_define.h"
 #include "./main_wnd.h"
+#include "./pixel_convert.h"
 
 BEGIN_EVENT_TABLE(SaveAsImageWnd, wxFrame)
 EVT_CLOSE(SaveAsImageWnd::OnClose)
@@ -134,11 +135,12 @@ void SaveAsImageWnd::OnSave(wxString image_file_path) {
 
   cv::Mat* temp_image;
   cv::Mat* image;
+  cv::Mat convert_image;
 
   /* image pointer check*/
   plugin_name = std::string(combo_box_output_->GetValue().mb_str());
   temp_image = parent_->SaveAsImage(plugin_name);
-  if (image == NULL) {
+  if (temp_image == NULL) {
     DEBUG_PRINT("Failed to get image \n");
     ErrorMessageBox("Failed to get image.");
     return;
@@ -154,8 +156,9 @@ void SaveAsImageWnd::OnSave(wxString image_file_path) {
   }
   /* 16bit image convert to 8bit image*/
   if (temp_image->depth() == CV_16U) {
-    image = UtilGetCvConvertScale(temp_image, UTIL_CONVERT_10U_TO_8U, 0);
-    if (!image) {
+    image = &convert_image;
+    if (PixelConvertTo8U(*temp_image, kPixelConvertSensorBits, 1, image) ==
+        false) {
       DEBUG_PRINT("It failed to convert 8bit image from 16bit \n");
       ErrorMessageBox("It failed to convert 8bit image from 16bit.");
       return;
@@ -189,114 +192,3 @@ void SaveAsImageWnd::OnSave(wxString image_file_path) {
   this->Show(false);
 }
 
-/**
- * @brief
- * utilGetCvConvertScale.
- * @param src_image [in] src cv::Mat
- * @param cvt_mode [in] enum UtilConvertMode
- * @param shift [in] Value added to the scaled source array elements
- * @return dst cv::Mat
- */
-cv::Mat* SaveAsImageWnd::UtilGetCvConvertScale(cv::Mat* src_image,
-                                               int cvt_mode, double shift) {
-  cv::Mat* dst_image;
-  int src_channels = src_image->channels();
-  int max_width = src_image->size().width * src_channels;
-  double scale;
-
-  if (cvt_mode == UTIL_CONVERT_10U_TO_8U) {
-    switch (src_channels) {
-      case 1:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height), CV_8UC1);
-        break;
-      case 3:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height), CV_8UC3);
-        break;
-      default:
-        return NULL;
-    }
-    scale = 1.0 / 4.0;  // change scale 10bit -> 8bit
-  } else if (cvt_mode == UTIL_CONVERT_10U_TO_16U) {
-    switch (src_channels) {
-      case 1:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height),
-            CV_16UC1);
-        break;
-      case 3:
-        dst_image = new cv::Mat(
-            cvSize(src_image->size().width, src_image->size().height),
-            CV_16UC3);
-        break;
-      default:
-        return NULL;
-    }
-    scale = 64.0;  // change scale 10bit -> 16bit
-  } else {
-    DEBUG_PRINT("Invalid convert mode =%d return NULL", cvt_mode);
-    return NULL;
-  }
-
-  if (cvt_mode == UTIL_CONVERT_10U_TO_8U) {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i = 0; i < dst_image->size().height; i++) {
-      for (int j = 0; j < max_width; j += src_channels) {
-        ((unsigned char*)(dst_image->data + dst_image->step * i))[j] =
-            (reinterpret_cast<INT16*>(src_image->data +
-                                      src_image->step * i))[j] *
-                scale +
-            shift;
-        if (src_channels == 3) {
-          ((unsigned char*)(dst_image->data + dst_image->step * i))[j + 1] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 1] *
-                  scale +
-              shift;
-          ((unsigned char*)(dst_image->data + dst_image->step * i))[j + 2] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 2] *
-                  scale +
-              shift;
-        }
-      }
-    }
-  } else if (cvt_mode == UTIL_CONVERT_10U_TO_16U) {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i = 0; i < dst_image->size().height; i++) {
-      for (int j = 0; j < max_width; j += src_channels) {
-        // 16bit code
-        (reinterpret_cast<INT16*>(dst_image->data + dst_image->step * i))[j] =
-            (reinterpret_cast<INT16*>(src_image->data +
-                                      src_image->step * i))[j] *
-                scale +
-            shift;
-        if (src_channels == 3) {
-          (reinterpret_cast<INT16*>(dst_image->data +
-                                    dst_image->step * i))[j + 1] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 1] *
-                  scale +
-              shift;
-          (reinterpret_cast<INT16*>(dst_image->data +
-                                    dst_image->step * i))[j + 2] =
-              (reinterpret_cast<INT16*>(src_image->data +
-                                        src_image->step * i))[j + 2] *
-                  scale +
-              shift;
-        }
-      }
-    }
-  } else {
-    DEBUG_PRINT("Invalid convert mode =%d return NULL", cvt_mode);
-    return NULL;
-  }
-
-  return dst_image;
-}
-
@@ -13,11 +13,6 @@
 
 class MainWnd;
 
-enum UtilConvertMode {
-  UTIL_CONVERT_10U_TO_8U = 0,
-  UTIL_CONVERT_10U_TO_16U,
-};
-
 /**
  * @class SaveAsImageWnd
  * @brief This class has a image file save.
@@ -51,17 +46,6 @@ class SaveAsImageWnd : public wxFrame {
    */
   virtual void OnOpenFileDialog(wxCommandEvent &event);/* NOLINT */
 
-  /**
-   * @brief
-   * utilGetCvConvertScale.
-   * @param src_image [in] src cv::Mat
-   * @param cvt_mode [in] enum UtilConvertMode
-   * @param shift [in] Value added to the scaled source array elements
-   * @return dst cv::Mat
-   */
-  virtual cv::Mat* UtilGetCvConvertScale(cv::Mat* src_image, int cvt_mode,
-                                         double shift);
-
   /**
    * @brief
    * Error message box
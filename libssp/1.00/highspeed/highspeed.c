@@ -723,7 +723,8 @@ int main(int argc, char **argv){
 
     cvWaitKey(2);
 
-    while(1){ if(stop_process==1) break;}
+    // The frames are handled on the preprocess threads: sleep, do not spin.
+    while(stop_process==0){ usleep(10000); }
 
     ////////////////////////////////////////
     discard_frame_array();